@@ -38,6 +38,7 @@
 #include "omnetpp/cdataratechannel.h"
 #include "omnetpp/cconfiguration.h"
 #include "omnetpp/ccoroutine.h"
+#include "omnetpp/ccoroutinemodule.h"
 #include "omnetpp/cdefaultowner.h"
 #include "omnetpp/cabstracthistogram.h"
 #include "omnetpp/cconfigoption.h"
@@ -50,6 +51,7 @@
 #include "omnetpp/cexpression.h"
 #include "omnetpp/chasher.h"
 #include "omnetpp/cfingerprint.h"
+#include "omnetpp/cprofiler.h"
 #include "omnetpp/checkandcast.h"
 #include "omnetpp/cfsm.h"
 #include "omnetpp/cfutureeventset.h"
@@ -66,11 +68,14 @@
 #include "omnetpp/simtimemath.h"
 #include "omnetpp/simtime_t.h"
 #include "omnetpp/cmessage.h"
+#include "omnetpp/cmessagepool.h"
 #include "omnetpp/cmessageprinter.h"
 #include "omnetpp/cmsgpar.h"
 #include "omnetpp/cmodelchange.h"
 #include "omnetpp/cmodule.h"
 #include "omnetpp/ceventheap.h"
+#include "omnetpp/ccalendarqueue.h"
+#include "omnetpp/cdaryeventheap.h"
 #include "omnetpp/cmatchexpression.h"
 #include "omnetpp/cpatternmatcher.h"
 #include "omnetpp/cnedfunction.h"
@@ -100,6 +105,7 @@
 #include "omnetpp/cresultrecorder.h"
 #include "omnetpp/crng.h"
 #include "omnetpp/cscheduler.h"
+#include "omnetpp/crealtimeioscheduler.h"
 #include "omnetpp/csimplemodule.h"
 #include "omnetpp/csimulation.h"
 #include "omnetpp/cstatistic.h"
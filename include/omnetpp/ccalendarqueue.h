@@ -0,0 +1,215 @@
+//==========================================================================
+//  CCALENDARQUEUE.H - part of
+//                     OMNeT++/OMNEST
+//            Discrete System Simulation in C++
+//
+//==========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_CCALENDARQUEUE_H
+#define __OMNETPP_CCALENDARQUEUE_H
+
+#include <vector>
+#include "cfutureeventset.h"
+
+namespace omnetpp {
+
+/**
+ * @brief Future event set implemented as an adaptive calendar queue,
+ * with amortized O(1) insertion and removal.
+ *
+ * Events are hashed into an array of buckets ("days") by their arrival time;
+ * the width of the buckets and their number is recalculated whenever the
+ * number of events grows or shrinks by a factor of two, so that each bucket
+ * contains only a few events on average. Each bucket is kept sorted, so the
+ * order of events is exactly the same as with cEventHeap: arrival time first,
+ * then scheduling priority, then insertion order. As a result, simulations
+ * produce identical fingerprints with both FES implementations.
+ *
+ * Calendar queue typically outperforms binary heap for large event sets
+ * (several hundred thousand events and up). It can be selected with the
+ * `futureeventset-class = omnetpp::cCalendarQueue` configuration option.
+ *
+ * @ingroup SimSupport
+ */
+class SIM_API cCalendarQueue : public cFutureEventSet
+{
+  private:
+    // Sorted circular buffer of events (a "day" of the calendar).
+    // Cheap when empty, and insertion at either end is O(1).
+    struct Bucket {
+        cEvent **items = nullptr;
+        int capacity = 0;  // always 0 or a power of 2
+        int head = 0;
+        int length = 0;
+
+        ~Bucket() {delete[] items;}
+        cEvent *& at(int k) const {return items[(head+k) & (capacity-1)];}
+        cEvent *front() const {return items[head];}
+        void grow();
+        void insert(cEvent *event);
+        cEvent *popFront();
+        bool remove(cEvent *event);
+    };
+
+    Bucket *buckets;          // the calendar
+    int numBuckets;           // always power of 2
+    int64_t bucketWidth;      // in raw simtime units; always >= 1
+    int length;               // total number of events
+    eventnumber_t insertCount; // counts insertions; used to preserve order among events with equal time and priority
+    mutable int64_t currentDay; // no event is earlier than this (day = arrivalTime.raw() / bucketWidth)
+    mutable int directSearchCount; // number of times a linear scan of the calendar was needed since the last resize
+    int removalsSinceResize;  // number of removeFirst() calls since the last resize; limits how often the bucket width is recalculated
+
+    // for random access
+    mutable std::vector<cEvent*> flattened;
+    mutable bool flattenedValid;
+
+  private:
+    void copy(const cCalendarQueue& other);
+    int64_t dayOf(const cEvent *event) const;
+    void insertIntoBucket(cEvent *event);
+    int findFirstBucket() const;
+    void flatten() const;
+    void resize(int newNumBuckets);
+    int64_t calculateBucketWidth(const std::vector<cEvent*>& events) const;
+
+  public:
+    /** @name Constructors, destructor, assignment */
+    //@{
+
+    /**
+     * Copy constructor.
+     */
+    cCalendarQueue(const cCalendarQueue& other);
+
+    /**
+     * Constructor.
+     */
+    cCalendarQueue(const char *name=nullptr);
+
+    /**
+     * Destructor.
+     */
+    virtual ~cCalendarQueue();
+
+    /**
+     * Assignment operator. The name member is not copied;
+     * see cOwnedObject's operator=() for more details.
+     */
+    cCalendarQueue& operator=(const cCalendarQueue& other);
+    //@}
+
+    /** @name Redefined cObject member functions. */
+    //@{
+
+    /**
+     * Creates and returns an exact copy of this object.
+     * See cObject for more details.
+     */
+    virtual cCalendarQueue *dup() const override  {return new cCalendarQueue(*this);}
+
+    /**
+     * Produces a one-line description of the object's contents.
+     * See cObject for more details.
+     */
+    virtual std::string str() const override;
+
+    /**
+     * Calls v->visit(this) for each contained object.
+     * See cObject for more details.
+     */
+    virtual void forEachChild(cVisitor *v) override;
+
+    // no parsimPack() and parsimUnpack()
+    //@}
+
+    /** @name Simulation-related operations. */
+    //@{
+    /**
+     * Insert an event into the FES.
+     */
+    virtual void insert(cEvent *event) override;
+
+    /**
+     * Peek the first event in the FES (the one with the smallest timestamp.)
+     * If the FES is empty, it returns nullptr.
+     */
+    virtual cEvent *peekFirst() const override;
+
+    /**
+     * Removes and return the first event in the FES (the one with the
+     * smallest timestamp.) If the FES is empty, it returns nullptr.
+     */
+    virtual cEvent *removeFirst() override;
+
+    /**
+     * Undo for removeFirst(): it puts back an event to the front of the FES.
+     */
+    virtual void putBackFirst(cEvent *event) override;
+
+    /**
+     * Removes and returns the given event in the FES. If the event is
+     * not in the FES, returns nullptr.
+     */
+    virtual cEvent *remove(cEvent *event) override;
+
+    /**
+     * Returns true if the FES is empty.
+     */
+    virtual bool isEmpty() const override {return length == 0;}
+
+    /**
+     * Deletes all events in the FES.
+     */
+    virtual void clear() override;
+    //@}
+
+    /** @name Random access. */
+    //@{
+
+    /**
+     * Returns the number of events in the FES.
+     */
+    virtual int getLength() const override {return length;}
+
+    /**
+     * Returns the kth event in the FES if 0 <= k < getLength(), and nullptr
+     * otherwise. Note that iteration does not necessarily return events
+     * in increasing timestamp (getArrivalTime()) order unless you called
+     * sort() before.
+     */
+    virtual cEvent *get(int k) override;
+
+    /**
+     * Sorts the contents of the FES. This is only necessary if one wants
+     * to iterate through in the FES in strict timestamp order.
+     */
+    virtual void sort() override;
+    //@}
+
+    /** @name Calendar parameters. */
+    //@{
+    /**
+     * Returns the current number of buckets (days) in the calendar.
+     */
+    int getNumBuckets() const {return numBuckets;}
+
+    /**
+     * Returns the current width of a bucket (day), as simulation time.
+     */
+    simtime_t getBucketWidth() const {return SimTime().setRaw(bucketWidth);}
+    //@}
+};
+
+}  // namespace omnetpp
+
+
+#endif
+
@@ -19,6 +19,7 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <atomic>
 #include <cmath>
 #include "cownedobject.h"
 
@@ -318,7 +319,7 @@ class SIM_API cFigure : public cOwnedObject
         };
 
     private:
-        static int lastId;
+        static std::atomic<int> lastId;  // shared by all threads, so IDs are unique within the process
         static cStringPool stringPool;
         int id;
         double zIndex;
@@ -47,6 +47,8 @@ class SIM_API cClassDescriptor : public cNoncopyableOwnedObject
         FD_ISEDITABLE = 0x20,     ///< whether field supports setFieldValueAsString()
         FD_ISREPLACEABLE = 0x40,  ///< whether field supports setFieldStructValuePointer()
         FD_ISRESIZABLE = 0x80,    ///< whether field supports setFieldArraySize()
+        FD_ISINTEGRAL = 0x100,    ///< field is of an integer type; supports getFieldValueAsInt()
+        FD_ISFLOATINGPOINT = 0x200, ///< field is of a floating-point type or simtime_t; supports getFieldValueAsDouble()
         FD_NONE = 0x0
     };
 
@@ -174,9 +176,23 @@ class SIM_API cClassDescriptor : public cNoncopyableOwnedObject
      * Returns the index of the field with the given name, or -1 if not found.
      * cClassDescriptor provides an default implementation, but it is
      * recommended to replace it in subclasses with a more efficient version.
+     * (Descriptors generated by the message compiler use a perfect hash
+     * table based on hashFieldName().)
      */
     virtual int findField(const char *fieldName) const;
 
+    /**
+     * The hash function used by the findField() implementations generated
+     * by the message compiler. The seed is chosen by the message compiler
+     * so that the field names of the class do not collide.
+     */
+    static uint32_t hashFieldName(const char *fieldName, uint32_t seed) {
+        uint32_t h = 2166136261u ^ seed;  // FNV-1a
+        for (const unsigned char *p = (const unsigned char *)fieldName; *p; p++)
+            h = (h ^ *p) * 16777619u;
+        return h ^ (h >> 15);
+    }
+
     /**
      * Returns the type flags of a field in the described class. Flags is a
      * binary OR of the following: FD_ISARRAY, FD_ISCOMPOUND, FD_ISPOINTER,
@@ -195,6 +211,8 @@ class SIM_API cClassDescriptor : public cNoncopyableOwnedObject
     bool getFieldIsEditable(int field) const {return getFieldTypeFlags(field) & FD_ISEDITABLE;}
     bool getFieldIsReplaceable(int field) const {return getFieldTypeFlags(field) & FD_ISREPLACEABLE;}
     bool getFieldIsResizable(int field) const {return getFieldTypeFlags(field) & FD_ISRESIZABLE;}
+    bool getFieldIsIntegral(int field) const {return getFieldTypeFlags(field) & FD_ISINTEGRAL;}
+    bool getFieldIsFloatingPoint(int field) const {return getFieldTypeFlags(field) & FD_ISFLOATINGPOINT;}
     //@}
 
     /**
@@ -263,6 +281,29 @@ class SIM_API cClassDescriptor : public cNoncopyableOwnedObject
      */
     virtual std::string getFieldValueAsString(void *object, int field, int i) const = 0;
 
+    /**
+     * Returns the value of an integer field in the given object, without
+     * going through a string conversion. Unsigned values that do not fit
+     * into intval_t are wrapped around. It is an error to call this method
+     * for fields that do not have the FD_ISINTEGRAL flag.
+     *
+     * The field argument must be in the 0..getFieldCount()-1 range.
+     * The i argument must be in the 0..getFieldArraySize()-1 range, or
+     * 0 if the field is not an array.
+     */
+    virtual intval_t getFieldValueAsInt(void *object, int field, int i) const;
+
+    /**
+     * Returns the value of a floating-point or simtime_t field in the given
+     * object, without going through a string conversion. It is an error to
+     * call this method for fields that do not have the FD_ISFLOATINGPOINT flag.
+     *
+     * The field argument must be in the 0..getFieldCount()-1 range.
+     * The i argument must be in the 0..getFieldArraySize()-1 range, or
+     * 0 if the field is not an array.
+     */
+    virtual double getFieldValueAsDouble(void *object, int field, int i) const;
+
     /**
      * Sets the value of a field in the given object by parsing the given value string.
      * If the operation is not successful, an exception is thrown.
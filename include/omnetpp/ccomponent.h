@@ -17,6 +17,7 @@
 #define __OMNETPP_CCOMPONENT_H
 
 #include <vector>
+#include <atomic>
 #include "simkerneldefs.h"
 #include "cownedobject.h"
 #include "cpar.h"
@@ -35,6 +36,8 @@ class cDisplayString;
 class cRNG;
 class cStatistic;
 class cResultRecorder;
+class cCommBuffer;
+class cProfiler;
 
 /**
  * @brief Common base for module and channel classes.
@@ -104,22 +107,43 @@ class SIM_API cComponent : public cDefaultOwner //implies noncopyable
     typedef std::vector<SignalListenerList> SignalTable;
     SignalTable *signalTable; // ordered by signalID so we can do binary search
 
-    // string-to-simsignal_t mapping
+    // string-to-simsignal_t mapping; shared by all simulations (guarded by a mutex)
     static struct SignalNameMapping {
         std::map<std::string,simsignal_t> signalNameToID;
         std::map<simsignal_t,std::string> signalIDToName;
     } *signalNameMapping;  // must be dynamically allocated on first access so that registerSignal() can be invoked from static initialization code
-    static int lastSignalID;
+    static std::atomic<int> lastSignalID;
 
-    // for hasListeners()/mayHaveListeners()
-    static std::vector<int> signalListenerCounts;  // index: signalID, value: number of listeners anywhere
+    // Flattened listener list of a signal as seen from a component: local listeners
+    // first, then those of the parent module, grandparent, etc. This is the order
+    // in which listeners are notified on emit().
+    struct SignalDispatchList {
+        simsignal_t signalID;
+        uint64_t generation; // the signal's generation when the list was built; the list is stale if it has changed since
+        std::vector<cIListener*> listeners; // entries of listeners unsubscribed during notification are set to nullptr
+        std::vector<const cComponent*> owners; // the component each listener is subscribed at (for checkNotFiring())
+    };
+
+    // Per-component cache of dispatch lists, built on demand by getDispatchList().
+    // A component emits only a few signals, so it is searched linearly.
+    mutable std::vector<SignalDispatchList*> *dispatchLists; // created on demand
+
+    // invalidated dispatch lists that may still be under notification; deleted when notificationSP drops to 0
+    static thread_local std::vector<SignalDispatchList*> retiredDispatchLists;
 
-    // stack of listener lists being notified, to detect concurrent modification
-    static cIListener **notificationStack[];
-    static int notificationSP;
+    // stack of dispatch lists being notified, to detect concurrent modification
+    struct NotificationFrame {
+        SignalDispatchList *dispatchList;
+        int listenerIndex; // the listener being notified
+    };
+    static thread_local NotificationFrame notificationStack[];
+    static thread_local int notificationSP;
 
-    // whether only signals declared in NED via @signal are allowed to be emitted
-    static bool checkSignals;
+    // for getSignalEmitCount()/getSignalEmitTime()
+    struct SignalStatistics {
+        int64_t emitCount = 0;
+        int64_t emitTimeNsecs = 0;
+    };
 
     // for caching the result of getResultRecorders()
     struct ResultRecorderList {
@@ -127,16 +151,36 @@ class SIM_API cComponent : public cDefaultOwner //implies noncopyable
         std::vector<cResultRecorder*> recorders;
     };
 
-    // for getResultRecorders(); static because we don't want to increase cComponent's size
-    static std::vector<ResultRecorderList*> cachedResultRecorderLists;
+    // signals-related state that belongs to a simulation (see cSimulation);
+    // it is accessed via the active simulation, and not kept in static variables,
+    // so that simulations running in different threads do not interfere
+    struct SignalState {
+        std::vector<int> listenerCounts;  // for hasListeners()/mayHaveListeners(); index: signalID, value: number of listeners anywhere
+        std::vector<uint64_t> signalGenerations;  // index: signalID; changed on subscribe/unsubscribe, invalidates the signal's dispatch lists
+        uint64_t lastGeneration = 0;  // source of signalGenerations[] values; never reused, so stale lists cannot become valid again
+        bool collectSignalStatistics = false;
+        std::vector<SignalStatistics> signalStatistics; // index: signalID
+        bool checkSignals = false; // whether only signals declared in NED via @signal are allowed to be emitted
+        std::vector<ResultRecorderList*> cachedResultRecorderLists; // for getResultRecorders(); not per component because we don't want to increase cComponent's size
+        ~SignalState();
+    };
 
   private:
+    static inline SignalState& getSignalState();  // defined in csimulation.h
     SignalListenerList *findListenerList(simsignal_t signalID) const;
     SignalListenerList *findOrCreateListenerList(simsignal_t signalID);
     void throwInvalidSignalID(simsignal_t signalID) const;
     void removeListenerList(simsignal_t signalID);
-    void checkNotFiring(simsignal_t, cIListener **listenerList);
-    template<typename T> void fire(cComponent *src, simsignal_t signalID, T x, cObject *details);
+    void checkNotFiring(simsignal_t signalID);
+    void cancelPendingNotifications(simsignal_t signalID, cIListener *listener) const;
+    SignalDispatchList *getDispatchList(simsignal_t signalID) const;
+    SignalDispatchList *buildDispatchList(simsignal_t signalID) const;
+    void discardDispatchCache() const;
+    static void retireDispatchList(SignalDispatchList *dispatchList);
+    static void invalidateDispatchLists(simsignal_t signalID);
+    static void disposeRetiredDispatchLists();
+    template<typename T> void emitSignal(simsignal_t signalID, T x, cObject *details);
+    template<typename T> void fire(simsignal_t signalID, T x, cObject *details, cProfiler *profiler=nullptr);
     void fireFinish();
     void releaseLocalListeners();
     const SignalListenerList& getListenerList(int k) const {return (*signalTable)[k];} // for inspectors
@@ -195,8 +239,13 @@ class SIM_API cComponent : public cDefaultOwner //implies noncopyable
     static uint64_t getSignalMask(simsignal_t signalID);
 
     // internal: controls whether signals should be validated against @signal declarations in NED files
-    static void setCheckSignals(bool b) {checkSignals = b;}
-    static bool getCheckSignals() {return checkSignals;}
+    static void setCheckSignals(bool b);
+    static bool getCheckSignals();
+
+    // internal: invalidates the flattened listener lists of this component and the
+    // components inside it; to be invoked when it is inserted into, removed from
+    // or moved within the module tree
+    void invalidateSignalDispatchCachesRec() const;
 
     // internal: for inspectors
     const std::vector<cResultRecorder*>& getResultRecorders() const;
@@ -295,6 +344,33 @@ class SIM_API cComponent : public cDefaultOwner //implies noncopyable
      * not only the one which has just processed an event.)
      */
     virtual void refreshDisplay() const;
+
+    /**
+     * Called by the simulation kernel when a checkpoint of the simulation
+     * is being written (see the `checkpoint-interval` configuration option).
+     * Components that have state in data members should override this method
+     * and pack that state into the buffer, in the same way as parsimPack()
+     * does for messages. Things owned by the simulation kernel (scheduled
+     * messages, parameter values, RNGs, result recording) are saved
+     * automatically and must not be packed here. This default implementation
+     * does nothing.
+     *
+     * When resuming from a checkpoint, the network is set up and initialized
+     * as usual, and then unpackCheckpoint() is called to overwrite the state
+     * created by initialize() with the saved one.
+     */
+    virtual void packCheckpoint(cCommBuffer *buffer) const;
+
+    /**
+     * Called by the simulation kernel when resuming from a checkpoint, after
+     * the network has been initialized and the scheduled messages have been
+     * restored. It should unpack exactly what packCheckpoint() has packed.
+     * Self-messages that were scheduled at the time of the checkpoint are
+     * restored into the message objects the module created during
+     * initialize(), if their class and name match, so pointers to timers
+     * stay valid. This default implementation does nothing.
+     */
+    virtual void unpackCheckpoint(cCommBuffer *buffer);
     //@}
 
   public:
@@ -931,16 +1007,13 @@ class SIM_API cComponent : public cDefaultOwner //implies noncopyable
      * has any listeners at all. if not, emitting the signal can be skipped.
      * This method has a constant cost but may return false positive.
      */
-    bool mayHaveListeners(simsignal_t signalID) const {
-        if (signalID < 0 || signalID > lastSignalID)
-            throwInvalidSignalID(signalID);
-        return signalListenerCounts[signalID] > 0;
-    }
+    inline bool mayHaveListeners(simsignal_t signalID) const;  // defined in csimulation.h
 
     /**
-     * Returns true if the given signal has any listeners. In the current
-     * implementation, this involves checking listener lists in ancestor
-     * modules until the first listener is found, or up to the root.
+     * Returns true if the given signal has any listeners in this component
+     * or in ancestor components. The result comes from the same cached,
+     * flattened listener list that emit() uses, so after the first call it
+     * is a constant-time operation (until listeners or the module tree change).
      * This method may be useful if producing the data for an emit()
      * call would be expensive compared to a hasListeners() call.
      *
@@ -949,6 +1022,38 @@ class SIM_API cComponent : public cDefaultOwner //implies noncopyable
     bool hasListeners(simsignal_t signalID) const;
     //@}
 
+    /** @name Signal statistics. */
+    //@{
+    /**
+     * Enables or disables counting emit() calls and measuring the wall-clock
+     * time spent in them (including the time spent in listeners), per signal,
+     * in the active simulation.
+     * Collection is disabled by default, as it adds two clock reads to every
+     * emit() call. Enabling it also resets the counters.
+     */
+    static void setCollectSignalStatistics(bool enabled);
+
+    /**
+     * Returns true if per-signal emit statistics are being collected.
+     */
+    static bool getCollectSignalStatistics();
+
+    /**
+     * Returns the number of emit() calls for the given signal since signal
+     * statistics collection was enabled, or since the start of the current
+     * simulation run.
+     */
+    static int64_t getSignalEmitCount(simsignal_t signalID);
+
+    /**
+     * Returns the total wall-clock time in seconds spent in emit() calls for the
+     * given signal, including the time spent in the listeners. Note that the time
+     * of nested emits (signals emitted from listeners) is included in the
+     * outer signal's time as well.
+     */
+    static double getSignalEmitTime(simsignal_t signalID);
+    //@}
+
     /** @name Subscribing to simulation signals. */
     //@{
     /**
@@ -19,6 +19,7 @@
 #include <string>
 #include <map>
 #include <set>
+#include <mutex>
 #include "cpar.h"
 #include "cgate.h"
 #include "cownedobject.h"
@@ -66,6 +67,11 @@ class SIM_API cComponentType : public cNoncopyableOwnedObject
     mutable bool sourceFileDirectoryCached = false;
     mutable std::string sourceFileDirectory;
 
+    // guards the state that is built lazily while simulations use the type (shared
+    // parameter values, signalsSeen, NED declaration caches, etc.), as simulations
+    // running concurrently in different threads share the component types
+    static std::recursive_mutex sharedStateMutex;
+
   protected:
     friend class cComponent;
     friend class cModule;
@@ -32,6 +32,7 @@ namespace omnetpp {
 
 class cObject;
 class cComponent;
+class cProfiler;
 
 // logically belongs to csimulation.h but must be here because of declaration order
 enum {CTX_NONE, CTX_BUILD, CTX_INITIALIZE, CTX_EVENT, CTX_REFRESHDISPLAY, CTX_FINISH, CTX_CLEANUP};
@@ -111,7 +112,8 @@ class SIM_API cContextSwitcher
 class SIM_API cMethodCallContextSwitcher : public cContextSwitcher
 {
   private:
-    static int depth;
+    static thread_local int depth;
+    cProfiler *profiler;  // non-nullptr if the call is being profiled
 
   public:
     /**
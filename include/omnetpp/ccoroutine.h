@@ -24,8 +24,11 @@
 #endif
 
 #ifdef USE_POSIX_COROUTINES
+#include <signal.h>
+#ifndef USE_FAST_CONTEXT_SWITCH
 #include <ucontext.h>
 #endif
+#endif
 
 namespace omnetpp {
 
@@ -50,8 +53,14 @@ typedef void (*CoroutineFnp)( void * );
  *
  * On Windows, it uses the Win32 Fiber API.
  *
- * On Unix-like systems, it uses POSIX coroutines (setcontext()/switchcontext())
- * if they are available.
+ * On Unix-like systems, it uses POSIX coroutines (separately allocated stacks)
+ * if they are available. Stacks are allocated with mmap(), so memory is only
+ * committed for the pages actually used; they are protected by a guard area
+ * (64 KiB) against overflow, and are recycled when coroutines are deleted. On x86-64 and AArch64, context switching is done
+ * by a short assembly routine that only saves and restores the callee-saved
+ * registers; elsewhere (or if USE_POSIX_SWAPCONTEXT is defined) it uses
+ * swapcontext(), which is considerably slower because it also saves and
+ * restores the signal mask, making a system call on every switch.
  *
  * Otherwise, it uses a portable coroutine library first described
  * by Stig Kofoed ("Portable coroutines", see the Manual for a better
@@ -69,32 +78,54 @@ class SIM_API cCoroutine
   protected:
 #ifdef USE_WIN32_FIBERS
     LPVOID lpFiber;
-    static LPVOID lpMainFiber;
+    static thread_local LPVOID lpMainFiber;
     unsigned stackSize;
 #endif
 #ifdef USE_POSIX_COROUTINES
-    static ucontext_t mainContext;
-    static ucontext_t *curContextPtr;
-    static unsigned totalStackLimit;
-    static unsigned totalStackUsage;
+#ifdef USE_FAST_CONTEXT_SWITCH
+    static thread_local void *mainStackPointer;
+    void *stackPointer;  // saved stack pointer while not running
+#else
+    static thread_local ucontext_t mainContext;
+    static thread_local ucontext_t *curContextPtr;
+    ucontext_t context;
+#endif
+    static thread_local cCoroutine *curCoroutine;  // nullptr: main
+    static thread_local unsigned totalStackLimit;
+    static thread_local unsigned totalStackUsage;
+    static struct sigaction oldSigsegvAction;
     unsigned stackSize;
     char *stackPtr;
-    ucontext_t context;
 #endif
 #ifdef USE_PORTABLE_COROUTINES
     _Task *task;
 #endif
 
+#ifdef USE_POSIX_COROUTINES
+    static void sigsegvHandler(int sig, siginfo_t *info, void *context);
+#endif
+
   public:
     /** @name Coroutine control */
     //@{
 
     /**
      * Initializes the coroutine library. This function has to be called
-     * exactly once in a program, possibly at the top of main().
+     * once in each thread that uses coroutines (i.e. runs simulations with
+     * activity()-based modules), before the first coroutine is created.
+     * Coroutines can only be switched to from the thread that created them.
      */
     static void init(unsigned totalStack, unsigned mainStack);
 
+    /**
+     * Releases the per-thread resources allocated by init(), e.g. the
+     * alternate signal stack used for reporting stack overflows. It should
+     * be called in each thread that called init(), after all coroutines
+     * have been deleted. The stack overflow handler remains installed until
+     * the last such thread calls cleanup().
+     */
+    static void cleanup();
+
     /**
      * Switch to another coroutine. The execution of the current coroutine
      * is suspended and the other coroutine is resumed from the point it
@@ -136,7 +167,15 @@ class SIM_API cCoroutine
      * Returns true if there was a stack overflow during execution of the
      * coroutine.
      *
-     * Windows/Fiber API, POSIX coroutines: Not implemented: always returns false.
+     * Windows/Fiber API: Not implemented: always returns false.
+     *
+     * POSIX coroutines: Returns true if the stack has been used down to
+     * its last page, i.e. the coroutine has (nearly) run out of stack.
+     * This is detected by checking a word at the page boundary, which is
+     * zero until written, so it may be missed by a large uninitialized local
+     * variable. Actual overflows hit the guard area below the stack, and
+     * cause a segmentation fault right away (with an error message on the
+     * standard error).
      *
      * Portable coroutines: it checks the intactness of a predefined byte pattern
      * (0xdeadbeef) at the stack boundary, and report stack overflow
@@ -156,7 +195,10 @@ class SIM_API cCoroutine
     /**
      * Returns the amount of stack actually used by the coroutine.
      *
-     * Windows/Fiber API, POSIX coroutines: Not implemented, always returns 0.
+     * Windows/Fiber API: Not implemented, always returns 0.
+     *
+     * POSIX coroutines: Returns the high-water mark, i.e. the maximum amount
+     * of stack used so far.
      *
      * Portable coroutines: It works by checking the intactness of
      * predefined byte patterns (0xdeadbeef) placed in the stack.
@@ -0,0 +1,320 @@
+//==========================================================================
+//   CCOROUTINEMODULE.H  -  header for
+//                     OMNeT++/OMNEST
+//            Discrete System Simulation in C++
+//
+//==========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_CCOROUTINEMODULE_H
+#define __OMNETPP_CCOROUTINEMODULE_H
+
+// Note: everything is inline, because the simulation library itself is not
+// necessarily compiled in C++20 mode. The classes are only available if
+// the model is compiled with C++20 coroutine support (e.g. -std=c++20).
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define OPP_HAVE_STACKLESS_COROUTINES
+#endif
+#endif
+
+#ifdef OPP_HAVE_STACKLESS_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include "csimplemodule.h"
+#include "csimulation.h"
+#include "cqueue.h"
+
+namespace omnetpp {
+
+class cCoroutineModule;
+
+/**
+ * @brief Return type of the C++20 coroutines used with cCoroutineModule:
+ * its run() method, and helper coroutines called from it.
+ *
+ * A helper coroutine runs when it is awaited (`co_await helper(args)`),
+ * and the awaiting coroutine continues when it has completed. Exceptions
+ * thrown in the helper are rethrown in the awaiting coroutine.
+ *
+ * @ingroup SimCore
+ */
+class cTask
+{
+    friend class cCoroutineModule;
+  public:
+    struct promise_type {
+        std::coroutine_handle<> continuation;  // the awaiting coroutine; none for run()
+        std::exception_ptr exception;
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept {return false;}
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+                std::coroutine_handle<> continuation = h.promise().continuation;
+                return continuation ? continuation : std::noop_coroutine();
+            }
+            void await_resume() noexcept {}
+        };
+
+        cTask get_return_object() {return cTask(std::coroutine_handle<promise_type>::from_promise(*this));}
+        std::suspend_always initial_suspend() noexcept {return {};}
+        FinalAwaiter final_suspend() noexcept {return {};}
+        void return_void() {}
+        void unhandled_exception() {exception = std::current_exception();}
+    };
+
+  private:
+    std::coroutine_handle<promise_type> handle;
+
+  private:
+    explicit cTask(std::coroutine_handle<promise_type> h) : handle(h) {}
+    void destroy() {if (handle) {handle.destroy(); handle = nullptr;}}
+
+  public:
+    cTask() {}
+    cTask(cTask&& other) noexcept : handle(other.handle) {other.handle = nullptr;}
+    cTask(const cTask&) = delete;
+    ~cTask() {destroy();}
+    cTask& operator=(cTask&& other) noexcept {if (this != &other) {destroy(); handle = other.handle; other.handle = nullptr;} return *this;}
+    cTask& operator=(const cTask&) = delete;
+
+    /**
+     * Returns true if the coroutine has completed.
+     */
+    bool isDone() const {return handle && handle.done();}
+
+    /** @name Awaitable interface; used by co_await. */
+    //@{
+    bool await_ready() const noexcept {return !handle || handle.done();}
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) noexcept {handle.promise().continuation = caller; return handle;}
+    void await_resume() {if (handle && handle.promise().exception) std::rethrow_exception(handle.promise().exception);}
+    //@}
+};
+
+/**
+ * @brief Base class for simple modules that are programmed in the sequential
+ * style of activity(), but with C++20 stackless coroutines.
+ *
+ * Subclasses implement run() as a coroutine that returns cTask, and use
+ * `co_await receiveAsync()`, `co_await receiveAsync(timeout)`,
+ * `co_await waitAsync(delay)` and `co_await waitAndEnqueueAsync(delay, queue)`
+ * where an activity() would call receive(), wait() etc.:
+ *
+ * <pre>
+ * cTask Sink::run()
+ * {
+ *     while (true) {
+ *         cMessage *msg = co_await receiveAsync();
+ *         co_await waitAsync(par("serviceTime"));
+ *         send(msg, "out");
+ *     }
+ * }
+ * </pre>
+ *
+ * Unlike activity(), there is no separate stack and no context switching:
+ * the module is driven by handleMessage() like any other simple module, and
+ * the coroutine frame (which holds the local variables of run()) is the only
+ * extra state. The coroutine runs in the context of the module as part of
+ * handleMessage(), so the Enter_Method rules apply as usual; receiveAsync()
+ * and waitAsync() may only be awaited from the module's own coroutine.
+ *
+ * run() starts at the module's start time (see scheduleStart()), after
+ * initialize(). When run() returns, the module terminates just like an
+ * activity() module. Exceptions thrown from run() end the simulation with
+ * an error, as if they had been thrown from handleMessage(). When the
+ * module is deleted, the coroutine frame is destroyed, which runs the
+ * destructors of the local variables of run().
+ *
+ * This class is only available if the simulation model is compiled with
+ * C++20 coroutine support.
+ *
+ * @ingroup SimCore
+ */
+class cCoroutineModule : public cSimpleModule
+{
+  private:
+    enum WaitState { WAIT_NONE, WAIT_START, WAIT_RECEIVE, WAIT_DELAY };
+    cTask mainTask;
+    std::coroutine_handle<> suspendedHandle;  // the innermost coroutine awaiting an event
+    WaitState waitState = WAIT_NONE;
+    cMessage *timeoutMsg = nullptr;
+    cMessage *receivedMsg = nullptr;
+    cQueue *enqueueQueue = nullptr;
+
+  public:
+    /**
+     * @brief The awaitable returned by receiveAsync(). The result of co_await is
+     * the received message, or nullptr on timeout.
+     */
+    class ReceiveAwaiter {
+      private:
+        cCoroutineModule *module;
+        simtime_t timeout;
+        bool hasTimeout;
+      public:
+        ReceiveAwaiter(cCoroutineModule *module, bool hasTimeout, simtime_t timeout) : module(module), timeout(timeout), hasTimeout(hasTimeout) {}
+        bool await_ready() const noexcept {return false;}
+        void await_suspend(std::coroutine_handle<> h) {module->suspend(h, WAIT_RECEIVE, hasTimeout, timeout, nullptr);}
+        cMessage *await_resume() {cMessage *msg = module->receivedMsg; module->receivedMsg = nullptr; return msg;}
+    };
+
+    /**
+     * @brief The awaitable returned by waitAsync() and waitAndEnqueueAsync().
+     */
+    class WaitAwaiter {
+      private:
+        cCoroutineModule *module;
+        simtime_t delay;
+        cQueue *queue;
+      public:
+        WaitAwaiter(cCoroutineModule *module, simtime_t delay, cQueue *queue) : module(module), delay(delay), queue(queue) {}
+        bool await_ready() const noexcept {return false;}
+        void await_suspend(std::coroutine_handle<> h) {module->suspend(h, WAIT_DELAY, true, delay, queue);}
+        void await_resume() {}
+    };
+
+  private:
+    void suspend(std::coroutine_handle<> h, WaitState state, bool hasTimeout, simtime_t timeout, cQueue *queue) {
+        if (getSimulation()->getContextModule() != this)
+            throw cRuntimeError(this, "receiveAsync()/waitAsync() may only be awaited from the module's own coroutine");
+        if (hasTimeout && timeout < SIMTIME_ZERO)
+            throw cRuntimeError(this, state == WAIT_DELAY ? "waitAsync(): Negative delay %s" : "receiveAsync(): Negative timeout %s", timeout.str().c_str());
+        suspendedHandle = h;
+        waitState = state;
+        enqueueQueue = queue;
+        if (hasTimeout)
+            scheduleAt(simTime() + timeout, timeoutMsg);
+    }
+
+    void resume() {
+        std::coroutine_handle<> h = suspendedHandle;
+        suspendedHandle = nullptr;
+        waitState = WAIT_NONE;
+        enqueueQueue = nullptr;
+        h.resume();
+
+        if (mainTask.isDone()) {
+            setFlag(FL_ISTERMINATED, true);
+            if (mainTask.handle.promise().exception)
+                std::rethrow_exception(mainTask.handle.promise().exception);
+        }
+        else if (!suspendedHandle)
+            throw cRuntimeError(this, "run() suspended without awaiting receiveAsync(), waitAsync() or a cTask");
+    }
+
+  protected:
+    /** @name Operations to be awaited from run(). */
+    //@{
+    /**
+     * Waits for the next message to arrive at the module.
+     */
+    ReceiveAwaiter receiveAsync() {return ReceiveAwaiter(this, false, SIMTIME_ZERO);}
+
+    /**
+     * Waits for the next message to arrive at the module, but at most for
+     * the given time. The result is nullptr on timeout.
+     */
+    ReceiveAwaiter receiveAsync(simtime_t timeout) {return ReceiveAwaiter(this, true, timeout);}
+
+    /**
+     * Waits for the given amount of simulation time. It is an error if
+     * a message arrives in the meantime.
+     */
+    WaitAwaiter waitAsync(simtime_t delay) {return WaitAwaiter(this, delay, nullptr);}
+
+    /**
+     * Waits for the given amount of simulation time, and inserts messages
+     * that arrive in the meantime into the given queue.
+     */
+    WaitAwaiter waitAndEnqueueAsync(simtime_t delay, cQueue *queue) {
+        if (!queue)
+            throw cRuntimeError(this, "waitAndEnqueueAsync(): Queue pointer is nullptr");
+        return WaitAwaiter(this, delay, queue);
+    }
+    //@}
+
+    /**
+     * The body of the module. It should be implemented as a C++20 coroutine.
+     */
+    virtual cTask run() = 0;
+
+    /**
+     * Resumes the coroutine with the message. Not to be redefined.
+     */
+    virtual void handleMessage(cMessage *msg) override {
+        switch (waitState) {
+            case WAIT_START:
+                if (msg != timeoutMsg)
+                    throw cRuntimeError("Message (%s)%s arrived before run() was started",
+                                        msg->getClassName(), msg->getFullName());
+                break;
+            case WAIT_RECEIVE:
+                if (msg == timeoutMsg)
+                    receivedMsg = nullptr;
+                else {
+                    cancelEvent(timeoutMsg);
+                    receivedMsg = msg;
+                }
+                break;
+            case WAIT_DELAY:
+                if (msg != timeoutMsg) {
+                    if (!enqueueQueue)
+                        throw cRuntimeError("Message arrived during waitAsync() ((%s)%s); if this "
+                                            "should be allowed, use waitAndEnqueueAsync() instead of waitAsync()",
+                                            msg->getClassName(), msg->getFullName());
+                    enqueueQueue->insert(msg);
+                    return;
+                }
+                break;
+            case WAIT_NONE:
+                throw cRuntimeError("Message (%s)%s arrived while run() was not waiting for one",
+                                    msg->getClassName(), msg->getFullName());
+        }
+        resume();
+    }
+
+  public:
+    /**
+     * Constructor.
+     */
+    cCoroutineModule() {}
+
+    /**
+     * Destructor. Destroys the coroutine frame.
+     */
+    virtual ~cCoroutineModule() {
+        mainTask.destroy();
+        cancelAndDelete(timeoutMsg);
+    }
+
+    /**
+     * Creates the coroutine, and schedules its start.
+     */
+    virtual void scheduleStart(simtime_t t) override {
+        if (timeoutMsg != nullptr)
+            throw cRuntimeError("scheduleStart(): Module '%s' already started", getFullPath().c_str());
+
+        Enter_Method_Silent("scheduleStart()");
+        timeoutMsg = new cMessage("timeout");
+        scheduleAt(t, timeoutMsg);
+        mainTask = run();
+        suspendedHandle = mainTask.handle;
+        waitState = WAIT_START;
+
+        cSimpleModule::scheduleStart(t);
+    }
+};
+
+}  // namespace omnetpp
+
+#endif
+
+#endif
+
@@ -0,0 +1,214 @@
+//==========================================================================
+//  CDARYEVENTHEAP.H - part of
+//                     OMNeT++/OMNEST
+//            Discrete System Simulation in C++
+//
+//==========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_CDARYEVENTHEAP_H
+#define __OMNETPP_CDARYEVENTHEAP_H
+
+#include "cfutureeventset.h"
+
+namespace omnetpp {
+
+/**
+ * @brief A cache-friendly, 4-ary heap based implementation of the future
+ * event set.
+ *
+ * Unlike cEventHeap, which stores pointers to the events and compares them
+ * by dereferencing, this class stores the ordering keys (arrival time,
+ * scheduling priority, insertion order) together with the event pointer
+ * in the heap array itself. Sift operations therefore only access the
+ * heap array; the event objects (which are typically scattered in memory)
+ * are never touched. The scheduling priority is taken at insertion time,
+ * so it should not be changed while the event is scheduled (the parallel
+ * simulation protocols only reset it on the first event right before
+ * removing it, which is harmless).
+ *
+ * Children of a node occupy 128 consecutive, aligned bytes, i.e. two full
+ * cache lines. The position of each event in the heap is kept in a separate
+ * compact index array, so that remove() remains O(log n).
+ *
+ * The order in which events are returned is exactly the same as with
+ * cEventHeap. It can be selected with the
+ * `futureeventset-class = omnetpp::cDaryEventHeap` configuration option.
+ *
+ * @ingroup SimSupport
+ */
+class SIM_API cDaryEventHeap : public cFutureEventSet
+{
+  private:
+    // A heap entry; exactly 32 bytes, so that four of them fill two cache lines
+    struct Entry {
+        int64_t arrivalTime;         // raw simtime value
+        eventnumber_t insertOrder;
+        cEvent *event;
+        int handle;                  // index into the positions[] array (same as event->heapIndex)
+        short priority;
+
+        bool operator<(const Entry& other) const {
+            return arrivalTime < other.arrivalTime ? true :
+                   arrivalTime > other.arrivalTime ? false :
+                   priority != other.priority ? priority < other.priority :
+                   insertOrder < other.insertOrder;
+        }
+    };
+    static_assert(sizeof(Entry) == 32, "heap entry size should be 32 bytes");
+
+    Entry *heap;              // heap array; first element at HEAP_OFFSET, see .cc file
+    char *heapAlloc;          // the allocated memory block (heap is aligned within it)
+    int heapLength;           // number of elements on the heap
+    int heapCapacity;         // allocated size of the heap[] array
+    eventnumber_t insertCount; // counts insertions; needed because heap's insert is not stable (does not keep order)
+
+    // handle -> position in heap[]; handles of removed events are kept on a free list
+    int *positions;
+    int positionsCapacity;    // allocated size of the positions[] array
+    int numHandles;           // number of handles ever given out (positions[0..numHandles-1] are in use or free)
+    int freeHandle;           // head of free list (linked via positions[]), or -1
+
+  private:
+    void copy(const cDaryEventHeap& other);
+    void allocateHeap(int capacity);
+    void growHeap();
+    int allocateHandle();
+    void releaseHandle(int handle);
+    void siftUp(int pos, const Entry& entry);
+    void siftDown(int pos, const Entry& entry);
+    void doInsert(cEvent *event);
+    cEvent *removeAt(int pos);
+
+  public:
+    /** @name Constructors, destructor, assignment */
+    //@{
+
+    /**
+     * Copy constructor.
+     */
+    cDaryEventHeap(const cDaryEventHeap& other);
+
+    /**
+     * Constructor.
+     */
+    cDaryEventHeap(const char *name=nullptr, int initialCapacity=128);
+
+    /**
+     * Destructor.
+     */
+    virtual ~cDaryEventHeap();
+
+    /**
+     * Assignment operator. The name member is not copied;
+     * see cOwnedObject's operator=() for more details.
+     */
+    cDaryEventHeap& operator=(const cDaryEventHeap& other);
+    //@}
+
+    /** @name Redefined cObject member functions. */
+    //@{
+
+    /**
+     * Creates and returns an exact copy of this object.
+     * See cObject for more details.
+     */
+    virtual cDaryEventHeap *dup() const override  {return new cDaryEventHeap(*this);}
+
+    /**
+     * Produces a one-line description of the object's contents.
+     * See cObject for more details.
+     */
+    virtual std::string str() const override;
+
+    /**
+     * Calls v->visit(this) for each contained object.
+     * See cObject for more details.
+     */
+    virtual void forEachChild(cVisitor *v) override;
+
+    // no parsimPack() and parsimUnpack()
+    //@}
+
+    /** @name Simulation-related operations. */
+    //@{
+    /**
+     * Insert an event into the FES.
+     */
+    virtual void insert(cEvent *event) override;
+
+    /**
+     * Peek the first event in the FES (the one with the smallest timestamp.)
+     * If the FES is empty, it returns nullptr.
+     */
+    virtual cEvent *peekFirst() const override;
+
+    /**
+     * Removes and return the first event in the FES (the one with the
+     * smallest timestamp.) If the FES is empty, it returns nullptr.
+     */
+    virtual cEvent *removeFirst() override;
+
+    /**
+     * Undo for removeFirst(): it puts back an event to the front of the FES.
+     */
+    virtual void putBackFirst(cEvent *event) override;
+
+    /**
+     * Removes and returns the given event in the FES. If the event is
+     * not in the FES, returns nullptr.
+     */
+    virtual cEvent *remove(cEvent *event) override;
+
+    /**
+     * Changes the arrival time of the given event, and moves it to its new
+     * place in the heap in a single pass. See cFutureEventSet::reschedule().
+     */
+    virtual void reschedule(cEvent *event, simtime_t t) override;
+
+    /**
+     * Returns true if the FES is empty.
+     */
+    virtual bool isEmpty() const override {return heapLength == 0;}
+
+    /**
+     * Deletes all events in the FES.
+     */
+    virtual void clear() override;
+    //@}
+
+    /** @name Random access. */
+    //@{
+
+    /**
+     * Returns the number of events in the FES.
+     */
+    virtual int getLength() const override {return heapLength;}
+
+    /**
+     * Returns the kth event in the FES if 0 <= k < getLength(), and nullptr
+     * otherwise. Note that iteration does not necessarily return events
+     * in increasing timestamp (getArrivalTime()) order unless you called
+     * sort() before.
+     */
+    virtual cEvent *get(int k) override;
+
+    /**
+     * Sorts the contents of the FES. This is only necessary if one wants
+     * to iterate through in the FES in strict timestamp order.
+     */
+    virtual void sort() override;
+    //@}
+};
+
+}  // namespace omnetpp
+
+
+#endif
+
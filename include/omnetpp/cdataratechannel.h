@@ -102,6 +102,10 @@ class SIM_API cDatarateChannel : public cChannel //implies noncopyable
     // internal: emits last busy signal
     virtual void finish() override;
 
+    // internal: saves/restores the state of the ongoing transmission in checkpoints
+    virtual void packCheckpoint(cCommBuffer *buffer) const override;
+    virtual void unpackCheckpoint(cCommBuffer *buffer) override;
+
   public:
     /** @name Constructors, destructor */
     //@{
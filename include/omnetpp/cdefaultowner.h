@@ -35,6 +35,8 @@ class SIM_API cDefaultOwner : public cNoncopyableOwnedObject
     friend class cObject;
     friend class cOwnedObject;
     friend class cChannelType;
+    friend class ParallelEventExecutor; // doInsert()
+    friend class cMessage; // doInsert()
 
   private:
     enum {FL_PERFORMFINALGC = 2};  // whether to delete owned objects in the destructor
@@ -43,6 +45,9 @@ class SIM_API cDefaultOwner : public cNoncopyableOwnedObject
     cOwnedObject **objs; // array of owned objects
     int numObjs;         // number of elements used in objects[] (0..num-1)
     int capacity;        // allocated size of objs[]
+    bool tracking;       // if false, owned objects are not added to objs[]
+
+    static thread_local bool ownershipTracking; // whether modules and channels should keep track of the objects they own; per thread like the default owner
 
 #ifdef SIMFRONTEND_SUPPORT
   private:
@@ -55,7 +60,24 @@ class SIM_API cDefaultOwner : public cNoncopyableOwnedObject
     virtual void ownedObjectDeleted(cOwnedObject *obj) override;
     virtual void yieldOwnership(cOwnedObject *obj, cObject *newOwner) override;
 
+  protected:
+    // internal: turns off maintaining the list of owned objects for this instance;
+    // invoked by cComponent if ownership tracking is disabled (see setOwnershipTracking())
+    void disableTracking() {ASSERT(numObjs == 0); tracking = false;}
+
   public:
+    // internal: if set to false, modules and channels created afterwards will not
+    // keep a list of the objects they own. This saves the bookkeeping cost on
+    // every object creation, deletion and ownership change, but the default
+    // list of components will always be empty, and deleting a module no longer
+    // deletes all objects it owns: objects left over by the module destructor
+    // are leaked (not deallocated or reported as undisposed), and their
+    // getOwner() pointer will dangle after the module is gone.
+    // The setting is per thread, so that simulations running concurrently in
+    // separate threads (see samples/embedding) may use different settings.
+    static void setOwnershipTracking(bool b) {ownershipTracking = b;}
+    static bool getOwnershipTracking() {return ownershipTracking;}
+
 #ifdef SIMFRONTEND_SUPPORT
     // internal: used by the UI to optimize refreshes
     void updateLastChangeSerial()  {lastChangeSerial = changeCounter++;}
@@ -157,7 +179,9 @@ class SIM_API cDefaultOwner : public cNoncopyableOwnedObject
     virtual void setPerformFinalGC(bool b)  {setFlag(FL_PERFORMFINALGC,b);}
 
     /**
-     * Returns the number of elements stored.
+     * Returns the number of elements stored. Note that this is always zero
+     * for modules and channels if ownership tracking is turned off
+     * (see the \opp{ownership-tracking} configuration option).
      */
     int defaultListSize() const {return numObjs;}
 
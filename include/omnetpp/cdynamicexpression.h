@@ -175,6 +175,14 @@ class SIM_API cDynamicExpression : public cExpression
      */
     virtual void parseNedExpr(const char *text, bool inSubcomponentScope, bool inInifile);
 
+    /**
+     * Compiles the parsed expression into a form that is faster to evaluate.
+     * Compilation takes time, so it only pays off for expressions that are
+     * evaluated many times, like those of volatile parameters and of
+     * result filters.
+     */
+    virtual void compile();
+
     /**
      * Evaluate the expression, and return the results as a cValue.
      * Evaluation errors result in exceptions.
@@ -146,6 +146,12 @@ class SIM_API cEventHeap : public cFutureEventSet
      */
     virtual cEvent *remove(cEvent *event) override;
 
+    /**
+     * Changes the arrival time of the given event, and moves it to its new
+     * place in the heap in a single pass. See cFutureEventSet::reschedule().
+     */
+    virtual void reschedule(cEvent *event, simtime_t t) override;
+
     /**
      * Returns true if the FES is empty.
      */
@@ -48,6 +48,7 @@ typedef int ErrorCodeInt;
  */
 class SIM_API cException : public std::exception
 {
+    friend class ParallelEventExecutor; // storeContext()
   protected:
     ErrorCode errorCode;
     std::string msg;
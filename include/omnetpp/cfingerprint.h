@@ -72,6 +72,35 @@ class SIM_API cFingerprintCalculator : public cObject, noncopyable
      * error if it doesn't match.
      */
     virtual bool checkFingerprint() const = 0;
+
+    /** @name Support for parallel event execution (see cSimulation::setParallelEventThreads()) */
+    //@{
+    /**
+     * Returns true if the calculator implements captureEvent() and
+     * addCapturedEvent(). Otherwise, events are not executed in parallel
+     * while the fingerprint is being calculated.
+     */
+    virtual bool canCaptureEvents() const {return false;}
+
+    /**
+     * Called instead of addEvent() before the event is executed in parallel
+     * with other events, i.e. when the handlers of preceding events may not
+     * have completed yet, and the event's own handler may change the message
+     * any time after this call. Computes the ingredients that only depend on
+     * the event (message, module), and returns them in an object. Ingredients
+     * that depend on the state of the simulation (event number, random numbers
+     * drawn, etc.) are added later by addCapturedEvent(), which is called when
+     * all preceding events have completed. Returns nullptr if the event does
+     * not contribute to the fingerprint.
+     */
+    virtual cObject *captureEvent(cEvent *event) {return nullptr;}
+
+    /**
+     * Adds the event captured by captureEvent() to the fingerprint. The
+     * capture object is deleted by the caller afterwards.
+     */
+    virtual void addCapturedEvent(cObject *capture) {}
+    //@}
 };
 
 #ifdef USE_OMNETPP4x_FINGERPRINTS
@@ -121,6 +150,8 @@ class SIM_API cOmnetpp4xFingerprintCalculator : public cFingerprintCalculator
 
     virtual bool checkFingerprint() const override;
 
+    virtual void parsimPack(cCommBuffer *buffer) const override;
+    virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 #else // if !USE_OMNETPP4x_FINGERPRINTS
@@ -195,6 +226,16 @@ class SIM_API cSingleFingerprintCalculator : public cFingerprintCalculator
         virtual const char *getAsString(const char *attribute) const;
     };
 
+    // the result of captureEvent(): the hashes of the captured ingredients
+    // before, between and after the ones that are added by addCapturedEvent()
+    class CapturedEvent : public cObject, omnetpp::noncopyable
+    {
+      public:
+        std::vector<cHasher *> segments;
+        std::string laterIngredients;  // segments.size() == laterIngredients.size()+1
+        virtual ~CapturedEvent() {for (cHasher *segment : segments) delete segment;}
+    };
+
   protected:
     std::string expectedFingerprints;
     std::string ingredients;
@@ -216,6 +257,9 @@ class SIM_API cSingleFingerprintCalculator : public cFingerprintCalculator
     virtual void parseResultMatcher(const char *s);
     virtual bool addEventIngredient(cEvent *event, FingerprintIngredient ingredient);
     virtual void addModuleVisuals(cModule *module, bool displayStrings, bool figures);
+    bool matchesEvent(cEvent *event) const;
+    void addIngredient(cEvent *event, FingerprintIngredient ingredient);
+    static bool dependsOnSimulationState(FingerprintIngredient ingredient);
 
   public:
     cSingleFingerprintCalculator();
@@ -247,6 +291,12 @@ class SIM_API cSingleFingerprintCalculator : public cFingerprintCalculator
 
     virtual bool checkFingerprint() const override;
 
+    virtual bool canCaptureEvents() const override;
+    virtual cObject *captureEvent(cEvent *event) override;
+    virtual void addCapturedEvent(cObject *capture) override;
+
+    virtual void parsimPack(cCommBuffer *buffer) const override;
+    virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 
@@ -264,6 +314,14 @@ class SIM_API cMultiFingerprintCalculator : public cFingerprintCalculator
     cFingerprintCalculator *prototype;
     std::vector<cFingerprintCalculator *> elements;
 
+    // the result of captureEvent(): the captures of the elements
+    class CapturedEvent : public cObject, omnetpp::noncopyable
+    {
+      public:
+        std::vector<cObject *> elementCaptures;
+        virtual ~CapturedEvent() {for (cObject *capture : elementCaptures) delete capture;}
+    };
+
   public:
     cMultiFingerprintCalculator(cFingerprintCalculator *prototype);
     virtual ~cMultiFingerprintCalculator();
@@ -293,6 +351,13 @@ class SIM_API cMultiFingerprintCalculator : public cFingerprintCalculator
     virtual void addExtraData(const char *data) override { for (auto element: elements) element->addExtraData(data); }
 
     virtual bool checkFingerprint() const override;
+
+    virtual bool canCaptureEvents() const override;
+    virtual cObject *captureEvent(cEvent *event) override;
+    virtual void addCapturedEvent(cObject *capture) override;
+
+    virtual void parsimPack(cCommBuffer *buffer) const override;
+    virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 #endif // !USE_OMNETPP4x_FINGERPRINTS
@@ -17,6 +17,7 @@
 #define __OMNETPP_CFUTUREEVENTSET_H
 
 #include "cownedobject.h"
+#include "simtime_t.h"
 
 namespace omnetpp {
 
@@ -60,6 +61,17 @@ class SIM_API cFutureEventSet : public cOwnedObject
     virtual std::string str() const override;
     //@}
 
+  protected:
+    /**
+     * Redefined to do nothing if the event is no longer owned by the FES.
+     * Events cancelled during parallel event execution are given to their
+     * module immediately, but are only removed from the FES after the batch
+     * (see cSimulation::isParallelEventBatchActive()).
+     */
+    virtual void drop(cOwnedObject *obj) override;
+
+  public:
+
     /** @name Simulation-related operations. */
     //@{
 
@@ -91,6 +103,19 @@ class SIM_API cFutureEventSet : public cOwnedObject
      */
     virtual cEvent *remove(cEvent *event) = 0;
 
+    /**
+     * Changes the arrival time of the given event to t, and moves the event
+     * to its new place in the FES. The result is the same as remove()
+     * followed by insert(); in particular, the event receives a new insertion
+     * order, i.e. it will come after the events that are already in the FES
+     * with the same arrival time and priority. If the event is not in the FES,
+     * it is inserted.
+     *
+     * The default implementation calls remove() and insert(); subclasses
+     * may override it to update the event's position in place.
+     */
+    virtual void reschedule(cEvent *event, simtime_t t);
+
     /**
      * Returns true if the FES is empty.
      */
@@ -133,8 +133,6 @@ class SIM_API cGate : public cObject, noncopyable
     cGate *prevGate;    // previous and next gate in the path
     cGate *nextGate;
 
-    static int lastConnectionId;
-
   protected:
     // internal: constructor is protected because only cModule is allowed to create instances
     explicit cGate();
@@ -38,11 +38,13 @@ class SIM_API cHasher : noncopyable
 {
   private:
     uint32_t value;
+    uint32_t rotation; // number of merge() calls modulo 32, for append()
 
     void merge(uint32_t x) {
         // rotate value left by one bit, and xor with new data
         uint32_t carry = (value & 0x80000000U) >> 31;
         value = ((value<<1)|carry) ^ x;
+        rotation = (rotation + 1) & 31;
     }
 
     void merge2(uint64_t x) {
@@ -54,11 +56,12 @@ class SIM_API cHasher : noncopyable
     /**
      * Constructor.
      */
-    cHasher() {ASSERT(sizeof(uint32_t)==4); ASSERT(sizeof(double)==8); value = 0;}
+    cHasher() {ASSERT(sizeof(uint32_t)==4); ASSERT(sizeof(double)==8); value = 0; rotation = 0;}
 
     /** @name Updating the hash */
     //@{
-    void reset() {value = 0;}
+    void reset() {value = 0; rotation = 0;}
+    void setHash(uint32_t hash) {value = hash; rotation = 0;}
     void add(const char *p, size_t length);
     void add(char d)           {merge((uint32_t)d);}
     void add(short d)          {merge((uint32_t)d);}
@@ -73,6 +76,19 @@ class SIM_API cHasher : noncopyable
     // note: safe(r) type punning, see http://cocoawithlove.decenturl.com/type-punning
     void add(double d)         {union _ {double d; uint64_t i;}; merge2(((union _ *)&d)->i);}
     void add(const char *s)    {if (s) add(s, strlen(s)+1); else add(0);}
+
+    /**
+     * Adds the data that was added to the other hasher since it was created
+     * or reset, with the same result as if it had been added to this hasher
+     * directly. (This works because merging is linear: the effect of the
+     * current value on the result is just a rotation.)
+     */
+    void append(const cHasher& other) {
+        if (other.rotation != 0)
+            value = (value << other.rotation) | (value >> (32 - other.rotation));
+        value ^= other.value;
+        rotation = (rotation + other.rotation) & 31;
+    }
     //@}
 
     /** @name Obtaining the result */
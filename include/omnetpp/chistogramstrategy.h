@@ -124,6 +124,12 @@ class SIM_API cFixedRangeHistogramStrategy : public cIHistogramStrategy
     virtual cFixedRangeHistogramStrategy *dup() const override {return new cFixedRangeHistogramStrategy(*this);}
     //@}
 
+    /** @name Redefined cObject methods. */
+    //@{
+    virtual void parsimPack(cCommBuffer *buffer) const override;
+    virtual void parsimUnpack(cCommBuffer *buffer) override;
+    //@}
+
     /** @name Configuring. */
     //@{
     void setRange(double lo, double hi) {this->lo = lo; this->hi = hi;}
@@ -183,6 +189,12 @@ class SIM_API cPrecollectionBasedHistogramStrategy : public cIHistogramStrategy
     cPrecollectionBasedHistogramStrategy& operator=(const cPrecollectionBasedHistogramStrategy& other);
     //@}
 
+    /** @name Redefined cObject methods. */
+    //@{
+    virtual void parsimPack(cCommBuffer *buffer) const override;
+    virtual void parsimUnpack(cCommBuffer *buffer) override;
+    //@}
+
     /** @name Configuring. */
     //@{
     int getNumToPrecollect() const {return numToPrecollect;}
@@ -250,6 +262,12 @@ class SIM_API cDefaultHistogramStrategy : public cPrecollectionBasedHistogramStr
     virtual cDefaultHistogramStrategy *dup() const override {return new cDefaultHistogramStrategy(*this);}
     //@}
 
+    /** @name Redefined cObject methods. */
+    //@{
+    virtual void parsimPack(cCommBuffer *buffer) const override;
+    virtual void parsimUnpack(cCommBuffer *buffer) override;
+    //@}
+
     /** @name Configuring. */
     //@{
     int getNumBinsHint() const {return numBinsHint;}
@@ -337,6 +355,12 @@ class SIM_API cAutoRangeHistogramStrategy : public cPrecollectionBasedHistogramS
     virtual cAutoRangeHistogramStrategy *dup() const override {return new cAutoRangeHistogramStrategy(*this);}
     //@}
 
+    /** @name Redefined cObject methods. */
+    //@{
+    virtual void parsimPack(cCommBuffer *buffer) const override;
+    virtual void parsimUnpack(cCommBuffer *buffer) override;
+    //@}
+
     /** @name Configuring. */
     //@{
     void setRangeHint(double lo, double hi) {this->lo = lo; this->hi = hi;}  ///< Use NAN to leave either value unspecified.
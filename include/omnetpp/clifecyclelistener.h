@@ -100,6 +100,24 @@ enum SimulationLifecycleEventType
     //TODO the detail object should contain the exception object
     LF_ON_SIMULATION_ERROR,
 
+    /**
+     * Fired before the state of the simulation process is saved, so that
+     * the simulation can later be rolled back to it. This is done by optimistic
+     * parallel simulation (see cTimeWarpProtocol), which saves the state by
+     * forking the process. Listeners that write files should remember the
+     * current sizes of the files (including buffered output).
+     */
+    LF_PRE_STATE_SAVE,
+
+    /**
+     * Fired after the simulation has been rolled back to a state saved earlier
+     * (see LF_PRE_STATE_SAVE). The memory of the process is as it was at the
+     * time of saving, but files may also contain output that was written
+     * after it by events that have been rolled back. Listeners should truncate
+     * their files to the sizes they remembered at LF_PRE_STATE_SAVE.
+     */
+    LF_POST_STATE_RESTORE,
+
     /**
      * Fired just before the network is finalized, i.e. before callFinish()
      * has been invoked on the system module. This only happens if the
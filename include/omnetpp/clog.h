@@ -156,23 +156,23 @@ class SIM_API cLog
     /**
      * This log level specifies a globally applied runtime modifiable filter. This is
      * the fastest runtime filter, it works with a simple integer comparison at the call
-     * site.
+     * site. Like the active simulation, it is a per-thread setting.
      */
-    static LogLevel logLevel;
+    static thread_local LogLevel logLevel;
 
     /**
      * This predicate determines if a log statement is executed for log statements
      * that occur outside module or channel member functions. This is a customization
-     * point for logging.
+     * point for logging. It is a per-thread setting.
      */
-    static NoncomponentLogPredicate noncomponentLogPredicate;
+    static thread_local NoncomponentLogPredicate noncomponentLogPredicate;
 
     /**
      * This predicate determines if a log statement is executed for log statements
      * that occur in module or channel member functions. This is a customization
-     * point for logging.
+     * point for logging. It is a per-thread setting.
      */
-    static ComponentLogPredicate componentLogPredicate;
+    static thread_local ComponentLogPredicate componentLogPredicate;
 
   public:
     /**
@@ -414,14 +414,15 @@ class SIM_API cLogProxy
     };
 
   public:
-    static nullstream dummyStream; // EV evaluates to this when in express mode (getEnvir()->disabled())
+    static thread_local nullstream dummyStream; // EV evaluates to this when in express mode (getEnvir()->disabled())
 
   private:
-    static LogBuffer buffer;  // underlying buffer that contains the text that has been written so far
-    static std::ostream stream;  // this singleton is used to avoid allocating a new stream each time a log statement executes
-    static cLogEntry currentEntry; // context of the current (last) log statement that has been executed.
-    static LogLevel previousLogLevel; // log level of the previous log statement
-    static const char *previousCategory; // category of the previous log statement
+    // note: these are per-thread, so that simulations running in different threads do not interfere
+    static thread_local LogBuffer buffer;  // underlying buffer that contains the text that has been written so far
+    static thread_local std::ostream stream;  // this singleton is used to avoid allocating a new stream each time a log statement executes
+    static thread_local cLogEntry currentEntry; // context of the current (last) log statement that has been executed.
+    static thread_local LogLevel previousLogLevel; // log level of the previous log statement
+    static thread_local const char *previousCategory; // category of the previous log statement
 
   private:
     void fillEntry(LogLevel logLevel, const char *category, const char *sourceFile, int sourceLine, const char *sourceFunction);
@@ -72,6 +72,12 @@ class SIM_API cMersenneTwister : public cRNG
 
     /** Random double on the [0,1] interval */
     virtual double doubleRandIncl1() override;
+
+    /** Serializes the RNG state, e.g. into a simulation checkpoint */
+    virtual void parsimPack(cCommBuffer *buffer) const override;
+
+    /** Restores the RNG state serialized with parsimPack() */
+    virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 }  // namespace omnetpp
@@ -94,6 +94,8 @@ enum eMessageKind
  */
 class SIM_API cMessage : public cEvent
 {
+    friend class cSimulation; // checkpointing: message ids and counters
+    friend class ParallelEventExecutor; // message ids
   private:
     enum {
         FL_ISPRIVATECOPY = 4,
@@ -115,11 +117,7 @@ class SIM_API cMessage : public cEvent
 
     long messageId;            // a unique message identifier assigned upon message creation
     long messageTreeId;        // a message identifier that is inherited by dup, if non dupped it is msgid
-    static long nextMessageId; // the next unique message identifier to be assigned upon message creation
-
-    // global variables for statistics
-    static long totalMsgCount;
-    static long liveMsgCount;
+    // note: the next message ID and the message counters are stored in cSimulation
 
   private:
     // internal: create parlist
@@ -145,6 +143,16 @@ class SIM_API cMessage : public cEvent
     // internal: used by the parallel simulation kernel.
     virtual int getSrcProcId() const override {return srcProcId;}
 
+    // internal: used by the parallel simulation kernel when the message object
+    // itself is handed over to a partition running in another thread (see
+    // cSharedMemoryCommunications). leaveSimulation() is called in the sending
+    // thread, after the message has been removed from the ownership tree, and
+    // removes it from the message counters; enterSimulation() is called in the
+    // receiving thread, and adds the message to the active simulation as if it
+    // had been created there (new message ID, counters, default owner).
+    virtual void leaveSimulation();
+    virtual void enterSimulation();
+
     // internal: returns the parameter list object, or nullptr if it hasn't been used yet
     cArray *getParListPtr()  {return parList;}
 
@@ -617,28 +625,28 @@ class SIM_API cMessage : public cEvent
     /** @name Statistics. */
     //@{
     /**
-     * Returns the total number of messages created since the last
-     * reset (reset is usually called by user interfaces at the beginning
-     * of each simulation run). The counter is incremented by cMessage constructor.
+     * Returns the total number of messages created in the active simulation
+     * since the last reset (reset is usually called by user interfaces at the
+     * beginning of each simulation run). The counter is incremented by cMessage constructor.
      * Counter is <tt>signed</tt> to make it easier to detect if it overflows
      * during very long simulation runs.
      * May be useful for profiling or debugging memory leaks.
      */
-    static long getTotalMessageCount() {return totalMsgCount;}
+    static long getTotalMessageCount() {return cSimulation::getActiveSimulation()->totalMessageCount;}
 
     /**
      * Returns the number of message objects that currently exist in the
-     * program. The counter is incremented by cMessage constructor
+     * active simulation. The counter is incremented by cMessage constructor
      * and decremented by the destructor.
      * May be useful for profiling or debugging memory leaks caused by forgetting
      * to delete messages.
      */
-    static long getLiveMessageCount() {return liveMsgCount;}
+    static long getLiveMessageCount() {return cSimulation::getActiveSimulation()->liveMessageCount;}
 
     /**
      * Reset counters used by getTotalMessageCount() and getLiveMessageCount().
      */
-    static void resetMessageCounters()  {totalMsgCount=liveMsgCount=0;}
+    static void resetMessageCounters()  {cSimulation *sim = cSimulation::getActiveSimulation(); sim->totalMessageCount = sim->liveMessageCount = 0;}
     //@}
 };
 
@@ -0,0 +1,157 @@
+//==========================================================================
+//  CMESSAGEPOOL.H - part of
+//                     OMNeT++/OMNEST
+//            Discrete System Simulation in C++
+//
+//==========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_CMESSAGEPOOL_H
+#define __OMNETPP_CMESSAGEPOOL_H
+
+#include <cstddef>
+#include "simkerneldefs.h"
+
+namespace omnetpp {
+
+/**
+ * @brief Recycling memory allocator for message and packet objects.
+ *
+ * Memory blocks released via deallocate() are not returned to the C++ heap,
+ * but kept on a free list (one list per size class), and are handed out again
+ * by subsequent allocate() calls for objects of the same size. Since models
+ * typically create and delete messages of a few distinct classes at a high
+ * rate, most allocations can be satisfied from the free lists without calling
+ * the general-purpose allocator. Sizes are rounded up to multiples of 16 bytes;
+ * objects larger than MAX_POOLED_SIZE bytes are not pooled.
+ *
+ * The pool only manages memory: constructors and destructors run as usual,
+ * so message counters (cMessage::getLiveMessageCount(), getTotalMessageCount()),
+ * ownership and the reporting of undisposed objects are not affected.
+ *
+ * Pooled allocation is opt-in. Message classes generated by the message
+ * compiler use it if they are annotated with the <tt>\@pooled</tt> property;
+ * the generated class then contains the following class-specific allocation
+ * functions, which are inherited by subclasses (and are also used by dup()):
+ *
+ * <pre>
+ * static void *operator new(size_t size) {return omnetpp::cMessagePool::allocate(size);}
+ * static void operator delete(void *p, size_t size) {omnetpp::cMessagePool::deallocate(p, size);}
+ * </pre>
+ *
+ * The same two lines can be added to hand-written message classes as well.
+ * The free lists are emptied when the network is deleted (see clear()).
+ *
+ * The free lists and the statistics are per thread, so simulations running
+ * concurrently in different threads do not need to lock each other out.
+ * A block released in a different thread than the one that allocated it
+ * (e.g. with parallel event execution) is put on the free list of the
+ * releasing thread. The free lists of a thread are emptied when it exits.
+ *
+ * @ingroup SimSupport
+ */
+class SIM_API cMessagePool
+{
+  public:
+    enum {
+        GRANULARITY = 16,       ///< Allocation sizes are rounded up to a multiple of this
+        MAX_POOLED_SIZE = 1024  ///< Larger objects are allocated directly from the C++ heap
+    };
+
+  private:
+    struct FreeBlock { FreeBlock *next; };
+    enum { NUM_SIZE_CLASSES = MAX_POOLED_SIZE / GRANULARITY };
+
+    static thread_local FreeBlock *freeLists[NUM_SIZE_CLASSES];
+    static thread_local long numBlocksInUse;
+    static thread_local long numFreeBlocks;
+    static thread_local long numReused;
+
+  private:
+    static size_t sizeClassOf(size_t size) {return size == 0 ? 0 : (size-1) / GRANULARITY;}
+    static void *allocateNew(size_t size);
+    static void ensureThreadCleanup();
+
+  public:
+    /** @name Allocation. */
+    //@{
+    /**
+     * Returns a memory block of at least the given size, preferably one
+     * that was previously released via deallocate().
+     */
+    static void *allocate(size_t size) {
+        size_t k = sizeClassOf(size);
+        if (k < NUM_SIZE_CLASSES && freeLists[k] != nullptr) {
+            FreeBlock *block = freeLists[k];
+            freeLists[k] = block->next;
+            numFreeBlocks--;
+            numBlocksInUse++;
+            numReused++;
+            return block;
+        }
+        return allocateNew(size);
+    }
+
+    /**
+     * Releases a memory block obtained from allocate(). The size must be
+     * the same as the one passed to allocate().
+     */
+    static void deallocate(void *p, size_t size) {
+        if (p == nullptr)
+            return;
+        size_t k = sizeClassOf(size);
+        numBlocksInUse--;
+        if (k < NUM_SIZE_CLASSES) {
+            FreeBlock *block = static_cast<FreeBlock *>(p);
+            block->next = freeLists[k];
+            freeLists[k] = block;
+            if (numFreeBlocks++ == 0)
+                ensureThreadCleanup();
+        }
+        else {
+            ::operator delete(p);
+        }
+    }
+
+    /**
+     * Returns the memory blocks on the free lists of the calling thread to
+     * the C++ heap. Blocks currently in use are not affected. This method is
+     * invoked by the simulation kernel after the network has been deleted.
+     */
+    static void clear();
+    //@}
+
+    /** @name Statistics. */
+    //@{
+    /**
+     * Returns the number of blocks allocated from the pool minus the number
+     * of blocks released to it in the calling thread, i.e. the number of live
+     * objects that use pooled allocation if only one thread is involved.
+     */
+    static long getNumBlocksInUse() {return numBlocksInUse;}
+
+    /**
+     * Returns the number of blocks on the free lists of the calling thread,
+     * waiting to be reused.
+     */
+    static long getNumFreeBlocks() {return numFreeBlocks;}
+
+    /**
+     * Returns the number of allocations in the calling thread that were
+     * served from the free lists.
+     */
+    static long getNumReused() {return numReused;}
+    //@}
+};
+
+}  // namespace omnetpp
+
+
+#endif
+
@@ -260,10 +260,6 @@ class SIM_API cModule : public cComponent //implies noncopyable
         ChannelIterator operator--(int) {ChannelIterator tmp(*this); if (!end()) retreat(); return tmp;}
     };
 
-  private:
-    static std::string lastModuleFullPath; // cached result of last getFullPath() call
-    static const cModule *lastModuleFullPathModule; // module of lastModuleFullPath
-
   private:
     enum {
         FL_BUILDINSIDE_CALLED = 1 << 11, // whether buildInside() has been called
@@ -290,6 +286,13 @@ class SIM_API cModule : public cComponent //implies noncopyable
     int gateDescArraySize;    // size of the descv array
     cGate::Desc *gateDescArray; // array with one element per gate or gate vector
 
+    // hash indexes for getSubmodule() and findGateDesc(), only built for modules
+    // with many submodules/gates (see cmodule.cc); nullptr when not in use
+    struct SubmoduleIndex;
+    struct GateDescIndex;
+    mutable SubmoduleIndex *submoduleIndex;
+    mutable GateDescIndex *gateDescIndex;
+
     int vectorIndex;      // index if module vector, 0 otherwise
     int vectorSize;       // vector size, -1 if not a vector
 #ifdef USE_OMNETPP4x_FINGERPRINTS
@@ -364,6 +367,14 @@ class SIM_API cModule : public cComponent //implies noncopyable
     // internal: like findGateDesc(), but throws an error if the gate does not exist
     cGate::Desc *gateDesc(const char *gatename, char& suffix) const;
 
+    // internal: maintenance of the submodule and gate desc hash indexes
+    void buildSubmoduleIndex() const;
+    void addToSubmoduleIndex(cModule *submodule);
+    void removeFromSubmoduleIndex(cModule *submodule);
+    void discardSubmoduleIndex() const;
+    void buildGateDescIndex() const;
+    void discardGateDescIndex() const;
+
     // internal: helper for setGateSize()
     void adjustGateDesc(cGate *g, cGate::Desc *newvec);
 
@@ -382,8 +393,10 @@ class SIM_API cModule : public cComponent //implies noncopyable
     int getVersion4ModuleId() const { return version4ModuleId; }
 #endif
 
-    // internal: may only be called between simulations, when no modules exist
-    static void clearNamePools();
+    // internal: the name pools are shared by all simulations in the process; they are
+    // acquired on network setup, and released (cleared when no longer used) on network deletion
+    static void acquireNamePools();
+    static void releaseNamePools();
 
     // internal utility function. Takes O(n) time as it iterates on the gates
     int gateCount() const;
@@ -601,6 +614,8 @@ class SIM_API cModule : public cComponent //implies noncopyable
      * Finds a direct submodule with the given name and index, and returns
      * its module ID. If the submodule was not found, returns -1. Index
      * must be specified exactly if the module is member of a module vector.
+     * In compound modules with many submodules, the lookup uses a hash
+     * index, so its cost does not depend on the number of submodules.
      */
     virtual int findSubmodule(const char *name, int index=-1) const;
 
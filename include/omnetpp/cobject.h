@@ -102,7 +102,7 @@ class SIM_API cObject
   protected:
 #ifdef SIMFRONTEND_SUPPORT
     // internal
-    static int64_t changeCounter;
+    static thread_local int64_t changeCounter;
 #endif
 
     // internal
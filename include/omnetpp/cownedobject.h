@@ -112,18 +112,34 @@ class SIM_API cOwnedObject : public cNamedObject
     cObject *owner;    // owner pointer
     unsigned int pos;  // used only when owner is a cDefaultOwner
 
+    // value of pos if the object is owned by a cDefaultOwner which does not
+    // keep a list of its objects (see cDefaultOwner::setOwnershipTracking())
+    enum : unsigned int {POS_UNTRACKED = ~0u};
+
   private:
     // list in which objects are accumulated if there is no simple module in context
-    // (see also setDefaultOwner() and cSimulation::setContextModule())
-    static cDefaultOwner *defaultOwner;
+    // (see also setDefaultOwner() and cSimulation::setContextModule()); nullptr means
+    // the thread's defaultList. Thread-local, like the active simulation.
+    static thread_local cDefaultOwner *defaultOwner;
 
-    // global variables for statistics
-    static long totalObjectCount;
-    static long liveObjectCount;
+    // per-thread variables for statistics
+    static thread_local long totalObjectCount;
+    static thread_local long liveObjectCount;
 
   private:
     void copy(const cOwnedObject& obj);
 
+    // asks the owner to yield ownership; untracked objects are simply
+    // detached, as their owner may no longer exist
+    void releaseFromOwner(cObject *newOwner) {
+        if (pos == POS_UNTRACKED) {
+            owner = newOwner;
+            pos = 0;
+        }
+        else
+            owner->yieldOwnership(this, newOwner);
+    }
+
   public:
     // internal
     virtual void removeFromOwnershipTree();
@@ -205,8 +221,9 @@ class SIM_API cOwnedObject : public cNamedObject
     /** @name Statistics. */
     //@{
     /**
-     * Returns the total number of objects created since the start of the program
-     * (or since the last reset). The counter is incremented by cOwnedObject constructor.
+     * Returns the total number of objects created by the calling thread since
+     * its start (or since the last reset). The counter is incremented by
+     * cOwnedObject constructor.
      * Counter is <tt>signed</tt> to make it easier to detect if it overflows
      * during very long simulation runs.
      * May be useful for profiling or debugging memory leaks.
@@ -214,9 +231,9 @@ class SIM_API cOwnedObject : public cNamedObject
     static long getTotalObjectCount() {return totalObjectCount;}
 
     /**
-     * Returns the number of objects that currently exist in the program.
-     * The counter is incremented by cOwnedObject constructor and decremented by
-     * the destructor.
+     * Returns the number of objects that currently exist in the program, as
+     * counted by the calling thread. The counter is incremented by cOwnedObject
+     * constructor and decremented by the destructor.
      * May be useful for profiling or debugging memory leaks.
      */
     static long getLiveObjectCount() {return liveObjectCount;}
@@ -108,6 +108,10 @@ class SIM_API cPacket : public cMessage
     // internal: only to be used by test cases
     int getShareCount() const {return shareCount;}
 
+    // internal: see cMessage; the encapsulated packets are handed over as well
+    virtual void leaveSimulation() override;
+    virtual void enterSimulation() override;
+
   public:
     /** @name Constructors, destructor, assignment */
     //@{
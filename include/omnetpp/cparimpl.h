@@ -60,9 +60,9 @@ class SIM_API cParImpl : public cNamedObject
     // base directory for interpreting relative path names in the expression (e.g. xmldoc())
     const char *baseDirectory; // stringpooled
 
-    // global variables for statistics
-    static long totalParimplObjs;
-    static long liveParimplObjs;
+    // per-thread variables for statistics
+    static thread_local long totalParimplObjs;
+    static thread_local long liveParimplObjs;
 
   protected:
     static cStringPool stringPool;
@@ -75,6 +75,7 @@ class SIM_API cParImpl : public cNamedObject
 
   protected:
     cValue evaluate(cExpression *expr, cComponent *context) const;
+    void compileIfVolatile(cExpression *expr) const;
 
   public:
     /** @name Constructors, destructor, assignment. */
@@ -0,0 +1,237 @@
+//==========================================================================
+//  CPROFILER.H - part of
+//                     OMNeT++/OMNEST
+//            Discrete System Simulation in C++
+//
+//==========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_CPROFILER_H
+#define __OMNETPP_CPROFILER_H
+
+#include <cstdint>
+#include <vector>
+#include <map>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include "cobject.h"
+#include "simutil.h"
+#include "clistener.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define OMNETPP_PROFILER_RDTSC
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define OMNETPP_PROFILER_RDTSC
+#endif
+
+namespace omnetpp {
+
+class cComponent;
+class cModule;
+class cIListener;
+class cMessage;
+class cSimulation;
+
+/**
+ * @brief Collects CPU time and call counts per component and per message class.
+ *
+ * When a profiler is installed in the simulation (see cSimulation::setProfiler(),
+ * and the <tt>profiling</tt> configuration option), the simulation kernel
+ * reports the following to it: events (handleMessage() and activity() calls,
+ * from cSimulation::executeEvent()), method calls between components
+ * (Enter_Method()), and signal emissions (cComponent::emit()). The profiler
+ * accumulates per component the number of these calls and the time spent
+ * in them, and per message class the number of events and the time spent
+ * handling them.
+ *
+ * Time is measured by reading the CPU's time stamp counter where available,
+ * and with the monotonic clock elsewhere; ticks are converted to seconds
+ * using a calibration against the monotonic clock over the profiling period.
+ *
+ * The inclusive time of a component is the time spent in its events and
+ * method calls, including nested method calls into other components; the
+ * exclusive time excludes the latter. The emit time (the time spent in
+ * emit() calls of the component, including the listeners) is a part of the
+ * inclusive time.
+ *
+ * Subclasses may override the notification methods to do something else or
+ * in addition, e.g. recording a timeline. Calls to individual listeners
+ * are only reported (see listenerDone()) while listener notifications are
+ * enabled with setListenerNotificationsEnabled().
+ *
+ * Profiling is not compatible with parallel execution of same-timestamp
+ * events; events are executed sequentially while a profiler is installed.
+ *
+ * @see cSimulation::getProfiler()
+ * @ingroup SimSupport
+ */
+class SIM_API cProfiler : public cObject, noncopyable
+{
+  public:
+    /**
+     * Counters collected for a component or a message class.
+     */
+    struct Stats {
+        int64_t numEvents = 0;       ///< Number of events handled
+        int64_t numMethodCalls = 0;  ///< Number of Enter_Method() calls into the component
+        int64_t numEmits = 0;        ///< Number of emit() calls by the component
+        uint64_t inclusiveTicks = 0; ///< Ticks spent in events and method calls, including nested calls into other components
+        uint64_t exclusiveTicks = 0; ///< Ticks spent in events and method calls, excluding nested calls into other components
+        uint64_t emitTicks = 0;      ///< Ticks spent in emit() calls, including listeners
+    };
+
+  private:
+    struct Frame {
+        int componentId;
+        Stats *classStats;  // for events, nullptr for method calls
+        uint64_t startTicks;
+        uint64_t childTicks;
+    };
+
+    std::vector<Stats> componentStats;  // index: component ID
+    struct ClassStats {
+        std::string className;
+        Stats stats;
+    };
+
+    std::unordered_map<std::type_index, ClassStats> classStats;  // key: message class
+    std::vector<Frame> stack;
+    uint64_t startTicks;
+    int64_t startNsecs;
+    bool listenerNotificationsEnabled = false;
+
+  private:
+    Stats& getStatsFor(int componentId);
+    void push(int componentId, Stats *classStats);
+    void pop();
+
+  public:
+    /** @name Constructor, destructor. */
+    //@{
+    cProfiler();
+    virtual ~cProfiler() {}
+    //@}
+
+    /** @name Reading the clock. */
+    //@{
+    /**
+     * Returns the current value of the clock used for profiling, in ticks.
+     */
+    static uint64_t getTicks() {
+#ifdef OMNETPP_PROFILER_RDTSC
+        return __rdtsc();
+#else
+        return opp_get_monotonic_clock_nsecs();
+#endif
+    }
+
+    /**
+     * Converts a duration in ticks to seconds.
+     */
+    double ticksToSeconds(uint64_t ticks) const;
+    //@}
+
+    /** @name Notifications from the simulation kernel. */
+    //@{
+    /**
+     * Called before a message is delivered to its module.
+     */
+    virtual void beginEvent(cMessage *msg);
+
+    /**
+     * Called after the event started with beginEvent() has been handled,
+     * also when an exception was thrown.
+     */
+    virtual void endEvent() {pop();}
+
+    /**
+     * Called when Enter_Method() switches to the given component.
+     */
+    virtual void beginMethodCall(cComponent *component);
+
+    /**
+     * Called when the method call started with beginMethodCall() returns.
+     */
+    virtual void endMethodCall() {pop();}
+
+    /**
+     * Called when an emit() call of the given component returns; startTicks
+     * is the value of getTicks() at the beginning of the call.
+     */
+    virtual void emitDone(const cComponent *component, simsignal_t signalID, uint64_t startTicks);
+
+    /**
+     * Called when a listener returns from receiveSignal() during an emit()
+     * call of the given component, provided that listener notifications
+     * are enabled. startTicks is the value of getTicks() before the call.
+     * This default implementation does nothing.
+     */
+    virtual void listenerDone(cIListener *listener, const cComponent *component, simsignal_t signalID, uint64_t startTicks) {}
+
+    /**
+     * Returns true if listenerDone() should be called for each listener
+     * notified by emit() calls.
+     */
+    bool getListenerNotificationsEnabled() const {return listenerNotificationsEnabled;}
+
+    /**
+     * Enables or disables calling listenerDone(). Timing individual listener
+     * calls has some overhead, so it is disabled by default.
+     */
+    void setListenerNotificationsEnabled(bool enabled) {listenerNotificationsEnabled = enabled;}
+    //@}
+
+    /** @name Results. */
+    //@{
+    /**
+     * Returns the counters of the component with the given ID. Components
+     * that have not been profiled have all-zero counters.
+     */
+    const Stats& getComponentStats(int componentId) const;
+
+    /**
+     * Returns the counters of events, keyed by message class name.
+     */
+    std::map<std::string, Stats> getMessageClassStats() const;
+
+    /**
+     * Returns the total exclusive time of all components in ticks, i.e. the
+     * time spent in events so far.
+     */
+    uint64_t getTotalTicks() const;
+
+    /**
+     * Returns the IDs of at most n components with the largest exclusive time,
+     * in decreasing order.
+     */
+    std::vector<int> getHotComponents(int n) const;
+
+    /**
+     * Records the counters as scalars of the components of the given
+     * simulation that still exist, and the per-message-class counters as
+     * scalars of the network module. Called from cSimulation::callFinish().
+     */
+    virtual void recordResults(cSimulation *simulation);
+
+    /**
+     * Resets all counters.
+     */
+    virtual void clear();
+    //@}
+};
+
+}  // namespace omnetpp
+
+
+#endif
+
+
@@ -16,6 +16,7 @@
 #ifndef __OMNETPP_CQUEUE_H
 #define __OMNETPP_CQUEUE_H
 
+#include <vector>
 #include "cownedobject.h"
 
 namespace omnetpp {
@@ -28,7 +29,14 @@ namespace omnetpp {
  * using insert(), and remove them at the front using pop().
  *
  * cQueue may be set up to act as a priority queue. This requires the user to
- * supply a comparison function.
+ * supply a comparison function. Elements that compare equal are kept in FIFO
+ * order. In priority mode, the queue is maintained as a binary heap, so
+ * insert() and pop() take logarithmic time; the contents are only fully
+ * sorted when needed, e.g. when iterating over the queue or calling get().
+ * Sorting costs O(n log n), but the queue then stays sorted until an
+ * element is inserted out of order, so only the first such access after
+ * insertions pays for it. Code that alternates insert() with get() or
+ * iteration in priority mode should use front()/pop() instead where possible.
  *
  * Ownership of cOwnedObjects may be controlled by invoking setTakeOwnership()
  * prior to inserting objects. Objects that cannot track their ownership
@@ -42,13 +50,23 @@ namespace omnetpp {
 class SIM_API cQueue : public cOwnedObject
 {
   private:
-    struct QElem
+    struct Elem
     {
-        cObject *obj; // the contained object
-        QElem *prev;  // element towards the front of the queue
-        QElem *next;  // element towards the back of the queue
+        cObject *obj;   // the contained object
+        uint64_t seq;   // insertion sequence number, for keeping equal elements in FIFO order
     };
 
+    // Layout of the elements in the ring buffer. Without a comparator, it is
+    // always LINEAR. With a comparator, the queue is kept as a binary heap
+    // and only sorted on demand (e.g. for iteration); it falls back to LINEAR
+    // when the contents are no longer known to be ordered by the comparator
+    // (after insertBefore()/insertAfter() or changing the comparator).
+    enum Layout { LINEAR, SORTED, HEAP };
+
+    // for the element-level API below; a QElem pointer is only valid until
+    // the queue is next modified
+    typedef Elem QElem;
+
   public:
     /**
      * @brief Base class for object comparators, used by cQueue for
@@ -77,11 +95,23 @@ class SIM_API cQueue : public cOwnedObject
 
     /**
      * @brief Walks along a cQueue.
+     *
+     * The iterator tolerates the removal of the current object from the
+     * queue during iteration: the next increment or decrement continues
+     * with the neighbor of the removed object.
+     *
+     * In priority mode, creating or advancing the iterator sorts the queue
+     * if elements have been inserted since the last sorting (see cQueue).
      */
     class SIM_API Iterator
     {
       private:
-        QElem *p;
+        const cQueue *q;
+        int pos;      // position in the queue
+        cObject *obj; // the object at pos when last checked
+
+      private:
+        void advance(int delta);
 
       public:
         /**
@@ -94,60 +124,73 @@ class SIM_API cQueue : public cOwnedObject
         /**
          * Reinitializes the iterator object.
          */
-        void init(const cQueue& q, bool reverse=false) {p = reverse ? q.backp : q.frontp;}
+        void init(const cQueue& q, bool reverse=false);
 
         /**
          * Returns the current object.
          */
-        cObject *operator*() const {return p ? p->obj : nullptr;}
+        cObject *operator*() const {return obj;}
 
         /**
          * Returns true if the iterator has reached either end of the queue.
          */
-        bool end() const {return p == nullptr;}
+        bool end() const {return obj == nullptr;}
 
         /**
          * Prefix increment operator (++it). Moves the iterator to the next object
          * in the queue. It has no effect if the iterator has reached either
          * end of the queue.
          */
-        Iterator& operator++() {if (!end()) p = p->next; return *this;}
+        Iterator& operator++() {if (!end()) advance(1); return *this;}
 
         /**
          * Postfix increment operator (it++). Moves the iterator to the next object
          * in the queue, and returns the iterator's previous state. It has
          * no effect if the iterator has reached either end of the queue.
          */
-        Iterator operator++(int) {Iterator tmp(*this); if (!end()) p = p->next; return tmp;}
+        Iterator operator++(int) {Iterator tmp(*this); if (!end()) advance(1); return tmp;}
 
         /**
          * Prefix decrement operator (--it). Moves the iterator to the previous object
          * in the queue. It has no effect if the iterator has reached either
          * end of the queue.
          */
-        Iterator& operator--() {if (!end()) p = p->prev; return *this;}
+        Iterator& operator--() {if (!end()) advance(-1); return *this;}
 
         /**
          * Postfix decrement operator (it--). Moves the iterator to the previous object
          * in the queue, and returns the iterator's previous state. It has
          * no effect if the iterator has reached either end of the queue.
          */
-        Iterator operator--(int) {Iterator tmp(*this); if (!end()) p = p->prev; return tmp;}
+        Iterator operator--(int) {Iterator tmp(*this); if (!end()) advance(-1); return tmp;}
     };
 
     friend class Iterator;
 
   private:
     bool takeOwnership = true;
-    QElem *frontp = nullptr, *backp = nullptr;  // front and back pointers
+    mutable std::vector<Elem> elems;  // ring buffer; its size is zero or a power of two
+    mutable int head = 0;  // position of the front element in elems[]
     int len = 0;  // number of items in the queue
+    mutable Layout layout = LINEAR;
+    uint64_t lastSeq = 0;
     Comparator *comparator = nullptr; // comparison functor; nullptr for FIFO
 
   private:
     void copy(const cQueue& other);
+    Elem& at(int i) const {return elems[(head + i) & (elems.size() - 1)];}
+    bool less(const Elem& a, const Elem& b) const;
+    void grow();
+    void siftUp(int i);
+    void siftDown(int i);
+    void ensureOrdered() const;
+    int indexOf(QElem *p) const {return (p - elems.data() - head) & (elems.size() - 1);}
 
   protected:
     // internal functions
+    int findIndex(cObject *obj) const;
+    void insertAt(int i, cObject *obj);
+    cObject *removeAt(int i);
     QElem *find_qelem(cObject *obj) const;
     void insbefore_qelem(QElem *p, cObject *obj);
     void insafter_qelem(QElem *p, cObject *obj);
@@ -316,8 +359,9 @@ class SIM_API cQueue : public cOwnedObject
 
     /**
      * Returns the ith element in the queue, or nullptr if i is out of range.
-     * get(0) returns the front element. This method performs linear
-     * search.
+     * get(0) returns the front element. In priority mode, this sorts the
+     * queue contents if elements have been inserted since the last sorting
+     * (see cQueue); subsequent calls take constant time.
      */
     virtual cObject *get(int i) const;
 
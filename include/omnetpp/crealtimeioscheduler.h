@@ -0,0 +1,146 @@
+//=========================================================================
+//  CREALTIMEIOSCHEDULER.H - part of
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_CREALTIMEIOSCHEDULER_H
+#define __OMNETPP_CREALTIMEIOSCHEDULER_H
+
+#include <map>
+#include <unordered_map>
+#include "cscheduler.h"
+#include "cstddev.h"
+
+#ifdef __linux__
+
+namespace omnetpp {
+
+class cModule;
+class cMessage;
+
+/**
+ * @brief Real-time scheduler that also waits for input on file descriptors,
+ * for hardware-in-the-loop simulation and emulation.
+ *
+ * It synchronizes the simulation to real time like cRealTimeScheduler
+ * (including the realtimescheduler-scaling setting), but instead of sleeping
+ * until the next event, it waits on an epoll set of file descriptors that
+ * modules register with addFd(): sockets, pipes, timerfd, eventfd, character
+ * devices, etc. When a registered file descriptor becomes readable, the
+ * scheduler inserts the notification message given in addFd() into the FES
+ * with the current (real) time as arrival time, and the module can then
+ * read the data in handleMessage(). The file descriptor is not watched again
+ * until the notification message has been delivered, so there is no busy
+ * waiting. The wait for the next event uses a timerfd with nanosecond
+ * resolution.
+ *
+ * \code
+ * void MyInterfaceModule::initialize()
+ * {
+ *     notificationMsg = new cMessage("dataAvailable");
+ *     auto scheduler = check_and_cast<cRealTimeIOScheduler *>(getSimulation()->getScheduler());
+ *     scheduler->addFd(sockFd, this, notificationMsg);
+ * }
+ * \endcode
+ *
+ * If the simulation falls behind real time, events are executed as fast as
+ * possible until it catches up, and registered file descriptors are polled
+ * before each event. The lateness of events (real time at execution minus
+ * the target real time of the event, or 0 if it was on time) is collected,
+ * and recorded at the end of the run as the `realtimeLateness` statistic
+ * and the `realtimeLateEvents` scalar of the network module.
+ *
+ * Only available on Linux.
+ *
+ * @ingroup SimSupport
+ */
+class SIM_API cRealTimeIOScheduler : public cRealTimeScheduler
+{
+  protected:
+    struct Registration {
+        cModule *module;
+        cMessage *notificationMsg;
+    };
+
+    int epollFd = -1;
+    int timerFd = -1;
+    std::map<int,Registration> registrations;  // key: fd
+    std::unordered_map<const cEvent *,int> fdByMessage;  // notification message -> fd
+
+    // lateness statistics
+    cStdDev *lateness = nullptr;
+    int64_t numLateEvents = 0;
+
+  protected:
+    virtual void startRun() override;
+    virtual void endRun() override;
+    virtual void lifecycleEvent(SimulationLifecycleEventType eventType, cObject *details) override;
+    virtual int waitForInput(int64_t targetTime);
+    virtual int processReadyFds(int timeoutMillis, bool& timerExpired);
+    virtual void injectNotification(int fd);
+    virtual void armFd(int fd, bool add);
+    virtual void recordLateness();
+    void closeFds();
+
+  public:
+    /**
+     * Constructor.
+     */
+    cRealTimeIOScheduler();
+
+    /**
+     * Destructor.
+     */
+    virtual ~cRealTimeIOScheduler();
+
+    /**
+     * Returns a description that depends on the parametrization of this class.
+     */
+    virtual std::string str() const override;
+
+    /**
+     * Registers a file descriptor. When it becomes readable, notificationMsg
+     * is delivered to the given module. The message must remain owned by
+     * the module, and must not be scheduled by the module itself. The file
+     * descriptor is watched again after the message has been delivered;
+     * if data is still available by then, the message is delivered again.
+     * May be called from initialize() or later.
+     */
+    virtual void addFd(int fd, cModule *module, cMessage *notificationMsg);
+
+    /**
+     * Removes a registered file descriptor. It does not close the file
+     * descriptor, and does not cancel the notification message if it is
+     * already scheduled.
+     */
+    virtual void removeFd(int fd);
+
+    /**
+     * Returns the lateness statistics collected so far, or nullptr if
+     * the run has not been started yet.
+     */
+    const cStdDev *getLatenessStatistics() const {return lateness;}
+
+    /**
+     * Scheduler function: waits until the real time reaches the time of
+     * the first event in the FES, or a registered file descriptor becomes
+     * readable, whichever happens first.
+     */
+    virtual cEvent *takeNextEvent() override;
+};
+
+}  // namespace omnetpp
+
+#endif
+
+#endif
+
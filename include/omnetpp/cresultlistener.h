@@ -63,6 +63,18 @@ class SIM_API cResultListener : public cObject, public cIListener
         virtual void unsubscribedFrom(cComponent *component, simsignal_t signalID) override;
         virtual void finish(cComponent *component, simsignal_t signalID) override;
 
+    public:
+        /**
+         * Packs the state of the listener (counters, last values, etc.) when
+         * a checkpoint of the simulation is written. This default implementation
+         * packs nothing; stateful filters and recorders redefine it.
+         */
+        virtual void parsimPack(cCommBuffer *buffer) const override {}
+
+        /**
+         * Restores the state saved with parsimPack().
+         */
+        virtual void parsimUnpack(cCommBuffer *buffer) override {}
 };
 
 }  // namespace omnetpp
@@ -192,6 +192,8 @@ class SIM_API cSimpleModule : public cModule //implies noncopyable
     friend class cModule;
     friend class cSimulation;
     friend class cMessage;
+    friend class cCoroutineModule;
+    friend class ParallelEventExecutor;
 
   private:
     enum {
@@ -199,14 +201,16 @@ class SIM_API cSimpleModule : public cModule //implies noncopyable
         FL_ISTERMINATED        = 1 << 15, // for both activity and handleMessage modules
         FL_STACKALREADYUNWOUND = 1 << 16, // only for activity modules
         FL_SUPPORTSTXUPDATES   = 1 << 17, // whether module is prepared to receive tx updates (see SendOptions)
+        FL_PARALLEL_CHECKED    = 1 << 18, // whether the FL_PARALLEL flag is valid
+        FL_PARALLEL            = 1 << 19, // whether the module has the @parallel NED property (see isParallel())
     };
 
     cMessage *timeoutMessage;   // msg used in wait() and receive() with timeout
     cCoroutine *coroutine;
 
-    static cMessage *msgForActivity; // helper variable to pass the received message into activity()
-    static bool stackCleanupRequested; // 'true' value asks activity() to throw a cStackCleanupException
-    static cSimpleModule *afterCleanupTransferTo; // transfer back to this module (or to main)
+    static thread_local cMessage *msgForActivity; // helper variable to pass the received message into activity()
+    static thread_local bool stackCleanupRequested; // 'true' value asks activity() to throw a cStackCleanupException
+    static thread_local cSimpleModule *afterCleanupTransferTo; // transfer back to this module (or to main)
 
   private:
     // internal use
@@ -335,6 +339,17 @@ class SIM_API cSimpleModule : public cModule //implies noncopyable
      * or returning from the activity() method.
      */
     bool isTerminated() const {return flags&FL_ISTERMINATED;}
+
+    /**
+     * Returns true if the module has the @parallel NED property. When
+     * same-timestamp events are executed in parallel (see the
+     * parallel-event-threads configuration option), only the events of such
+     * modules are executed in parallel with each other. By giving the property,
+     * the module promises that its handleMessage() only uses the operations
+     * allowed during parallel execution (see the manual), and only accesses
+     * the state of its own module.
+     */
+    bool isParallel() const;
     //@}
 
     /** @name Debugging aids. */
@@ -528,7 +543,10 @@ class SIM_API cSimpleModule : public cModule //implies noncopyable
     /**
      * Equivalent to scheduleAt(simtime_t t, cMessage *msg), except that
      * if the message is currently scheduled, the method cancels it before
-     * scheduling it again.
+     * scheduling it again. The effect (including the event log and the
+     * fingerprint) is the same as that of cancelEvent() followed by
+     * scheduleAt(), but the message is moved to its new place in the
+     * future events in one step, using cFutureEventSet::reschedule().
      *
      * @see scheduleAt(), cancelEvent(), cMessage::isScheduled()
      */
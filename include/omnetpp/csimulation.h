@@ -37,11 +37,14 @@ class cScheduler;
 class cParsimPartition;
 class cNedFileLoader;
 class cFingerprintCalculator;
+class cProfiler;
 class cModuleType;
 class cEnvir;
 class cDefaultOwner;
+class cCommBuffer;
+class ParallelEventExecutor;
 
-SIM_API extern cDefaultOwner defaultList; // also in globals.h
+SIM_API extern thread_local cDefaultOwner defaultList; // also in globals.h
 
 
 /**
@@ -61,11 +64,16 @@ SIM_API extern cDefaultOwner defaultList; // also in globals.h
  */
 class SIM_API cSimulation : public cNamedObject, noncopyable
 {
+    friend class cModule;
     friend class cSimpleModule;
+    friend class cMessage;
+    friend class cComponent;
+    friend class cGate;
+    friend class ParallelEventExecutor;
   private:
-    // global variables
-    static cSimulation *activeSimulation;
-    static cEnvir *activeEnvir;
+    // global variables; the thread-local ones allow independent simulations to run on different threads
+    static thread_local cSimulation *activeSimulation;
+    static thread_local cEnvir *activeEnvir; // nullptr means staticEnvir
     static cEnvir *staticEnvir; // the environment to activate when activeSimulation becomes nullptr
 
     // variables of the module vector
@@ -96,6 +104,20 @@ class SIM_API cSimulation : public cNamedObject, noncopyable
     bool trapOnNextEvent;  // when set, next handleMessage or activity() will execute debugger interrupt
 
     cFingerprintCalculator *fingerprint; // used for fingerprint calculation
+    cProfiler *profiler = nullptr; // used for profiling (optional)
+
+    // state of other classes that belongs to the simulation and not to the process
+    long nextMessageId = 0;     // the next unique message identifier (see cMessage::getId())
+    long totalMessageCount = 0; // see cMessage::getTotalMessageCount()
+    long liveMessageCount = 0;  // see cMessage::getLiveMessageCount()
+    int lastConnectionId = -1;  // see cGate::getConnectionId()
+    std::string lastModuleFullPath; // cached result of the last cModule::getFullPath() call
+    const cModule *lastModuleFullPathModule = nullptr; // module of lastModuleFullPath
+    cComponent::SignalState signalState; // listener counts, signal statistics, etc.
+
+    int parallelEventThreads; // number of threads for executing same-timestamp events; 1 means sequential execution
+    ParallelEventExecutor *parallelEventExecutor; // created on demand
+    bool parallelEventBatchActive = false; // true while the handlers of a batch of events are running in parallel
 
   private:
     // internal
@@ -134,6 +156,10 @@ class SIM_API cSimulation : public cNamedObject, noncopyable
     //@{
     /**
      * Returns the active simulation object. May be nullptr.
+     *
+     * The active simulation is a per-thread setting, so an application
+     * may run several simulations concurrently, each on its own thread.
+     * On a newly started thread, there is no active simulation.
      */
     static cSimulation *getActiveSimulation()  {return activeSimulation;}
 
@@ -141,18 +167,20 @@ class SIM_API cSimulation : public cNamedObject, noncopyable
      * Returns the environment object for the active simulation. Never returns nullptr;
      * setActiveSimulation(nullptr) will cause a static "do-nothing" instance to step in.
      */
-    static cEnvir *getActiveEnvir()  {return activeEnvir;}
+    static cEnvir *getActiveEnvir()  {return activeEnvir ? activeEnvir : staticEnvir;}
 
     /**
      * Activate the given simulation object, and its associated environment
-     * object. nullptr is also accepted; it will cause the static environment
-     * object to step in (see getStaticEnvir()).
+     * object, in the calling thread. nullptr is also accepted; it will cause
+     * the static environment object to step in (see getStaticEnvir()).
+     * A simulation object must not be used by more than one thread at a time.
      */
     static void setActiveSimulation(cSimulation *sim);
 
     /**
      * Sets the environment object to use when there is no active simulation object.
-     * The argument cannot be nullptr.
+     * The argument cannot be nullptr. Unlike the active simulation, this setting
+     * is shared by all threads.
      */
     static void setStaticEnvir(cEnvir *env);
 
@@ -334,6 +362,23 @@ class SIM_API cSimulation : public cNamedObject, noncopyable
      */
     cFutureEventSet *getFES() const  {return fes;}
 
+    /**
+     * Sets the number of threads used for executing events that have the same
+     * arrival time and priority, and are targeted at different simple modules
+     * whose NED type has the @parallel property. The value 1 means sequential
+     * execution, and 0 means one thread per CPU core. Parallel execution
+     * produces the same results as sequential execution, provided that the
+     * @parallel modules obey the restrictions described in the manual
+     * (see also the "parallel-event-threads" configuration option).
+     */
+    void setParallelEventThreads(int numThreads);
+
+    /**
+     * Returns the number of threads used for executing same-timestamp events.
+     * See setParallelEventThreads().
+     */
+    int getParallelEventThreads() const  {return parallelEventThreads;}
+
     /**
      * Sets the simulation stop time be scheduling an appropriate
      * "end-simulation" event. May only be called once per run.
@@ -363,6 +408,26 @@ class SIM_API cSimulation : public cNamedObject, noncopyable
      * all modules and deleting the messages in the scheduled-event list.
      */
     void deleteNetwork();
+
+    /**
+     * Packs the state of the simulation into the buffer, as part of writing
+     * a checkpoint: simulation time, event number, the contents of the future
+     * events set, parameter values, the state of result filters and recorders,
+     * the fingerprint, and whatever the components save in their
+     * cComponent::packCheckpoint() methods. May only be called between events.
+     * Throws an error if the state cannot be saved, e.g. because a module
+     * uses activity(), or a scheduled message cannot be packed.
+     */
+    void packCheckpoint(cCommBuffer *buffer);
+
+    /**
+     * Restores a state saved by packCheckpoint(). The same network must have
+     * been set up and initialized (via callInitialize()) before calling this
+     * method. Throws an error if the network does not match the checkpoint,
+     * for example because modules were created or deleted dynamically
+     * before the checkpoint was written.
+     */
+    void unpackCheckpoint(cCommBuffer *buffer);
     //@}
 
     /** @name Information about the current simulation run. */
@@ -397,7 +462,10 @@ class SIM_API cSimulation : public cNamedObject, noncopyable
 
     /**
      * Returns the sequence number of current event. Between events it returns
-     * the sequence number of the next event.
+     * the sequence number of the next event. During parallel event execution
+     * (see isParallelEventBatchActive()), the handlers of the batch see the
+     * number of the event preceding the batch; the events get their own
+     * numbers when their operations are committed.
      */
     eventnumber_t getEventNumber() const  {return currentEventNumber;}
 
@@ -486,6 +554,14 @@ class SIM_API cSimulation : public cNamedObject, noncopyable
      */
     void insertEvent(cEvent *event);
 
+    /**
+     * Variant of insertEvent(cEvent*) for an event that is already in the
+     * future events queue: moves it to arrival time t in one step (see
+     * cFutureEventSet::reschedule()), as if it had been removed and inserted
+     * again. Used internally by cSimpleModule::rescheduleAt().
+     */
+    void insertEvent(cEvent *event, simtime_t t);
+
     /**
      * Sets the component (module or channel) in context. Used internally.
      */
@@ -510,6 +586,9 @@ class SIM_API cSimulation : public cNamedObject, noncopyable
 
     /**
      * Returns the component (module or channel) currently in context.
+     * During parallel event execution (see isParallelEventBatchActive()),
+     * the context stays global, i.e. this method returns nullptr in the
+     * handlers; use getContextModule() instead.
      */
     cComponent *getContext() const {return contextComponent;}
 
@@ -524,7 +603,8 @@ class SIM_API cSimulation : public cNamedObject, noncopyable
 
     /**
      * If the current context is a module, returns its pointer,
-     * otherwise returns nullptr.
+     * otherwise returns nullptr. During parallel event execution, it returns
+     * the module of the event being executed by the calling thread.
      */
     cModule *getContextModule() const;
 
@@ -554,6 +634,18 @@ class SIM_API cSimulation : public cNamedObject, noncopyable
     bool isTrapOnNextEventRequested() const {return trapOnNextEvent;}
     //@}
 
+    /** @name Parallel execution of same-timestamp events. */
+    //@{
+    /**
+     * Returns true while the handleMessage() methods of a batch of
+     * same-timestamp events are running in parallel (see
+     * setParallelEventThreads()). The simulation library uses it to buffer
+     * the operations of the handlers that affect shared state, and to reject
+     * the ones that are not allowed in @parallel modules.
+     */
+    bool isParallelEventBatchActive() const {return parallelEventBatchActive;}
+    //@}
+
     /** @name Miscellaneous. */
     //@{
     /**
@@ -581,9 +673,37 @@ class SIM_API cSimulation : public cNamedObject, noncopyable
      * Installs a new fingerprint object, used for fingerprint calculation.
      */
     void setFingerprintCalculator(cFingerprintCalculator *fingerprint);
+
+    /**
+     * Returns the profiler that collects CPU time per component and message
+     * class. It returns nullptr if profiling is off for this simulation run.
+     */
+    cProfiler *getProfiler() const {return profiler;}
+
+    /**
+     * Installs a new profiler (the old one is deleted), or turns off profiling
+     * if the argument is nullptr. The simulation object takes ownership of the
+     * profiler. The profiler's results are recorded in callFinish().
+     * This method must not be called while an event is being executed.
+     */
+    void setProfiler(cProfiler *profiler);
     //@}
 };
 
+// cComponent methods that need the definition of cSimulation
+inline cComponent::SignalState& cComponent::getSignalState()
+{
+    return cSimulation::getActiveSimulation()->signalState;
+}
+
+inline bool cComponent::mayHaveListeners(simsignal_t signalID) const
+{
+    if (signalID < 0 || signalID > lastSignalID)
+        throwInvalidSignalID(signalID);
+    const std::vector<int>& listenerCounts = getSignalState().listenerCounts;
+    return signalID < (int)listenerCounts.size() && listenerCounts[signalID] > 0;
+}
+
 /**
  * @brief Returns the current simulation time.
  *
@@ -19,6 +19,7 @@
 #include <cstring>
 #include <string>
 #include <map>
+#include <mutex>
 #include "simkerneldefs.h"
 
 namespace omnetpp {
@@ -29,6 +30,7 @@ namespace omnetpp {
  * The purpose of this class is to allow saving memory on the storage of
  * (largely) constant strings that occur in many instances during runtime:
  * module names, gate names, property names, keys and values, etc.
+ * The methods are thread-safe.
  *
  * @see cNamedObject::cNamedObject, cNamedObject::setNamePooling()
  * @ingroup internals
@@ -46,6 +48,7 @@ class cStringPool
     std::string name;
     typedef std::map<char *,int,strless> StringIntMap;
     StringIntMap pool; // map<string,refcount>
+    mutable std::mutex mutex;
     bool alive; // useful when stringpool is a global variable
 
   public:
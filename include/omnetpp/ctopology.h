@@ -337,12 +337,20 @@ class SIM_API cTopology : public cOwnedObject
     std::vector<Node*> nodes;
     Node *target;
 
+    // results of the all-pairs shortest path algorithms
+    int numAllPairsNodes = 0;
+    std::vector<int> nextHopTable;      // [nodeIndex*numAllPairsNodes + targetIndex]: index of the out link, or -1
+    std::vector<double> distanceTable;  // same layout; empty if distances were not requested
+
     // note: the purpose of the (unsigned int) cast is that nodes with moduleId==-1 are inserted at the end of the vector
     static bool lessByModuleId(Node *a, Node *b) { return (unsigned int)a->moduleId < (unsigned int)b->moduleId; }
     static bool isModuleIdLess(Node *a, int moduleId) { return (unsigned int)a->moduleId < (unsigned int)moduleId; }
 
     void unlinkFromSourceNode(Link *link);
     void unlinkFromDestNode(Link *link);
+    int findNodeIndex(Node *node) const;
+    void discardAllPairsShortestPaths() {numAllPairsNodes = 0; nextHopTable.clear(); distanceTable.clear();}
+    void calculateAllPairsShortestPaths(bool weighted, bool storeDistances, int numThreads);
 
   public:
     /** @name Constructors, destructor, assignment */
@@ -573,6 +581,72 @@ class SIM_API cTopology : public cOwnedObject
     virtual Node *getTargetNode() const {return target;}
     //@}
 
+    /** @name All-pairs shortest paths.
+     *
+     * These functions calculate the shortest paths from all nodes to all
+     * nodes. For each (node, target) pair, they store the next hop, i.e. the
+     * index of the out link of the node that starts the shortest path. This
+     * makes a table of 4*n*n bytes for n nodes, and an additional 8*n*n bytes
+     * if distances are also requested. The paths are the same as the ones
+     * found by the corresponding ...SingleShortestPathsTo() function.
+     *
+     * The results are kept until the next all-pairs calculation or until the
+     * graph is changed via addNode(), deleteNode(), addLink(), deleteLink()
+     * or clear(). Enabling or disabling nodes and links does not update them.
+     */
+    //@{
+
+    /**
+     * Calculates the unweighted shortest paths between all pairs of nodes.
+     * The targets are distributed among numThreads threads; 0 means one
+     * thread per CPU core.
+     */
+    virtual void calculateUnweightedAllPairsShortestPaths(bool storeDistances=false, int numThreads=0);
+
+    /**
+     * Calculates the weighted shortest paths between all pairs of nodes,
+     * using weights in nodes and links. The targets are distributed among
+     * numThreads threads; 0 means one thread per CPU core.
+     */
+    virtual void calculateWeightedAllPairsShortestPaths(bool storeDistances=false, int numThreads=0);
+
+    /**
+     * Returns true if the results of an all-pairs shortest path calculation
+     * are available.
+     */
+    bool hasAllPairsShortestPaths() const {return numAllPairsNodes > 0;}
+
+    /**
+     * Returns the index of the out link of the node with the given index
+     * (see getNode(int)) that starts the shortest path towards the target
+     * node with the given index, or -1 if the target is not reachable or
+     * it is the node itself.
+     */
+    int getNextHopIndex(int nodeIndex, int targetIndex) const;
+
+    /**
+     * Returns the out link of the given node that starts the shortest path
+     * towards the given target node, or nullptr if the target is not
+     * reachable or it is the node itself.
+     */
+    virtual LinkOut *getNextHop(Node *node, Node *target);
+
+    /**
+     * Returns the distance of the given node to the given target node.
+     * It is an error to call this function if distances were not requested.
+     */
+    virtual double getDistance(Node *node, Node *target);
+
+    /**
+     * Sets up the shortest path information of all nodes (see
+     * Node::getDistanceToTarget() and Node::getPath()) towards the given
+     * target from the all-pairs results, with the same result as the
+     * corresponding ...SingleShortestPathsTo() function would produce.
+     * It requires that distances were also stored.
+     */
+    virtual void selectShortestPathsTo(Node *target);
+    //@}
+
   protected:
     /**
      * Node factory.
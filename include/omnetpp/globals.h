@@ -36,9 +36,9 @@ SIM_API extern cGlobalRegistrationList resultRecorders; ///< List of result reco
 SIM_API extern cGlobalRegistrationList messagePrinters; ///< List of message printers (cMessagePrinter)
 SIM_API extern std::map<std::string,std::string> figureTypes; ///< Maps figure type names to implementation C++ class names (index into "classes")
 
-// Internal: list in which objects are accumulated if there is no simple module in context.
+// Internal: list in which objects are accumulated if there is no simple module in context (one per thread).
 // @see cOwnedObject::setDefaultOwner() and cSimulation::setContextModule())
-SIM_API extern cDefaultOwner defaultList;
+SIM_API extern thread_local cDefaultOwner defaultList;
 
 // Internal: Support for embedding NED files as string constants
 struct EmbeddedNedFile
@@ -79,5 +79,13 @@
 #  endif
 #endif
 
+// POSIX coroutines: on x86-64 and AArch64, switch contexts with a short
+// assembly routine instead of swapcontext(), which also saves and restores
+// the signal mask (i.e. makes a system call on every switch).
+// Define USE_POSIX_SWAPCONTEXT to use swapcontext() anyway.
+#if defined(USE_POSIX_COROUTINES) && !defined(USE_POSIX_SWAPCONTEXT) && defined(__GNUC__) && (defined(__x86_64__) || defined(__aarch64__))
+#  define USE_FAST_CONTEXT_SWITCH
+#endif
+
 #endif
 
@@ -61,6 +61,8 @@ class SIM_API TotalCountFilter : public cResultFilter
         intval_t getCount() const {return count;}
         virtual double getInitialDoubleValue() const override {return getCount();}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -178,6 +180,8 @@ class SIM_API CountNanFilter : public cNumericResultFilter
         intval_t getCount() const {return count;}
         virtual double getInitialDoubleValue() const override {return getCount();}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -194,6 +198,8 @@ class SIM_API SumFilter : public cNumericResultFilter
         double getSum() const {return sum;}
         virtual double getInitialDoubleValue() const override {return getSum();}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -217,6 +223,8 @@ class SIM_API MeanFilter : public cNumericResultFilter
         virtual void init(cComponent *component, cProperty *attrsProperty) override;
         double getMean() const;
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -233,6 +241,8 @@ class SIM_API MinFilter : public cNumericResultFilter
         MinFilter() {min = INFINITY;}
         double getMin() const {return min;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -249,6 +259,8 @@ class SIM_API MaxFilter : public cNumericResultFilter
         MaxFilter() {max = -INFINITY;}
         double getMax() const {return max;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -266,6 +278,8 @@ class SIM_API AverageFilter : public cNumericResultFilter
         AverageFilter() {count = 0; sum = 0;}
         double getAverage() const {return sum/count;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -285,6 +299,8 @@ class SIM_API TimeAverageFilter : public cNumericResultFilter
         TimeAverageFilter() {}
         double getTimeAverage() const;
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -300,6 +316,8 @@ class SIM_API RemoveRepeatsFilter : public cNumericResultFilter
         RemoveRepeatsFilter() {prev = NAN;}
         double getLastValue() const {return prev;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -341,6 +359,8 @@ class SIM_API SumPerDurationFilter : public cNumericResultFilter
         double getSumPerDuration() const;
         virtual double getInitialDoubleValue() const override {return getSumPerDuration();}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 }  // namespace omnetpp
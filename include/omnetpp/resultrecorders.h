@@ -43,6 +43,8 @@ class SIM_API VectorRecorder : public cNumericResultRecorder
         virtual simtime_t getLastWriteTime() const {return lastTime;}
         virtual double getLastValue() const {return lastValue;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -65,6 +67,8 @@ class SIM_API TotalCountRecorder : public cResultRecorder
         TotalCountRecorder() {count = 0;}
         long getCount() const {return count;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -95,6 +99,8 @@ class SIM_API LastValueRecorder : public cNumericResultRecorder
         LastValueRecorder() {lastValue = NAN;}
         double getLastValue() const {return lastValue;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -124,6 +130,8 @@ class SIM_API SumRecorder : public cNumericResultRecorder
         SumRecorder() {sum = 0;}
         double getSum() const {return sum;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -148,6 +156,8 @@ class SIM_API MeanRecorder : public cNumericResultRecorder
         virtual void collect(simtime_t_cref t, double value, cObject *details) override;
         double getMean() const;
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -165,6 +175,8 @@ class SIM_API MinRecorder : public cNumericResultRecorder
         MinRecorder() {min = INFINITY;}
         double getMin() const {return min;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -182,6 +194,8 @@ class SIM_API MaxRecorder : public cNumericResultRecorder
         MaxRecorder() {max = -INFINITY;}
         double getMax() const {return max;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -200,6 +214,8 @@ class SIM_API AverageRecorder : public cNumericResultRecorder
         AverageRecorder() {count = 0; sum = 0;}
         double getAverage() const {return sum/count;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -220,6 +236,8 @@ class SIM_API TimeAverageRecorder : public cNumericResultRecorder
         TimeAverageRecorder() {}
         double getTimeAverage() const;
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 /**
@@ -243,6 +261,8 @@ class SIM_API StatisticsRecorder : public cNumericResultRecorder
         virtual void setStatistic(cStatistic* stat);
         virtual cStatistic *getStatistic() const {return statistic;}
         virtual std::string str() const override;
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 class SIM_API StatsRecorder : public StatisticsRecorder
@@ -21,6 +21,13 @@
 #include <cstring>
 #include <csignal>
 #include <algorithm>
+#include <deque>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <poll.h>
+#include <sys/wait.h>
+#endif
 
 #include "common/opp_ctype.h"
 #include "common/commonutil.h"
@@ -44,6 +51,7 @@
 #include "omnetpp/cfutureeventset.h"
 #include "omnetpp/cresultfilter.h"
 #include "omnetpp/cresultrecorder.h"
+#include "omnetpp/cprofiler.h"
 #include "omnetpp/cclassdescriptor.h"
 #include "omnetpp/cqueue.h"
 #include "omnetpp/cchannel.h"
@@ -63,6 +71,7 @@ namespace cmdenv {
 Register_GlobalConfigOption(CFGID_CMDENV_CONFIG_NAME, "cmdenv-config-name", CFG_STRING, nullptr, "Specifies the name of the configuration to be run (for a value `Foo`, section `[Config Foo]` will be used from the ini file). See also `cmdenv-runs-to-execute`. The `-c` command line option overrides this setting.")
 Register_GlobalConfigOption(CFGID_CMDENV_RUNS_TO_EXECUTE, "cmdenv-runs-to-execute", CFG_STRING, nullptr, "Specifies which runs to execute from the selected configuration (see `cmdenv-config-name` option). It accepts a filter expression of iteration variables such as `$numHosts>10 && $iatime==1s`, or a comma-separated list of run numbers or run number ranges, e.g. `1,3..4,7..9`. If the value is missing, Cmdenv executes all runs in the selected configuration. The `-r` command line option overrides this setting.")
 Register_GlobalConfigOptionU(CFGID_CMDENV_EXTRA_STACK, "cmdenv-extra-stack", "B", "8KiB", "Specifies the extra amount of stack that is reserved for each `activity()` simple module when the simulation is run under Cmdenv.")
+Register_GlobalConfigOption(CFGID_CMDENV_BRANCH_AFTER_WARMUP, "cmdenv-branch-after-warmup", CFG_BOOL, "false", "Simulate the warmup period (see `warmup-period`) only once, using the configuration of the first selected run, then fork the process into one branch for each selected run. At the end of the warmup period, each branch switches over to the configuration of its own run: parameters whose values differ are assigned the new values, together with the non-volatile parameters whose expressions refer to them (modules are notified via `handleParameterChange()`), RNGs are reseeded according to `seed-set`, and results are recorded into the files of the run. Scalars recorded during the warmup period go into the files of every run; vector data recorded during the warmup period is discarded. The runs must not differ in anything else that takes effect before the end of the warmup period. Use -j to run several branches at the same time. Not available on Windows.");
 Register_PerRunConfigOption(CFGID_CMDENV_STOP_BATCH_ON_ERROR, "cmdenv-stop-batch-on-error", CFG_BOOL, "true", "Decides whether Cmdenv should skip the rest of the runs when an error occurs during the execution of one run.")
 Register_PerRunConfigOption(CFGID_CMDENV_INTERACTIVE, "cmdenv-interactive", CFG_BOOL, "false", "Defines what Cmdenv should do when the model contains unassigned parameters. In interactive mode, it asks the user. In non-interactive mode (which is more suitable for batch execution), Cmdenv stops with an error.")
 Register_PerRunConfigOption(CFGID_CMDENV_OUTPUT_FILE, "cmdenv-output-file", CFG_FILENAME, "${resultdir}/${configname}-${iterationvarsf}#${repetition}.out", "When `cmdenv-record-output=true`: file name to redirect standard output to. See also `fname-append-host`.")
@@ -73,6 +82,7 @@ Register_PerRunConfigOption(CFGID_CMDENV_EVENT_BANNERS, "cmdenv-event-banners",
 Register_PerRunConfigOption(CFGID_CMDENV_EVENT_BANNER_DETAILS, "cmdenv-event-banner-details", CFG_BOOL, "false", "When `cmdenv-express-mode=false`: print extra information after event banners.")
 Register_PerRunConfigOptionU(CFGID_CMDENV_STATUS_FREQUENCY, "cmdenv-status-frequency", "s", "2s", "When `cmdenv-express-mode=true`: print status update every n seconds.")
 Register_PerRunConfigOption(CFGID_CMDENV_PERFORMANCE_DISPLAY, "cmdenv-performance-display", CFG_BOOL, "true", "When `cmdenv-express-mode=true`: print detailed performance information. Turning it on results in a 3-line entry printed on each update, containing ev/sec, simsec/sec, ev/simsec, number of messages created/still present/currently scheduled in FES.")
+Register_PerRunConfigOption(CFGID_CMDENV_PROFILING_HOT_MODULES, "cmdenv-profiling-hot-modules", CFG_INT, "3", "When `cmdenv-express-mode=true` and `profiling=true`: the number of modules/channels with the largest CPU usage (exclusive time) to list on each status update, with their share of the total time spent in events.");
 Register_PerRunConfigOption(CFGID_CMDENV_LOG_PREFIX, "cmdenv-log-prefix", CFG_STRING, "[%l]\t", "Specifies the format string that determines the prefix of each log line. The format string may contain format directives in the syntax `%x` (a `%` followed by a single format character).  For example `%l` stands for log level, and `%J` for source component. See the manual for the list of available format characters.");
 Register_PerRunConfigOption(CFGID_CMDENV_FAKE_GUI, "cmdenv-fake-gui", CFG_BOOL, "false", "Causes Cmdenv to lie to simulations that is a GUI (isGui()=true), and to periodically invoke refreshDisplay() during simulation execution.");
 Register_PerObjectConfigOption(CFGID_CMDENV_LOGLEVEL, "cmdenv-log-level", KIND_MODULE, CFG_STRING, "TRACE", "Specifies the per-component level of detail recorded by log statements, output below the specified level is omitted. Available values are (case insensitive): `off`, `fatal`, `error`, `warn`, `info`, `detail`, `debug` or `trace`. Note that the level of detail is also controlled by the globally specified runtime log level and the `COMPILETIME_LOGLEVEL` macro that is used to completely remove log statements from the executable.")
@@ -123,7 +133,9 @@ CmdenvOptions::CmdenvOptions()
     detailedEventBanners = false;
     statusFrequencyMs = 2000;
     printPerformanceData = false;
+    numHotModules = 3;
     fakeGUI = false;
+    branchAfterWarmup = false;
 }
 
 Cmdenv::Cmdenv() : opt((CmdenvOptions *&)EnvirBase::opt)
@@ -152,6 +164,7 @@ void Cmdenv::readOptions()
     opt->configName = cfg->getAsString(CFGID_CMDENV_CONFIG_NAME);
     opt->runFilter = cfg->getAsString(CFGID_CMDENV_RUNS_TO_EXECUTE);
     opt->extraStack = (size_t)cfg->getAsDouble(CFGID_CMDENV_EXTRA_STACK);
+    opt->branchAfterWarmup = cfg->getAsBool(CFGID_CMDENV_BRANCH_AFTER_WARMUP);
 }
 
 void Cmdenv::readPerRunOptions()
@@ -167,6 +180,7 @@ void Cmdenv::readPerRunOptions()
     opt->detailedEventBanners = cfg->getAsBool(CFGID_CMDENV_EVENT_BANNER_DETAILS);
     opt->statusFrequencyMs = 1000*cfg->getAsDouble(CFGID_CMDENV_STATUS_FREQUENCY);
     opt->printPerformanceData = cfg->getAsBool(CFGID_CMDENV_PERFORMANCE_DISPLAY);
+    opt->numHotModules = cfg->getAsInt(CFGID_CMDENV_PROFILING_HOT_MODULES);
     setLogFormat(getConfig()->getAsString(CFGID_CMDENV_LOG_PREFIX).c_str());
     opt->outputFile = cfg->getAsFilename(CFGID_CMDENV_OUTPUT_FILE).c_str();
     opt->redirectOutput = cfg->getAsBool(CFGID_CMDENV_REDIRECT_OUTPUT);
@@ -196,8 +210,18 @@ void Cmdenv::doRun()
             opt->runFilter = args->optionValue('r');
 
         std::vector<int> runNumbers;
+        int numJobs = 1;
         try {
             runNumbers = resolveRunFilter(opt->configName.c_str(), opt->runFilter.c_str());
+
+            // '-j' option: number of runs to execute in parallel
+            if (args->optionGiven('j')) {
+                numJobs = opp_atol(args->optionValue('j'));
+                if (numJobs < 1)
+                    throw cRuntimeError("Invalid value %d for -j, positive number expected", numJobs);
+                if (numJobs > 1 && opt->parsim)
+                    throw cRuntimeError("-j cannot be used together with parallel simulation");
+            }
         }
         catch (std::exception& e) {
             displayException(e);
@@ -208,145 +232,613 @@ void Cmdenv::doRun()
         numRuns = (int)runNumbers.size();
         runsTried = 0;
         int numErrors = 0;
-        for (int runNumber : runNumbers) {
-            runsTried++;
-            bool finishedOK = false;
-            bool networkSetupDone = false;
-            bool endRunRequired = false;
-            try {
-                if (opt->verbose)
-                    out << "\nPreparing for running configuration " << opt->configName << ", run #" << runNumber << "..." << endl;
-
-                cfg->activateConfig(opt->configName.c_str(), runNumber);
-                readPerRunOptions();
-
-                const char *iterVars = cfg->getVariable(CFGVAR_ITERATIONVARS);
-                const char *runId = cfg->getVariable(CFGVAR_RUNID);
-                const char *repetition = cfg->getVariable(CFGVAR_REPETITION);
-                if (!opt->verbose)
-                    out << opt->configName << " run " << runNumber << ": " << iterVars << ", $repetition=" << repetition << endl; // print before redirection; useful as progress indication from opp_runall
-
-                if (opt->redirectOutput) {
-                    processFileName(opt->outputFile);
-                    if (opt->verbose)
-                        out << "Redirecting output to file \"" << opt->outputFile << "\"..." << endl;
-                    startOutputRedirection(opt->outputFile.c_str());
-                    if (opt->verbose)
-                        out << "\nRunning configuration " << opt->configName << ", run #" << runNumber << "..." << endl;
-                }
+        if (opt->branchAfterWarmup && numRuns > 0) {
+            numErrors = runBranches(runNumbers, numJobs);
+        }
+        else if (numJobs > 1 && numRuns > 1) {
+            numErrors = runInWorkerProcesses(runNumbers, numJobs);
+        }
+        else {
+            for (int runNumber : runNumbers) {
+                runsTried++;
+                bool finishedOK = runSimulation(runNumber, numErrors);
 
-                if (opt->verbose) {
-                    if (iterVars && strlen(iterVars) > 0)
-                        out << "Scenario: " << iterVars << ", $repetition=" << repetition << endl;
-                    out << "Assigned runID=" << runId << endl;
-                }
+                // skip further runs if signal was caught
+                if (sigintReceived)
+                    break;
 
-                // find network
-                if (opt->networkName.empty())
-                    throw cRuntimeError("No network specified (missing or empty network= configuration option)");
-                cModuleType *network = resolveNetwork(opt->networkName.c_str());
-                ASSERT(network);
+                if (!finishedOK && opt->stopBatchOnError)
+                    break;
+            }
+        }
 
-                endRunRequired = true;
+        if (numRuns > 1 && opt->verbose) {
+            int numSkipped = numRuns - runsTried;
+            int numSuccess = runsTried - numErrors;
+            out << "\nRun statistics: total " << numRuns;
+            if (numSuccess > 0)
+                out << ", successful " << numSuccess;
+            if (numErrors > 0)
+                out << ", errors " << numErrors;
+            if (numSkipped > 0)
+                out << ", skipped " << numSkipped;
+            out << endl;
+        }
 
-                // set up network
-                if (opt->verbose)
-                    out << "Setting up network \"" << opt->networkName.c_str() << "\"..." << endl;
+        exitCode = numErrors > 0 ? 1 : sigintReceived ? 2 : 0;
+    }
+}
 
-                setupNetwork(network);
-                networkSetupDone = true;
+bool Cmdenv::runSimulation(int runNumber, int& numErrors, bool isBranch)
+{
+    bool finishedOK = false;
+    bool networkSetupDone = false;
+    bool endRunRequired = false;
+    try {
+        if (opt->verbose)
+            out << "\nPreparing for running configuration " << opt->configName << ", run #" << runNumber << "..." << endl;
 
-                // prepare for simulation run
-                if (opt->verbose)
-                    out << "Initializing..." << endl;
+        if (!isBranch) {
+            cfg->activateConfig(opt->configName.c_str(), runNumber);
+            readPerRunOptions();
+        }
+        else {
+            // continue the simulation inherited from the warmup period
+            networkSetupDone = endRunRequired = true;
+            startBranch(opt->configName.c_str(), runNumber);
+            opt->stopBatchOnError = cfg->getAsBool(CFGID_CMDENV_STOP_BATCH_ON_ERROR);
+            opt->outputFile = cfg->getAsFilename(CFGID_CMDENV_OUTPUT_FILE).c_str();
+            opt->redirectOutput = cfg->getAsBool(CFGID_CMDENV_REDIRECT_OUTPUT);
+        }
 
-                loggingEnabled = !opt->expressMode;
+        const char *iterVars = cfg->getVariable(CFGVAR_ITERATIONVARS);
+        const char *runId = cfg->getVariable(CFGVAR_RUNID);
+        const char *repetition = cfg->getVariable(CFGVAR_REPETITION);
+        if (!opt->verbose)
+            out << opt->configName << " run " << runNumber << ": " << iterVars << ", $repetition=" << repetition << endl; // print before redirection; useful as progress indication from opp_runall
+
+        if (opt->redirectOutput) {
+            processFileName(opt->outputFile);
+            if (opt->verbose)
+                out << "Redirecting output to file \"" << opt->outputFile << "\"..." << endl;
+            startOutputRedirection(opt->outputFile.c_str());
+            if (opt->verbose)
+                out << "\nRunning configuration " << opt->configName << ", run #" << runNumber << "..." << endl;
+        }
 
-                prepareForRun();
+        if (opt->verbose) {
+            if (iterVars && strlen(iterVars) > 0)
+                out << "Scenario: " << iterVars << ", $repetition=" << repetition << endl;
+            out << "Assigned runID=" << runId << endl;
+        }
 
-                // run the simulation
-                if (opt->verbose)
-                    out << "\nRunning simulation..." << endl;
+        if (!isBranch) {
+            // find network
+            if (opt->networkName.empty())
+                throw cRuntimeError("No network specified (missing or empty network= configuration option)");
+            cModuleType *network = resolveNetwork(opt->networkName.c_str());
+            ASSERT(network);
 
-                // simulate() should only throw exception if error occurred and
-                // finish() should not be called.
-                notifyLifecycleListeners(LF_ON_SIMULATION_START);
-                simulate();
-                loggingEnabled = true;
+            endRunRequired = true;
 
-                if (opt->verbose)
-                    out << "\nCalling finish() at end of Run #" << runNumber << "..." << endl;
-                getSimulation()->callFinish();
-                cLogProxy::flushLastLine();
+            // set up network
+            if (opt->verbose)
+                out << "Setting up network \"" << opt->networkName.c_str() << "\"..." << endl;
+
+            setupNetwork(network);
+            networkSetupDone = true;
+
+            // prepare for simulation run
+            if (opt->verbose)
+                out << "Initializing..." << endl;
+
+            loggingEnabled = !opt->expressMode;
+
+            prepareForRun();
+        }
+        else {
+            loggingEnabled = !opt->expressMode;
+        }
+
+        // run the simulation
+        if (opt->verbose) {
+            if (isBranch)
+                out << "\nRunning simulation from the end of the warmup period, t=" << getSimulation()->getWarmupPeriod() << "..." << endl;
+            else
+                out << "\nRunning simulation..." << endl;
+        }
+
+        // simulate() should only throw exception if error occurred and
+        // finish() should not be called.
+        notifyLifecycleListeners(isBranch ? LF_ON_SIMULATION_RESUME : LF_ON_SIMULATION_START);
+        simulate();
+        loggingEnabled = true;
+
+        if (opt->verbose)
+            out << "\nCalling finish() at end of Run #" << runNumber << "..." << endl;
+        getSimulation()->callFinish();
+        cLogProxy::flushLastLine();
+
+        if (opt->signalStatistics)
+            printSignalStatistics();
+        if (opt->printStackUsage)
+            printStackUsage();
+
+        checkFingerprint();
+
+        notifyLifecycleListeners(LF_ON_SIMULATION_SUCCESS);
+
+        finishedOK = true;
+    }
+    catch (std::exception& e) {
+        loggingEnabled = true;
+        stoppedWithException(e);
+        notifyLifecycleListeners(LF_ON_SIMULATION_ERROR);
+        displayException(e);
+    }
+
+    // send LF_ON_RUN_END notification
+    if (endRunRequired) {
+        try {
+            notifyLifecycleListeners(LF_ON_RUN_END);
+        }
+        catch (std::exception& e) {
+            finishedOK = false;
+            notifyLifecycleListeners(LF_ON_SIMULATION_ERROR);
+            displayException(e);
+        }
+    }
+
+    // delete network
+    if (networkSetupDone) {
+        try {
+            getSimulation()->deleteNetwork();
+        }
+        catch (std::exception& e) {
+            numErrors++;
+            notifyLifecycleListeners(LF_ON_SIMULATION_ERROR);
+            displayException(e);
+        }
+    }
+
+    // stop redirecting into file
+    stopOutputRedirection();
+
+    if (!finishedOK)
+        numErrors++;
+    return finishedOK;
+}
+
+#ifdef _WIN32
+
+int Cmdenv::runInWorkerProcesses(const std::vector<int>& runNumbers, int numJobs)
+{
+    throw cRuntimeError("-j is not supported on this platform (it requires fork())");
+}
+
+int Cmdenv::runBranches(const std::vector<int>& runNumbers, int numJobs)
+{
+    throw cRuntimeError("cmdenv-branch-after-warmup is not supported on this platform (it requires fork())");
+}
+
+#else
+
+// sent to a worker process to start a run
+struct RunTask
+{
+    int runNumber;
+    int runsTried;  // including this one; for the progress display
+};
+
+// reported by a worker process to the parent after each run
+struct RunResult
+{
+    int runNumber;
+    int numErrors;
+    bool finishedOK;
+    bool stopBatchOnError;
+    bool sigintReceived;
+};
+
+// the parent's bookkeeping about a worker process
+struct Cmdenv::Worker
+{
+    pid_t pid = -1;
+    int taskFd = -1;       // parent writes run numbers here
+    int resultFd = -1;     // parent reads RunResult structs from here
+    FILE *stdoutFile = nullptr;  // captures the output of the current run
+    FILE *stderrFile = nullptr;
+    int currentRun = -1;   // -1 if idle
+};
+
+static bool writeFully(int fd, const void *data, size_t size)
+{
+    const char *p = (const char *)data;
+    while (size > 0) {
+        ssize_t n = write(fd, p, size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+static bool readFully(int fd, void *data, size_t size)
+{
+    char *p = (char *)data;
+    while (size > 0) {
+        ssize_t n = read(fd, p, size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+// copies the contents of the file (from its beginning) to the stream
+static void copyFileContents(FILE *f, std::ostream& os)
+{
+    char buf[4096];
+    off_t offset = 0;
+    ssize_t n;
+    while ((n = pread(fileno(f), buf, sizeof(buf), offset)) > 0) {
+        os.write(buf, n);
+        offset += n;
+    }
+    os.flush();
+}
+
+static void truncateFile(FILE *f)
+{
+    if (ftruncate(fileno(f), 0) != 0 || lseek(fileno(f), 0, SEEK_SET) != 0)
+        throw cRuntimeError("Cannot truncate output capture file: %s", strerror(errno));
+}
+
+void Cmdenv::startWorker(Worker& worker, std::vector<Worker>& workers)
+{
+    int taskPipe[2], resultPipe[2];
+    if (pipe(taskPipe) != 0)
+        throw cRuntimeError("Cannot create pipe for worker process: %s", strerror(errno));
+    if (pipe(resultPipe) != 0) {
+        close(taskPipe[0]);
+        close(taskPipe[1]);
+        throw cRuntimeError("Cannot create pipe for worker process: %s", strerror(errno));
+    }
+    if (!worker.stdoutFile)
+        worker.stdoutFile = tmpfile();
+    if (!worker.stderrFile)
+        worker.stderrFile = tmpfile();
+    if (!worker.stdoutFile || !worker.stderrFile)
+        throw cRuntimeError("Cannot create temporary file for capturing the output of worker process: %s", strerror(errno));
+
+    // don't let the child inherit (and later flush) buffered output
+    out.flush();
+    std::cerr.flush();
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if (pid < 0)
+        throw cRuntimeError("Cannot fork worker process: %s", strerror(errno));
+
+    if (pid == 0) {
+        // child: close the parent's end of the pipes, including those of other workers
+        for (Worker& w : workers) {
+            if (w.taskFd != -1)
+                close(w.taskFd);
+            if (w.resultFd != -1)
+                close(w.resultFd);
+        }
+        close(taskPipe[1]);
+        close(resultPipe[0]);
+        workerMain(taskPipe[0], resultPipe[1], worker.stdoutFile, worker.stderrFile);  // does not return
+    }
+
+    // parent
+    close(taskPipe[0]);
+    close(resultPipe[1]);
+    worker.pid = pid;
+    worker.taskFd = taskPipe[1];
+    worker.resultFd = resultPipe[0];
+    worker.currentRun = -1;
+}
+
+void Cmdenv::stopWorker(Worker& worker)
+{
+    close(worker.taskFd);  // signals the worker to exit
+    close(worker.resultFd);
+    while (waitpid(worker.pid, nullptr, 0) < 0 && errno == EINTR)
+        ;
+    worker.pid = -1;
+    worker.taskFd = worker.resultFd = -1;
+}
+
+void Cmdenv::workerMain(int taskFd, int resultFd, FILE *stdoutFile, FILE *stderrFile)
+{
+    // the parent handles Ctrl-C by not starting new runs; the run in progress
+    // is ended gracefully as usual (see simulate())
+    signal(SIGINT, SIG_IGN);
+    signal(SIGTERM, SIG_IGN);
+
+    if (dup2(fileno(stdoutFile), STDOUT_FILENO) < 0 || dup2(fileno(stderrFile), STDERR_FILENO) < 0)
+        _exit(1);
+
+    RunTask task;
+    while (readFully(taskFd, &task, sizeof(task))) {
+        truncateFile(stdoutFile);
+        truncateFile(stderrFile);
+
+        runsTried = task.runsTried;
+        RunResult result;
+        result.runNumber = task.runNumber;
+        result.numErrors = 0;
+        result.finishedOK = runSimulation(task.runNumber, result.numErrors, isBranching);
+        result.stopBatchOnError = opt->stopBatchOnError;
+        result.sigintReceived = sigintReceived;
+
+        out.flush();
+        std::cerr.flush();
+        fflush(stdout);
+        fflush(stderr);
+
+        if (!writeFully(resultFd, &result, sizeof(result)))
+            break;
 
-                checkFingerprint();
+        // a branch cannot be reused, as the warmup state is gone
+        if (isBranching)
+            break;
+    }
 
-                notifyLifecycleListeners(LF_ON_SIMULATION_SUCCESS);
+    // skip the shutdown sequence and static destructors: they belong to the parent process
+    _exit(0);
+}
 
-                finishedOK = true;
+int Cmdenv::runInWorkerProcesses(const std::vector<int>& runNumbers, int numJobs)
+{
+    numJobs = std::min(numJobs, (int)runNumbers.size());
+    if (opt->verbose) {
+        if (isBranching)
+            out << "\nExecuting " << runNumbers.size() << " runs as branches of the warmup period, " << numJobs << " at a time..." << endl;
+        else
+            out << "\nExecuting " << runNumbers.size() << " runs in " << numJobs << " worker processes..." << endl;
+    }
+
+    std::deque<int> pendingRuns(runNumbers.begin(), runNumbers.end());
+    std::vector<Worker> workers(numJobs);
+    std::vector<int> failedRuns;
+    int numErrors = 0;
+    bool stopping = false;
+
+    sigintReceived = false;
+    installSignalHandler();
+    signal(SIGPIPE, SIG_IGN);  // let writes to a crashed worker fail with EPIPE instead
+
+    try {
+        for (Worker& worker : workers)
+            startWorker(worker, workers);
+
+        auto dispatch = [&](Worker& worker) {
+            if (stopping || pendingRuns.empty()) {
+                stopWorker(worker);
+                return;
             }
-            catch (std::exception& e) {
-                loggingEnabled = true;
-                stoppedWithException(e);
-                notifyLifecycleListeners(LF_ON_SIMULATION_ERROR);
-                displayException(e);
+            worker.currentRun = pendingRuns.front();
+            pendingRuns.pop_front();
+            runsTried++;
+            RunTask task;
+            task.runNumber = worker.currentRun;
+            task.runsTried = runsTried;
+            // note: if this fails, the worker is gone, and we'll notice it when reading its result
+            writeFully(worker.taskFd, &task, sizeof(task));
+        };
+
+        for (Worker& worker : workers)
+            dispatch(worker);
+
+        while (true) {
+            std::vector<pollfd> fds;
+            std::vector<Worker*> pollWorkers;
+            for (Worker& worker : workers) {
+                if (worker.pid != -1) {
+                    fds.push_back(pollfd{worker.resultFd, POLLIN, 0});
+                    pollWorkers.push_back(&worker);
+                }
             }
+            if (fds.empty())
+                break;
 
-            // send LF_ON_RUN_END notification
-            if (endRunRequired) {
-                try {
-                    notifyLifecycleListeners(LF_ON_RUN_END);
-                }
-                catch (std::exception& e) {
-                    finishedOK = false;
-                    notifyLifecycleListeners(LF_ON_SIMULATION_ERROR);
-                    displayException(e);
-                }
+            int ret = poll(fds.data(), fds.size(), -1);
+            if (sigintReceived && !stopping) {
+                stopping = true;
+                out << "\nSIGINT or SIGTERM received, waiting for runs in progress to finish" << endl;
+            }
+            if (ret < 0) {
+                if (errno == EINTR)
+                    continue;
+                throw cRuntimeError("poll() failed: %s", strerror(errno));
             }
 
-            // delete network
-            if (networkSetupDone) {
-                try {
-                    getSimulation()->deleteNetwork();
+            for (size_t i = 0; i < fds.size(); i++) {
+                if (fds[i].revents == 0)
+                    continue;
+                Worker& worker = *pollWorkers[i];
+                RunResult result;
+                bool workerAlive = readFully(worker.resultFd, &result, sizeof(result));
+
+                // print the captured output of the run as one block, so that
+                // the output of different runs does not get mixed up
+                copyFileContents(worker.stdoutFile, out);
+                copyFileContents(worker.stderrFile, std::cerr);
+
+                if (workerAlive) {
+                    numErrors += result.numErrors;
+                    if (!result.finishedOK) {
+                        failedRuns.push_back(result.runNumber);
+                        if (opt->verbose)
+                            out << "Run #" << result.runNumber << " failed" << endl;
+                        if (result.stopBatchOnError)
+                            stopping = true;
+                    }
+                    if (result.sigintReceived)
+                        stopping = true;
+                    if (isBranching) {
+                        // fork the next branch from the warmed-up state
+                        stopWorker(worker);
+                        if (stopping || pendingRuns.empty())
+                            continue;
+                        startWorker(worker, workers);
+                    }
+                    dispatch(worker);
                 }
-                catch (std::exception& e) {
+                else {
+                    // worker crashed
+                    int status = 0;
+                    while (waitpid(worker.pid, &status, 0) < 0 && errno == EINTR)
+                        ;
+                    close(worker.taskFd);
+                    close(worker.resultFd);
+                    worker.pid = -1;
+                    worker.taskFd = worker.resultFd = -1;
+
+                    std::cerr << "<!> Error: Run #" << worker.currentRun << ": worker process ";
+                    if (WIFSIGNALED(status))
+                        std::cerr << "terminated by signal " << WTERMSIG(status) << " (" << strsignal(WTERMSIG(status)) << ")";
+                    else
+                        std::cerr << "exited unexpectedly with exit code " << WEXITSTATUS(status);
+                    std::cerr << endl;
                     numErrors++;
-                    notifyLifecycleListeners(LF_ON_SIMULATION_ERROR);
-                    displayException(e);
+                    failedRuns.push_back(worker.currentRun);
+                    cfg->activateConfig(opt->configName.c_str(), worker.currentRun);
+                    if (cfg->getAsBool(CFGID_CMDENV_STOP_BATCH_ON_ERROR))
+                        stopping = true;
+
+                    // replace it
+                    if (!stopping && !pendingRuns.empty()) {
+                        startWorker(worker, workers);
+                        dispatch(worker);
+                    }
                 }
             }
+        }
+    }
+    catch (std::exception& e) {
+        displayException(e);
+        numErrors++;
+        for (Worker& worker : workers)
+            if (worker.pid != -1)
+                stopWorker(worker);
+    }
 
-            // stop redirecting into file
-            stopOutputRedirection();
+    for (Worker& worker : workers) {
+        if (worker.stdoutFile)
+            fclose(worker.stdoutFile);
+        if (worker.stderrFile)
+            fclose(worker.stderrFile);
+    }
+    deinstallSignalHandler();
+    signal(SIGPIPE, SIG_DFL);
+
+    if (!failedRuns.empty()) {
+        std::sort(failedRuns.begin(), failedRuns.end());
+        out << "\nFailed runs:";
+        for (int runNumber : failedRuns)
+            out << " #" << runNumber;
+        out << endl;
+    }
+    return numErrors;
+}
 
-            if (!finishedOK)
-                numErrors++;
+int Cmdenv::runBranches(const std::vector<int>& runNumbers, int numJobs)
+{
+    int warmupRunNumber = runNumbers[0];
+    bool warmupDone = false;
+    bool networkSetupDone = false;
+    int numErrors = 0;
+    try {
+        if (opt->parsim)
+            throw cRuntimeError("cmdenv-branch-after-warmup cannot be used together with parallel simulation");
+
+        if (opt->verbose)
+            out << "\nPreparing for running configuration " << opt->configName << ", run #" << warmupRunNumber << " for the warmup period..." << endl;
+
+        cfg->activateConfig(opt->configName.c_str(), warmupRunNumber);
+        readPerRunOptions();
+
+        if (opt->warmupPeriod <= SIMTIME_ZERO)
+            throw cRuntimeError("cmdenv-branch-after-warmup requires a nonzero warmup-period");
+        if (opt->networkName.empty())
+            throw cRuntimeError("No network specified (missing or empty network= configuration option)");
+        cModuleType *network = resolveNetwork(opt->networkName.c_str());
+        ASSERT(network);
+
+        deferResultRecording();
+
+        if (opt->verbose)
+            out << "Setting up network \"" << opt->networkName.c_str() << "\"..." << endl;
+        setupNetwork(network);
+        networkSetupDone = true;
+
+        if (opt->verbose)
+            out << "Initializing..." << endl;
+        loggingEnabled = !opt->expressMode;
+        prepareForRun();
+
+        if (opt->verbose)
+            out << "\nSimulating the warmup period until t=" << opt->warmupPeriod << "..." << endl;
+        notifyLifecycleListeners(LF_ON_SIMULATION_START);
+        branchingTime = opt->warmupPeriod;
+        branchingTimeReached = false;
+        runsTried = 1;  // for the progress display
+        simulate();
+        runsTried = 0;
+        branchingTime = SIMTIME_MAX;
+        loggingEnabled = true;
 
-            // skip further runs if signal was caught
-            if (sigintReceived)
-                break;
+        if (!branchingTimeReached)
+            throw cRuntimeError("Simulation ended before the end of the warmup period, no branches to run");
+        notifyLifecycleListeners(LF_ON_SIMULATION_PAUSE);
+        warmupDone = true;
+    }
+    catch (std::exception& e) {
+        branchingTime = SIMTIME_MAX;
+        loggingEnabled = true;
+        notifyLifecycleListeners(LF_ON_SIMULATION_ERROR);
+        displayException(e);
+    }
 
-            if (!finishedOK && opt->stopBatchOnError)
-                break;
-        }
+    if (warmupDone) {
+        isBranching = true;
+        numErrors = runInWorkerProcesses(runNumbers, numJobs);
+        isBranching = false;
+    }
+    else {
+        // none of the runs could be executed
+        runsTried = numRuns;
+        numErrors = numRuns;
+    }
 
-        if (numRuns > 1 && opt->verbose) {
-            int numSkipped = numRuns - runsTried;
-            int numSuccess = runsTried - numErrors;
-            out << "\nRun statistics: total " << numRuns;
-            if (numSuccess > 0)
-                out << ", successful " << numSuccess;
-            if (numErrors > 0)
-                out << ", errors " << numErrors;
-            if (numSkipped > 0)
-                out << ", skipped " << numSkipped;
-            out << endl;
+    if (networkSetupDone) {
+        try {
+            notifyLifecycleListeners(LF_ON_RUN_END);
+            getSimulation()->deleteNetwork();
+        }
+        catch (std::exception& e) {
+            notifyLifecycleListeners(LF_ON_SIMULATION_ERROR);
+            displayException(e);
         }
-
-        exitCode = numErrors > 0 ? 1 : sigintReceived ? 2 : 0;
     }
+    discardBranchingState();
+    return numErrors;
 }
 
+#endif
+
 // note: also updates "since" (sets it to the current time) if answer is "true"
 inline bool elapsed(long millis, int64_t& since)
 {
@@ -378,6 +870,18 @@ void Cmdenv::simulate()
                 if (!event)
                     throw cTerminationException("Scheduler interrupted while waiting");
 
+                if (event->getArrivalTime() >= branchingTime) {
+                    simulation->putBackEvent(event);
+                    branchingTimeReached = true;
+                    break;
+                }
+
+                if (checkpointingEnabled && isCheckpointDue(event)) {
+                    simulation->putBackEvent(event);
+                    writeCheckpoint();
+                    continue;
+                }
+
                 // flush *between* printing event banner and event processing, so that
                 // if event processing crashes, it can be seen which event it was
                 if (opt->autoflush)
@@ -413,6 +917,18 @@ void Cmdenv::simulate()
                 if (!event)
                     throw cTerminationException("Scheduler interrupted while waiting");
 
+                if (event->getArrivalTime() >= branchingTime) {
+                    simulation->putBackEvent(event);
+                    branchingTimeReached = true;
+                    break;
+                }
+
+                if (checkpointingEnabled && isCheckpointDue(event)) {
+                    simulation->putBackEvent(event);
+                    writeCheckpoint();
+                    continue;
+                }
+
                 speedometer.addEvent(simulation->getSimTime());
 
                 // print event banner from time to time
@@ -510,10 +1026,69 @@ void Cmdenv::doStatusUpdate(Speedometer& speedometer)
             << "   ev/sec=" << speedometer.getEventsPerSec() << endl;
     }
 
+    if (getSimulation()->getProfiler() && opt->numHotModules > 0)
+        printHotModules();
+
     // status update is always autoflushed (not only if opt->autoflush is on)
     out.flush();
 }
 
+void Cmdenv::printHotModules()
+{
+    cProfiler *profiler = getSimulation()->getProfiler();
+    uint64_t totalTicks = profiler->getTotalTicks();
+    if (totalTicks == 0)
+        return;
+    out << "     Hot modules:";
+    for (int id : profiler->getHotComponents(opt->numHotModules)) {
+        cComponent *component = getSimulation()->getComponent(id);
+        double percentage = 100.0 * profiler->getComponentStats(id).exclusiveTicks / totalTicks;
+        out << "  " << (component ? component->getFullPath() : "(deleted id=" + std::to_string(id) + ")") << " " << opp_stringf("%.1f%%", percentage);
+    }
+    out << endl;
+}
+
+void Cmdenv::printSignalStatistics()
+{
+    // collect emitted signals, most expensive first
+    std::vector<simsignal_t> signals;
+    for (simsignal_t signalID = 0; cComponent::getSignalName(signalID) != nullptr; signalID++)
+        if (cComponent::getSignalEmitCount(signalID) > 0)
+            signals.push_back(signalID);
+    std::stable_sort(signals.begin(), signals.end(), [](simsignal_t a, simsignal_t b) {
+        return cComponent::getSignalEmitTime(a) > cComponent::getSignalEmitTime(b);
+    });
+
+    out << "\nSignal statistics (emit count, total time, time per emit):" << endl;
+    for (simsignal_t signalID : signals) {
+        int64_t count = cComponent::getSignalEmitCount(signalID);
+        double time = cComponent::getSignalEmitTime(signalID);
+        out << "  " << cComponent::getSignalName(signalID) << ": " << count << "  "
+            << time << "s  " << (time / count * 1e9) << "ns" << endl;
+    }
+    out.flush();
+}
+
+void Cmdenv::printStackUsage()
+{
+    cSimulation *simulation = getSimulation();
+    bool headerPrinted = false;
+    for (int id = 0; id <= simulation->getLastComponentId(); id++) {
+        cSimpleModule *module = dynamic_cast<cSimpleModule *>(simulation->getModule(id));
+        if (!module || !module->usesActivity())
+            continue;
+        if (!headerPrinted) {
+            out << "\nStack usage of activity() modules (used / stack size):" << endl;
+            headerPrinted = true;
+        }
+        unsigned size = module->getStackSize();
+        unsigned usage = module->getStackUsage();
+        out << "  " << module->getFullPath() << ": " << usage << " / " << size << " bytes ("
+            << (size == 0 ? 0 : (int)(100.0 * usage / size)) << "%)" << endl;
+    }
+    out.flush();
+}
+
 const char *Cmdenv::progressPercentage()
 {
     double simtimeRatio = -1;
@@ -46,7 +46,9 @@ struct CMDENV_API CmdenvOptions : public EnvirOptions
     bool detailedEventBanners; // if normal mode
     long statusFrequencyMs; // if express mode
     bool printPerformanceData; // if express mode
+    int numHotModules; // if express mode and profiling
     bool fakeGUI; // all modes
+    bool branchAfterWarmup;
 };
 
 /**
@@ -64,6 +66,11 @@ class CMDENV_API Cmdenv : public EnvirBase
      int runsTried = 0;
      int numRuns = 0;
 
+     // warm-start branching (cmdenv-branch-after-warmup)
+     simtime_t branchingTime = SIMTIME_MAX;  // simulate() returns before executing events at or after this time
+     bool branchingTimeReached = false;
+     bool isBranching = false;  // true while the runs are being executed as branches
+
      // logging
      bool logging = true;
      FILE *logStream;
@@ -76,6 +83,9 @@ class CMDENV_API Cmdenv : public EnvirBase
      virtual bool askYesNo(const char *question) override;
      virtual void printEventBanner(cEvent *event);
      virtual void doStatusUpdate(Speedometer& speedometer);
+     virtual void printSignalStatistics();
+     virtual void printHotModules();
+     virtual void printStackUsage();
 
    public:
      Cmdenv();
@@ -113,9 +123,18 @@ class CMDENV_API Cmdenv : public EnvirBase
      virtual void askParameter(cPar *par, bool unassigned) override;
 
      void help();
+     bool runSimulation(int runNumber, int& numErrors, bool isBranch=false);
      void simulate();
      const char *progressPercentage();
 
+     // executing runs in parallel, in forked worker processes (-j option)
+     struct Worker;
+     int runInWorkerProcesses(const std::vector<int>& runNumbers, int numJobs);
+     int runBranches(const std::vector<int>& runNumbers, int numJobs);
+     void startWorker(Worker& worker, std::vector<Worker>& workers);
+     void stopWorker(Worker& worker);
+     void workerMain(int taskFd, int resultFd, FILE *stdoutFile, FILE *stderrFile);
+
      void installSignalHandler();
      void deinstallSignalHandler();
      static void signalHandler(int signum);
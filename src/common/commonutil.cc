@@ -22,6 +22,7 @@
 #include <string>
 #include <functional> // reference_wrapper
 #include <unordered_map>
+#include <mutex>
 #include "omnetpp/platdep/platmisc.h"
 #include "commonutil.h"
 #include "opp_ctype.h"
@@ -219,12 +220,14 @@ struct EqualTo {
 };
 
 std::unordered_map<TypeInfoRef, std::string, Hasher, EqualTo> demangledNames;
+std::mutex demangledNamesMutex;
 
 const char *opp_typename(const std::type_info& t)
 {
     if (t == typeid(std::string))
         return "std::string";  // otherwise we'd get "std::basic_string<........>"
 
+    std::lock_guard<std::mutex> lock(demangledNamesMutex);
     auto it = demangledNames.find(t);
     if (it == demangledNames.end()) {
         demangledNames[t] = demangle(t.name());
@@ -23,6 +23,7 @@
 #include <sstream>
 #include <iomanip>
 #include <typeinfo>
+#include <mutex>
 #include "commondefs.h"
 #include "exception.h"
 
@@ -122,14 +123,17 @@ template <class T> struct ToString<T*>
 #define RETURN(x) { __x.setResult(x); return x; }
 
 /**
- * Not all our bison/flex based parsers are reentrant. This macro is meant
- * to catch and report concurrent invocations, e.g. from background threads
- * in the GUI code.
+ * Not all our bison/flex based parsers are reentrant. This macro serializes
+ * invocations from different threads (e.g. simulations running concurrently
+ * in the same process, or background threads in the GUI code), and catches
+ * and reports reentrant invocations from the same thread.
  */
 #define NONREENTRANT_PARSER() \
-    static bool active = false; \
+    static std::mutex mutex; \
+    static thread_local bool active = false; \
     struct Guard { \
-      Guard() {if (active) throw opp_runtime_error("non-reentrant parser invoked again while parsing"); active=true;} \
+      std::unique_lock<std::mutex> lock; \
+      Guard() {if (active) throw opp_runtime_error("non-reentrant parser invoked again while parsing"); lock = std::unique_lock<std::mutex>(mutex); active=true;} \
       ~Guard() {active=false;} \
     } __guard;
 
@@ -17,6 +17,7 @@
 
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <stack>
 #include <typeinfo>
 #include <cinttypes>
@@ -66,8 +67,12 @@ const char *Expression::AstNode::typeName(Type type)
 
 void Expression::copy(const Expression& other)
 {
+    delete program;
+    program = nullptr;
     delete tree;
     tree = other.tree->dupTree();
+    if (other.program)
+        compile();
 }
 
 Expression& Expression::operator=(const Expression& other)
@@ -94,14 +99,34 @@ ExprNode *Expression::parseAndTranslate(const char *expr, AstTranslator *transla
     return exprTree;
 }
 
+void Expression::compile()
+{
+    if (!tree)
+        throw opp_runtime_error("Cannot compile empty expression");
+    delete program;
+    program = nullptr;
+    program = ExprProgram::compile(tree);
+}
+
 void Expression::setExpressionTree(ExprNode* exprTree)
 {
     Assert(exprTree);
+    delete program;
+    program = nullptr;
     if (tree)
         delete tree;
     tree = exprTree;
 }
 
+ExprNode *Expression::removeExpressionTree()
+{
+    delete program;
+    program = nullptr;
+    ExprNode *result = tree;
+    tree = nullptr;
+    return result;
+}
+
 void Expression::dumpAst(AstNode *node, std::ostream& out, int indentLevel) const
 {
     out << std::string(4*indentLevel, ' ' ) << node->str() << std::endl;
@@ -190,6 +215,7 @@ bool Expression::isFoldableNode(ExprNode *node) const
             dynamic_cast<TernaryOperatorNode*>(node) != nullptr ||
             dynamic_cast<DoubleCastNode*>(node) != nullptr ||
             dynamic_cast<IntCastNode*>(node) != nullptr ||
+            dynamic_cast<UnitConversionNode*>(node) != nullptr ||
             (ExprNodeFactory::supportsStdMathFunction(node->getName().c_str()) &&
                     (dynamic_cast<MathFunc1Node*>(node) || dynamic_cast<MathFunc2Node*>(node) || dynamic_cast<MathFunc3Node*>(node))
             );
@@ -212,7 +238,7 @@ ExprValue Expression::evaluate(Context *context) const
 {
     if (!tree)
         throw opp_runtime_error("Cannot evaluate empty expression");
-    return tree->tryEvaluate(context);
+    return program ? program->evaluate(context) : tree->tryEvaluate(context);
 }
 
 bool Expression::boolValue(Context *context) const
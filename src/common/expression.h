@@ -19,6 +19,7 @@
 #include "commondefs.h"
 #include "exprvalue.h"
 #include "exprnode.h"
+#include "exprprogram.h"
 #include "stringpool.h"
 
 namespace omnetpp {
@@ -33,6 +34,7 @@ public:
     typedef omnetpp::common::expression::ExprValue ExprValue;
     typedef omnetpp::common::expression::ExprNode ExprNode;
     typedef omnetpp::common::expression::Context Context;
+    typedef omnetpp::common::expression::ExprProgram ExprProgram;
 
     /**
      * Node type for the expression AST, an intermediate representation which
@@ -117,6 +119,7 @@ public:
 
   protected:
     ExprNode *tree = nullptr;
+    ExprProgram *program = nullptr; // optional compiled form of tree, see compile()
     static MultiAstTranslator defaultTranslator;
 
   protected:
@@ -139,7 +142,7 @@ public:
      */
     Expression() {}
     Expression(const Expression& other) {copy(other);}
-    virtual ~Expression() {delete tree;}
+    virtual ~Expression() {delete program; delete tree;}
     Expression& operator=(const Expression& other);
 
     /**
@@ -157,6 +160,20 @@ public:
      */
     virtual Expression& parse(const char *text, AstTranslator *translator=nullptr);
 
+    /**
+     * Compiles the expression tree into an ExprProgram which will be used by
+     * subsequent evaluations. This makes evaluation faster, and is worthwhile
+     * for expressions that are evaluated many times (volatile parameters,
+     * statistic sources, etc.) The compiled form is discarded when the
+     * expression tree is replaced or removed.
+     */
+    virtual void compile();
+
+    /**
+     * Returns true if the expression has been compiled, see compile().
+     */
+    bool isCompiled() const {return program != nullptr;}
+
     /**
      * Returns true if the expression is empty. An empty expression cannot be evaluated.
      */
@@ -206,7 +223,8 @@ public:
     // direct access to the expression evaluator tree
     virtual void setExpressionTree(ExprNode *exprTree);
     virtual const ExprNode *getExpressionTree() const {return tree;}
-    virtual ExprNode *removeExpressionTree() {ExprNode *result = tree; tree = nullptr; return result;}
+    virtual ExprNode *removeExpressionTree();
+    virtual const ExprProgram *getProgram() const {return program;}
 
     // various stages of the expression parsing and translation, as utility functions
     virtual AstNode *parseToAst(const char *text) const;
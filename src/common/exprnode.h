@@ -30,6 +30,8 @@ namespace omnetpp {
 namespace common {
 namespace expression {
 
+class ExprProgram;
+
 /**
  * Subclass to pass more information into the evaluator.
  */
@@ -42,6 +44,7 @@ struct Context {
  * Node in the expression evaluation tree.
  */
 class COMMON_API ExprNode {
+    friend class ExprProgram;
 public:
     enum Precedence {
         ELEM = 0,    // constant, variable, function
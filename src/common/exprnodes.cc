@@ -18,6 +18,7 @@
 #include <cmath>
 #include <cinttypes>  // PRId64
 #include <sstream>
+#include <memory>
 #include "unitconversion.h"
 #include "stlutil.h"
 #include "stringutil.h"
@@ -195,6 +196,12 @@ void IndexedMemberNode::print(std::ostream& out, int spaciousness) const
 ExprValue NegateNode::evaluate(Context *context) const
 {
     ExprValue value = child->tryEvaluate(context);
+    compute(value);
+    return value;
+}
+
+void NegateNode::compute(ExprValue& value)
+{
     if (value.type == ExprValue::INT) {
         ensureNoLogarithmicUnit(value);
         value.intv = -value.intv;
@@ -203,11 +210,8 @@ ExprValue NegateNode::evaluate(Context *context) const
         ensureNoLogarithmicUnit(value);
         value.dbl = -value.dbl;
     }
-    else if (value.type == ExprValue::UNDEF)
-        return value;
-    else
+    else if (value.type != ExprValue::UNDEF)
         errorNumericArgExpected(value);
-    return value;
 }
 
 void UnaryOperatorNode::print(std::ostream& out, int spaciousness) const
@@ -242,8 +246,16 @@ ExprValue AddNode::evaluate(Context *context) const
 {
     ExprValue leftValue = child1->tryEvaluate(context);
     ExprValue rightValue = child2->tryEvaluate(context);
-    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF)
-        return ExprValue();
+    compute(leftValue, rightValue);
+    return leftValue;
+}
+
+void AddNode::compute(ExprValue& leftValue, ExprValue& rightValue)
+{
+    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF) {
+        leftValue = ExprValue();
+        return;
+    }
 
     // numeric addition or string concatenation
     if (leftValue.type == ExprValue::INT && rightValue.type == ExprValue::INT) {  // both ints -> integer addition
@@ -251,20 +263,17 @@ ExprValue AddNode::evaluate(Context *context) const
         ensureNoLogarithmicUnit(leftValue);
         bringToCommonTypeAndUnit(rightValue, leftValue);
         leftValue.intv = safeAdd(leftValue.intv, rightValue.intv);
-        return leftValue;
     }
     else if (leftValue.type == ExprValue::DOUBLE || rightValue.type == ExprValue::DOUBLE) { // at least one is double -> double addition
         ensureNoLogarithmicUnit(rightValue);
         ensureNoLogarithmicUnit(leftValue);
         bringToCommonTypeAndUnit(rightValue, leftValue);
         leftValue.dbl = leftValue.dbl + rightValue.dbl;
-        return leftValue;
     }
     else if (leftValue.type == ExprValue::STRING && rightValue.type == ExprValue::STRING) {
         char *res = concatenate(leftValue.s, rightValue.s);
         leftValue.deleteOld();
         leftValue.s = res;
-        return leftValue;
     }
     else
         errorNumericArgsExpected(leftValue, rightValue);
@@ -274,8 +283,16 @@ ExprValue SubNode::evaluate(Context *context) const
 {
     ExprValue leftValue = child1->tryEvaluate(context);
     ExprValue rightValue = child2->tryEvaluate(context);
-    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF)
-        return ExprValue();
+    compute(leftValue, rightValue);
+    return leftValue;
+}
+
+void SubNode::compute(ExprValue& leftValue, ExprValue& rightValue)
+{
+    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF) {
+        leftValue = ExprValue();
+        return;
+    }
 
     // numeric addition or string concatenation
     if (leftValue.type == ExprValue::INT && rightValue.type == ExprValue::INT) {  // both ints -> integer subtraction
@@ -283,14 +300,12 @@ ExprValue SubNode::evaluate(Context *context) const
         ensureNoLogarithmicUnit(leftValue);
         bringToCommonTypeAndUnit(rightValue, leftValue);
         leftValue.intv = safeSub(leftValue.intv, rightValue.intv);
-        return leftValue;
     }
     else if (leftValue.type == ExprValue::DOUBLE || rightValue.type == ExprValue::DOUBLE) { // at least one is double -> double addition
         ensureNoLogarithmicUnit(rightValue);
         ensureNoLogarithmicUnit(leftValue);
         bringToCommonTypeAndUnit(rightValue, leftValue);
         leftValue.dbl = leftValue.dbl - rightValue.dbl;
-        return leftValue;
     }
     else
         errorNumericArgsExpected(leftValue, rightValue);
@@ -300,8 +315,16 @@ ExprValue MulNode::evaluate(Context *context) const
 {
     ExprValue leftValue = child1->tryEvaluate(context);
     ExprValue rightValue = child2->tryEvaluate(context);
-    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF)
-        return ExprValue();
+    compute(leftValue, rightValue);
+    return leftValue;
+}
+
+void MulNode::compute(ExprValue& leftValue, ExprValue& rightValue)
+{
+    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF) {
+        leftValue = ExprValue();
+        return;
+    }
 
     if (leftValue.type == ExprValue::INT && rightValue.type == ExprValue::INT) {  // both are integers -> integer multiplication
         if (!opp_isempty(rightValue.unit) && !opp_isempty(leftValue.unit))
@@ -311,7 +334,6 @@ ExprValue MulNode::evaluate(Context *context) const
         leftValue.intv = safeMul(leftValue.intv, rightValue.intv);
         if (opp_isempty(leftValue.unit))
             leftValue.unit = rightValue.unit;
-        return leftValue;
     }
     else if (leftValue.type == ExprValue::DOUBLE || rightValue.type == ExprValue::DOUBLE) { // at least one is double -> double multiplication
         if (!opp_isempty(rightValue.unit) && !opp_isempty(leftValue.unit))
@@ -323,7 +345,6 @@ ExprValue MulNode::evaluate(Context *context) const
         leftValue.dbl = leftValue.dbl * rightValue.dbl;
         if (opp_isempty(leftValue.unit))
             leftValue.unit = rightValue.unit;
-        return leftValue;
     }
     else
         errorNumericArgsExpected(leftValue, rightValue);
@@ -333,8 +354,16 @@ ExprValue DivNode::evaluate(Context *context) const
 {
     ExprValue leftValue = child1->tryEvaluate(context);
     ExprValue rightValue = child2->tryEvaluate(context);
-    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF)
-        return ExprValue();
+    compute(leftValue, rightValue);
+    return leftValue;
+}
+
+void DivNode::compute(ExprValue& leftValue, ExprValue& rightValue)
+{
+    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF) {
+        leftValue = ExprValue();
+        return;
+    }
 
     // even if both args are integer, we perform the division in double, to reduce surprises;
     // for now we only support num/num, unit/num, plus and unit/unit only if the two units are convertible
@@ -348,15 +377,22 @@ ExprValue DivNode::evaluate(Context *context) const
     leftValue.dbl = leftValue.dbl / rightValue.dbl;
     if (!opp_isempty(rightValue.unit))
         leftValue.unit = nullptr;
-    return leftValue;
 }
 
 ExprValue ModNode::evaluate(Context *context) const
 {
     ExprValue leftValue = child1->tryEvaluate(context);
     ExprValue rightValue = child2->tryEvaluate(context);
-    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF)
-        return ExprValue();
+    compute(leftValue, rightValue);
+    return leftValue;
+}
+
+void ModNode::compute(ExprValue& leftValue, ExprValue& rightValue)
+{
+    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF) {
+        leftValue = ExprValue();
+        return;
+    }
 
     if (leftValue.type == ExprValue::INT && rightValue.type == ExprValue::INT) {  // both ints -> integer modulo
         ensureNoLogarithmicUnit(rightValue);
@@ -364,7 +400,6 @@ ExprValue ModNode::evaluate(Context *context) const
         if (!opp_isempty(rightValue.unit) || !opp_isempty(leftValue.unit))
             bringToCommonTypeAndUnit(leftValue, rightValue);
         leftValue.intv = leftValue.intv % rightValue.intv;
-        return leftValue;
     }
     else
         errorIntegerArgsExpected(leftValue, rightValue);
@@ -374,22 +409,30 @@ ExprValue PowNode::evaluate(Context *context) const
 {
     ExprValue leftValue = child1->tryEvaluate(context);
     ExprValue rightValue = child2->tryEvaluate(context);
-    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF)
-        return ExprValue();
+    compute(leftValue, rightValue);
+    return leftValue;
+}
+
+void PowNode::compute(ExprValue& leftValue, ExprValue& rightValue)
+{
+    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF) {
+        leftValue = ExprValue();
+        return;
+    }
 
     if (leftValue.type == ExprValue::INT && rightValue.type == ExprValue::INT) { // both ints -> integer exponentiation
         if (!opp_isempty(rightValue.unit) || !opp_isempty(leftValue.unit))
             errorDimlessArgsExpected(leftValue, rightValue);
         if (rightValue.intv < 0)
             throw opp_runtime_error("Negative exponent in integer exponentiation, cast operands to double to allow it");
-        return intPow(leftValue.intv, rightValue.intv);
+        leftValue = intPow(leftValue.intv, rightValue.intv);
     }
     else {
         leftValue.convertToDouble();
         rightValue.convertToDouble();
         if (!opp_isempty(rightValue.unit) || !opp_isempty(leftValue.unit))
             errorDimlessArgsExpected(leftValue, rightValue);
-        return pow(leftValue.dbl, rightValue.dbl);
+        leftValue = pow(leftValue.dbl, rightValue.dbl);
     }
 }
 
@@ -397,8 +440,16 @@ ExprValue CompareNode::evaluate(Context *context) const
 {
     ExprValue leftValue = child1->tryEvaluate(context);
     ExprValue rightValue = child2->tryEvaluate(context);
-    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF)
-        return ExprValue();
+    computeValue(leftValue, rightValue);
+    return leftValue;
+}
+
+void CompareNode::computeValue(ExprValue& leftValue, ExprValue& rightValue) const
+{
+    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF) {
+        leftValue = ExprValue();
+        return;
+    }
 
     double diff;
     if (leftValue.type==ExprValue::INT && rightValue.type==ExprValue::INT) {
@@ -421,20 +472,28 @@ ExprValue CompareNode::evaluate(Context *context) const
     else
         throw opp_runtime_error("Wrong argument type for '%s'", getName().c_str());
 
-    return compute(diff);
+    leftValue = compute(diff);
 }
 
 ExprValue MatchNode::evaluate(Context *context) const
 {
-    ExprValue value = child1->tryEvaluate(context);
-    ExprValue pattern = child2->tryEvaluate(context);
-    if (value.type == ExprValue::UNDEF || pattern.type == ExprValue::UNDEF)
-        return ExprValue();
+    ExprValue leftValue = child1->tryEvaluate(context);
+    ExprValue rightValue = child2->tryEvaluate(context);
+    compute(leftValue, rightValue);
+    return leftValue;
+}
 
-    if (value.type!=ExprValue::STRING || pattern.type!=ExprValue::STRING)
+void MatchNode::compute(ExprValue& leftValue, ExprValue& rightValue)
+{
+    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF) {
+        leftValue = ExprValue();
+        return;
+    }
+
+    if (leftValue.type!=ExprValue::STRING || rightValue.type!=ExprValue::STRING)
         throw opp_runtime_error("String operands expected for '=~'");
-    PatternMatcher matcher(pattern.s, true/*dottedpath*/, true/*fullstring*/, true/*casesensitive*/);
-    return matcher.matches(value.s);
+    PatternMatcher matcher(rightValue.s, true/*dottedpath*/, true/*fullstring*/, true/*casesensitive*/);
+    leftValue = matcher.matches(leftValue.s);
 }
 
 void MatchConstPatternNode::print(std::ostream& out, int spaciousness) const
@@ -447,12 +506,17 @@ void MatchConstPatternNode::print(std::ostream& out, int spaciousness) const
 ExprValue MatchConstPatternNode::evaluate(Context *context) const
 {
     ExprValue value = child->tryEvaluate(context);
+    compute(value);
+    return value;
+}
+
+void MatchConstPatternNode::compute(ExprValue& value) const
+{
     if (value.type == ExprValue::UNDEF)
-        return value;
+        return;
     if (value.type != ExprValue::STRING)
         throw opp_runtime_error("String operand expected for '=~'");
-    return matcher.matches(value.s);
-
+    value = matcher.matches(value.s);
 }
 
 void InlineIfNode::print(std::ostream& out, int spaciousness) const
@@ -477,12 +541,17 @@ ExprValue InlineIfNode::evaluate(Context *context) const
 ExprValue NotNode::evaluate(Context *context) const
 {
     ExprValue value = child->tryEvaluate(context);
+    compute(value);
+    return value;
+}
+
+void NotNode::compute(ExprValue& value)
+{
     if (value.type == ExprValue::UNDEF)
-        return value;
+        return;
     if (value.type != ExprValue::BOOL)
         errorBooleanArgExpected(value);
     value.bl = !value.bl;
-    return value;
 }
 
 ExprValue LogicalInfixOperatorNode::evaluate(Context *context) const
@@ -506,27 +575,40 @@ ExprValue LogicalInfixOperatorNode::evaluate(Context *context) const
 ExprValue BitwiseNotNode::evaluate(Context *context) const
 {
     ExprValue value = child->tryEvaluate(context);
+    compute(value);
+    return value;
+}
+
+void BitwiseNotNode::compute(ExprValue& value)
+{
     if (value.type == ExprValue::UNDEF)
-        return value;
+        return;
     if (value.type != ExprValue::INT)
         errorIntegerArgExpected(value);
     if (!opp_isempty(value.unit))
         errorDimlessArgExpected(value);
     value.intv = ~value.intv;
-    return value;
 }
 
 ExprValue BitwiseInfixOperatorNode::evaluate(Context *context) const
 {
     ExprValue leftValue = child1->tryEvaluate(context);
     ExprValue rightValue = child2->tryEvaluate(context);
-    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF)
-        return ExprValue();
+    computeValue(leftValue, rightValue);
+    return leftValue;
+}
+
+void BitwiseInfixOperatorNode::computeValue(ExprValue& leftValue, ExprValue& rightValue) const
+{
+    if (leftValue.type == ExprValue::UNDEF || rightValue.type == ExprValue::UNDEF) {
+        leftValue = ExprValue();
+        return;
+    }
     if (rightValue.type != ExprValue::INT || leftValue.type != ExprValue::INT)
         errorIntegerArgsExpected(leftValue, rightValue);
     if (!opp_isempty(rightValue.unit) || !opp_isempty(leftValue.unit))
         errorDimlessArgsExpected(leftValue, rightValue);
-    return compute(leftValue.intv, rightValue.intv);
+    leftValue = compute(leftValue.intv, rightValue.intv);
 }
 
 void IntCastNode::print(std::ostream& out, int spaciousness) const
@@ -537,24 +619,32 @@ void IntCastNode::print(std::ostream& out, int spaciousness) const
 ExprValue IntCastNode::evaluate(Context *context) const
 {
     ExprValue value = child->tryEvaluate(context);
+    compute(value);
+    return value;
+}
+
+void IntCastNode::compute(ExprValue& value)
+{
     switch (value.getType()) {
         case ExprValue::UNDEF:
-            return value;
+            break;
         case ExprValue::BOOL:
-            return (intval_t)( (bool)value ? 1 : 0 );
+            value = (intval_t)( (bool)value ? 1 : 0 );
+            break;
         case ExprValue::INT:
-            return value;
+            break;
         case ExprValue::DOUBLE:
-            return ExprValue(checked_int_cast<intval_t>(floor(value.doubleValue())), value.getUnit());
+            value = ExprValue(checked_int_cast<intval_t>(floor(value.doubleValue())), value.getUnit());
+            break;
         case ExprValue::STRING: {
             std::string unit;
             double d = UnitConversion::parseQuantity(value.stringValue(), unit);
-            return ExprValue(checked_int_cast<intval_t>(floor(d)), ExprValue::getPooled(unit.c_str()));
+            value = ExprValue(checked_int_cast<intval_t>(floor(d)), ExprValue::getPooled(unit.c_str()));
+            break;
         }
         default:
             throw opp_runtime_error("Cannot cast %s to int", ExprValue::getTypeName(value.getType()));
     }
-
 }
 
 void DoubleCastNode::print(std::ostream& out, int spaciousness) const
@@ -565,19 +655,28 @@ void DoubleCastNode::print(std::ostream& out, int spaciousness) const
 ExprValue DoubleCastNode::evaluate(Context *context) const
 {
     ExprValue value = child->tryEvaluate(context);
+    compute(value);
+    return value;
+}
+
+void DoubleCastNode::compute(ExprValue& value)
+{
     switch (value.getType()) {
         case ExprValue::UNDEF:
-            return value;
+            break;
         case ExprValue::BOOL:
-            return (bool)value ? 1.0 : 0.0;
+            value = (bool)value ? 1.0 : 0.0;
+            break;
         case ExprValue::INT:
-            return ExprValue((double)value.intValue(), value.getUnit());
+            value = ExprValue((double)value.intValue(), value.getUnit());
+            break;
         case ExprValue::DOUBLE:
-            return value;
+            break;
         case ExprValue::STRING: {
             std::string unit;
             double d = UnitConversion::parseQuantity(value.stringValue(), unit);
-            return ExprValue(d, ExprValue::getPooled(unit.c_str()));
+            value = ExprValue(d, ExprValue::getPooled(unit.c_str()));
+            break;
         }
         default:
             throw opp_runtime_error("Cannot cast %s to double", ExprValue::getTypeName(value.getType()));
@@ -592,15 +691,20 @@ void UnitConversionNode::print(std::ostream& out, int spaciousness) const
 ExprValue UnitConversionNode::evaluate(Context *context) const
 {
     ExprValue arg = child->tryEvaluate(context);
-    if (arg.getType() == ExprValue::UNDEF)
-        return arg;
-    if (arg.getUnit() == nullptr)
-        arg.setUnit(name.c_str());
+    compute(arg, name.c_str());
+    return arg;
+}
+
+void UnitConversionNode::compute(ExprValue& value, const char *unit)
+{
+    if (value.getType() == ExprValue::UNDEF)
+        return;
+    if (value.getUnit() == nullptr)
+        value.setUnit(unit);
     else {
-        arg.convertToDouble();
-        arg.convertTo(name.c_str());
+        value.convertToDouble();
+        value.convertTo(unit);
     }
-    return arg;
 }
 
 void MathFunc0Node::print(std::ostream& out, int spaciousness) const
@@ -689,13 +793,16 @@ void FunctionNode::print(std::ostream& out, int spaciousness) const
 
 ExprValue FunctionNode::evaluate(Context *context) const
 {
+    // note: no buffer in the node, as expressions may be shared by simulations running in different threads
     int n = children.size();
-    if (values == nullptr)
-        values = new ExprValue[n]; // spare per-call allocation
+    ExprValue localValues[MAX_LOCAL_ARGS];
+    std::unique_ptr<ExprValue[]> heapValues(n > MAX_LOCAL_ARGS ? new ExprValue[n] : nullptr);
+    ExprValue *values = heapValues ? heapValues.get() : localValues;
+    bool undefOk = acceptsUndefinedArgs();
     int i = 0;
     for (ExprNode *child : children) {
         values[i] = child->tryEvaluate(context);
-        if (values[i].type == ExprValue::UNDEF)
+        if (values[i].type == ExprValue::UNDEF && !undefOk)
             return ExprValue();
         i++;
     }
@@ -711,9 +818,11 @@ void MethodNode::print(std::ostream& out, int spaciousness) const
 
 ExprValue MethodNode::evaluate(Context *context) const
 {
+    // note: no buffer in the node, as expressions may be shared by simulations running in different threads
     int n = children.size();
-    if (values == nullptr)
-        values = new ExprValue[n]; // spare per-call allocation
+    ExprValue localValues[MAX_LOCAL_ARGS];
+    std::unique_ptr<ExprValue[]> heapValues(n > MAX_LOCAL_ARGS ? new ExprValue[n] : nullptr);
+    ExprValue *values = heapValues ? heapValues.get() : localValues;
     int i = 0;
     for (ExprNode *child : children) {
         values[i] = child->tryEvaluate(context);
@@ -61,6 +61,7 @@ public:
 //--------
 
 class COMMON_API ConstantNode : public ValueNode {
+    friend class ExprProgram;
 protected:
     ExprValue value;
 protected:
@@ -73,6 +74,7 @@ public:
 };
 
 class COMMON_API VariableNode : public ValueNode {
+    friend class ExprProgram;
 protected:
     std::string name;
 protected:
@@ -87,6 +89,7 @@ public:
 
 class COMMON_API IndexedVariableNode : public UnaryNode
 {
+    friend class ExprProgram;
 protected:
     std::string name;
 protected:
@@ -100,6 +103,7 @@ public:
 };
 
 class COMMON_API MemberNode : public UnaryNode {
+    friend class ExprProgram;
 protected:
     std::string name;
 protected:
@@ -114,6 +118,7 @@ public:
 
 class COMMON_API IndexedMemberNode : public BinaryNode
 {
+    friend class ExprProgram;
 protected:
     std::string name;
 protected:
@@ -130,6 +135,7 @@ class COMMON_API NegateNode : public UnaryOperatorNode {
 protected:
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& value);  // in place
     virtual ExprNode *dup() const override {return new NegateNode;}
     virtual std::string getName() const override {return "-";}
     virtual Precedence getPrecedence() const override {return UNARY;}
@@ -140,6 +146,7 @@ class COMMON_API AddNode : public BinaryOperatorNode {
 protected:
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& leftValue, ExprValue& rightValue);  // result is stored in leftValue
     virtual ExprNode *dup() const override {return new AddNode;}
     virtual std::string getName() const override {return "+";}
     virtual Precedence getPrecedence() const override {return ADDSUB;}
@@ -149,6 +156,7 @@ class COMMON_API SubNode : public BinaryOperatorNode {
 protected:
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& leftValue, ExprValue& rightValue);  // result is stored in leftValue
     virtual ExprNode *dup() const override {return new SubNode;}
     virtual std::string getName() const override {return "-";}
     virtual Precedence getPrecedence() const override {return ADDSUB;}
@@ -158,6 +166,7 @@ class COMMON_API MulNode : public BinaryOperatorNode {
 protected:
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& leftValue, ExprValue& rightValue);  // result is stored in leftValue
     virtual ExprNode *dup() const override {return new MulNode;}
     virtual std::string getName() const override {return "*";}
     virtual Precedence getPrecedence() const override {return MULDIV;}
@@ -167,6 +176,7 @@ class COMMON_API DivNode : public BinaryOperatorNode {
 protected:
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& leftValue, ExprValue& rightValue);  // result is stored in leftValue
     virtual ExprNode *dup() const override {return new DivNode;}
     virtual std::string getName() const override {return "/";}
     virtual Precedence getPrecedence() const override {return MULDIV;}
@@ -176,6 +186,7 @@ class COMMON_API ModNode : public BinaryOperatorNode {
 protected:
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& leftValue, ExprValue& rightValue);  // result is stored in leftValue
     virtual ExprNode *dup() const override {return new ModNode;}
     virtual std::string getName() const override {return "%";}
     virtual Precedence getPrecedence() const override {return MULDIV;}
@@ -185,15 +196,19 @@ class COMMON_API PowNode : public BinaryOperatorNode {
 protected:
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& leftValue, ExprValue& rightValue);  // result is stored in leftValue
     virtual ExprNode *dup() const override {return new PowNode;}
     virtual std::string getName() const override {return "^";}
     virtual Precedence getPrecedence() const override {return POW;}
 };
 
 class COMMON_API CompareNode : public BinaryOperatorNode {
+    friend class ExprProgram;
 protected:
     virtual ExprValue compute(double diff) const = 0;
     virtual ExprValue evaluate(Context *context) const override;
+public:
+    void computeValue(ExprValue& leftValue, ExprValue& rightValue) const;  // result is stored in leftValue
 };
 
 class COMMON_API ThreeWayComparisonNode : public CompareNode {
@@ -263,6 +278,7 @@ class COMMON_API MatchNode : public BinaryOperatorNode {
 protected:
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& leftValue, ExprValue& rightValue);  // result is stored in leftValue
     virtual ExprNode *dup() const override {return new MatchNode;}
     virtual std::string getName() const override {return "=~";}
     virtual Precedence getPrecedence() const override {return MATCH;}
@@ -278,6 +294,7 @@ public:
     MatchConstPatternNode(const PatternMatcher& matcher) : matcher(matcher) {}
     MatchConstPatternNode(const char *pattern, bool dottedpath=true, bool fullstring=true, bool casesensitive=true) :
         matcher(pattern,dottedpath, fullstring, casesensitive) {}
+    void compute(ExprValue& value) const;  // in place
     virtual ExprNode *dup() const override {return new MatchConstPatternNode(matcher);}
     virtual std::string getName() const override {return "=~<PATTERN>";}
     virtual Precedence getPrecedence() const override {return MATCH;}
@@ -297,12 +314,14 @@ class COMMON_API NotNode : public UnaryOperatorNode {
 protected:
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& value);  // in place
     virtual ExprNode *dup() const override {return new NotNode;}
     virtual std::string getName() const override {return "!";}
     virtual Precedence getPrecedence() const override {return UNARY;}
 };
 
 class COMMON_API LogicalInfixOperatorNode : public BinaryOperatorNode {
+    friend class ExprProgram;
 protected:
     virtual ExprValue evaluate(Context *context) const override;
     virtual bool shortcut(bool left) const = 0;
@@ -343,6 +362,7 @@ class COMMON_API BitwiseNotNode : public UnaryOperatorNode {
 protected:
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& value);  // in place
     virtual ExprNode *dup() const override {return new BitwiseNotNode;}
     virtual std::string getName() const override {return "~";}
     virtual Precedence getPrecedence() const override {return UNARY;}
@@ -352,6 +372,8 @@ class COMMON_API BitwiseInfixOperatorNode : public BinaryOperatorNode {
 protected:
     virtual intval_t compute(intval_t a, intval_t b) const = 0;
     virtual ExprValue evaluate(Context *context) const override;
+public:
+    void computeValue(ExprValue& leftValue, ExprValue& rightValue) const;  // result is stored in leftValue
 };
 
 class COMMON_API BitwiseAndNode : public BitwiseInfixOperatorNode {
@@ -406,6 +428,7 @@ protected:
     virtual void print(std::ostream& out, int spaciousness) const override;
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& value);  // in place
     virtual ExprNode *dup() const override {return new IntCastNode;}
     virtual std::string getName() const override {return "int";}
     virtual Precedence getPrecedence() const override {return ELEM;}
@@ -416,12 +439,14 @@ protected:
     virtual void print(std::ostream& out, int spaciousness) const override;
     virtual ExprValue evaluate(Context *context) const override;
 public:
+    static void compute(ExprValue& value);  // in place
     virtual ExprNode *dup() const override {return new DoubleCastNode;}
     virtual std::string getName() const override {return "double";}
     virtual Precedence getPrecedence() const override {return ELEM;}
 };
 
 class COMMON_API UnitConversionNode : public UnaryNode {
+    friend class ExprProgram;
 protected:
     std::string name;
 protected:
@@ -429,12 +454,14 @@ protected:
     virtual ExprValue evaluate(Context *context) const override;
 public:
     UnitConversionNode(const char *name) : name(name) {}
+    static void compute(ExprValue& value, const char *unit);  // in place
     virtual ExprNode *dup() const override {return new UnitConversionNode(name.c_str());}
     virtual std::string getName() const override {return name;}
     virtual Precedence getPrecedence() const override {return ELEM;}
 };
 
 class COMMON_API MathFunc0Node : public LeafNode {
+    friend class ExprProgram;
 protected:
     std::string name;
     double (*f)();
@@ -449,6 +476,7 @@ public:
 };
 
 class COMMON_API MathFunc1Node : public UnaryNode {
+    friend class ExprProgram;
 protected:
     std::string name;
     double (*f)(double);
@@ -463,6 +491,7 @@ public:
 };
 
 class COMMON_API MathFunc2Node : public BinaryNode {
+    friend class ExprProgram;
 protected:
     std::string name;
     double (*f)(double,double);
@@ -477,6 +506,7 @@ public:
 };
 
 class COMMON_API MathFunc3Node : public TernaryNode {
+    friend class ExprProgram;
 protected:
     std::string name;
     double (*f)(double,double,double);
@@ -491,6 +521,7 @@ public:
 };
 
 class COMMON_API MathFunc4Node : public NaryNode {
+    friend class ExprProgram;
 protected:
     std::string name;
     double (*f)(double,double,double,double);
@@ -505,31 +536,32 @@ public:
 };
 
 class COMMON_API FunctionNode : public NaryNode {
+    friend class ExprProgram;
 protected:
+    enum { MAX_LOCAL_ARGS = 8 }; // argument values are collected in a stack buffer up to this count
     std::string name;
-    mutable ExprValue *values = nullptr; // preallocated buffer
 protected:
     virtual void print(std::ostream& out, int spaciousness) const override;
     virtual ExprValue evaluate(Context *context) const override;
     virtual ExprValue compute(Context *context, ExprValue argv[], int argc) const = 0;
+    virtual bool acceptsUndefinedArgs() const {return false;} // if false, an undefined argument makes the result undefined without calling compute()
 public:
     FunctionNode(const char *name) : name(name) {}
-    ~FunctionNode() {delete[] values;}
     virtual std::string getName() const override {return name;}
     virtual Precedence getPrecedence() const override {return ELEM;}
 };
 
 class COMMON_API MethodNode : public NaryNode {
+    friend class ExprProgram;
 protected:
+    enum { MAX_LOCAL_ARGS = 8 }; // argument values are collected in a stack buffer up to this count
     std::string name;
-    mutable ExprValue *values = nullptr; // preallocated buffer
 protected:
     virtual void print(std::ostream& out, int spaciousness) const override;
     virtual ExprValue evaluate(Context *context) const override;
     virtual ExprValue compute(Context *context, ExprValue& object, ExprValue argv[], int argc) const = 0;
 public:
     MethodNode(const char *name) : name(name) {}
-    ~MethodNode() {delete[] values;}
     virtual std::string getName() const override {return name;}
     virtual Precedence getPrecedence() const override {return ELEM;}
 };
@@ -0,0 +1,629 @@
+//==========================================================================
+//   EXPRPROGRAM.CC  - part of
+//                     OMNeT++/OMNEST
+//            Discrete System Simulation in C++
+//
+//==========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <typeinfo>
+#include "exprprogram.h"
+#include "exprnodes.h"
+#include "stringutil.h"
+
+namespace omnetpp {
+namespace common {
+namespace expression {
+
+inline bool unitMatches(const char *unit, const char *expectedUnit)
+{
+    return unit == expectedUnit || (unit && expectedUnit && strcmp(unit, expectedUnit) == 0);
+}
+
+// whether the unit is known to be linear without looking it up; expectedLinearUnit is a linear unit or nullptr
+inline bool isKnownLinear(const char *unit, const char *expectedLinearUnit)
+{
+    return unit == nullptr || (expectedLinearUnit && unitMatches(unit, expectedLinearUnit));
+}
+
+inline bool isNumeric(const ExprValue& value)
+{
+    return value.getType() == ExprValue::INT || value.getType() == ExprValue::DOUBLE;
+}
+
+ExprProgram *ExprProgram::compile(const ExprNode *tree)
+{
+    Assert(tree);
+    ExprProgram *program = new ExprProgram();
+    try {
+        program->compileNode(tree);
+    }
+    catch (std::exception&) {
+        delete program;
+        throw;
+    }
+    Assert(program->depth == 1);
+    return program;
+}
+
+ExprProgram::Instruction& ExprProgram::emit(Opcode opcode, const ExprNode *node, int stackChange)
+{
+    code.push_back(Instruction(opcode, node));
+    depth += stackChange;
+    if (depth > maxStackDepth)
+        maxStackDepth = depth;
+    return code.back();
+}
+
+const char *ExprProgram::getLinearUnit(const UnitHint& hint1, const UnitHint& hint2)
+{
+    const char *unit = (hint1.known && !opp_isempty(hint1.unit)) ? hint1.unit : (hint2.known && !opp_isempty(hint2.unit)) ? hint2.unit : nullptr;
+    return (unit && UnitConversion::isLinearUnit(unit)) ? unit : nullptr;
+}
+
+void ExprProgram::addConversion(Instruction& instr, const UnitHint& from, const UnitHint& to, bool linearOnly)
+{
+    if (!from.known || !to.known || opp_isempty(from.unit) || opp_isempty(to.unit) || unitMatches(from.unit, to.unit))
+        return;
+    if (linearOnly && (!UnitConversion::isLinearUnit(from.unit) || !UnitConversion::isLinearUnit(to.unit)))
+        return;
+    if (UnitConversion::getLinearConversion(from.unit, to.unit, instr.conversion)) {
+        instr.sourceUnit = from.unit;
+        instr.unit = to.unit;
+        instr.hasConversion = true;
+    }
+}
+
+ExprProgram::UnitHint ExprProgram::compileNode(const ExprNode *node)
+{
+    // Emits code for the node, and returns the unit its value is likely to have.
+    // The hint is used for precomputing unit conversions, and it is always
+    // verified at runtime.
+    UnitHint hint;
+    const std::type_info& type = typeid(*node);
+
+    if (type == typeid(ConstantNode)) {
+        const ExprValue& value = static_cast<const ConstantNode *>(node)->value;
+        emit(CONSTANT, node, 1).constant = value;
+        hint.known = true;
+        hint.unit = isNumeric(value) ? value.getUnit() : nullptr;
+    }
+    else if (dynamic_cast<const VariableNode *>(node)) {
+        emit(VARIABLE, node, 1);
+    }
+    else if (auto indexedVariableNode = dynamic_cast<const IndexedVariableNode *>(node)) {
+        compileNode(indexedVariableNode->getChildren()[0]);
+        emit(INDEXED_VARIABLE, node, 0);
+    }
+    else if (auto memberNode = dynamic_cast<const MemberNode *>(node)) {
+        compileNode(memberNode->getChildren()[0]);
+        emit(MEMBER, node, 0);
+    }
+    else if (auto indexedMemberNode = dynamic_cast<const IndexedMemberNode *>(node)) {
+        for (ExprNode *child : indexedMemberNode->getChildren())
+            compileNode(child);
+        emit(INDEXED_MEMBER, node, -1);
+    }
+    else if (type == typeid(NegateNode) || type == typeid(NotNode) || type == typeid(BitwiseNotNode) ||
+             type == typeid(IntCastNode) || type == typeid(DoubleCastNode))
+    {
+        std::vector<ExprNode *> children = node->getChildren();
+        UnitHint childHint = compileNode(children[0]);
+        Instruction& instr = emit(UNARY, node, 0);
+        if (type == typeid(NegateNode))
+            instr.unaryFunc = &NegateNode::compute, hint = childHint;
+        else if (type == typeid(NotNode))
+            instr.unaryFunc = &NotNode::compute, hint.known = true;
+        else if (type == typeid(BitwiseNotNode))
+            instr.unaryFunc = &BitwiseNotNode::compute, hint.known = true;
+        else if (type == typeid(IntCastNode))
+            instr.unaryFunc = &IntCastNode::compute, hint = childHint;
+        else
+            instr.unaryFunc = &DoubleCastNode::compute, hint = childHint;
+    }
+    else if (type == typeid(MatchConstPatternNode)) {
+        compileNode(node->getChildren()[0]);
+        emit(MATCH_CONST_PATTERN, node, 0);
+        hint.known = true;
+    }
+    else if (type == typeid(UnitConversionNode)) {
+        auto unitConversionNode = static_cast<const UnitConversionNode *>(node);
+        UnitHint childHint = compileNode(unitConversionNode->getChildren()[0]);
+        Instruction& instr = emit(UNIT_CONVERSION, node, 0);
+        hint.known = true;
+        hint.unit = unitConversionNode->name.c_str();
+        addConversion(instr, childHint, hint, false);
+        instr.unit = hint.unit;
+    }
+    else if (type == typeid(AddNode) || type == typeid(SubNode) || type == typeid(MulNode) || type == typeid(DivNode)) {
+        std::vector<ExprNode *> children = node->getChildren();
+        UnitHint leftHint = compileNode(children[0]);
+        UnitHint rightHint = compileNode(children[1]);
+        Opcode opcode = type == typeid(AddNode) ? ADD : type == typeid(SubNode) ? SUB : type == typeid(MulNode) ? MUL : DIV;
+        Instruction& instr = emit(opcode, node, -1);
+        instr.unit = getLinearUnit(leftHint, rightHint);
+        if (opcode == ADD || opcode == SUB) {
+            addConversion(instr, rightHint, leftHint, true);
+            hint = leftHint.known ? leftHint : rightHint;
+        }
+        else if (opcode == MUL) {
+            // at most one of the operands may have a unit
+            if (leftHint.known && leftHint.unit)
+                hint = leftHint;
+            else if (rightHint.known && rightHint.unit)
+                hint = rightHint;
+            else if (leftHint.known && rightHint.known)
+                hint.known = true;
+        }
+        else {
+            if (rightHint.known && rightHint.unit)
+                hint.known = true;
+            else if (rightHint.known)
+                hint = leftHint;
+        }
+    }
+    else if (type == typeid(ModNode) || type == typeid(PowNode) || type == typeid(MatchNode)) {
+        for (ExprNode *child : node->getChildren())
+            compileNode(child);
+        Instruction& instr = emit(BINARY, node, -1);
+        instr.binaryFunc = type == typeid(ModNode) ? &ModNode::compute : type == typeid(PowNode) ? &PowNode::compute : &MatchNode::compute;
+        hint.known = type != typeid(ModNode);
+    }
+    else if (dynamic_cast<const CompareNode *>(node)) {
+        std::vector<ExprNode *> children = node->getChildren();
+        UnitHint leftHint = compileNode(children[0]);
+        UnitHint rightHint = compileNode(children[1]);
+        Instruction& instr = emit(COMPARE, node, -1);
+        instr.compareKind =
+                type == typeid(EqualNode) ? CMP_EQ : type == typeid(NotEqualNode) ? CMP_NE :
+                type == typeid(LessThanNode) ? CMP_LT : type == typeid(LessOrEqualNode) ? CMP_LE :
+                type == typeid(GreaterThanNode) ? CMP_GT : type == typeid(GreaterOrEqualNode) ? CMP_GE : CMP_OTHER;
+        addConversion(instr, rightHint, leftHint, false);
+        hint.known = true;
+    }
+    else if (dynamic_cast<const BitwiseInfixOperatorNode *>(node)) {
+        for (ExprNode *child : node->getChildren())
+            compileNode(child);
+        emit(BITWISE, node, -1);
+        hint.known = true;
+    }
+    else if (dynamic_cast<const LogicalInfixOperatorNode *>(node)) {
+        std::vector<ExprNode *> children = node->getChildren();
+        compileNode(children[0]);
+        int left = code.size();
+        emit(LOGICAL_LEFT, node, 0);
+        compileNode(children[1]);
+        emit(LOGICAL_RIGHT, node, -1);
+        code[left].target = code.size();
+        hint.known = true;
+    }
+    else if (type == typeid(InlineIfNode)) {
+        std::vector<ExprNode *> children = node->getChildren();
+        compileNode(children[0]);
+        int cond = code.size();
+        emit(IIF_COND, node, -1);
+        UnitHint thenHint = compileNode(children[1]);
+        int jump = code.size();
+        emit(JUMP, node, 0);
+        depth--;  // the "else" branch starts with the same stack as the "then" branch
+        code[cond].target = code.size();
+        UnitHint elseHint = compileNode(children[2]);
+        code[jump].target = code[cond].undefTarget = code.size();
+        if (thenHint.known && elseHint.known && unitMatches(thenHint.unit, elseHint.unit))
+            hint = thenHint;
+    }
+    else if (type == typeid(MathFunc0Node) || type == typeid(MathFunc1Node) || type == typeid(MathFunc2Node) ||
+             type == typeid(MathFunc3Node) || type == typeid(MathFunc4Node))
+    {
+        std::vector<ExprNode *> children = node->getChildren();
+        for (ExprNode *child : children)
+            compileNode(child);
+        int argc = children.size();
+        Instruction& instr = emit(MATH, node, 1 - argc);
+        instr.argc = argc;
+        if (type == typeid(MathFunc0Node))
+            instr.f0 = static_cast<const MathFunc0Node *>(node)->f;
+        else if (type == typeid(MathFunc1Node))
+            instr.f1 = static_cast<const MathFunc1Node *>(node)->f;
+        else if (type == typeid(MathFunc2Node))
+            instr.f2 = static_cast<const MathFunc2Node *>(node)->f;
+        else if (type == typeid(MathFunc3Node))
+            instr.f3 = static_cast<const MathFunc3Node *>(node)->f;
+        else
+            instr.f4 = static_cast<const MathFunc4Node *>(node)->f;
+        hint.known = true;
+    }
+    else if (dynamic_cast<const FunctionNode *>(node) || dynamic_cast<const MethodNode *>(node)) {
+        // like the interpreter, stop evaluating arguments at the first undefined one
+        auto functionNode = dynamic_cast<const FunctionNode *>(node);
+        bool checkArgs = !functionNode || !functionNode->acceptsUndefinedArgs();
+        std::vector<ExprNode *> children = node->getChildren();
+        std::vector<int> argChecks;
+        int argc = 0;
+        for (ExprNode *child : children) {
+            compileNode(child);
+            argc++;
+            if (checkArgs) {
+                argChecks.push_back(code.size());
+                emit(ARG_CHECK, node, 0).argc = argc;
+            }
+        }
+        emit(functionNode ? CALL_FUNCTION : CALL_METHOD, node, 1 - argc).argc = argc;
+        for (int i : argChecks)
+            code[i].target = code.size();
+    }
+    else {
+        emit(NODE, node, 1);
+    }
+    return hint;
+}
+
+ExprValue ExprProgram::evaluate(Context *context) const
+{
+    if (code.size() == 1 && code[0].opcode == CONSTANT)
+        return code[0].constant;  // folded constant
+    if (code.size() == 1 && code[0].opcode == NODE)
+        return code[0].node->tryEvaluate(context);  // e.g. a lone parameter reference; spare the stack setup
+
+    // note: no buffer in the program, as expressions may be shared by simulations running in different threads
+    ExprValue localStack[MAX_LOCAL_STACK];
+    std::unique_ptr<ExprValue[]> heapStack(maxStackDepth > MAX_LOCAL_STACK ? new ExprValue[maxStackDepth] : nullptr);
+    ExprValue *stack = heapStack ? heapStack.get() : localStack;
+    ExprValue *sp = stack; // points to the first free slot
+
+    int pc = 0;
+    int n = code.size();
+    try {
+        while (pc < n) {
+            const Instruction& instr = code[pc];
+            switch (instr.opcode) {
+                case CONSTANT:
+                    *sp++ = instr.constant;
+                    break;
+
+                case NODE:
+                    *sp++ = instr.node->evaluate(context);
+                    break;
+
+                case VARIABLE:
+                    *sp++ = static_cast<const VariableNode *>(instr.node)->getValue(context);
+                    break;
+
+                case INDEXED_VARIABLE: {
+                    ExprValue& indexValue = sp[-1];
+                    intval_t index = indexValue.intValue();
+                    if (indexValue.getUnit() != nullptr)
+                        throw opp_runtime_error("Index must be dimensionless");
+                    indexValue = static_cast<const IndexedVariableNode *>(instr.node)->getValue(context, index);
+                    break;
+                }
+
+                case MEMBER: {
+                    ExprValue result = static_cast<const MemberNode *>(instr.node)->getValue(context, sp[-1]);
+                    sp[-1] = result;
+                    break;
+                }
+
+                case INDEXED_MEMBER: {
+                    ExprValue& indexValue = sp[-1];
+                    intval_t index = indexValue.intValue();
+                    if (indexValue.getUnit() != nullptr)
+                        throw opp_runtime_error("Index must be dimensionless");
+                    ExprValue result = static_cast<const IndexedMemberNode *>(instr.node)->getValue(context, sp[-2], index);
+                    sp[-2] = result;
+                    sp--;
+                    break;
+                }
+
+                case UNARY:
+                    instr.unaryFunc(sp[-1]);
+                    break;
+
+                case MATCH_CONST_PATTERN:
+                    static_cast<const MatchConstPatternNode *>(instr.node)->compute(sp[-1]);
+                    break;
+
+                case UNIT_CONVERSION: {
+                    ExprValue& value = sp[-1];
+                    if (value.type == ExprValue::UNDEF)
+                        ;
+                    else if (value.unit == nullptr)
+                        value.setUnit(instr.unit);
+                    else if (instr.hasConversion && unitMatches(value.unit, instr.sourceUnit)) {
+                        value.convertToDouble();
+                        value.dbl = UnitConversion::applyLinearConversion(value.dbl, instr.conversion);
+                        value.unit = instr.unit;
+                    }
+                    else
+                        UnitConversionNode::compute(value, instr.unit);
+                    break;
+                }
+
+                case ADD:
+                case SUB: {
+                    ExprValue& left = sp[-2];
+                    ExprValue& right = sp[-1];
+                    bool isAdd = instr.opcode == ADD;
+                    if (left.type == right.type && isNumeric(left) && unitMatches(left.unit, right.unit) && isKnownLinear(left.unit, instr.unit)) {
+                        if (left.type == ExprValue::DOUBLE)
+                            left.dbl = isAdd ? left.dbl + right.dbl : left.dbl - right.dbl;
+                        else
+                            left.intv = isAdd ? safeAdd(left.intv, right.intv) : safeSub(left.intv, right.intv);
+                    }
+                    else if (instr.hasConversion && isNumeric(left) && isNumeric(right) && (left.type == ExprValue::DOUBLE || right.type == ExprValue::DOUBLE) &&
+                             unitMatches(left.unit, instr.unit) && unitMatches(right.unit, instr.sourceUnit))
+                    {
+                        right.convertToDouble();
+                        left.convertToDouble();
+                        double rightDbl = UnitConversion::applyLinearConversion(right.dbl, instr.conversion);
+                        left.dbl = isAdd ? left.dbl + rightDbl : left.dbl - rightDbl;
+                    }
+                    else if (isAdd)
+                        AddNode::compute(left, right);
+                    else
+                        SubNode::compute(left, right);
+                    sp--;
+                    break;
+                }
+
+                case MUL: {
+                    ExprValue& left = sp[-2];
+                    ExprValue& right = sp[-1];
+                    if (left.type == right.type && isNumeric(left) && (left.unit == nullptr || right.unit == nullptr) &&
+                            isKnownLinear(left.unit, instr.unit) && isKnownLinear(right.unit, instr.unit))
+                    {
+                        if (left.type == ExprValue::DOUBLE)
+                            left.dbl = left.dbl * right.dbl;
+                        else
+                            left.intv = safeMul(left.intv, right.intv);
+                        if (left.unit == nullptr)
+                            left.unit = right.unit;
+                    }
+                    else
+                        MulNode::compute(left, right);
+                    sp--;
+                    break;
+                }
+
+                case DIV: {
+                    ExprValue& left = sp[-2];
+                    ExprValue& right = sp[-1];
+                    if (left.type == ExprValue::DOUBLE && right.type == ExprValue::DOUBLE &&
+                            (right.unit == nullptr || unitMatches(left.unit, right.unit)) && isKnownLinear(left.unit, instr.unit))
+                    {
+                        left.dbl = left.dbl / right.dbl;
+                        if (!opp_isempty(right.unit))
+                            left.unit = nullptr;
+                    }
+                    else
+                        DivNode::compute(left, right);
+                    sp--;
+                    break;
+                }
+
+                case BINARY:
+                    instr.binaryFunc(sp[-2], sp[-1]);
+                    sp--;
+                    break;
+
+                case COMPARE: {
+                    ExprValue& left = sp[-2];
+                    ExprValue& right = sp[-1];
+                    double diff;
+                    if (left.type == ExprValue::DOUBLE && right.type == ExprValue::DOUBLE && unitMatches(left.unit, right.unit))
+                        diff = left.dbl == right.dbl ? 0 : left.dbl - right.dbl;
+                    else if (left.type == ExprValue::INT && right.type == ExprValue::INT && unitMatches(left.unit, right.unit))
+                        diff = left.intv - right.intv;
+                    else if (isNumeric(left) && isNumeric(right) && unitMatches(left.unit, right.unit)) {
+                        left.convertToDouble();  // mixed integer and double, e.g. "x > 2"
+                        right.convertToDouble();
+                        diff = left.dbl == right.dbl ? 0 : left.dbl - right.dbl;
+                    }
+                    else if (instr.hasConversion && isNumeric(left) && isNumeric(right) && (left.type == ExprValue::DOUBLE || right.type == ExprValue::DOUBLE) &&
+                             unitMatches(left.unit, instr.unit) && unitMatches(right.unit, instr.sourceUnit))
+                    {
+                        left.convertToDouble();
+                        right.convertToDouble();
+                        double rightDbl = UnitConversion::applyLinearConversion(right.dbl, instr.conversion);
+                        diff = left.dbl == rightDbl ? 0 : left.dbl - rightDbl;
+                    }
+                    else {
+                        static_cast<const CompareNode *>(instr.node)->computeValue(left, right);
+                        sp--;
+                        break;
+                    }
+                    switch (instr.compareKind) {
+                        case CMP_EQ: left = diff == 0; break;
+                        case CMP_NE: left = diff != 0; break;
+                        case CMP_LT: left = diff < 0; break;
+                        case CMP_LE: left = diff <= 0; break;
+                        case CMP_GT: left = diff > 0; break;
+                        case CMP_GE: left = diff >= 0; break;
+                        default: left = static_cast<const CompareNode *>(instr.node)->compute(diff);
+                    }
+                    sp--;
+                    break;
+                }
+
+                case BITWISE:
+                    static_cast<const BitwiseInfixOperatorNode *>(instr.node)->computeValue(sp[-2], sp[-1]);
+                    sp--;
+                    break;
+
+                case LOGICAL_LEFT: {
+                    ExprValue& left = sp[-1];
+                    if (left.type == ExprValue::UNDEF) {
+                        pc = instr.target;
+                        continue;
+                    }
+                    if (left.type != ExprValue::BOOL)
+                        ExprNode::errorBooleanArgExpected(left);
+                    auto logicalNode = static_cast<const LogicalInfixOperatorNode *>(instr.node);
+                    if (logicalNode->shortcut(left.bl)) {
+                        left = logicalNode->compute(left.bl, false); // value of 2nd arg is irrelevant
+                        pc = instr.target;
+                        continue;
+                    }
+                    break;
+                }
+
+                case LOGICAL_RIGHT: {
+                    ExprValue& left = sp[-2];
+                    ExprValue& right = sp[-1];
+                    if (right.type == ExprValue::UNDEF)
+                        left = ExprValue();
+                    else {
+                        if (right.type != ExprValue::BOOL)
+                            ExprNode::errorBooleanArgExpected(right);
+                        left = static_cast<const LogicalInfixOperatorNode *>(instr.node)->compute(left.bl, right.bl);
+                    }
+                    sp--;
+                    break;
+                }
+
+                case IIF_COND: {
+                    ExprValue& cond = sp[-1];
+                    if (cond.type == ExprValue::UNDEF) {
+                        pc = instr.undefTarget; // result is the undefined condition
+                        continue;
+                    }
+                    if (cond.type != ExprValue::BOOL)
+                        ExprNode::errorBooleanArgExpected(cond);
+                    sp--;
+                    if (!cond.bl) {
+                        pc = instr.target;
+                        continue;
+                    }
+                    break;
+                }
+
+                case JUMP:
+                    pc = instr.target;
+                    continue;
+
+                case ARG_CHECK:
+                    if (sp[-1].type == ExprValue::UNDEF) {
+                        sp -= instr.argc;
+                        *sp++ = ExprValue();
+                        pc = instr.target;
+                        continue;
+                    }
+                    break;
+
+                case MATH: {
+                    ExprValue *args = sp - instr.argc;
+                    bool undef = false;
+                    for (int i = 0; i < instr.argc; i++)
+                        if (args[i].type == ExprValue::UNDEF)
+                            undef = true;
+                    if (undef)
+                        args[0] = ExprValue();
+                    else {
+                        for (int i = 0; i < instr.argc; i++)
+                            ExprNode::ensureDimlessDoubleArg(args[i]);
+                        switch (instr.argc) {
+                            case 0: args[0] = instr.f0(); break;
+                            case 1: args[0] = instr.f1(args[0].dbl); break;
+                            case 2: args[0] = instr.f2(args[0].dbl, args[1].dbl); break;
+                            case 3: args[0] = instr.f3(args[0].dbl, args[1].dbl, args[2].dbl); break;
+                            case 4: args[0] = instr.f4(args[0].dbl, args[1].dbl, args[2].dbl, args[3].dbl); break;
+                        }
+                    }
+                    sp = args + 1;
+                    break;
+                }
+
+                case CALL_FUNCTION: {
+                    ExprValue *args = sp - instr.argc;
+                    ExprValue result = static_cast<const FunctionNode *>(instr.node)->compute(context, args, instr.argc);
+                    args[0] = result;
+                    sp = args + 1;
+                    break;
+                }
+
+                case CALL_METHOD: {
+                    ExprValue *args = sp - instr.argc;
+                    ExprValue result = static_cast<const MethodNode *>(instr.node)->compute(context, args[0], args + 1, instr.argc - 1);
+                    args[0] = result;
+                    sp = args + 1;
+                    break;
+                }
+            }
+            pc++;
+        }
+    }
+    catch (const ExprNode::eval_error& e) {
+        throw;
+    }
+    catch (std::exception& e) {
+        throw ExprNode::eval_error(code[pc].node->makeErrorMessage(e));
+    }
+    Assert(sp == stack + 1);
+    return std::move(stack[0]);
+}
+
+const char *ExprProgram::getOpcodeName(Opcode opcode)
+{
+    switch (opcode) {
+        case CONSTANT: return "CONSTANT";
+        case NODE: return "NODE";
+        case VARIABLE: return "VARIABLE";
+        case INDEXED_VARIABLE: return "INDEXED_VARIABLE";
+        case MEMBER: return "MEMBER";
+        case INDEXED_MEMBER: return "INDEXED_MEMBER";
+        case UNARY: return "UNARY";
+        case MATCH_CONST_PATTERN: return "MATCH_CONST_PATTERN";
+        case UNIT_CONVERSION: return "UNIT_CONVERSION";
+        case ADD: return "ADD";
+        case SUB: return "SUB";
+        case MUL: return "MUL";
+        case DIV: return "DIV";
+        case BINARY: return "BINARY";
+        case COMPARE: return "COMPARE";
+        case BITWISE: return "BITWISE";
+        case LOGICAL_LEFT: return "LOGICAL_LEFT";
+        case LOGICAL_RIGHT: return "LOGICAL_RIGHT";
+        case IIF_COND: return "IIF_COND";
+        case JUMP: return "JUMP";
+        case ARG_CHECK: return "ARG_CHECK";
+        case MATH: return "MATH";
+        case CALL_FUNCTION: return "CALL_FUNCTION";
+        case CALL_METHOD: return "CALL_METHOD";
+    }
+    return "???";
+}
+
+std::string ExprProgram::str() const
+{
+    std::stringstream out;
+    for (int pc = 0; pc < (int)code.size(); pc++) {
+        const Instruction& instr = code[pc];
+        out << pc << ": " << getOpcodeName(instr.opcode);
+        switch (instr.opcode) {
+            case CONSTANT: out << " " << instr.constant.str(); break;
+            case UNIT_CONVERSION: out << " " << instr.unit; break;
+            case JUMP: case LOGICAL_LEFT: out << " ->" << instr.target; break;
+            case IIF_COND: out << " ->" << instr.target << " undef->" << instr.undefTarget; break;
+            case ARG_CHECK: out << " " << instr.argc << " ->" << instr.target; break;
+            case NODE: case VARIABLE: out << " " << instr.node->str(); break;
+            default: out << " " << instr.node->getName(); if (instr.argc) out << "/" << instr.argc; break;
+        }
+        if (instr.hasConversion)
+            out << " (" << instr.sourceUnit << "->" << instr.unit << " precomputed)";
+        out << "\n";
+    }
+    return out.str();
+}
+
+}  // namespace expression
+}  // namespace common
+}  // namespace omnetpp
@@ -0,0 +1,142 @@
+//==========================================================================
+//  EXPRPROGRAM.H  - part of
+//                     OMNeT++/OMNEST
+//            Discrete System Simulation in C++
+//
+//==========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_COMMON_EXPRPROGRAM_H
+#define __OMNETPP_COMMON_EXPRPROGRAM_H
+
+#include <string>
+#include <vector>
+#include "exprnode.h"
+
+namespace omnetpp {
+namespace common {
+namespace expression {
+
+/**
+ * An expression tree compiled into a flat sequence of instructions for a
+ * stack machine. Evaluating the program produces the same result (or error)
+ * as calling tryEvaluate() on the tree, but without the virtual call and
+ * exception frame per node. Math functions are bound to their function
+ * pointers, and functions and methods are invoked via FunctionNode::compute()
+ * and MethodNode::compute() directly. Unit conversions between units that
+ * can be inferred at compile time are looked up at compile time; such
+ * inferences are verified at runtime, so a wrong guess only costs performance.
+ *
+ * Nodes the compiler does not know (e.g. parameter references) are invoked
+ * as a whole, via their evaluate() method. Subclasses of VariableNode,
+ * IndexedVariableNode, MemberNode, IndexedMemberNode, FunctionNode, MethodNode,
+ * CompareNode, LogicalInfixOperatorNode and BitwiseInfixOperatorNode are
+ * compiled according to the extension points of these classes (getValue(),
+ * compute(), etc.), so they must not override evaluate().
+ *
+ * The program refers to the nodes of the tree, so it must not outlive it.
+ * The program is immutable after compilation, and can be evaluated from
+ * several threads concurrently.
+ */
+class COMMON_API ExprProgram
+{
+  public:
+    enum Opcode {
+        CONSTANT,           // push constant
+        NODE,               // push node->evaluate()
+        VARIABLE,           // push VariableNode::getValue()
+        INDEXED_VARIABLE,   // replace index with IndexedVariableNode::getValue()
+        MEMBER,             // replace object with MemberNode::getValue()
+        INDEXED_MEMBER,     // replace object and index with IndexedMemberNode::getValue()
+        UNARY,              // unaryFunc() on the top of the stack, in place
+        MATCH_CONST_PATTERN,// MatchConstPatternNode::compute() on the top of the stack
+        UNIT_CONVERSION,    // convert the top of the stack to unit
+        ADD, SUB, MUL, DIV, // arithmetic with fast paths; result replaces the two operands
+        BINARY,             // binaryFunc() on the two topmost values; result replaces them
+        COMPARE,            // comparison of the two topmost values; result replaces them
+        BITWISE,            // BitwiseInfixOperatorNode::computeValue() on the two topmost values
+        LOGICAL_LEFT,       // checks left operand, jumps to target if it decides the result
+        LOGICAL_RIGHT,      // combines left and right operands
+        IIF_COND,           // pops condition, jumps to target (the "else" branch) if false
+        JUMP,               // jump to target
+        ARG_CHECK,          // if the top of the stack is undefined, replaces the argc topmost values with it and jumps to target
+        MATH,               // math function of argc arguments
+        CALL_FUNCTION,      // FunctionNode::compute() with argc arguments
+        CALL_METHOD         // MethodNode::compute() with the object and argc-1 arguments
+    };
+
+    enum CompareKind { CMP_EQ, CMP_NE, CMP_LT, CMP_LE, CMP_GT, CMP_GE, CMP_OTHER };
+
+    struct Instruction {
+        Opcode opcode;
+        const ExprNode *node = nullptr; // the node the instruction was compiled from; used for calls and error messages
+        ExprValue constant;             // CONSTANT
+        int argc = 0;                   // MATH, ARG_CHECK, CALL_FUNCTION, CALL_METHOD
+        int target = -1;                // jump target
+        int undefTarget = -1;           // IIF_COND: jump target for an undefined condition
+        CompareKind compareKind = CMP_OTHER; // COMPARE
+        const char *unit = nullptr;     // UNIT_CONVERSION: target unit; arithmetic: expected linear unit of the (left) operand
+        const char *sourceUnit = nullptr; // expected unit of the value to be converted to unit (if hasConversion)
+        bool hasConversion = false;     // whether conversion is filled in
+        std::vector<UnitConversion::LinearConversionStep> conversion; // from sourceUnit to unit
+        union {
+            void (*unaryFunc)(ExprValue&) = nullptr;
+            void (*binaryFunc)(ExprValue&, ExprValue&);
+            double (*f0)();
+            double (*f1)(double);
+            double (*f2)(double, double);
+            double (*f3)(double, double, double);
+            double (*f4)(double, double, double, double);
+        };
+        Instruction(Opcode opcode, const ExprNode *node) : opcode(opcode), node(node) {}
+    };
+
+  protected:
+    enum { MAX_LOCAL_STACK = 8 }; // evaluation stack is allocated on the C++ stack up to this depth
+    struct UnitHint { bool known = false; const char *unit = nullptr; };
+
+    std::vector<Instruction> code;
+    int depth = 0;
+    int maxStackDepth = 0;
+
+  protected:
+    ExprProgram() {}
+    UnitHint compileNode(const ExprNode *node);
+    Instruction& emit(Opcode opcode, const ExprNode *node, int stackChange);
+    static const char *getLinearUnit(const UnitHint& hint1, const UnitHint& hint2);
+    void addConversion(Instruction& instr, const UnitHint& from, const UnitHint& to, bool linearOnly);
+    static const char *getOpcodeName(Opcode opcode);
+
+  public:
+    /**
+     * Compiles the given expression tree.
+     */
+    static ExprProgram *compile(const ExprNode *tree);
+
+    /**
+     * Evaluates the program. Throws ExprNode::eval_error on errors.
+     */
+    ExprValue evaluate(Context *context) const;
+
+    /**
+     * Returns the number of instructions.
+     */
+    int getNumInstructions() const {return code.size();}
+
+    /**
+     * Returns a disassembly of the program, for debugging purposes.
+     */
+    std::string str() const;
+};
+
+}  // namespace expression
+}  // namespace common
+}  // namespace omnetpp
+
+#endif
@@ -28,34 +28,6 @@ namespace expression {
 
 std::string (*ExprValue::objectToString)(cObject *);
 
-void ExprValue::operator=(const ExprValue& other)
-{
-    deleteOld();
-    type = other.type;
-    switch (type) {
-        case UNDEF: break;
-        case BOOL: bl = other.bl; break;
-        case INT: intv = other.intv; unit = other.unit; break;
-        case DOUBLE: dbl = other.dbl; unit = other.unit; break;
-        case STRING: s = strdup(other.s); break;
-        case OBJECT: obj = other.obj; break;
-    }
-}
-
-void ExprValue::operator=(ExprValue&& other)
-{
-    deleteOld();
-    type = other.type;
-    switch (type) {
-        case UNDEF: break;
-        case BOOL: bl = other.bl; break;
-        case INT: intv = other.intv; unit = other.unit; break;
-        case DOUBLE: dbl = other.dbl; unit = other.unit; break;
-        case STRING: s = other.s; other.type = UNDEF; other.s = nullptr; break;
-        case OBJECT: obj = other.obj; break;
-    }
-}
-
 const char *ExprValue::getTypeName(Type t)
 {
     switch (t) {
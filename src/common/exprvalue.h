@@ -17,6 +17,7 @@
 #define __OMNETPP_COMMON_EXPRVALUE_H
 
 #include <string>
+#include <utility>
 #include "commondefs.h"
 #include "intutil.h"
 #include "stringutil.h"
@@ -71,6 +72,7 @@ class COMMON_API ExprValue
     friend class MathFunc4Node;
     friend class FunctionNode;
     friend class MethodNode;
+    friend class ExprProgram;
     friend class omnetpp::common::MatchExpression;
 
   public:
@@ -99,7 +101,7 @@ class COMMON_API ExprValue
     //@{
     ExprValue() {}
     ExprValue(const ExprValue& other) {operator=(other);}
-    ExprValue(ExprValue&& other) {operator=(other);}
+    ExprValue(ExprValue&& other) {operator=(std::move(other));}
     ExprValue(bool b)  {operator=(b);}
     ExprValue(intval_t l)  {operator=(l);}
     ExprValue(intval_t l, const char *unit)  {setQuantity(l, unit);}
@@ -326,6 +328,34 @@ class COMMON_API ExprValue
     //@}
 };
 
+inline void ExprValue::operator=(const ExprValue& other)
+{
+    deleteOld();
+    type = other.type;
+    switch (type) {
+        case UNDEF: break;
+        case BOOL: bl = other.bl; break;
+        case INT: intv = other.intv; unit = other.unit; break;
+        case DOUBLE: dbl = other.dbl; unit = other.unit; break;
+        case STRING: s = strdup(other.s); break;
+        case OBJECT: obj = other.obj; break;
+    }
+}
+
+inline void ExprValue::operator=(ExprValue&& other)
+{
+    deleteOld();
+    type = other.type;
+    switch (type) {
+        case UNDEF: break;
+        case BOOL: bl = other.bl; break;
+        case INT: intv = other.intv; unit = other.unit; break;
+        case DOUBLE: dbl = other.dbl; unit = other.unit; break;
+        case STRING: s = other.s; other.type = UNDEF; other.s = nullptr; break;
+        case OBJECT: obj = other.obj; break;
+    }
+}
+
 }  // namespace expression
 }  // namespace common
 }  // namespace omnetpp
@@ -16,6 +16,7 @@
 
 #ifdef _WIN32
 #include <direct.h>
+#include <io.h>  // _chsize_s
 #include <cstdlib>  // _MAX_PATH
 #else
 #include <unistd.h>
@@ -270,6 +271,17 @@ void removeFile(const char *fname, const char *descr)
         throw opp_runtime_error("Cannot remove %s '%s': %s", descr, fname, strerror(errno));
 }
 
+void truncateFile(FILE *f, file_offset_t size, const char *fname, const char *descr)
+{
+#ifdef _WIN32
+    int err = fflush(f) != 0 || _chsize_s(_fileno(f), size) != 0;
+#else
+    int err = fflush(f) != 0 || ftruncate(fileno(f), size) != 0;
+#endif
+    if (err || opp_fseek(f, 0, SEEK_END) != 0)
+        throw opp_runtime_error("Cannot truncate %s '%s': %s", descr, fname, strerror(errno));
+}
+
 void mkPath(const char *pathname)
 {
     if (!fileExists(pathname)) {
@@ -17,8 +17,10 @@
 #ifndef __OMNETPP_COMMON_FILEUTIL_H
 #define __OMNETPP_COMMON_FILEUTIL_H
 
+#include <cstdio>
 #include <string>
 #include <vector>
+#include "omnetpp/platdep/platmisc.h"  // file_offset_t
 #include "commondefs.h"
 
 namespace omnetpp {
@@ -109,6 +111,13 @@ COMMON_API bool isDirectory(const char *pathname);
  */
 COMMON_API void removeFile(const char *fname, const char *descr);
 
+/**
+ * Truncates the file of the given stream to the given size, and moves the
+ * stream position to the new end of the file. Buffered output is written out
+ * first. Throws an error if the file could not be truncated.
+ */
+COMMON_API void truncateFile(FILE *f, file_offset_t size, const char *fname, const char *descr);
+
 /**
  * Recursively creates all directories in the specified path
  */
@@ -15,6 +15,7 @@
 *--------------------------------------------------------------*/
 
 #include "commonutil.h"
+#include "fileutil.h"
 #include "stringutil.h"
 #include "omnetpp/platdep/platmisc.h"
 #include "omnetppscalarfilewriter.h"
@@ -57,6 +58,21 @@ void OmnetppScalarFileWriter::close()
     }
 }
 
+file_offset_t OmnetppScalarFileWriter::getFileSize()
+{
+    Assert(isOpen());
+    // the file is opened in append mode, so the stream position is only meaningful at the end
+    if (opp_fseek(f, 0, SEEK_END) != 0)
+        throw opp_runtime_error("Cannot seek in output scalar file '%s'", fname.c_str());
+    return opp_ftell(f);
+}
+
+void OmnetppScalarFileWriter::truncate(file_offset_t size)
+{
+    Assert(isOpen());
+    truncateFile(f, size, fname.c_str(), "output scalar file");
+}
+
 void OmnetppScalarFileWriter::check(int fprintfResult)
 {
     if (fprintfResult < 0) {
@@ -20,6 +20,7 @@
 #include <string>
 #include <map>
 #include <vector>
+#include "omnetpp/platdep/platmisc.h"  // file_offset_t
 #include "statistics.h"
 #include "histogram.h"
 
@@ -55,6 +56,8 @@ class COMMON_API OmnetppScalarFileWriter
     void open(const char *filename); // append if file exists
     void close();
     bool isOpen() const {return f != nullptr;} // IMPORTANT: file will be closed when an error occurs
+    file_offset_t getFileSize(); // including buffered output
+    void truncate(file_offset_t size); // discard data written after the given size (used on rollback in optimistic parallel simulation)
 
     void setPrecision(int p) {prec = p;}
     int getPrecision() const {return prec;}
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include "commonutil.h"
+#include "fileutil.h"
 #include "stringutil.h"
 #include "omnetppvectorfilewriter.h"
 
@@ -80,6 +81,44 @@ void OmnetppVectorFileWriter::open(const char *filename)
     check(fprintf(fi, "version %d\n", INDEX_FILE_VERSION));
 }
 
+static FILE *openTruncated(const std::string& fname, file_offset_t size, const char *what)
+{
+    struct opp_stat_t s;
+    if (opp_stat(fname.c_str(), &s) != 0)
+        throw opp_runtime_error("Cannot resume %s '%s': File does not exist", what, fname.c_str());
+    if ((file_offset_t)s.st_size < size)
+        throw opp_runtime_error("Cannot resume %s '%s': File is shorter than expected", what, fname.c_str());
+    FILE *f = fopen(fname.c_str(), "r+");
+    if (f == nullptr)
+        throw opp_runtime_error("Cannot open %s '%s'", what, fname.c_str());
+    try {
+        truncateFile(f, size, fname.c_str(), what);
+    }
+    catch (std::exception&) {
+        fclose(f);
+        throw;
+    }
+    return f;
+}
+
+void OmnetppVectorFileWriter::reopen(const char *filename, file_offset_t vectorFileSize, file_offset_t indexFileSize, int nextVectorId)
+{
+    Assert(vectors.empty());
+    fname = filename;
+    f = openTruncated(fname, vectorFileSize, "output vector file");
+    ifname = opp_substringbeforelast(fname, ".") + ".vci";
+    fi = openTruncated(ifname, indexFileSize, "index file");
+    this->nextVectorId = nextVectorId;
+    bufferedSamples = 0;
+}
+
+void OmnetppVectorFileWriter::truncate(file_offset_t vectorFileSize, file_offset_t indexFileSize)
+{
+    Assert(isOpen());
+    truncateFile(f, vectorFileSize, fname.c_str(), "output vector file");
+    truncateFile(fi, indexFileSize, ifname.c_str(), "index file");
+}
+
 void OmnetppVectorFileWriter::close()
 {
     if (f) {
@@ -190,6 +229,19 @@ void *OmnetppVectorFileWriter::registerVector(const std::string& componentFullPa
     return vp;
 }
 
+void *OmnetppVectorFileWriter::resumeVector(int id, size_t bufferSize, bool recordEventNumbers)
+{
+    Assert(id < nextVectorId);
+    VectorData *vp = new VectorData();
+    vp->id = id;
+    vp->recordEventNumbers = recordEventNumbers;
+    vp->bufferedSamplesLimit = bufferSize / sizeof(Sample);
+    if (vp->bufferedSamplesLimit > 0)
+        vp->buffer.reserve(vp->bufferedSamplesLimit);
+    vectors.push_back(vp);
+    return vp;
+}
+
 void OmnetppVectorFileWriter::deregisterVector(void *vectorhandle)
 {
     Assert(f != nullptr && vectorhandle != nullptr);
@@ -107,6 +107,8 @@ class COMMON_API OmnetppVectorFileWriter
     virtual ~OmnetppVectorFileWriter();
 
     void open(const char *filename); // overwrite if file exists (append not supported)
+    void reopen(const char *filename, file_offset_t vectorFileSize, file_offset_t indexFileSize, int nextVectorId); // truncate to the given sizes, and continue writing (used when resuming from a checkpoint)
+    void truncate(file_offset_t vectorFileSize, file_offset_t indexFileSize); // discard data written after the given sizes, and continue writing there (used on rollback in optimistic parallel simulation)
     void close();
     bool isOpen() const {return f != nullptr;} // IMPORTANT: file will be closed when an error occurs
 
@@ -118,10 +120,18 @@ class COMMON_API OmnetppVectorFileWriter
     void beginRecordingForRun(const std::string& runName, const StringMap& attributes, const StringMap& itervars, const OrderedKeyValueList& paramAssignments);
     void endRecordingForRun();
     void *registerVector(const std::string& componentFullPath, const std::string& name, const StringMap& attributes, size_t bufferSize, bool recordEventNumbers);
+    void *resumeVector(int id, size_t bufferSize, bool recordEventNumbers); // for a vector already declared in the file (see reopen())
+    int getVectorId(void *vechandle) const {return ((VectorData *)vechandle)->id;}
+    bool getRecordEventNumbers(void *vechandle) const {return ((VectorData *)vechandle)->recordEventNumbers;}
     void deregisterVector(void *vechandle);
     void recordInVector(void *vectorhandle, eventnumber_t eventNumber, rawsimtime_t t, int simtimeScaleExp, double value);
 
     void flush();
+
+    // current file sizes and the next vector ID (to be called after flush())
+    file_offset_t getVectorFileSize() const {return opp_ftell(f);}
+    file_offset_t getIndexFileSize() const {return opp_ftell(fi);}
+    int getNextVectorId() const {return nextVectorId;}
 };
 
 
@@ -31,6 +31,7 @@ StringPool::~StringPool()
 
 void StringPool::clear()
 {
+    std::lock_guard<std::mutex> lock(mutex);
     for (const char *str : pool)
         delete[] const_cast<char *>(str);
     pool.clear();
@@ -40,6 +41,7 @@ const char *StringPool::get(const char *s)
 {
     if (s == nullptr)
         return "";  // must not be nullptr because SWIG-generated code will crash!
+    std::lock_guard<std::mutex> lock(mutex);
     StringSet::iterator it = pool.find(s);
     if (it != pool.end())
         return *it;
@@ -51,7 +53,10 @@ const char *StringPool::get(const char *s)
 
 bool StringPool::contains(const char *s) const
 {
-    return s == nullptr ? true : pool.find(s) != pool.end();
+    if (s == nullptr)
+        return true;
+    std::lock_guard<std::mutex> lock(mutex);
+    return pool.find(s) != pool.end();
 }
 
 }  // namespace common
@@ -18,6 +18,7 @@
 #define __OMNETPP_COMMON_STRINGPOOL_H
 
 #include <set>
+#include <mutex>
 #include <cstring>
 #include "commondefs.h"
 
@@ -31,6 +32,8 @@ namespace common {
  * Note: this variant does not do reference counting, so strings do not need
  * to be released. The downside is that they will only be deallocated in the
  * stringpool object's destructor.
+ *
+ * The methods are thread-safe.
  */
 class COMMON_API StringPool
 {
@@ -48,6 +51,7 @@ class COMMON_API StringPool
     };
     typedef std::set<const char *,strless> StringSet;
     StringSet pool;
+    mutable std::mutex mutex;
 
   public:
     StringPool();
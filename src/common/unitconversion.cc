@@ -422,6 +422,58 @@ double UnitConversion::convertUnit(double value, const char *unit, const char *t
     return res;
 }
 
+bool UnitConversion::getLinearConversion(const char *unit, const char *targetUnit, std::vector<LinearConversionStep>& steps)
+{
+    // mirrors convertUnit()
+    steps.clear();
+    if (unit == targetUnit || opp_strcmp(unit, targetUnit) == 0)
+        return true;
+    if (opp_isempty(unit) || opp_isempty(targetUnit))
+        return false;
+    UnitDesc *unitDesc = lookupUnit(unit);
+    UnitDesc *targetUnitDesc = lookupUnit(targetUnit);
+    if (unitDesc == nullptr || targetUnitDesc == nullptr)
+        return false;
+    return tryGetLinearConversion(unitDesc, targetUnitDesc, steps);
+}
+
+bool UnitConversion::tryGetLinearConversion(UnitDesc *unitDesc, UnitDesc *targetUnitDesc, std::vector<LinearConversionStep>& steps)
+{
+    // mirrors tryConvert(), but records the steps instead of performing them
+    if (unitDesc == targetUnitDesc)
+        return true;
+    if (equal(unitDesc->baseUnit, targetUnitDesc->unit)) {
+        steps.push_back(LinearConversionStep{unitDesc->mult, false});
+        return unitDesc->mapping == LINEAR;
+    }
+    if (equal(unitDesc->unit, targetUnitDesc->baseUnit)) {
+        steps.push_back(LinearConversionStep{targetUnitDesc->mult, true});
+        return targetUnitDesc->mapping == LINEAR;
+    }
+
+    // convert unit to the base, and try again
+    if (!equal(unitDesc->unit, unitDesc->baseUnit)) {
+        if (unitDesc->mapping != LINEAR)
+            return false;
+        steps.push_back(LinearConversionStep{unitDesc->mult, false});
+        UnitDesc *baseUnitDesc = lookupUnit(unitDesc->baseUnit);
+        return tryGetLinearConversion(baseUnitDesc, targetUnitDesc, steps);
+    }
+
+    // try converting via the target unit's base
+    if (!equal(targetUnitDesc->unit, targetUnitDesc->baseUnit)) {
+        if (targetUnitDesc->mapping != LINEAR)
+            return false;
+        UnitDesc *targetBaseDesc = lookupUnit(targetUnitDesc->baseUnit);
+        if (!tryGetLinearConversion(unitDesc, targetBaseDesc, steps))
+            return false;
+        steps.push_back(LinearConversionStep{targetUnitDesc->mult, true});
+        return true;
+    }
+
+    return false;
+}
+
 void UnitConversion::cannotConvert(const char *unit, const char *targetUnit)
 {
     throw opp_runtime_error("Cannot convert unit %s to %s",
@@ -30,6 +30,12 @@ namespace common {
  */
 class COMMON_API UnitConversion
 {
+  public:
+    /**
+     * One step of a linear conversion, see getLinearConversion().
+     */
+    struct LinearConversionStep { double factor; bool divide; };
+
   protected:
     enum Mapping { LINEAR, LOG10 };
     struct UnitDesc { const char *unit; double mult; Mapping mapping; const char *baseUnit; const char *longName; };
@@ -53,6 +59,7 @@ class COMMON_API UnitConversion
     static double tryConvert(double d, UnitDesc *unitDesc, UnitDesc *targetUnitDesc);
     static void cannotConvert(const char *unit, const char *targetUnit);
     static double tryGetConversionFactor(UnitDesc *unitDesc, UnitDesc *targetUnitDesc);
+    static bool tryGetLinearConversion(UnitDesc *unitDesc, UnitDesc *targetUnitDesc, std::vector<LinearConversionStep>& steps);
 
   private:
     // all methods are static, no reason to instantiate
@@ -119,6 +126,24 @@ class COMMON_API UnitConversion
      */
     static double convertUnit(double d, const char *unit, const char *targetUnit);
 
+    /**
+     * Returns the conversion between the two units as a sequence of
+     * multiplications and divisions which, applied in order, yield exactly
+     * the same result as convertUnit(). This allows the conversion to be
+     * looked up once and applied many times. Returns false if the conversion
+     * is not possible, or involves a nonlinear unit (such as dBW).
+     */
+    static bool getLinearConversion(const char *unit, const char *targetUnit, std::vector<LinearConversionStep>& steps);
+
+    /**
+     * Applies a conversion obtained with getLinearConversion() to the value.
+     */
+    static double applyLinearConversion(double d, const std::vector<LinearConversionStep>& steps) {
+        for (const LinearConversionStep& step : steps)
+            d = step.divide ? d / step.factor : step.factor * d;
+        return d;
+    }
+
     /**
      * Returns the long name for the given unit, or nullptr if it is unrecognized.
      * See getAllUnits().
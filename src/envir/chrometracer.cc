@@ -0,0 +1,334 @@
+//==========================================================================
+//  CHROMETRACER.CC - part of
+//                     OMNeT++/OMNEST
+//            Discrete System Simulation in C++
+//
+//==========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <typeinfo>
+#include "common/commonutil.h"
+#include "common/fileutil.h"
+#include "omnetpp/csimulation.h"
+#include "omnetpp/cmodule.h"
+#include "omnetpp/cmessage.h"
+#include "omnetpp/cresultrecorder.h"
+#include "omnetpp/cexception.h"
+#include "chrometracer.h"
+
+using namespace omnetpp::common;
+
+namespace omnetpp {
+namespace envir {
+
+RingBufferFileWriter::RingBufferFileWriter(FILE *f, size_t capacity) :
+    f(f), buffer(capacity), capacity(capacity), head(0), tail(0)
+{
+    thread = std::thread(&RingBufferFileWriter::threadMain, this);
+}
+
+RingBufferFileWriter::~RingBufferFileWriter()
+{
+    close();
+}
+
+void RingBufferFileWriter::wakeUpWriter()
+{
+    // taking the lock ensures that the writer thread is either before checking
+    // its wait condition or already waiting, so the notification is not lost
+    { std::lock_guard<std::mutex> lock(mutex); }
+    dataAvailable.notify_one();
+}
+
+void RingBufferFileWriter::write(const char *data, size_t length)
+{
+    while (length > 0) {
+        size_t h = head.load(std::memory_order_relaxed);
+        size_t used = h - tail.load(std::memory_order_acquire);
+        if (used == capacity) {
+            // buffer full: wait for the writer thread
+            std::unique_lock<std::mutex> lock(mutex);
+            dataAvailable.notify_one();
+            spaceAvailable.wait(lock, [this] {return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire) < capacity;});
+            continue;
+        }
+        size_t n = std::min(length, capacity - used);
+        size_t pos = h % capacity;
+        size_t n1 = std::min(n, capacity - pos);
+        memcpy(buffer.data() + pos, data, n1);
+        memcpy(buffer.data(), data + n1, n - n1);
+        head.store(h + n, std::memory_order_release);
+        data += n;
+        length -= n;
+
+        // wake up the writer thread when the buffer gets half full
+        if (used < capacity/2 && used + n >= capacity/2)
+            wakeUpWriter();
+    }
+}
+
+void RingBufferFileWriter::close()
+{
+    if (!thread.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    dataAvailable.notify_one();
+    thread.join();
+}
+
+void RingBufferFileWriter::threadMain()
+{
+    bool done = false;
+    while (!done) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            dataAvailable.wait_for(lock, std::chrono::milliseconds(100), [this] {
+                return stopping || head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed) >= capacity/2;
+            });
+            done = stopping;
+        }
+        size_t h = head.load(std::memory_order_acquire);
+        size_t t = tail.load(std::memory_order_relaxed);
+        while (t != h) {
+            size_t pos = t % capacity;
+            size_t n = std::min(h - t, capacity - pos);
+            fwrite(buffer.data() + pos, 1, n, f);
+            t += n;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tail.store(t, std::memory_order_release);
+        }
+        spaceAvailable.notify_one();
+    }
+    fflush(f);
+}
+
+//----
+
+ChromeTracer::ChromeTracer(const char *fileName, const char *runId, int samplingInterval, bool traceOutsideEvents, size_t bufferSize, bool collectStatistics) :
+    fileName(fileName), collectStatistics(collectStatistics), samplingInterval(samplingInterval), traceOutsideEvents(traceOutsideEvents), tracing(traceOutsideEvents)
+{
+    if (samplingInterval < 1)
+        throw cRuntimeError("Invalid trace sampling interval %d, must be at least 1", samplingInterval);
+
+    calibrate();
+
+    mkPath(directoryOf(fileName).c_str());
+    f = fopen(fileName, "w");
+    if (f == nullptr)
+        throw cRuntimeError("Cannot open trace file '%s' for write", fileName);
+    writer = new RingBufferFileWriter(f, std::max(bufferSize, (size_t)4096));
+    setListenerNotificationsEnabled(tracing);
+
+    line = "{\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":";
+    appendString(runId);
+    line += "}}";
+    writer->write(line.data(), line.size());
+}
+
+ChromeTracer::~ChromeTracer()
+{
+    closeFile();
+}
+
+void ChromeTracer::calibrate()
+{
+#ifdef OMNETPP_PROFILER_RDTSC
+    // measure the frequency of the time stamp counter against the monotonic clock
+    int64_t startNsecs = opp_get_monotonic_clock_nsecs();
+    uint64_t startTicks = getTicks();
+    int64_t elapsedNsecs;
+    do {
+        elapsedNsecs = opp_get_monotonic_clock_nsecs() - startNsecs;
+    } while (elapsedNsecs < 10000000);
+    usecsPerTick = elapsedNsecs / 1000.0 / (getTicks() - startTicks);
+#else
+    usecsPerTick = 0.001;
+#endif
+    traceStartTicks = getTicks();
+}
+
+bool ChromeTracer::closeFile()
+{
+    if (f == nullptr)
+        return true;
+    tracing = false;
+    setListenerNotificationsEnabled(false);
+    line = "\n],\n\"displayTimeUnit\":\"ns\"}\n";
+    writer->write(line.data(), line.size());
+    writer->close();
+    delete writer;
+    writer = nullptr;
+    bool ok = !ferror(f);
+    ok = fclose(f) == 0 && ok;
+    f = nullptr;
+    return ok;
+}
+
+void ChromeTracer::appendString(const char *s)
+{
+    line += '"';
+    for (const char *p = s; *p; p++) {
+        unsigned char c = *p;
+        if (c == '"' || c == '\\') {
+            line += '\\';
+            line += c;
+        }
+        else if (c < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            line += buf;
+        }
+        else {
+            line += c;
+        }
+    }
+    line += '"';
+}
+
+void ChromeTracer::beginSlice(const char *name, const char *category, uint64_t startTicks, uint64_t endTicks)
+{
+    char buf[160];
+    line = ",\n{\"name\":";
+    appendString(name);
+    snprintf(buf, sizeof(buf), ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1,\"args\":{",
+            category, toUsecs(startTicks), (endTicks - startTicks) * usecsPerTick);
+    line += buf;
+    firstArg = true;
+}
+
+void ChromeTracer::appendArg(const char *name, const char *value)
+{
+    if (!firstArg)
+        line += ',';
+    firstArg = false;
+    appendString(name);
+    line += ':';
+    appendString(value);
+}
+
+void ChromeTracer::appendArg(const char *name, int64_t value)
+{
+    if (!firstArg)
+        line += ',';
+    firstArg = false;
+    appendString(name);
+    line += ':';
+    line += std::to_string(value);
+}
+
+void ChromeTracer::endSlice()
+{
+    line += "}}";
+    writer->write(line.data(), line.size());
+}
+
+void ChromeTracer::writeSlice(const Frame& frame, uint64_t endTicks)
+{
+    beginSlice(frame.componentPath.c_str(), frame.category, frame.startTicks, endTicks);
+    if (frame.className) {
+        appendArg("event", (int64_t)frame.eventNumber);
+        appendArg("class", frame.className);
+        appendArg("message", frame.messageName.c_str());
+    }
+    endSlice();
+}
+
+void ChromeTracer::beginEvent(cMessage *msg)
+{
+    if (collectStatistics)
+        cProfiler::beginEvent(msg);
+    eventnumber_t eventNumber = getSimulation()->getEventNumber();
+    tracing = writer != nullptr && eventNumber % samplingInterval == 0;
+    setListenerNotificationsEnabled(tracing);
+    if (tracing) {
+        cModule *module = msg->getArrivalModule();
+        stack.push_back(Frame {"event", module ? module->getFullPath() : "", msg->getClassName(), msg->getName(), eventNumber, getTicks()});
+    }
+}
+
+void ChromeTracer::endEvent()
+{
+    uint64_t endTicks = getTicks();
+    if (tracing) {
+        writeSlice(stack.back(), endTicks);
+        stack.pop_back();
+    }
+    tracing = writer != nullptr && traceOutsideEvents;
+    setListenerNotificationsEnabled(tracing);
+    if (collectStatistics)
+        cProfiler::endEvent();
+}
+
+void ChromeTracer::beginMethodCall(cComponent *component)
+{
+    if (collectStatistics)
+        cProfiler::beginMethodCall(component);
+    if (tracing)
+        stack.push_back(Frame {"method", component->getFullPath(), nullptr, "", 0, getTicks()});
+}
+
+void ChromeTracer::endMethodCall()
+{
+    uint64_t endTicks = getTicks();
+    if (tracing) {
+        writeSlice(stack.back(), endTicks);
+        stack.pop_back();
+    }
+    if (collectStatistics)
+        cProfiler::endMethodCall();
+}
+
+void ChromeTracer::emitDone(const cComponent *component, simsignal_t signalID, uint64_t startTicks)
+{
+    uint64_t endTicks = getTicks();
+    if (collectStatistics)
+        cProfiler::emitDone(component, signalID, startTicks);
+    if (tracing) {
+        const char *signalName = cComponent::getSignalName(signalID);
+        beginSlice(signalName ? signalName : "(unknown signal)", "emit", startTicks, endTicks);
+        appendArg("module", component->getFullPath().c_str());
+        endSlice();
+    }
+}
+
+void ChromeTracer::listenerDone(cIListener *listener, const cComponent *component, simsignal_t signalID, uint64_t startTicks)
+{
+    uint64_t endTicks = getTicks();
+    if (tracing) {
+        // result filters and recorders are distinguished from other listeners
+        cResultListener *resultListener = dynamic_cast<cResultListener *>(listener);
+        const char *className = resultListener ? resultListener->getClassName() : opp_typename(typeid(*listener));
+        beginSlice(className, resultListener ? "result" : "listener", startTicks, endTicks);
+        const char *signalName = cComponent::getSignalName(signalID);
+        appendArg("signal", signalName ? signalName : "(unknown signal)");
+        if (cResultRecorder *recorder = dynamic_cast<cResultRecorder *>(listener))
+            appendArg("result", recorder->getFullPath().c_str());
+        endSlice();
+    }
+}
+
+void ChromeTracer::recordResults(cSimulation *simulation)
+{
+    if (collectStatistics)
+        cProfiler::recordResults(simulation);
+    if (!closeFile())
+        throw cRuntimeError("Cannot write trace file '%s'", fileName.c_str());
+}
+
+}  // namespace envir
+}  // namespace omnetpp
+
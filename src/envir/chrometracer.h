@@ -0,0 +1,133 @@
+//==========================================================================
+//  CHROMETRACER.H - part of
+//                     OMNeT++/OMNEST
+//            Discrete System Simulation in C++
+//
+//==========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_ENVIR_CHROMETRACER_H
+#define __OMNETPP_ENVIR_CHROMETRACER_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include "omnetpp/cprofiler.h"
+#include "envirdefs.h"
+
+namespace omnetpp {
+namespace envir {
+
+/**
+ * Writes data into a file via a fixed-size ring buffer, which is drained by
+ * a background thread. write() only blocks when the buffer is full.
+ * There may be only one writer thread.
+ */
+class ENVIR_API RingBufferFileWriter
+{
+  private:
+    FILE *f;
+    std::vector<char> buffer;
+    size_t capacity;
+    std::atomic<size_t> head;  // total number of bytes written into the buffer
+    std::atomic<size_t> tail;  // total number of bytes written into the file
+    std::mutex mutex;
+    std::condition_variable dataAvailable;
+    std::condition_variable spaceAvailable;
+    bool stopping = false;
+    std::thread thread;
+
+  private:
+    void threadMain();
+    void wakeUpWriter();
+
+  public:
+    RingBufferFileWriter(FILE *f, size_t capacity);
+    ~RingBufferFileWriter();
+    void write(const char *data, size_t length);
+    void close();  // drains the buffer and stops the thread; does not close the file
+};
+
+/**
+ * A profiler that writes the timeline of the simulation into a JSON file in
+ * the Trace Event Format used by chrome://tracing and Perfetto. Each event
+ * becomes a slice, with nested slices for method calls (Enter_Method), emit()
+ * calls and the listeners (e.g. result filters and recorders) notified by them.
+ * Only every Nth event is traced if a sampling interval is given; method calls
+ * and emits outside events (e.g. during initialization) are traced unless
+ * turned off separately.
+ * Optionally, it also collects the statistics of cProfiler.
+ */
+class ENVIR_API ChromeTracer : public cProfiler
+{
+  private:
+    struct Frame {
+        const char *category;
+        std::string componentPath;
+        const char *className;  // message class for events, nullptr for method calls
+        std::string messageName;
+        eventnumber_t eventNumber;
+        uint64_t startTicks;
+    };
+
+    std::string fileName;
+    FILE *f = nullptr;
+    RingBufferFileWriter *writer = nullptr;
+    bool collectStatistics;
+    int samplingInterval;
+    bool traceOutsideEvents;
+    bool tracing;  // false during events that are not sampled, and outside events if !traceOutsideEvents
+    std::vector<Frame> stack;
+    uint64_t traceStartTicks;
+    double usecsPerTick;
+    std::string line;  // buffer for formatting a record
+    bool firstArg;
+
+  private:
+    void calibrate();
+    double toUsecs(uint64_t ticks) const {return (int64_t)(ticks - traceStartTicks) * usecsPerTick;}
+    void appendString(const char *s);
+    void beginSlice(const char *name, const char *category, uint64_t startTicks, uint64_t endTicks);
+    void appendArg(const char *name, const char *value);
+    void appendArg(const char *name, int64_t value);
+    void endSlice();
+    void writeSlice(const Frame& frame, uint64_t endTicks);
+    bool closeFile();
+
+  public:
+    /**
+     * Opens the trace file. A samplingInterval of N means that every Nth
+     * event is traced; traceOutsideEvents controls whether method calls and
+     * emits outside events are traced. If collectStatistics is true, the
+     * statistics of the base class are also collected and recorded.
+     */
+    ChromeTracer(const char *fileName, const char *runId, int samplingInterval, bool traceOutsideEvents, size_t bufferSize, bool collectStatistics);
+    virtual ~ChromeTracer();
+
+    virtual void beginEvent(cMessage *msg) override;
+    virtual void endEvent() override;
+    virtual void beginMethodCall(cComponent *component) override;
+    virtual void endMethodCall() override;
+    virtual void emitDone(const cComponent *component, simsignal_t signalID, uint64_t startTicks) override;
+    virtual void listenerDone(cIListener *listener, const cComponent *component, simsignal_t signalID, uint64_t startTicks) override;
+
+    /**
+     * Records the statistics if requested, and completes the trace file.
+     */
+    virtual void recordResults(cSimulation *simulation) override;
+};
+
+}  // namespace envir
+}  // namespace omnetpp
+
+#endif
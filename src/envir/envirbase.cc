@@ -21,6 +21,8 @@
 #include <sstream>
 #include <set>
 #include <algorithm>
+#include <climits>
+#include <memory>
 #include "common/stringtokenizer.h"
 #include "common/fnamelisttokenizer.h"
 #include "common/stringutil.h"
@@ -33,11 +35,17 @@
 #include "common/commonutil.h"
 #include "common/ver.h"
 #include "common/fileutil.h"  // splitFileName
+#include "omnetpp/ccontextswitcher.h"
 #include "omnetpp/ccoroutine.h"
 #include "omnetpp/csimulation.h"
 #include "omnetpp/cscheduler.h"
 #include "omnetpp/cfutureeventset.h"
 #include "omnetpp/cpar.h"
+#include "omnetpp/cparimpl.h"
+#include "omnetpp/clistener.h"
+#include "omnetpp/cgate.h"
+#include "omnetpp/cmodelchange.h"
+#include "omnetpp/cstatistic.h"
 #include "omnetpp/cproperties.h"
 #include "omnetpp/cproperty.h"
 #include "omnetpp/crng.h"
@@ -49,6 +57,8 @@
 #include "omnetpp/cobjectfactory.h"
 #include "omnetpp/checkandcast.h"
 #include "omnetpp/cfingerprint.h"
+#include "omnetpp/cprofiler.h"
+#include "omnetpp/ccommbuffer.h"
 #include "omnetpp/cconfigoption.h"
 #include "omnetpp/cnedmathfunction.h"
 #include "omnetpp/cnedfunction.h"
@@ -62,6 +72,8 @@
 #include "appreg.h"
 #include "valueiterator.h"
 #include "xmldoccache.h"
+#include "sectionbasedconfig.h"
+#include "chrometracer.h"
 
 #ifdef __APPLE__
 // these are needed for debugger detection
@@ -81,6 +93,8 @@
 #include "sim/parsim/cparsimpartition.h"
 #include "sim/parsim/cparsimsynchr.h"
 #include "sim/parsim/creceivedexception.h"
+#include "sim/parsim/ctopologypartitioner.h"
+#include "sim/parsim/cmemcommbuffer.h"
 #endif
 
 #ifdef USE_PORTABLE_COROUTINES  /* coroutine stacks reside in main stack area */
@@ -136,15 +150,27 @@ Register_GlobalConfigOption(CFGID_PARSIM_NUM_PARTITIONS, "parsim-num-partitions"
 Register_PerRunConfigOption(CFGID_SCHEDULER_CLASS, "scheduler-class", CFG_STRING, "omnetpp::cSequentialScheduler", "Part of the Envir plugin mechanism: selects the scheduler class. This plugin interface allows for implementing real-time, hardware-in-the-loop, distributed and distributed parallel simulation. The class has to implement the `cScheduler` interface.");
 Register_GlobalConfigOption(CFGID_PARSIM_COMMUNICATIONS_CLASS, "parsim-communications-class", CFG_STRING, "omnetpp::cFileCommunications", "If `parallel-simulation=true`, it selects the class that implements communication between partitions. The class must implement the `cParsimCommunications` interface.");
 Register_GlobalConfigOption(CFGID_PARSIM_SYNCHRONIZATION_CLASS, "parsim-synchronization-class", CFG_STRING, "omnetpp::cNullMessageProtocol", "If `parallel-simulation=true`, it selects the parallel simulation algorithm. The class must implement the `cParsimSynchronizer` interface.");
+Register_GlobalConfigOption(CFGID_PARSIM_AUTO_PARTITIONING, "parsim-auto-partitioning", CFG_BOOL, "false", "Compute the partitioning for parallel simulation from the network topology instead of reading the `partition-id` settings. The submodules of the network are distributed among `parsim-num-partitions` partitions so that the partitions are balanced (see `partition-cost`) and the links between them are few and have long delays (i.e. provide good lookahead). If `parallel-simulation=false`, the partitioning is only computed and reported, which is useful for producing `partition-id` lines for the ini file.");
+Register_GlobalConfigOption(CFGID_PARSIM_AUTO_PARTITIONING_FILE, "parsim-auto-partitioning-file", CFG_FILENAME, nullptr, "When `parsim-auto-partitioning=true`: name of a file to write the computed partitioning into, as `partition-id` lines that can be included in omnetpp.ini. With parallel simulation, only partition 0 writes the file.");
 Register_PerRunConfigOption(CFGID_EVENTLOGMANAGER_CLASS, "eventlogmanager-class", CFG_STRING, "omnetpp::envir::EventlogFileManager", "Part of the Envir plugin mechanism: selects the eventlog manager class to be used to record data. The class has to implement the `cIEventlogManager` interface.");
 Register_PerRunConfigOption(CFGID_OUTPUTVECTORMANAGER_CLASS, "outputvectormanager-class", CFG_STRING, DEFAULT_OUTPUTVECTORMANAGER_CLASS, "Part of the Envir plugin mechanism: selects the output vector manager class to be used to record data from output vectors. The class has to implement the `cIOutputVectorManager` interface.");
 Register_PerRunConfigOption(CFGID_OUTPUTSCALARMANAGER_CLASS, "outputscalarmanager-class", CFG_STRING, DEFAULT_OUTPUTSCALARMANAGER_CLASS, "Part of the Envir plugin mechanism: selects the output scalar manager class to be used to record data passed to recordScalar(). The class has to implement the `cIOutputScalarManager` interface.");
 Register_PerRunConfigOption(CFGID_SNAPSHOTMANAGER_CLASS, "snapshotmanager-class", CFG_STRING, "omnetpp::envir::FileSnapshotManager", "Part of the Envir plugin mechanism: selects the class to handle streams to which snapshot() writes its output. The class has to implement the `cISnapshotManager` interface.");
-Register_PerRunConfigOption(CFGID_FUTUREEVENTSET_CLASS, "futureeventset-class", CFG_STRING, "omnetpp::cEventHeap", "Part of the Envir plugin mechanism: selects the class for storing the future events in the simulation. The class has to implement the `cFutureEventSet` interface.");
+Register_PerRunConfigOption(CFGID_FUTUREEVENTSET_CLASS, "futureeventset-class", CFG_STRING, "omnetpp::cEventHeap", "Part of the Envir plugin mechanism: selects the class for storing the future events in the simulation. The class has to implement the `cFutureEventSet` interface. Built-in implementations are `omnetpp::cEventHeap` (binary heap), `omnetpp::cDaryEventHeap` (4-ary heap with inlined ordering keys, more cache-friendly) and `omnetpp::cCalendarQueue` (calendar queue, faster for very large event sets).");
 Register_GlobalConfigOption(CFGID_IMAGE_PATH, "image-path", CFG_PATH, "./images", "A semicolon-separated list of directories that contain module icons and other resources. This list will be concatenated with the contents of the `OMNETPP_IMAGE_PATH` environment variable or with a compile-time, hardcoded image path if the environment variable is empty.");
 Register_GlobalConfigOption(CFGID_FNAME_APPEND_HOST, "fname-append-host", CFG_BOOL, nullptr, "Turning it on will cause the host name and process Id to be appended to the names of output files (e.g. omnetpp.vec, omnetpp.sca). This is especially useful with distributed simulation. The default value is true if parallel simulation is enabled, false otherwise.");
 Register_PerRunConfigOption(CFGID_DEBUG_ON_ERRORS, "debug-on-errors", CFG_BOOL, "false", "When set to true, runtime errors will cause the simulation program to break into the C++ debugger (if the simulation is running under one, or just-in-time debugging is activated). Once in the debugger, you can view the stack trace or examine variables.");
 Register_PerRunConfigOption(CFGID_PRINT_UNDISPOSED, "print-undisposed", CFG_BOOL, "true", "Whether to report objects left (that is, not deallocated by simple module destructors) after network cleanup.");
+Register_PerRunConfigOption(CFGID_OWNERSHIP_TRACKING, "ownership-tracking", CFG_BOOL, "true", "Whether modules and channels should keep a list of the objects they own (see `cDefaultOwner`). Turning it off saves some bookkeeping on every object creation, deletion and ownership transfer, and may be useful for Cmdenv express mode runs. Turning it off gives up the guarantee that deleting the network also deletes the objects owned by modules: objects left over by module destructors are leaked, i.e. neither deallocated nor reported as undisposed. Also, the objects owned by modules do not appear in inspectors.");
+Register_PerRunConfigOption(CFGID_PRINT_STACK_USAGE, "print-stack-usage", CFG_BOOL, "false", "When enabled, Cmdenv prints the stack size and the actual stack usage (high-water mark) of `activity()` simple modules at the end of the run, which helps tuning their stack sizes. Stack usage is not available on all platforms.");
+Register_PerRunConfigOption(CFGID_PARALLEL_EVENT_THREADS, "parallel-event-threads", CFG_INT, "1", "The number of threads used for executing events that have the same arrival time and scheduling priority and are targeted at different `handleMessage()`-based simple modules with the `@parallel` NED property. 1 means sequential execution, and 0 means one thread per CPU core. The handlers of such a batch run concurrently; creating and deleting messages, `scheduleAt()`, `cancelEvent()`, `send()`, `sendDirect()`, emitting non-object signal values and recording output vectors are buffered and performed after the batch, in the original order, so results are the same as with sequential execution. A `@parallel` module may only access its own state, and must not use random numbers, enter other modules (e.g. via `Enter_Method()`), record scalars or delete modules; the latter are detected and reported as errors. Batches are only formed with the default (sequential) scheduler and when logging, eventlog recording, profiling and GUI are all inactive, e.g. in Cmdenv express mode; fingerprint calculation is supported except for the `d` ingredient.");
+Register_PerRunConfigOption(CFGID_SIGNAL_STATISTICS, "signal-statistics", CFG_BOOL, "false", "When enabled, the simulation kernel counts `emit()` calls and measures the time spent in them (including the time spent in listeners) per signal, and Cmdenv prints a summary at the end of the run. The numbers are also available via `cComponent::getSignalEmitCount()` and `getSignalEmitTime()`.");
+Register_PerRunConfigOption(CFGID_PROFILING, "profiling", CFG_BOOL, "false", "When enabled, the simulation kernel measures the CPU time spent in events, `Enter_Method()` method calls and `emit()` calls, and counts these calls, per module/channel and per message class. The numbers are recorded as scalars at the end of the run (`profileEvents`, `profileExclusiveTime`, etc.), and Cmdenv shows the modules with the largest CPU usage in express mode. Enabling profiling disables the parallel execution of same-timestamp events. See `cProfiler`.");
+Register_PerRunConfigOption(CFGID_RECORD_TRACE, "record-trace", CFG_BOOL, "false", "Enables recording the timeline of the simulation run (CPU time spent in events, `Enter_Method()` method calls, `emit()` calls and listeners such as result recorders) into a JSON file in the Trace Event Format, which can be viewed in Perfetto (ui.perfetto.dev) or chrome://tracing. See `trace-file`, `trace-sampling-interval` and `trace-buffer-size` too. Enabling tracing disables the parallel execution of same-timestamp events.");
+Register_PerRunConfigOption(CFGID_TRACE_FILE, "trace-file", CFG_FILENAME, "${resultdir}/${configname}-${iterationvarsf}#${repetition}.trace.json", "When `record-trace=true`: name of the trace file to generate.");
+Register_PerRunConfigOption(CFGID_TRACE_SAMPLING_INTERVAL, "trace-sampling-interval", CFG_INT, "1", "When `record-trace=true`: only every Nth event is recorded into the trace file, which reduces the overhead of tracing and the size of the file. See also `trace-outside-events`.");
+Register_PerRunConfigOption(CFGID_TRACE_OUTSIDE_EVENTS, "trace-outside-events", CFG_BOOL, "true", "When `record-trace=true`: whether method calls and emits outside events (e.g. during initialization and finish, or from the scheduler) are recorded into the trace file. They are not subject to `trace-sampling-interval`, so turn this off if they are numerous.");
+Register_PerRunConfigOptionU(CFGID_TRACE_BUFFER_SIZE, "trace-buffer-size", "B", "1MiB", "When `record-trace=true`: size of the ring buffer through which the trace is written into the file by a background thread. The simulation only waits for the background thread when the buffer is full.");
 Register_GlobalConfigOption(CFGID_SIMTIME_SCALE, "simtime-scale", CFG_INT, "-12", "DEPRECATED in favor of simtime-resolution. Sets the scale exponent, and thus the resolution of time for the 64-bit fixed-point simulation time representation. Accepted values are -18..0; for example, -6 selects microsecond resolution. -12 means picosecond resolution, with a maximum simtime of ~110 days.");
 Register_GlobalConfigOption(CFGID_SIMTIME_RESOLUTION, "simtime-resolution", CFG_CUSTOM, "ps", "Sets the resolution for the 64-bit fixed-point simulation time representation. Accepted values are: second-or-smaller time units (`s`, `ms`, `us`, `ns`, `ps`, `fs` or as), power-of-ten multiples of such units (e.g. 100ms), and base-10 scale exponents in the -18..0 range. The maximum representable simulation time depends on the resolution. The default is picosecond resolution, which offers a range of ~110 days.");
 Register_GlobalConfigOption(CFGID_NED_PATH, "ned-path", CFG_PATH, "", "A semicolon-separated list of directories. The directories will be regarded as roots of the NED package hierarchy, and all NED files will be loaded from their subdirectory trees. This option is normally left empty, as the OMNeT++ IDE sets the NED path automatically, and for simulations started outside the IDE it is more convenient to specify it via command-line option (-n) or via environment variable (OMNETPP_NED_PATH, NEDPATH).");
@@ -160,6 +186,10 @@ Register_PerRunConfigOptionU(CFGID_SIM_TIME_LIMIT, "sim-time-limit", "s", nullpt
 Register_PerRunConfigOptionU(CFGID_CPU_TIME_LIMIT, "cpu-time-limit", "s", nullptr, "Stops the simulation when CPU usage has reached the given limit. The default is no limit. Note: To reduce per-event overhead, this time limit is only checked every N events (by default, N=1024).");
 Register_PerRunConfigOptionU(CFGID_REAL_TIME_LIMIT, "real-time-limit", "s", nullptr, "Stops the simulation after the specified amount of time has elapsed. The default is no limit. Note: To reduce per-event overhead, this time limit is only checked every N events (by default, N=1024).");
 Register_PerRunConfigOptionU(CFGID_WARMUP_PERIOD, "warmup-period", "s", nullptr, "Length of the initial warm-up period. When set, results belonging to the first x seconds of the simulation will not be recorded into output vectors, and will not be counted into output scalars (see option `**.result-recording-modes`). This option is useful for steady-state simulations. The default is 0s (no warmup period). Note that models that compute and record scalar results manually (via `recordScalar()`) will not automatically obey this setting.");
+Register_PerRunConfigOption(CFGID_CHECKPOINT_FILE, "checkpoint-file", CFG_FILENAME, "${resultdir}/${configname}-${iterationvarsf}#${repetition}.ckp", "Name of the checkpoint file of the run. See `checkpoint-interval`, `checkpoint-real-time-interval` and `checkpoint-restore`.");
+Register_PerRunConfigOptionU(CFGID_CHECKPOINT_INTERVAL, "checkpoint-interval", "s", nullptr, "When set, the complete state of the simulation is saved into the checkpoint file (see `checkpoint-file`) whenever simulation time passes a multiple of the given interval, overwriting the previous checkpoint. A run can then be resumed from the last checkpoint with `checkpoint-restore=true`, for example after the simulation process has been killed. Checkpointing is supported by Cmdenv, requires a simulation kernel built with parallel simulation support (WITH_PARSIM=yes), and cannot be used together with parallel simulation or eventlog recording. Models must save and restore their state in `cComponent::packCheckpoint()` and `unpackCheckpoint()`.");
+Register_PerRunConfigOptionU(CFGID_CHECKPOINT_REAL_TIME_INTERVAL, "checkpoint-real-time-interval", "s", nullptr, "When set, a checkpoint is written (see `checkpoint-interval`) whenever the given amount of real (wall clock) time has elapsed since the start of the run or since the last checkpoint. Note: To reduce per-event overhead, in Cmdenv express mode this is only checked every N events (by default, N=1024).");
+Register_PerRunConfigOption(CFGID_CHECKPOINT_RESTORE, "checkpoint-restore", CFG_BOOL, "false", "When set to true and the checkpoint file of the run (see `checkpoint-file`) exists, the run is resumed from the checkpoint instead of being started from the beginning. The output vector file is truncated to its size at the time of the checkpoint and continued, and the output scalar file is written anew. The configuration must be the same as that of the run that wrote the checkpoint.");
 Register_PerRunConfigOption(CFGID_FINGERPRINT, "fingerprint", CFG_STRING, nullptr, "The expected fingerprints of the simulation. If you need multiple fingerprints, separate them with commas. When provided, the fingerprints will be calculated from the specified properties of simulation events, messages, and statistics during execution, and checked against the provided values. Fingerprints are suitable for crude regression tests. As fingerprints occasionally differ across platforms, more than one value can be specified for a single fingerprint, separated by spaces, and a match with any of them will be accepted. To obtain a fingerprint, enter a dummy value (such as `0000`), and run the simulation.");
 #ifndef USE_OMNETPP4x_FINGERPRINTS
 Register_PerRunConfigOption(CFGID_FINGERPRINTER_CLASS, "fingerprintcalculator-class", CFG_STRING, "omnetpp::cSingleFingerprintCalculator", "Part of the Envir plugin mechanism: selects the fingerprint calculator class to be used to calculate the simulation fingerprint. The class has to implement the `cFingerprintCalculator` interface.");
@@ -173,6 +203,7 @@ Register_PerRunConfigOption(CFGID_DEBUG_STATISTICS_RECORDING, "debug-statistics-
 Register_PerRunConfigOption(CFGID_CHECK_SIGNALS, "check-signals", CFG_BOOL, CHECKSIGNALS_DEFAULT, "Controls whether the simulation kernel will validate signals emitted by modules and channels against signal declarations (`@signal` properties) in NED files. The default setting depends on the build type: `true` in DEBUG, and `false` in RELEASE mode.");
 
 Register_PerObjectConfigOption(CFGID_PARTITION_ID, "partition-id", KIND_MODULE, CFG_STRING, nullptr, "With parallel simulation: in which partition the module should be instantiated. Specify numeric partition ID, or a comma-separated list of partition IDs for compound modules that span across multiple partitions. Ranges (`5..9`) and `*` (=all) are accepted too.");
+Register_PerObjectConfigOption(CFGID_PARTITION_COST, "partition-cost", KIND_MODULE, CFG_DOUBLE, nullptr, "With `parsim-auto-partitioning=true`: the expected relative share of the simulation load of a submodule of the network, used for balancing the partitions. The default is the number of simple modules in it (but at least 1).");
 Register_PerObjectConfigOption(CFGID_RNG_K, "rng-%", KIND_COMPONENT, CFG_INT, "", "Maps a module-local RNG to one of the global RNGs. Example: `**.gen.rng-1=3` maps the local RNG 1 of modules matching `**.gen` to the global RNG 3. The value may be an expression, with the `index` and `ancestorIndex()` operators being potentially very useful. The default is one-to-one mapping, i.e. RNG k of all modules refer to the global RNG k (`for k=0..num-rngs-1`).\nUsage: `<module-full-path>.rng-<local-index>=<global-index>`. Examples: `**.mac.rng-0=1; **.source[*].rng-0=index`");
 
 Register_PerRunConfigOption(CFGID_OUTPUT_SCALAR_FILE, "output-scalar-file", CFG_FILENAME, "${resultdir}/${configname}-${iterationvarsf}#${repetition}.sca", "Name for the output scalar file.");
@@ -283,8 +314,18 @@ EnvirOptions::EnvirOptions()
     verbose = true;
     useStderr = true;
     printUndisposed = true;
+    ownershipTracking = true;
+    signalStatistics = false;
+    profiling = false;
+    recordTrace = false;
+    traceSamplingInterval = 1;
+    traceBufferSize = 0;
+    printStackUsage = false;
+    parallelEventThreads = 1;
     realTimeLimit = 0;
     cpuTimeLimit = 0;
+    checkpointRealTimeInterval = 0;
+    checkpointRestore = false;
 }
 
 EnvirBase::EnvirBase() : out(std::cout.rdbuf())
@@ -332,6 +373,8 @@ EnvirBase::~EnvirBase()
         delete rngs[i];
     delete[] rngs;
 
+    delete checkpointBuffer;
+
 #ifdef WITH_PARSIM
     delete parsimComm;
     delete parsimPartition;
@@ -656,6 +699,12 @@ void EnvirBase::printHelp()
     out << "                containing spaces etc need to be enclosed in quotes. Patterns\n";
     out << "                may contain elements matching numeric ranges, in the {a..b}\n";
     out << "                syntax. See also: -q.\n";
+    out << "  -j <numjobs>  Cmdenv: execute the selected runs in <numjobs> parallel worker\n";
+    out << "                processes. The workers are forked after the NED files and the\n";
+    out << "                configuration have been loaded, and they take the next run as\n";
+    out << "                soon as they finish one. The output of each run is printed as a\n";
+    out << "                block when the run completes, and failed runs are listed at the\n";
+    out << "                end. Not available on Windows.\n";
     out << "  -n <nedpath>  List of folders to load NED files from. Folders are separated\n";
     out << "                with a semicolon (on non-Windows systems, colon may also be used).\n";
     out << "                Multiple -n options may be present. The effective NED path is\n";
@@ -793,6 +842,7 @@ void EnvirBase::shutdown()
     catch (std::exception& e) {
         displayException(e);
     }
+    cCoroutine::cleanup();
 }
 
 void EnvirBase::setupNetwork(cModuleType *network)
@@ -801,20 +851,502 @@ void EnvirBase::setupNetwork(cModuleType *network)
     currentEventClassName = nullptr;
     currentModuleId = -1;
 
+#ifdef WITH_PARSIM
+    // with parsim, partitioning must be known before the network is built
+    autoPartitioning.clear();
+    if (opt->parsim && opt->parsimAutoPartitioning)
+        computeAutoPartitioning(network);
+#endif
+
     getSimulation()->setupNetwork(network);
     eventlogManager->flush();
 
+#ifdef WITH_PARSIM
+    if (!opt->parsim && opt->parsimAutoPartitioning)
+        computeAutoPartitioning(network);
+#endif
+
     if (opt->debugStatisticsRecording)
         EnvirUtils::dumpResultRecorders(out, getSimulation()->getSystemModule());
 }
 
+/**
+ * Collects the expressions of non-volatile parameters at the time they are
+ * converted to constants, i.e. when finalizeParameters() evaluates them.
+ * Subscribed to the system module in the warmup run of warm-start branching.
+ */
+class ParamExpressionCollector : public cListener
+{
+  protected:
+    std::map<std::pair<int,int>,EnvirBase::ParamExpression>& paramExpressions;
+
+  public:
+    ParamExpressionCollector(std::map<std::pair<int,int>,EnvirBase::ParamExpression>& paramExpressions) : paramExpressions(paramExpressions) {}
+    virtual void receiveSignal(cComponent *source, simsignal_t signalID, cObject *obj, cObject *details) override;
+};
+
+void ParamExpressionCollector::receiveSignal(cComponent *source, simsignal_t signalID, cObject *obj, cObject *details)
+{
+    cPreParameterChangeNotification *notification = dynamic_cast<cPreParameterChangeNotification *>(obj);
+    if (!notification)
+        return;
+    cPar *par = notification->par;
+    cComponent *component = check_and_cast<cComponent *>(par->getOwner());
+    int parIndex = component->findPar(par->getName());
+    auto key = std::make_pair(component->getId(), parIndex);
+    auto it = paramExpressions.find(key);
+    if (it != paramExpressions.end()) {
+        delete it->second.impl;
+        paramExpressions.erase(it);
+    }
+
+    // Unset parameters only hold their default value, which may still be
+    // replaced. Before the parameters are finalized, a change of a set,
+    // non-volatile expression parameter is its conversion to a constant.
+    // Changes done by the model later are its own business.
+    if (!component->parametersFinalized() && par->isSet() && par->isExpression() && !par->isVolatile()) {
+        cComponent *evalContext = par->getEvaluationContext() ? par->getEvaluationContext() : component;
+        paramExpressions[key] = EnvirBase::ParamExpression { par->impl()->dup(), evalContext->getId() };
+    }
+}
+
+void EnvirBase::deferResultRecording()
+{
+    if (recordEventlog)
+        throw cRuntimeError("Eventlog recording is not supported with warm-start branching");
+
+    // result files will be opened by the branches, with their own names;
+    // until then, scalar results are buffered and vector data is discarded
+    removeLifecycleListener(outvectorManager);
+    removeLifecycleListener(outScalarManager);
+    removeLifecycleListener(snapshotManager);
+    resultRecordingDeferred = true;
+
+    // subscribed to the system module in moduleCreated()
+    paramExpressionCollector = new ParamExpressionCollector(paramExpressions);
+}
+
+void EnvirBase::discardBranchingState()
+{
+    for (DeferredResult& result : deferredResults)
+        delete result.statistic;
+    deferredResults.clear();
+    resultRecordingDeferred = false;
+
+    for (auto& entry : paramExpressions)
+        delete entry.second.impl;
+    paramExpressions.clear();
+
+    if (paramExpressionCollector) {
+        cModule *systemModule = getSimulation()->getSystemModule();
+        if (systemModule && systemModule->isSubscribed(PRE_MODEL_CHANGE, paramExpressionCollector))
+            systemModule->unsubscribe(PRE_MODEL_CHANGE, paramExpressionCollector);
+        delete paramExpressionCollector;
+        paramExpressionCollector = nullptr;
+    }
+}
+
+void EnvirBase::writeDeferredResults()
+{
+    // Components deleted during the warmup period cannot be passed to the
+    // managers, so their results are lost. Parameters are recorded with the
+    // values of the branch.
+    cSimulation *sim = getSimulation();
+    for (DeferredResult& result : deferredResults) {
+        cComponent *component = sim->getComponent(result.componentId);
+        if (!component)
+            continue;
+        opp_string_map *attributes = result.hasAttributes ? &result.attributes : nullptr;
+        switch (result.kind) {
+            case DeferredResult::SCALAR: outScalarManager->recordScalar(component, result.name.c_str(), result.value, attributes); break;
+            case DeferredResult::STATISTIC: outScalarManager->recordStatistic(component, result.name.c_str(), result.statistic, attributes); break;
+            case DeferredResult::PARAMETER: outScalarManager->recordParameter(&component->par(result.parIndex)); break;
+            case DeferredResult::COMPONENTTYPE: outScalarManager->recordComponentType(component); break;
+        }
+    }
+}
+
+static void collectComponents(cModule *module, std::vector<cComponent *>& result)
+{
+    result.push_back(module);
+    for (cModule::ChannelIterator it(module); !it.end(); ++it)
+        result.push_back(*it);
+    for (cModule::SubmoduleIterator it(module); !it.end(); ++it)
+        collectComponents(*it, result);
+}
+
+void EnvirBase::startBranch(const char *configName, int runNumber)
+{
+    cSimulation *sim = getSimulation();
+    std::vector<cComponent *> components;
+    collectComponents(sim->getSystemModule(), components);
+
+    // remember the parameter assignments of the warmup run
+    std::vector<std::string> oldValues;
+    for (cComponent *component : components) {
+        std::string fullPath = component->getFullPath();
+        for (int i = 0; i < component->getNumParams(); i++) {
+            cPar& par = component->par(i);
+            oldValues.push_back(opp_nulltoempty(cfg->getParameterEntry(fullPath.c_str(), par.getName(), par.containsValue()).getValue()));
+        }
+    }
+
+    std::string oldNetworkName = opt->networkName;
+    simtime_t oldSimtimeLimit = opt->simtimeLimit;
+    simtime_t oldWarmupPeriod = opt->warmupPeriod;
+
+    cfg->activateConfig(configName, runNumber);
+
+    opt->networkName = cfg->getAsString(CFGID_NETWORK);
+    opt->simtimeLimit = cfg->getAsDouble(CFGID_SIM_TIME_LIMIT, -1);
+    opt->realTimeLimit = cfg->getAsDouble(CFGID_REAL_TIME_LIMIT, -1);
+    opt->cpuTimeLimit = cfg->getAsDouble(CFGID_CPU_TIME_LIMIT, -1);
+    opt->warmupPeriod = cfg->getAsDouble(CFGID_WARMUP_PERIOD);
+    opt->seedset = cfg->getAsInt(CFGID_SEED_SET);
+    if (opt->networkName != oldNetworkName)
+        throw cRuntimeError("Network '%s' differs from the one used in the warmup period ('%s')", opt->networkName.c_str(), oldNetworkName.c_str());
+    if (opt->warmupPeriod != oldWarmupPeriod)
+        throw cRuntimeError("warmup-period=%s differs from the one used for branching (%s)", opt->warmupPeriod.str().c_str(), oldWarmupPeriod.str().c_str());
+    if (cfg->getAsInt(CFGID_NUM_RNGS) != numRNGs || cfg->getAsString(CFGID_RNG_CLASS) != opt->rngClass)
+        throw cRuntimeError("The number and class of RNGs must be the same as in the warmup period");
+
+    stopwatch.setCPUTimeLimit(opt->cpuTimeLimit);
+    stopwatch.setRealTimeLimit(opt->realTimeLimit);
+
+    // fingerprints of branches are not comparable to those of ordinary runs
+    sim->setFingerprintCalculator(nullptr);
+
+    // replace the end-of-simulation event if the time limit is different
+    if (opt->simtimeLimit != oldSimtimeLimit) {
+        cFutureEventSet *fes = sim->getFES();
+        for (int i = 0; i < fes->getLength(); i++) {
+            cEvent *event = fes->get(i);
+            if (strcmp(event->getClassName(), "omnetpp::cEndSimulationEvent") == 0) {
+                delete fes->remove(event);
+                break;
+            }
+        }
+        if (opt->simtimeLimit >= SIMTIME_ZERO) {
+            if (opt->simtimeLimit < sim->getSimTime())
+                throw cRuntimeError("sim-time-limit=%s is before the end of the warmup period", opt->simtimeLimit.str().c_str());
+            sim->setSimulationTimeLimit(opt->simtimeLimit);
+        }
+    }
+
+    // reseed the RNGs
+    for (int i = 0; i < numRNGs; i++)
+        rngs[i]->initialize(opt->seedset, i, numRNGs, getParsimProcId(), getParsimNumPartitions(), getConfig());
+
+    // the branch starts at the end of the warmup period (the next event may be later)
+    sim->setSimTime(opt->warmupPeriod);
+
+    // the parameter changes of the branch itself must not be collected
+    if (paramExpressionCollector)
+        sim->getSystemModule()->unsubscribe(PRE_MODEL_CHANGE, paramExpressionCollector);
+    applyBranchParameters(components, oldValues);
+
+    // start recording results into the files of this run
+    outvectorManager->startRun();
+    addLifecycleListener(outvectorManager);
+    outScalarManager->startRun();
+    addLifecycleListener(outScalarManager);
+    snapshotManager->startRun();
+    addLifecycleListener(snapshotManager);
+    resultRecordingDeferred = false;
+    writeDeferredResults();
+    discardBranchingState();
+}
+
+static bool containsIdentifier(const std::string& text, const std::string& name)
+{
+    for (size_t pos = text.find(name); pos != std::string::npos; pos = text.find(name, pos + 1)) {
+        bool startsWord = pos == 0 || !(opp_isalnum(text[pos-1]) || text[pos-1] == '_');
+        size_t end = pos + name.size();
+        bool endsWord = end == text.size() || !(opp_isalnum(text[end]) || text[end] == '_');
+        if (startsWord && endsWord)
+            return true;
+    }
+    return false;
+}
+
+// assigns the value of impl to par if it differs, and returns whether it did
+static bool assignIfDiffers(cPar& par, cParImpl *impl, cComponent *evalContext)
+{
+    switch (par.getType()) {
+        case cPar::BOOL: {bool v = impl->boolValue(evalContext); if (v == par.boolValue()) return false; par.setBoolValue(v); return true;}
+        case cPar::INT: {intval_t v = impl->intValue(evalContext); if (v == par.intValue()) return false; par.setIntValue(v); return true;}
+        case cPar::DOUBLE: {double v = impl->doubleValue(evalContext); if (v == par.doubleValue()) return false; par.setDoubleValue(v); return true;}
+        case cPar::STRING: {std::string v = impl->stdstringValue(evalContext); if (v == par.stdstringValue()) return false; par.setStringValue(v); return true;}
+        case cPar::XML: {cXMLElement *v = impl->xmlValue(evalContext); if (v == par.xmlValue()) return false; par.setXMLValue(v); return true;}
+        case cPar::OBJECT: throw cRuntimeError("Cannot change parameter '%s' when branching: object parameters are not supported", par.getFullPath().c_str());
+    }
+    return false;
+}
+
+void EnvirBase::applyBranchParameters(const std::vector<cComponent *>& components, const std::vector<std::string>& oldValues)
+{
+    // apply the parameter assignments that differ from those of the warmup run;
+    // components are notified via handleParameterChange()
+    std::set<std::string> changedNames;
+    std::set<cPar *> assignedPars;
+    int k = 0;
+    for (cComponent *component : components) {
+        std::string fullPath = component->getFullPath();
+        for (int i = 0; i < component->getNumParams(); i++, k++) {
+            cPar& par = component->par(i);
+            const cConfiguration::KeyValue& entry = cfg->getParameterEntry(fullPath.c_str(), par.getName(), par.containsValue());
+            const char *value = opp_nulltoempty(entry.getValue());
+            if (oldValues[k] == value)
+                continue;
+            if (opp_isempty(value) || strcmp(value, "default") == 0 || strcmp(value, "ask") == 0)
+                throw cRuntimeError("Cannot change parameter '%s' when branching: it is not assigned a value in the configuration", par.getFullPath().c_str());
+            assignedPars.insert(&par);
+            cContextSwitcher tmp(component);
+            if (par.isVolatile()) {
+                par.parse(value, entry.getBaseDirectory());
+                changedNames.insert(par.getName());
+            }
+            else {
+                // evaluate it like finalizeParameters() would
+                std::unique_ptr<cParImpl> impl(par.impl()->dup());
+                impl->setBaseDirectory(entry.getBaseDirectory());
+                impl->parse(value);
+                if (assignIfDiffers(par, impl.get(), component))
+                    changedNames.insert(par.getName());
+            }
+        }
+    }
+
+    // Re-evaluate the expressions of other non-volatile parameters (from NED
+    // or the configuration) that refer to a changed parameter, until no more
+    // values change. Parameters are matched by name, which is conservative.
+    // Expressions that don't refer to changed parameters are not re-evaluated,
+    // so e.g. random values drawn in the warmup run are kept.
+    cSimulation *sim = getSimulation();
+    bool again = !changedNames.empty();
+    for (size_t round = 0; again; round++) {
+        if (round > paramExpressions.size())
+            throw cRuntimeError("Parameter values do not settle when re-evaluating them for the branch");
+        again = false;
+        for (auto& entry : paramExpressions) {
+            cComponent *component = sim->getComponent(entry.first.first);
+            cComponent *evalContext = sim->getComponent(entry.second.evalContextId);
+            if (!component || !evalContext)
+                continue;
+            cPar& par = component->par(entry.first.second);
+            if (assignedPars.count(&par))
+                continue;
+            std::string text = entry.second.impl->str();
+            bool refersToChanged = std::any_of(changedNames.begin(), changedNames.end(), [&](const std::string& name) {return containsIdentifier(text, name);});
+            if (!refersToChanged)
+                continue;
+            cContextSwitcher tmp(component);
+            if (assignIfDiffers(par, entry.second.impl, evalContext)) {
+                changedNames.insert(par.getName());
+                again = true;
+            }
+        }
+    }
+}
+
 void EnvirBase::prepareForRun()
 {
     resetClock();
     if (opt->simtimeLimit >= SIMTIME_ZERO)
         getSimulation()->setSimulationTimeLimit(opt->simtimeLimit);
+    bool restoring = checkpointBuffer != nullptr;
+    isRestoringCheckpoint = restoring;
     getSimulation()->callInitialize();
     cLogProxy::flushLastLine();
+    if (restoring)
+        restoreCheckpoint();
+
+    if (checkpointingEnabled) {
+        nextCheckpointSimtime = SIMTIME_MAX;
+        if (opt->checkpointInterval > SIMTIME_ZERO) {
+            // a restored checkpoint was written just before the next event, don't write it again
+            simtime_t t = restoring ? getSimulation()->guessNextSimtime() : getSimulation()->getSimTime();
+            if (t >= SIMTIME_ZERO)
+                nextCheckpointSimtime = opt->checkpointInterval * (t.raw() / opt->checkpointInterval.raw() + 1);
+        }
+        nextCheckpointRealTime = opt->checkpointRealTimeInterval;
+    }
+}
+
+//-------------------------------------------------------------
+
+#define CHECKPOINT_MAGIC  "OMNETPP-CHECKPOINT-1"  // includes the file format version
+
+bool EnvirBase::isCheckpointDue(cEvent *nextEvent)
+{
+    if (nextEvent->getArrivalTime() >= nextCheckpointSimtime && opt->checkpointInterval > SIMTIME_ZERO) {
+        simtime_t interval = opt->checkpointInterval;
+        nextCheckpointSimtime = interval * (nextEvent->getArrivalTime().raw() / interval.raw() + 1);
+        nextCheckpointRealTime = getElapsedSecs() + opt->checkpointRealTimeInterval;
+        return true;
+    }
+    if (opt->checkpointRealTimeInterval > 0) {
+        if (isExpressMode() && (getSimulation()->getEventNumber() & 1023) != 0)  // don't read the clock on every event
+            return false;
+        double now = getElapsedSecs();
+        if (now >= nextCheckpointRealTime) {
+            nextCheckpointRealTime = now + opt->checkpointRealTimeInterval;
+            return true;
+        }
+    }
+    return false;
+}
+
+void EnvirBase::writeCheckpoint()
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError("Checkpointing requires a simulation kernel built with parallel simulation support (WITH_PARSIM=yes in configure.user)");
+#else
+    cSimulation *sim = getSimulation();
+    cMemCommBuffer buffer;
+
+    // identification of the run
+    buffer.pack(cfg->getActiveConfigName());
+    buffer.pack(cfg->getActiveRunNumber());
+    buffer.pack(opt->networkName.c_str());
+    buffer.pack(cfg->getVariable(CFGVAR_RUNID));
+    buffer.pack(cfg->getVariable(CFGVAR_DATETIME));
+    buffer.pack(cfg->getVariable(CFGVAR_PROCESSID));
+
+    // the output vector file is continued from its current size on restore
+    outvectorManager->flush();
+    try {
+        outvectorManager->parsimPack(&buffer);
+    }
+    catch (std::exception& e) {
+        throw cRuntimeError("Cannot write checkpoint: The output vector manager (%s) does not support checkpointing", outvectorManager->getClassName());
+    }
+
+    buffer.pack(nextUniqueNumber);
+    buffer.pack(numRNGs);
+    for (int i = 0; i < numRNGs; i++) {
+        buffer.pack(rngs[i]->getClassName());
+        rngs[i]->parsimPack(&buffer);
+    }
+
+    sim->packCheckpoint(&buffer);
+
+    // write into a temporary file first, so that the previous checkpoint
+    // survives if the process is killed while writing
+    const std::string& fname = opt->checkpointFile;
+    std::string tmpFname = fname + ".tmp";
+    mkPath(directoryOf(fname.c_str()).c_str());
+    FILE *f = fopen(tmpFname.c_str(), "wb");
+    if (f == nullptr)
+        throw cRuntimeError("Cannot open checkpoint file '%s' for write", tmpFname.c_str());
+    int64_t size = buffer.getMessageSize();
+    bool ok = fwrite(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC), 1, f) == 1 &&
+              fwrite(&size, sizeof(size), 1, f) == 1 &&
+              fwrite(buffer.getBuffer(), size, 1, f) == 1 &&
+              fflush(f) == 0;
+    // make sure the data is on the disk before the rename replaces the previous checkpoint
+#ifdef _WIN32
+    ok = ok && _commit(_fileno(f)) == 0;
+#else
+    ok = ok && fsync(fileno(f)) == 0;
+#endif
+    if (fclose(f) != 0 || !ok) {
+        unlink(tmpFname.c_str());
+        throw cRuntimeError("Cannot write checkpoint file '%s'", tmpFname.c_str());
+    }
+#ifdef _WIN32
+    unlink(fname.c_str());  // rename() does not overwrite on Windows
+#endif
+    if (rename(tmpFname.c_str(), fname.c_str()) != 0)
+        throw cRuntimeError("Cannot rename '%s' to '%s'", tmpFname.c_str(), fname.c_str());
+
+    if (opt->verbose)
+        out << "Checkpoint written at t=" << sim->getSimTime() << ", event #" << sim->getEventNumber() << " into \"" << fname << "\"" << endl;
+#endif
+}
+
+void EnvirBase::loadCheckpoint()
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError("Checkpointing requires a simulation kernel built with parallel simulation support (WITH_PARSIM=yes in configure.user)");
+#else
+    const std::string& fname = opt->checkpointFile;
+    std::ifstream in(fname, std::ios::in | std::ios::binary);
+    if (!in.is_open())
+        throw cRuntimeError("Cannot open checkpoint file '%s'", fname.c_str());
+    char magic[sizeof(CHECKPOINT_MAGIC)];
+    int64_t size = -1;
+    in.read(magic, sizeof(magic));
+    in.read((char *)&size, sizeof(size));
+    if (!in.good() || memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0 || size < 0 || size > INT_MAX)
+        throw cRuntimeError("'%s' is not a checkpoint file, or it was written by a different version or on a different platform", fname.c_str());
+
+    cMemCommBuffer *buffer = new cMemCommBuffer();
+    delete checkpointBuffer;
+    checkpointBuffer = buffer;
+    buffer->allocateAtLeast(size);
+    in.read(buffer->getBuffer(), size);
+    if (in.gcount() != size || in.peek() != EOF)
+        throw cRuntimeError("Checkpoint file '%s' is corrupt", fname.c_str());
+    buffer->setMessageSize(size);
+
+    // check that the checkpoint belongs to this run
+    opp_string configName, networkName;
+    int runNumber;
+    buffer->unpack(configName);
+    buffer->unpack(runNumber);
+    buffer->unpack(networkName);
+    if (opp_strcmp(configName.c_str(), cfg->getActiveConfigName()) != 0 || runNumber != cfg->getActiveRunNumber() || networkName.c_str() != opt->networkName)
+        throw cRuntimeError("Checkpoint file '%s' belongs to a different run (%s #%d, network %s)", fname.c_str(), configName.c_str(), runNumber, networkName.c_str());
+
+    // the resumed run keeps its original run ID, so that the result files are consistent
+    opp_string runId, datetime, processId;
+    buffer->unpack(runId);
+    buffer->unpack(datetime);
+    buffer->unpack(processId);
+    if (SectionBasedConfiguration *sbcfg = dynamic_cast<SectionBasedConfiguration *>(cfg)) {
+        sbcfg->setVariable(CFGVAR_RUNID, runId.c_str());
+        sbcfg->setVariable(CFGVAR_DATETIME, datetime.c_str());
+        sbcfg->setVariable(CFGVAR_DATETIMEF, opp_replacesubstring(datetime.c_str(), ":", "", true).c_str());
+        sbcfg->setVariable(CFGVAR_PROCESSID, processId.c_str());
+    }
+
+    outvectorManager->parsimUnpack(buffer);
+#endif
+}
+
+void EnvirBase::restoreCheckpoint()
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError("Checkpointing requires a simulation kernel built with parallel simulation support (WITH_PARSIM=yes in configure.user)");
+#else
+    cSimulation *sim = getSimulation();
+    cCommBuffer *buffer = checkpointBuffer;
+
+    buffer->unpack(nextUniqueNumber);
+    int n;
+    buffer->unpack(n);
+    if (n != numRNGs)
+        throw cRuntimeError("Cannot restore checkpoint: It contains %d RNGs instead of %d", n, numRNGs);
+    for (int i = 0; i < numRNGs; i++) {
+        opp_string className;
+        buffer->unpack(className);
+        if (opp_strcmp(className.c_str(), rngs[i]->getClassName()) != 0)
+            throw cRuntimeError("Cannot restore checkpoint: It contains RNGs of class %s instead of %s", className.c_str(), rngs[i]->getClassName());
+        rngs[i]->parsimUnpack(buffer);
+    }
+
+    sim->unpackCheckpoint(buffer);
+
+    if (!buffer->isBufferEmpty())
+        throw cRuntimeError("Cannot restore checkpoint: Checkpoint file '%s' contains extra data", opt->checkpointFile.c_str());
+    delete checkpointBuffer;
+    checkpointBuffer = nullptr;
+    isRestoringCheckpoint = false;
+
+    if (opt->verbose)
+        out << "Resumed from checkpoint at t=" << sim->getSimTime() << ", event #" << sim->getEventNumber() << endl;
+#endif
 }
 
 //-------------------------------------------------------------
@@ -911,10 +1443,76 @@ void EnvirBase::readParameter(cPar *par)
     ASSERT(par->isSet());  // and must be set after
 }
 
+#ifdef WITH_PARSIM
+void EnvirBase::computeAutoPartitioning(cModuleType *network)
+{
+    cSimulation *sim = getSimulation();
+
+    // With parsim, build the complete network first (as if the simulation
+    // was sequential) to learn the topology, then throw it away. Notifications
+    // are suppressed, so that the eventlog etc. don't see this network.
+    bool dryBuild = opt->parsim;
+    if (dryBuild) {
+        bool savedSuppressNotifications = suppressNotifications;
+        suppressNotifications = true;
+        isBuildingCompleteNetwork = true;
+        try {
+            cContextTypeSwitcher tmp(CTX_BUILD);
+            cModule *module = network->create(network->getName(), nullptr);
+            module->finalizeParameters();
+            module->buildInside();
+        }
+        catch (std::exception& e) {
+            suppressNotifications = savedSuppressNotifications;
+            isBuildingCompleteNetwork = false;
+            throw;
+        }
+        suppressNotifications = savedSuppressNotifications;
+        isBuildingCompleteNetwork = false;
+    }
+
+    cTopologyPartitioner partitioner;
+    partitioner.extractFromNetwork(sim->getSystemModule());
+    for (int i = 0; i < partitioner.getNumNodes(); i++) {
+        double cost = getConfig()->getAsDouble(partitioner.getNode(i).fullPath.c_str(), CFGID_PARTITION_COST, -1);
+        if (cost >= 0)
+            partitioner.setNodeCost(i, cost);
+    }
+    partitioner.partition(opt->parsimNumPartitions);
+
+    if (dryBuild) {
+        sim->deleteNetwork();
+        autoPartitioning = partitioner.getAssignment();
+    }
+
+    if (!opt->parsim || parsimComm->getProcId() == 0) {
+        if (opt->verbose)
+            partitioner.printReport(out);
+        std::string fname = opt->parsimAutoPartitioningFile;
+        if (fname.empty()) {
+            if (opt->verbose)
+                partitioner.printIniLines(out);
+        }
+        else {
+            std::ofstream file(fname);
+            if (!file.is_open())
+                throw cRuntimeError("Cannot open '%s' for write", fname.c_str());
+            file << "# ";
+            std::stringstream report;
+            partitioner.printReport(report);
+            file << opp_replacesubstring(report.str().substr(0, report.str().size()-1), "\n", "\n# ", true) << "\n";
+            partitioner.printIniLines(file);
+            if (opt->verbose)
+                out << "Partitioning written to " << fname << endl;
+        }
+    }
+}
+#endif
+
 bool EnvirBase::isModuleLocal(cModule *parentmod, const char *modname, int index)
 {
 #ifdef WITH_PARSIM
-    if (!opt->parsim)
+    if (!opt->parsim || isBuildingCompleteNetwork)
         return true;
 
     // toplevel module is local everywhere
@@ -927,6 +1525,17 @@ bool EnvirBase::isModuleLocal(cModule *parentmod, const char *modname, int index
         sprintf(parname, "%s.%s", parentmod->getFullPath().c_str(), modname);
     else
         sprintf(parname, "%s.%s[%d]", parentmod->getFullPath().c_str(), modname, index);  // FIXME this is incorrectly chosen for non-vector modules too!
+
+    if (opt->parsimAutoPartitioning) {
+        // only the submodules of the network are assigned; deeper modules are inherited
+        if (parentmod->getParentModule())
+            return true;
+        auto it = autoPartitioning.find(parname);
+        if (it == autoPartitioning.end())
+            throw cRuntimeError("Automatic partitioning: No partition was computed for '%s' "
+                                "(does the network topology depend on random values?)", parname);
+        return it->second == parsimComm->getProcId();
+    }
     std::string procIds = getConfig()->getAsString(parname, CFGID_PARTITION_ID, "");
     if (procIds.empty()) {
         // modules inherit the setting from their parents, except when the parent is the system module (the network) itself
@@ -1161,6 +1770,8 @@ void EnvirBase::componentMethodEnd()
 
 void EnvirBase::moduleCreated(cModule *newmodule)
 {
+    if (paramExpressionCollector && newmodule->getParentModule() == nullptr)
+        newmodule->subscribe(PRE_MODEL_CHANGE, paramExpressionCollector);
     if (recordEventlog)
         eventlogManager->moduleCreated(newmodule);
 }
@@ -1318,6 +1929,14 @@ void EnvirBase::readOptions()
         throw cRuntimeError("Parallel simulation is turned on in the ini file, but OMNeT++ was compiled without parallel simulation support (WITH_PARSIM=no)");
 #endif
     }
+#ifdef WITH_PARSIM
+    opt->parsimAutoPartitioning = cfg->getAsBool(CFGID_PARSIM_AUTO_PARTITIONING);
+    opt->parsimAutoPartitioningFile = cfg->getAsFilename(CFGID_PARSIM_AUTO_PARTITIONING_FILE);
+    if (opt->parsimAutoPartitioning && !opt->parsim)
+        opt->parsimNumPartitions = cfg->getAsInt(CFGID_PARSIM_NUM_PARTITIONS, 0);
+    if (opt->parsimAutoPartitioning && opt->parsimNumPartitions < 1)
+        throw cRuntimeError("parsim-auto-partitioning=true requires parsim-num-partitions to be set");
+#endif
 
     opt->fnameAppendHost = cfg->getAsBool(CFGID_FNAME_APPEND_HOST, opt->parsim);
 
@@ -1395,6 +2014,17 @@ void EnvirBase::readPerRunOptions()
     opt->snapshotmanagerClass = cfg->getAsString(CFGID_SNAPSHOTMANAGER_CLASS);
     debugOnErrors = cfg->getAsBool(CFGID_DEBUG_ON_ERRORS);
     opt->printUndisposed = cfg->getAsBool(CFGID_PRINT_UNDISPOSED);
+    opt->ownershipTracking = cfg->getAsBool(CFGID_OWNERSHIP_TRACKING);
+    opt->signalStatistics = cfg->getAsBool(CFGID_SIGNAL_STATISTICS);
+    opt->profiling = cfg->getAsBool(CFGID_PROFILING);
+    opt->recordTrace = cfg->getAsBool(CFGID_RECORD_TRACE);
+    opt->traceFile = cfg->getAsFilename(CFGID_TRACE_FILE).c_str();
+    processFileName(opt->traceFile);
+    opt->traceSamplingInterval = cfg->getAsInt(CFGID_TRACE_SAMPLING_INTERVAL);
+    opt->traceOutsideEvents = cfg->getAsBool(CFGID_TRACE_OUTSIDE_EVENTS);
+    opt->traceBufferSize = (size_t)cfg->getAsDouble(CFGID_TRACE_BUFFER_SIZE);
+    opt->parallelEventThreads = cfg->getAsInt(CFGID_PARALLEL_EVENT_THREADS);
+    opt->printStackUsage = cfg->getAsBool(CFGID_PRINT_STACK_USAGE);
 
     // make time limits effective
     stopwatch.setCPUTimeLimit(opt->cpuTimeLimit);
@@ -1449,6 +2079,13 @@ void EnvirBase::readPerRunOptions()
     getSimulation()->setFingerprintCalculator(fingerprint);
 
     cComponent::setCheckSignals(opt->checkSignals);
+    cDefaultOwner::setOwnershipTracking(opt->ownershipTracking);
+    cComponent::setCollectSignalStatistics(opt->signalStatistics);
+    getSimulation()->setProfiler(nullptr);  // closes the trace file of the previous run
+    if (opt->recordTrace)
+        getSimulation()->setProfiler(new ChromeTracer(opt->traceFile.c_str(), getConfigEx()->getVariable(CFGVAR_RUNID), opt->traceSamplingInterval, opt->traceOutsideEvents, opt->traceBufferSize, opt->profiling));
+    else if (opt->profiling)
+        getSimulation()->setProfiler(new cProfiler());
 
     // run RNG self-test on RNG class selected for this run
     cRNG *testRng = createByClassName<cRNG>(opt->rngClass.c_str(), "random number generator");
@@ -1476,6 +2113,33 @@ void EnvirBase::readPerRunOptions()
 
     // open eventlog file.
     recordEventlog = cfg->getAsBool(CFGID_RECORD_EVENTLOG);
+
+    // the eventlog needs events to be executed one by one
+    if (opt->parallelEventThreads < 0)
+        throw cRuntimeError("Invalid value %d for parallel-event-threads", opt->parallelEventThreads);
+    getSimulation()->setParallelEventThreads(recordEventlog ? 1 : opt->parallelEventThreads);
+
+    // checkpointing
+    opt->checkpointFile = cfg->getAsFilename(CFGID_CHECKPOINT_FILE).c_str();
+    processFileName(opt->checkpointFile);
+    opt->checkpointInterval = cfg->getAsDouble(CFGID_CHECKPOINT_INTERVAL, -1);
+    opt->checkpointRealTimeInterval = cfg->getAsDouble(CFGID_CHECKPOINT_REAL_TIME_INTERVAL, -1);
+    opt->checkpointRestore = cfg->getAsBool(CFGID_CHECKPOINT_RESTORE);
+    checkpointingEnabled = opt->checkpointInterval > SIMTIME_ZERO || opt->checkpointRealTimeInterval > 0;
+    isRestoringCheckpoint = false;
+    delete checkpointBuffer;
+    checkpointBuffer = nullptr;
+    if (checkpointingEnabled || opt->checkpointRestore) {
+        if (opt->parsim)
+            throw cRuntimeError("Checkpointing is not supported with parallel simulation");
+        if (recordEventlog)
+            throw cRuntimeError("Checkpointing is not supported together with eventlog recording");
+        if (opt->checkpointRestore && fileExists(opt->checkpointFile.c_str())) {
+            if (opt->verbose)
+                out << "Loading checkpoint \"" << opt->checkpointFile << "\"..." << endl;
+            loadCheckpoint();
+        }
+    }
 }
 
 int EnvirBase::parseSimtimeResolution(const char *resolution)
@@ -1525,6 +2189,7 @@ void EnvirBase::setEventlogRecording(bool enabled)
         else
             eventlogManager->stopRecording();
         recordEventlog = enabled;
+        getSimulation()->setParallelEventThreads(enabled ? 1 : opt->parallelEventThreads);
     }
 }
 
@@ -1638,9 +2303,13 @@ void EnvirBase::setVectorAttribute(void *vechandle, const char *name, const char
 bool EnvirBase::recordInOutputVector(void *vechandle, simtime_t t, double value)
 {
     ASSERT(outvectorManager);
+    if (isRestoringCheckpoint)
+        return false;  // values are already in the file
     if (getSimulation()->getFingerprintCalculator())
         // TODO: determine component and result name if possible
         getSimulation()->getFingerprintCalculator()->addVectorResult(nullptr, "", t, value);
+    if (resultRecordingDeferred)
+        return false;  // warmup period of warm-start branching: the branches have their own vector files
     return outvectorManager->record(vechandle, t, value);
 }
 
@@ -1649,7 +2318,10 @@ bool EnvirBase::recordInOutputVector(void *vechandle, simtime_t t, double value)
 void EnvirBase::recordScalar(cComponent *component, const char *name, double value, opp_string_map *attributes)
 {
     ASSERT(outScalarManager);
-    outScalarManager->recordScalar(component, name, value, attributes);
+    if (resultRecordingDeferred)
+        deferResult(DeferredResult::SCALAR, component, name, attributes).value = value;
+    else
+        outScalarManager->recordScalar(component, name, value, attributes);
     if (getSimulation()->getFingerprintCalculator())
         getSimulation()->getFingerprintCalculator()->addScalarResult(component, name, value);
 }
@@ -1657,7 +2329,10 @@ void EnvirBase::recordScalar(cComponent *component, const char *name, double val
 void EnvirBase::recordStatistic(cComponent *component, const char *name, cStatistic *statistic, opp_string_map *attributes)
 {
     ASSERT(outScalarManager);
-    outScalarManager->recordStatistic(component, name, statistic, attributes);
+    if (resultRecordingDeferred)
+        deferResult(DeferredResult::STATISTIC, component, name ? name : statistic->getFullName(), attributes).statistic = static_cast<cStatistic *>(statistic->dup());
+    else
+        outScalarManager->recordStatistic(component, name, statistic, attributes);
     if (getSimulation()->getFingerprintCalculator())
         getSimulation()->getFingerprintCalculator()->addStatisticResult(component, name, statistic);
 }
@@ -1665,19 +2340,43 @@ void EnvirBase::recordStatistic(cComponent *component, const char *name, cStatis
 void EnvirBase::recordParameter(cPar *par)
 {
     assert(outScalarManager);
-    outScalarManager->recordParameter(par);
+    if (resultRecordingDeferred) {
+        cComponent *component = check_and_cast<cComponent *>(par->getOwner());
+        deferResult(DeferredResult::PARAMETER, component, nullptr, nullptr).parIndex = component->findPar(par->getName());
+    }
+    else
+        outScalarManager->recordParameter(par);
 }
 
 void EnvirBase::recordComponentType(cComponent *component)
 {
     assert(outScalarManager);
-    outScalarManager->recordComponentType(component);
+    if (resultRecordingDeferred)
+        deferResult(DeferredResult::COMPONENTTYPE, component, nullptr, nullptr);
+    else
+        outScalarManager->recordComponentType(component);
+}
+
+EnvirBase::DeferredResult& EnvirBase::deferResult(DeferredResult::Kind kind, cComponent *component, const char *name, opp_string_map *attributes)
+{
+    deferredResults.push_back(DeferredResult());
+    DeferredResult& result = deferredResults.back();
+    result.kind = kind;
+    result.componentId = component->getId();
+    result.name = opp_nulltoempty(name);
+    if (attributes) {
+        result.hasAttributes = true;
+        result.attributes = *attributes;
+    }
+    return result;
 }
 
 //-------------------------------------------------------------
 
 std::ostream *EnvirBase::getStreamForSnapshot()
 {
+    if (resultRecordingDeferred)
+        throw cRuntimeError("Snapshots cannot be written during the warmup period of warm-start branching");
     return snapshotManager->getStreamForSnapshot();
 }
 
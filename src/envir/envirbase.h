@@ -22,6 +22,7 @@
 #ifndef __OMNETPP_ENVIR_ENVIRBASE_H
 #define __OMNETPP_ENVIR_ENVIRBASE_H
 
+#include <map>
 #include "omnetpp/carray.h"
 #include "omnetpp/csimulation.h"
 #include "omnetpp/cchannel.h"
@@ -49,11 +50,15 @@ class cParsimPartition;
 class cParsimSynchronizer;
 class cResultRecorder;
 class cIEventlogManager;
+class cCommBuffer;
+class cParImpl;
+class cStatistic;
 
 namespace envir {
 
 class XMLDocCache;
 class SignalSource;
+class ParamExpressionCollector;
 
 // assumed maximum length for getFullPath() string.
 // note: this maximum actually not enforced anywhere
@@ -74,7 +79,7 @@ enum class DebuggerPresence {
     CANT_DETECT
 };
 
-#define ARGSPEC "h?f:u:l:c:r:n:x:i:p:q:e:avwsm"
+#define ARGSPEC "h?f:u:l:c:r:j:n:x:i:p:q:e:avwsm"
 
 struct ENVIR_API EnvirOptions
 {
@@ -103,6 +108,8 @@ struct ENVIR_API EnvirOptions
     int parsimNumPartitions = 0;
     std::string parsimcommClass; // if parsim: cParsimCommunications class to use
     std::string parsimsynchClass; // if parsim: cParsimSynchronizer class to use
+    bool parsimAutoPartitioning = false;
+    std::string parsimAutoPartitioningFile;
 #endif
 
     bool debugStatisticsRecording;
@@ -113,12 +120,27 @@ struct ENVIR_API EnvirOptions
     bool verbose;
     bool warnings;
     bool printUndisposed;
+    bool ownershipTracking;
+    bool signalStatistics;
+    bool profiling;
+    bool recordTrace;
+    std::string traceFile;
+    int traceSamplingInterval;
+    bool traceOutsideEvents;
+    size_t traceBufferSize;
+    bool printStackUsage;
+    int parallelEventThreads;
 
     simtime_t simtimeLimit;
     simtime_t warmupPeriod;
 
     double realTimeLimit;
     double cpuTimeLimit;
+
+    std::string checkpointFile;
+    simtime_t checkpointInterval;
+    double checkpointRealTimeInterval;
+    bool checkpointRestore;
 };
 
 /**
@@ -127,6 +149,7 @@ struct ENVIR_API EnvirOptions
  */
 class ENVIR_API EnvirBase : public cRunnableEnvir
 {
+    friend class ParamExpressionCollector;
   protected:
     cConfigurationEx *cfg;
     ArgList *args;
@@ -141,6 +164,8 @@ class ENVIR_API EnvirBase : public cRunnableEnvir
 #ifdef WITH_PARSIM
     cParsimCommunications *parsimComm;
     cParsimPartition *parsimPartition;
+    std::map<std::string,int> autoPartitioning;  // with parsim-auto-partitioning: full path of network submodule -> partition
+    bool isBuildingCompleteNetwork = false;  // while building the network for automatic partitioning
 #endif
 
     // Random number generators. Module RNG's map to these RNG objects.
@@ -175,6 +200,38 @@ class ENVIR_API EnvirBase : public cRunnableEnvir
 
     simtime_t simulatedTime;  // sim. time after finishing simulation
 
+    // Warm-start branching: scalar results recorded during the warmup are
+    // buffered, and written into the result files of each branch
+    struct DeferredResult {
+        enum Kind {SCALAR, STATISTIC, PARAMETER, COMPONENTTYPE} kind;
+        int componentId;
+        int parIndex = -1;      // PARAMETER
+        std::string name;       // SCALAR, STATISTIC
+        double value = 0;       // SCALAR
+        cStatistic *statistic = nullptr;  // STATISTIC; owned
+        bool hasAttributes = false;
+        opp_string_map attributes;
+    };
+    bool resultRecordingDeferred = false;
+    std::vector<DeferredResult> deferredResults;
+
+    // Warm-start branching: expressions of non-volatile parameters before they
+    // were converted to constants, so that branches can re-evaluate the ones
+    // that depend on changed parameters
+    struct ParamExpression {
+        cParImpl *impl;  // owned copy of the parameter while it still held the expression
+        int evalContextId;
+    };
+    std::map<std::pair<int,int>,ParamExpression> paramExpressions;  // key: (component ID, parameter index)
+    cIListener *paramExpressionCollector = nullptr;
+
+    // Checkpointing
+    bool checkpointingEnabled = false;
+    simtime_t nextCheckpointSimtime;
+    double nextCheckpointRealTime = 0;  // in elapsed seconds
+    cCommBuffer *checkpointBuffer = nullptr;  // checkpoint loaded by loadCheckpoint(), to be restored after initialization
+    bool isRestoringCheckpoint = false;  // while the network is initialized before restoring the checkpoint
+
   public:
 
     bool attachDebuggerOnErrors = false;
@@ -311,6 +368,32 @@ class ENVIR_API EnvirBase : public cRunnableEnvir
     virtual void setupNetwork(cModuleType *network);
     virtual void prepareForRun();
 
+    // Warm-start branching: the warmup period is simulated once, and the
+    // process is forked into branches. deferResultRecording() must be called
+    // before setupNetwork() in the warmup run; startBranch() is called in the
+    // forked process to switch over to the configuration of the given run
+    // (parameter changes, RNG seeds, time limit, result files).
+    virtual void deferResultRecording();
+    virtual void startBranch(const char *configName, int runNumber);
+    virtual void applyBranchParameters(const std::vector<cComponent *>& components, const std::vector<std::string>& oldValues);
+    virtual DeferredResult& deferResult(DeferredResult::Kind kind, cComponent *component, const char *name, opp_string_map *attributes);
+    virtual void writeDeferredResults();
+    virtual void discardBranchingState();
+#ifdef WITH_PARSIM
+    virtual void computeAutoPartitioning(cModuleType *network);
+#endif
+
+    // Checkpointing: loadCheckpoint() is called from readPerRunOptions()
+    // if the run is to be resumed, and restoreCheckpoint() from prepareForRun()
+    // after the network has been initialized. The event loop of the user
+    // interface should call isCheckpointDue() with the next event (before
+    // executing it), and if it returns true, put back the event and call
+    // writeCheckpoint().
+    bool isCheckpointDue(cEvent *nextEvent);
+    virtual void writeCheckpoint();
+    virtual void loadCheckpoint();
+    virtual void restoreCheckpoint();
+
     ArgList *argList()  {return args;}
     void printHelp();
     void setupEventLog();
@@ -100,6 +100,7 @@ EventlogFileManager::EventlogFileManager()
 {
     envir = getEnvir();
     feventlog = nullptr;
+    savedFileSize = -1;
     objectPrinter = nullptr;
     recordingIntervals = nullptr;
     keyframeBlockSize = 1000;
@@ -174,6 +175,16 @@ void EventlogFileManager::lifecycleEvent(SimulationLifecycleEventType eventType,
             flush();
             break;
 
+        case LF_PRE_STATE_SAVE:
+            savedFileSize = isOpen() ? opp_ftell(feventlog) : -1;
+            break;
+
+        case LF_POST_STATE_RESTORE:
+            // discard the entries of rolled back events
+            if (isOpen() && savedFileSize != -1)
+                truncateFile(feventlog, savedFileSize, filename.c_str(), "eventlog file");
+            break;
+
         default:
             break;
     }
@@ -48,6 +48,7 @@ class ENVIR_API EventlogFileManager : public cIEventlogManager, public cISimulat
     int entryIndex;
     int keyframeBlockSize;
     file_offset_t previousKeyframeFileOffset;
+    file_offset_t savedFileSize;  // at the last LF_PRE_STATE_SAVE
     bool isUserRecordingEnabled;
     bool isCombinedRecordingEnabled;  // combines several other enablement flags
 
@@ -15,7 +15,10 @@
   `license' for details on this and other legal matters.
 *--------------------------------------------------------------*/
 
+#include <cstdio>
+#include <cstring>
 #include "omnetpp/cclassdescriptor.h"
+#include "omnetpp/platdep/platmisc.h"  // PRId64
 #include "matchableobject.h"
 
 namespace omnetpp {
@@ -62,6 +65,13 @@ void MatchableObjectAdapter::splitIndex(char *indexedName, int& index)
 
 bool MatchableObjectAdapter::findDescriptorField(cClassDescriptor *desc, const char *attribute, int& fieldId, int& index)
 {
+    if (!strchr(attribute, '[')) {
+        // plain field name, no need to copy it
+        index = 0;
+        fieldId = desc->findField(attribute);
+        return fieldId != -1;
+    }
+
     // attribute may be in the form "fieldName[index]"; split the two
     char *fieldNameBuf = new char[strlen(attribute)+1];
     strcpy(fieldNameBuf, attribute);
@@ -101,6 +111,17 @@ const char *MatchableObjectAdapter::getAsString(const char *attribute) const
     if (!found)
         return nullptr;
 
+    if (desc->getFieldIsIntegral(fieldId)) {
+        // format integers directly, avoiding the std::string temporary of
+        // getFieldValueAsString(); negative values may also come from wrapped
+        // around unsigned fields, so those go the generic way
+        intval_t value = desc->getFieldValueAsInt(obj, fieldId, index);
+        if (value >= 0) {
+            snprintf(intBuf, sizeof(intBuf), "%" PRId64, (int64_t)value);
+            return intBuf;
+        }
+    }
+
     tmp = desc->getFieldValueAsString(obj, fieldId, index);
     return tmp.c_str();
 }
@@ -41,6 +41,7 @@ class ENVIR_API MatchableObjectAdapter : public omnetpp::common::MatchExpression
     cObject *obj;
     mutable cClassDescriptor *desc;
     mutable std::string tmp;
+    mutable char intBuf[24];
   protected:
     static void splitIndex(char *indexedName, int& index);
     static bool findDescriptorField(cClassDescriptor *desc, const char *attribute, int& fieldId, int& index);
@@ -83,6 +83,24 @@ void OmnetppOutputScalarManager::endRun()
     }
 }
 
+void OmnetppOutputScalarManager::lifecycleEvent(SimulationLifecycleEventType eventType, cObject *details)
+{
+    switch (eventType) {
+        case LF_PRE_STATE_SAVE:
+            // the file is opened for appending, so open it now to know which part to keep on restore
+            if (state == STARTED)
+                openFileForRun();
+            savedFileSize = writer.isOpen() ? writer.getFileSize() : -1;
+            break;
+        case LF_POST_STATE_RESTORE:
+            if (writer.isOpen() && savedFileSize != -1)
+                writer.truncate(savedFileSize);
+            break;
+        default:
+            cIOutputScalarManager::lifecycleEvent(eventType, details);
+    }
+}
+
 void OmnetppOutputScalarManager::openFileForRun()
 {
     // ensure startRun() has been invoked
@@ -41,8 +41,10 @@ class ENVIR_API OmnetppOutputScalarManager : public cIOutputScalarManager
     enum State {NEW, STARTED, OPENED, ENDED} state = NEW;
     std::string fname;
     OmnetppScalarFileWriter writer;
+    file_offset_t savedFileSize = -1; // file size at the last LF_PRE_STATE_SAVE
 
   protected:
+    virtual void lifecycleEvent(SimulationLifecycleEventType eventType, cObject *details) override;
     virtual void openFileForRun();
     virtual void closeFile();
     bool isBad() {return state==OPENED && !writer.isOpen();}
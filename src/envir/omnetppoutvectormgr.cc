@@ -30,6 +30,10 @@
 #include "omnetppoutvectormgr.h"
 #include "resultfileutils.h"
 
+#ifdef WITH_PARSIM
+#include "omnetpp/ccommbuffer.h"
+#endif
+
 using namespace omnetpp::common;
 
 namespace omnetpp {
@@ -64,13 +68,20 @@ void OmnetppOutputVectorManager::startRun()
 
     fname = getEnvir()->getConfig()->getAsFilename(CFGID_OUTPUT_VECTOR_FILE).c_str();
     dynamic_cast<EnvirBase *>(getEnvir())->processFileName(fname);
-    removeFile(fname.c_str(), "old output vector file");
+    if (!resuming)
+        removeFile(fname.c_str(), "old output vector file");
 
     int prec = getEnvir()->getConfig()->getAsInt(CFGID_OUTPUT_VECTOR_PRECISION);
     writer.setPrecision(prec);
 
     size_t memoryLimit = (size_t) getEnvir()->getConfig()->getAsDouble(CFGID_OUTPUTVECTOR_MEMORY_LIMIT);
     writer.setOverallMemoryLimit(memoryLimit);
+
+    if (resuming) {
+        // continue the file from where it was at the time of the checkpoint
+        state = OPENED;
+        writer.reopen(fname.c_str(), resumeVectorFileSize, resumeIndexFileSize, resumeNextVectorId);
+    }
 }
 
 void OmnetppOutputVectorManager::endRun()
@@ -164,7 +175,14 @@ bool OmnetppOutputVectorManager::record(void *vectorhandle, simtime_t t, double
         std::string vectorFullPath = vp->moduleName.str() + "." + vp->vectorName.c_str();
         size_t bufferSize = (size_t) getEnvir()->getConfig()->getAsDouble(vectorFullPath.c_str(), CFGID_VECTOR_BUFFER);
         bool recordEventNumbers = getEnvir()->getConfig()->getAsBool(vectorFullPath.c_str(), CFGID_VECTOR_RECORD_EVENTNUMBERS);
-        vp->handleInWriter = writer.registerVector(vp->moduleName.c_str(), vp->vectorName.c_str(), ResultFileUtils::convertMap(&vp->attributes), bufferSize, recordEventNumbers);
+        auto it = resumedVectors.find(std::make_pair(vp->moduleName.str(), vp->vectorName.str()));
+        if (it != resumedVectors.end()) {
+            // already declared in the file before the checkpoint
+            vp->handleInWriter = writer.resumeVector(it->second.idInWriter, bufferSize, it->second.recordEventNumbers);
+            resumedVectors.erase(it);
+        }
+        else
+            vp->handleInWriter = writer.registerVector(vp->moduleName.c_str(), vp->vectorName.c_str(), ResultFileUtils::convertMap(&vp->attributes), bufferSize, recordEventNumbers);
     }
 
     eventnumber_t eventNumber = getSimulation()->getEventNumber();
@@ -178,6 +196,77 @@ void OmnetppOutputVectorManager::flush()
         writer.flush();
 }
 
+void OmnetppOutputVectorManager::lifecycleEvent(SimulationLifecycleEventType eventType, cObject *details)
+{
+    switch (eventType) {
+        case LF_PRE_STATE_SAVE:
+            // note: samples buffered in memory are part of the saved state
+            savedVectorFileSize = writer.isOpen() ? writer.getVectorFileSize() : -1;
+            savedIndexFileSize = writer.isOpen() ? writer.getIndexFileSize() : -1;
+            break;
+        case LF_POST_STATE_RESTORE:
+            // if the file was not open, it will be overwritten when opened
+            if (writer.isOpen() && savedVectorFileSize != -1)
+                writer.truncate(savedVectorFileSize, savedIndexFileSize);
+            break;
+        default:
+            cIOutputVectorManager::lifecycleEvent(eventType, details);
+    }
+}
+
+void OmnetppOutputVectorManager::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    if (buffer->packFlag(state == OPENED && writer.isOpen())) {
+        buffer->pack(writer.getVectorFileSize());
+        buffer->pack(writer.getIndexFileSize());
+        buffer->pack(writer.getNextVectorId());
+
+        std::vector<VectorData *> declaredVectors;
+        for (VectorData *vp : vectors)
+            if (vp->handleInWriter != nullptr)
+                declaredVectors.push_back(vp);
+        buffer->pack((int)declaredVectors.size());
+        for (VectorData *vp : declaredVectors) {
+            buffer->pack(vp->moduleName);
+            buffer->pack(vp->vectorName);
+            buffer->pack(writer.getVectorId(vp->handleInWriter));
+            buffer->pack(writer.getRecordEventNumbers(vp->handleInWriter));
+        }
+    }
+#endif
+}
+
+void OmnetppOutputVectorManager::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    Assert(state == NEW);
+    resuming = buffer->checkFlag();
+    resumedVectors.clear();
+    if (resuming) {
+        buffer->unpack(resumeVectorFileSize);
+        buffer->unpack(resumeIndexFileSize);
+        buffer->unpack(resumeNextVectorId);
+
+        int n;
+        buffer->unpack(n);
+        for (int i = 0; i < n; i++) {
+            opp_string moduleName, vectorName;
+            ResumedVector resumedVector;
+            buffer->unpack(moduleName);
+            buffer->unpack(vectorName);
+            buffer->unpack(resumedVector.idInWriter);
+            buffer->unpack(resumedVector.recordEventNumbers);
+            resumedVectors[std::make_pair(moduleName.str(), vectorName.str())] = resumedVector;
+        }
+    }
+#endif
+}
+
 }  // namespace envir
 }  // namespace omnetpp
 
@@ -19,6 +19,7 @@
 #define __OMNETPP_ENVIR_OMNETPPOUTVECTORMGR_H
 
 #include <stddef.h>
+#include <map>
 #include <string>
 #include <vector>
 #include "omnetpp/envirext.h"
@@ -52,12 +53,31 @@ class OmnetppOutputVectorManager : public cIOutputVectorManager
 
     typedef std::vector<VectorData*> Vectors;
 
+    struct ResumedVector {
+        int idInWriter;            // vector ID in the file
+        bool recordEventNumbers;   // the columns the vector was declared with
+    };
+
+    typedef std::map<std::pair<std::string,std::string>, ResumedVector> ResumedVectors; // key: module name, vector name
+
     enum State {NEW, STARTED, OPENED, ENDED} state = NEW;
     std::string fname;
     OmnetppVectorFileWriter writer;
     Vectors vectors; // registered output vectors
 
+    // when resuming from a checkpoint: the state of the file at the time of the checkpoint
+    bool resuming = false;
+    file_offset_t resumeVectorFileSize = 0;
+    file_offset_t resumeIndexFileSize = 0;
+    int resumeNextVectorId = 0;
+    ResumedVectors resumedVectors; // vectors declared in the file, not yet registered again
+
+    // file sizes at the last LF_PRE_STATE_SAVE (-1: the file was not open)
+    file_offset_t savedVectorFileSize = -1;
+    file_offset_t savedIndexFileSize = -1;
+
   protected:
+    virtual void lifecycleEvent(SimulationLifecycleEventType eventType, cObject *details) override;
     virtual void openFileForRun();
     virtual void closeFile();
     bool isBad() {return state==OPENED && !writer.isOpen();}
@@ -121,6 +141,22 @@ class OmnetppOutputVectorManager : public cIOutputVectorManager
      */
     virtual void flush() override;
     //@}
+
+    /** @name Checkpointing. */
+    //@{
+    /**
+     * Packs the current sizes of the vector file and the index file, and
+     * the IDs of the vectors declared in them. flush() must be called before.
+     */
+    virtual void parsimPack(cCommBuffer *buffer) const override;
+
+    /**
+     * Unpacks the state saved by parsimPack(). Must be called before
+     * startRun(); the vector file of the run will then be truncated to the
+     * saved size and continued instead of being overwritten.
+     */
+    virtual void parsimUnpack(cCommBuffer *buffer) override;
+    //@}
 };
 
 } // namespace envir
@@ -722,6 +722,13 @@ const char *SectionBasedConfiguration::getVariable(const char *varname) const
     return it == variables.end() ? nullptr : it->second.c_str();
 }
 
+void SectionBasedConfiguration::setVariable(const char *varname, const char *value)
+{
+    variables[varname] = value;
+    if (strcmp(varname, CFGVAR_RUNID) == 0)
+        runId = value;
+}
+
 std::vector<const char *> SectionBasedConfiguration::getIterationVariableNames() const
 {
     std::vector<const char *> result;
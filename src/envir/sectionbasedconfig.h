@@ -240,6 +240,13 @@ class ENVIR_API SectionBasedConfiguration : public cConfigurationEx
     virtual const char *substituteVariables(const char *value) const override;
     virtual void dump() const override;
     //@}
+
+    /**
+     * Overrides the value of a variable of the active run, e.g. the run ID
+     * when a run is resumed from a checkpoint. Config values that have
+     * already been substituted are not affected.
+     */
+    virtual void setVariable(const char *varname, const char *value);
 };
 
 } // namespace envir
@@ -342,6 +342,11 @@ void MsgAnalyzer::analyzeClassOrStruct(ClassInfo& classInfo, const std::string&
     if (classInfo.beforeChange.empty() && baseClassInfo != nullptr)
         classInfo.beforeChange = baseClassInfo->beforeChange;
 
+    // pooled allocation
+    classInfo.pooled = getPropertyAsBool(classInfo.props, PROP_POOLED, false);
+    if (classInfo.pooled && !hasSuperclass(classInfo, "omnetpp::cMessage"))
+        errors->addError(classInfo.astNode, "'%s': @pooled is only supported for message and packet classes", classInfo.name.c_str());
+
     // additional base classes (interfaces)
     std::string s = getProperty(classInfo.props, PROP_IMPLEMENTS);
     if (!s.empty())
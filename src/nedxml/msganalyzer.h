@@ -115,6 +115,7 @@ class NEDXML_API MsgAnalyzer
     static constexpr const char* PROP_FIELDNAMESUFFIX = "fieldNameSuffix";
     static constexpr const char* PROP_BEFORECHANGE = "beforeChange";
     static constexpr const char* PROP_IMPLEMENTS = "implements";
+    static constexpr const char* PROP_POOLED = "pooled";
     static constexpr const char* PROP_NOPACK = "nopack";
     static constexpr const char* PROP_OWNED = "owned";
     static constexpr const char* PROP_EDITABLE = "editable";
@@ -63,6 +63,53 @@ inline std::ostream& operator<<(std::ostream& o, const std::pair<std::string, in
     return o << '(' << p.first << ':' << p.second << ')';
 }
 
+// Fields of built-in numeric types are recognized by their string conversion
+// function; fields with a custom @toString (e.g. enums) are left out.
+static bool isIntegralField(const MsgCodeGenerator::FieldInfo& field)
+{
+    const std::string& f = field.toString;
+    return !field.isPointer && (f == "long2string($)" || f == "ulong2string($)" || f == "int642string($)" || f == "uint642string($)");
+}
+
+static bool isFloatingPointField(const MsgCodeGenerator::FieldInfo& field)
+{
+    const std::string& f = field.toString;
+    return !field.isPointer && (f == "double2string($)" || f == "simtime2string($)");
+}
+
+// must produce the same result as cClassDescriptor::hashFieldName()
+static uint32_t hashFieldName(const char *fieldName, uint32_t seed)
+{
+    uint32_t h = 2166136261u ^ seed;  // FNV-1a
+    for (const unsigned char *p = (const unsigned char *)fieldName; *p; p++)
+        h = (h ^ *p) * 16777619u;
+    return h ^ (h >> 15);
+}
+
+// Finds a seed for hashFieldName() that maps the given names into distinct
+// slots of a table of the returned size (a power of two).
+static int findPerfectHash(const std::vector<std::string>& names, uint32_t& seed)
+{
+    for (int tableSize = 1; ; tableSize *= 2) {
+        if (tableSize < 2 * (int)names.size())
+            continue;
+        for (seed = 0; seed < 10000; seed++) {
+            std::vector<bool> used(tableSize, false);
+            bool ok = true;
+            for (const std::string& name : names) {
+                int slot = hashFieldName(name.c_str(), seed) & (tableSize - 1);
+                if (used[slot]) {
+                    ok = false;
+                    break;
+                }
+                used[slot] = true;
+            }
+            if (ok)
+                return tableSize;
+        }
+    }
+}
+
 void MsgCodeGenerator::openFiles(const char *hFile, const char *ccFile)
 {
     hFilename = hFile;
@@ -472,6 +519,10 @@ void MsgCodeGenerator::generateClassDecl(const ClassInfo& classInfo, const std::
         else
             H << "{return new " << classInfo.className << "(*this);}\n";
     }
+    if (classInfo.pooled) {
+        H << "    static void *operator new(size_t size) {return omnetpp::cMessagePool::allocate(size);}\n";
+        H << "    static void operator delete(void *p, size_t size) {omnetpp::cMessagePool::deallocate(p, size);}\n";
+    }
     std::string maybe_override = classInfo.iscObject ? " override" : "";
     std::string maybe_handleChange = classInfo.beforeChange.empty() ? "" : (classInfo.beforeChange + ";");
     if (!classInfo.str.empty())
@@ -1107,6 +1158,8 @@ void MsgCodeGenerator::generateDescriptorClass(const ClassInfo& classInfo)
     CC << "\n";
     CC << "    virtual const char *getFieldDynamicTypeString(void *object, int field, int i) const override;\n";
     CC << "    virtual std::string getFieldValueAsString(void *object, int field, int i) const override;\n";
+    CC << "    virtual omnetpp::intval_t getFieldValueAsInt(void *object, int field, int i) const override;\n";
+    CC << "    virtual double getFieldValueAsDouble(void *object, int field, int i) const override;\n";
     CC << "    virtual void setFieldValueAsString(void *object, int field, int i, const char *value) const override;\n";
     CC << "\n";
     CC << "    virtual const char *getFieldStructName(int field) const override;\n";
@@ -1212,6 +1265,10 @@ void MsgCodeGenerator::generateDescriptorClass(const ClassInfo& classInfo)
                 flags.push_back("FD_ISREPLACEABLE");
             if (field.isResizable)
                 flags.push_back("FD_ISRESIZABLE");
+            if (isIntegralField(field))
+                flags.push_back("FD_ISINTEGRAL");
+            if (isFloatingPointField(field))
+                flags.push_back("FD_ISFLOATINGPOINT");
             std::string flagss;
             if (flags.empty())
                 flagss = "0";
@@ -1257,12 +1314,26 @@ void MsgCodeGenerator::generateDescriptorClass(const ClassInfo& classInfo)
     CC << "{\n";
     CC << "    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();\n";
     if (numFields > 0) {
-        CC << "    int base = basedesc ? basedesc->getFieldCount() : 0;\n";
-        for (size_t i = 0; i < classInfo.fieldList.size(); ++i) {
-            const FieldInfo& field = classInfo.fieldList[i];
-            char c = field.name[0];
-            CC << "    if (fieldName[0] == '" << c << "' && strcmp(fieldName, \""<<field.name<<"\") == 0) return base+" << i << ";\n";
+        // perfect hash table of the field names
+        std::vector<std::string> names;
+        for (const auto& field : classInfo.fieldList)
+            names.push_back(field.name);
+        uint32_t seed;
+        int tableSize = findPerfectHash(names, seed);
+        std::vector<const FieldInfo *> slots(tableSize, nullptr);
+        for (const auto& field : classInfo.fieldList)
+            slots[hashFieldName(field.name.c_str(), seed) & (tableSize - 1)] = &field;
+        CC << "    static const struct { const char *name; int index; } fieldsByHash[" << tableSize << "] = {\n";
+        for (const FieldInfo *field : slots) {
+            if (field)
+                CC << "        { \"" << field->name << "\", " << field->symbolicConstant << " },\n";
+            else
+                CC << "        { nullptr, -1 },\n";
         }
+        CC << "    };\n";
+        CC << "    int slot = hashFieldName(fieldName, " << seed << "u) & " << (tableSize - 1) << ";\n";
+        CC << "    if (fieldsByHash[slot].name != nullptr && strcmp(fieldName, fieldsByHash[slot].name) == 0)\n";
+        CC << "        return (basedesc ? basedesc->getFieldCount() : 0) + fieldsByHash[slot].index;\n";
     }
     CC << "    return basedesc ? basedesc->findField(fieldName) : -1;\n";
     CC << "}\n";
@@ -1462,6 +1533,44 @@ void MsgCodeGenerator::generateDescriptorClass(const ClassInfo& classInfo)
     CC << "}\n";
     CC << "\n";
 
+    // getFieldValueAsInt(), getFieldValueAsDouble()
+    for (bool isInt : {true, false}) {
+        const char *methodName = isInt ? "getFieldValueAsInt" : "getFieldValueAsDouble";
+        CC << (isInt ? "omnetpp::intval_t " : "double ") << classInfo.descriptorClass << "::" << methodName << "(void *object, int field, int i) const\n";
+        CC << "{\n";
+        CC << "    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();\n";
+        CC << "    if (basedesc) {\n";
+        CC << "        if (field < basedesc->getFieldCount())\n";
+        CC << "            return basedesc->" << methodName << "(object,field,i);\n";
+        CC << "        field -= basedesc->getFieldCount();\n";
+        CC << "    }\n";
+        CC << "    " << classInfo.className << " *pp = (" << classInfo.className << " *)object; (void)pp;\n";
+        CC << "    switch (field) {\n";
+        for (size_t i = 0; i < numFields; i++) {
+            const FieldInfo& field = classInfo.fieldList[i];
+            if (isInt ? !isIntegralField(field) : !isFloatingPointField(field))
+                continue;
+            CC << "        case " << field.symbolicConstant << ": ";
+            if (!classInfo.isClass && field.isArray) {
+                Assert(field.isFixedArray); // struct may not contain dynamic arrays; checked by analyzer
+                CC << "if (i >= " << field.arraySize << ") return 0;\n                ";
+            }
+            std::string value = classInfo.isClass ?
+                    makeFuncall("pp", field.getter, field.isArray) :
+                    (str("pp->") + field.var + (field.isArray ? "[i]" : ""));
+            if (isInt)
+                CC << "return (omnetpp::intval_t)(" << value << ");\n";
+            else if (field.toString == "simtime2string($)")
+                CC << "return (" << value << ").dbl();\n";
+            else
+                CC << "return (double)(" << value << ");\n";
+        }
+        CC << "        default: return omnetpp::cClassDescriptor::" << methodName << "(object, field + (basedesc ? basedesc->getFieldCount() : 0), i);\n";
+        CC << "    }\n";
+        CC << "}\n";
+        CC << "\n";
+    }
+
     // setFieldValueAsString()
     CC << "void " << classInfo.descriptorClass << "::setFieldValueAsString(void *object, int field, int i, const char *value) const\n";
     CC << "{\n";
@@ -56,6 +56,7 @@ const char *MsgCompiler::BUILTIN_DEFINITIONS =
         @property[fieldNameSuffix](type=string; usage=class; desc="Suffix to append to the names of data members.");
         @property[beforeChange](type=string; usage=class; desc="Method to be called before mutator code (in setters, non-const getters, operator=, etc.).");
         @property[implements](type=stringlist; usage=class; desc="Names of additional base classes.");
+        @property[pooled](type=bool; usage=class; desc="If true: Generate class-specific operator new/delete which allocate instances via cMessagePool, a recycling allocator with per-size free lists. Only for message and packet classes.");
         @property[nopack](type=bool; usage=field; desc="If true: Ignore this field in parsimPack/parsimUnpack methods.");
         @property[editable](type=bool; usage=field,class; desc="Specifies whether field value (or value of fields that are instances of this type) can be set via the class descriptor's setFieldValueFromString() method.");
         @property[replaceable](type=bool; usage=field; desc="If true: Field is a pointer whose value can be set via the class descriptor's setFieldStructValuePointer() method.");
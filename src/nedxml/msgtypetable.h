@@ -161,6 +161,7 @@ class NEDXML_API MsgTypeTable
         std::string extendsQName;      // fully qualified name of base type
         std::string extendsName;       // base type's name from MSG
         bool customize;                // from @customize
+        bool pooled = false;           // from @pooled
         bool omitGetVerb;              // from @omitGetVerb
         bool isClass;                  // true=class, false=struct
         bool iscObject;                // whether type is subclassed from cObject
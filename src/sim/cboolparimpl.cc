@@ -85,6 +85,7 @@ void cBoolParImpl::setExpression(cExpression *e)
 {
     deleteOld();
     expr = e;
+    compileIfVolatile(expr);
     flags |= FL_ISEXPR | FL_CONTAINSVALUE | FL_ISSET;
 }
 
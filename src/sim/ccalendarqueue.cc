@@ -0,0 +1,437 @@
+//=========================================================================
+//  CCALENDARQUEUE.CC - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//   Member functions of
+//    cCalendarQueue : future event set, implemented as calendar queue
+//
+//  The algorithm is from R. Brown: Calendar Queues: A Fast O(1)
+//  Priority Queue Implementation for the Simulation Event Set
+//  Problem, CACM 31(10), 1988.
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include <algorithm>
+#include <sstream>
+#include "omnetpp/globals.h"
+#include "omnetpp/cevent.h"
+#include "omnetpp/ccalendarqueue.h"
+
+namespace omnetpp {
+
+Register_Class(cCalendarQueue);
+
+#define MIN_BUCKETS             16
+#define WIDTH_SAMPLE_SIZE       64
+#define MAX_DIRECT_SEARCHES     4
+
+// same as cEvent::shouldPrecede(), but inline
+inline bool precedes(const cEvent *a, const cEvent *b)
+{
+    return a->getArrivalTime() < b->getArrivalTime() ? true :
+           a->getArrivalTime() > b->getArrivalTime() ? false :
+           a->getSchedulingPriority() != b->getSchedulingPriority() ? a->getSchedulingPriority() < b->getSchedulingPriority() :
+           a->getInsertOrder() < b->getInsertOrder();
+}
+
+//----
+
+void cCalendarQueue::Bucket::grow()
+{
+    int newCapacity = capacity == 0 ? 4 : 2*capacity;
+    cEvent **newItems = new cEvent *[newCapacity];
+    for (int i = 0; i < length; i++)
+        newItems[i] = at(i);
+    delete[] items;
+    items = newItems;
+    capacity = newCapacity;
+    head = 0;
+}
+
+void cCalendarQueue::Bucket::insert(cEvent *event)
+{
+    if (length == capacity)
+        grow();
+
+    // fast path: appending at the end is by far the most common case
+    if (length == 0 || !precedes(event, at(length-1))) {
+        at(length++) = event;
+        return;
+    }
+
+    // binary search for the insertion point (first element that event should precede)
+    int lo = 0, hi = length-1;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (precedes(event, at(mid)))
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    int pos = lo;
+
+    // make room by shifting the shorter side
+    if (pos >= length - pos) {
+        for (int i = length; i > pos; i--)
+            at(i) = at(i-1);
+    }
+    else {
+        head = (head - 1) & (capacity - 1);
+        for (int i = 0; i < pos; i++)
+            at(i) = at(i+1);
+    }
+    at(pos) = event;
+    length++;
+}
+
+cEvent *cCalendarQueue::Bucket::popFront()
+{
+    cEvent *event = items[head];
+    head = (head + 1) & (capacity - 1);
+    length--;
+    return event;
+}
+
+bool cCalendarQueue::Bucket::remove(cEvent *event)
+{
+    // binary search for the first element that does not precede event
+    int lo = 0, hi = length;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (precedes(at(mid), event))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    int pos = lo;
+    if (pos == length || at(pos) != event)
+        return false;
+
+    // close the gap by shifting the shorter side
+    if (pos < length / 2) {
+        for (int i = pos; i > 0; i--)
+            at(i) = at(i-1);
+        head = (head + 1) & (capacity - 1);
+    }
+    else {
+        for (int i = pos; i < length-1; i++)
+            at(i) = at(i+1);
+    }
+    length--;
+    return true;
+}
+
+//----
+
+cCalendarQueue::cCalendarQueue(const char *name) : cFutureEventSet(name)
+{
+    numBuckets = MIN_BUCKETS;
+    buckets = new Bucket[numBuckets];
+    bucketWidth = 1;  // will be adjusted to the workload on the first resize
+    length = 0;
+    insertCount = 0;
+    currentDay = 0;
+    directSearchCount = 0;
+    removalsSinceResize = 0;
+    flattenedValid = false;
+}
+
+cCalendarQueue::cCalendarQueue(const cCalendarQueue& other) : cFutureEventSet(other)
+{
+    buckets = nullptr;
+    length = 0;
+    copy(other);
+}
+
+cCalendarQueue::~cCalendarQueue()
+{
+    clear();
+    delete[] buckets;
+}
+
+std::string cCalendarQueue::str() const
+{
+    if (isEmpty())
+        return std::string("empty");
+    std::stringstream out;
+    out << "length=" << getLength() << ", buckets=" << numBuckets << ", bucketWidth=" << getBucketWidth().ustr();
+    return out.str();
+}
+
+void cCalendarQueue::forEachChild(cVisitor *v)
+{
+    sort();
+
+    for (cEvent *event : flattened)
+        v->visit(event);
+}
+
+void cCalendarQueue::clear()
+{
+    for (int i = 0; i < numBuckets; i++) {
+        Bucket& bucket = buckets[i];
+        for (int k = 0; k < bucket.length; k++)
+            dropAndDelete(bucket.at(k));
+        bucket.head = bucket.length = 0;
+    }
+    length = 0;
+    flattened.clear();
+    flattenedValid = false;
+}
+
+void cCalendarQueue::copy(const cCalendarQueue& other)
+{
+    numBuckets = other.numBuckets;
+    bucketWidth = other.bucketWidth;
+    insertCount = other.insertCount;
+    currentDay = other.currentDay;
+    directSearchCount = other.directSearchCount;
+    removalsSinceResize = other.removalsSinceResize;
+    flattened.clear();
+    flattenedValid = false;
+
+    delete[] buckets;
+    buckets = new Bucket[numBuckets];
+    length = 0;
+    for (int i = 0; i < numBuckets; i++) {
+        const Bucket& bucket = other.buckets[i];
+        for (int k = 0; k < bucket.length; k++) {
+            cEvent *event = bucket.at(k)->dup();
+            event->insertOrder = bucket.at(k)->insertOrder;
+            take(event);
+            insertIntoBucket(event);
+            length++;
+        }
+    }
+}
+
+cCalendarQueue& cCalendarQueue::operator=(const cCalendarQueue& other)
+{
+    if (this == &other)
+        return *this;
+    cFutureEventSet::operator=(other);
+    clear();
+    copy(other);
+    return *this;
+}
+
+inline int64_t cCalendarQueue::dayOf(const cEvent *event) const
+{
+    return event->getArrivalTime().raw() / bucketWidth;
+}
+
+void cCalendarQueue::insertIntoBucket(cEvent *event)
+{
+    int64_t day = dayOf(event);
+    int index = (int)(day & (numBuckets - 1));
+    buckets[index].insert(event);
+    event->heapIndex = index;
+    if (day < currentDay)
+        currentDay = day;
+    flattenedValid = false;
+}
+
+int cCalendarQueue::findFirstBucket() const
+{
+    if (length == 0)
+        return -1;
+
+    // scan one "year", starting at the current day
+    int mask = numBuckets - 1;
+    for (int i = 0; i < numBuckets; i++, currentDay++) {
+        const Bucket& bucket = buckets[currentDay & mask];
+        if (bucket.length != 0 && dayOf(bucket.front()) == currentDay)
+            return (int)(currentDay & mask);
+    }
+
+    // no event within a year: find the earliest one by checking the head of each bucket
+    int best = -1;
+    for (int i = 0; i < numBuckets; i++)
+        if (buckets[i].length != 0 && (best == -1 || precedes(buckets[i].front(), buckets[best].front())))
+            best = i;
+    currentDay = dayOf(buckets[best].front());
+    directSearchCount++;
+    return best;
+}
+
+int64_t cCalendarQueue::calculateBucketWidth(const std::vector<cEvent*>& events) const
+{
+    int n = events.size();
+    if (n < 2)
+        return bucketWidth;
+
+    // take the earliest few events (these are the ones that will be dequeued
+    // next), and compute the average separation of their arrival times
+    std::vector<int64_t> times;
+    times.reserve(n);
+    for (cEvent *event : events)
+        times.push_back(event->getArrivalTime().raw());
+    int sampleSize = std::min(n, WIDTH_SAMPLE_SIZE);
+    std::partial_sort(times.begin(), times.begin() + sampleSize, times.end());
+
+    // ignore zero separations (bursts at the same simtime would only pull down
+    // the average), and, following Brown, large separations as well
+    double sum = 0;
+    int count = 0;
+    for (int i = 1; i < sampleSize; i++) {
+        if (times[i] != times[i-1]) {
+            sum += (double)(times[i] - times[i-1]);
+            count++;
+        }
+    }
+    double averageSeparation;
+    if (count != 0) {
+        double average = sum / count;
+        sum = 0;
+        count = 0;
+        for (int i = 1; i < sampleSize; i++) {
+            int64_t d = times[i] - times[i-1];
+            if (d != 0 && d <= 2 * average) {
+                sum += (double)d;
+                count++;
+            }
+        }
+        averageSeparation = sum / count;
+    }
+    else {
+        // all sampled events are at the same time; use the average separation of all events
+        int64_t maxTime = *std::max_element(times.begin() + sampleSize - 1, times.end());
+        averageSeparation = (double)(maxTime - times[0]) / n;
+        if (averageSeparation == 0)
+            return bucketWidth;
+    }
+
+    double width = 3 * averageSeparation;
+    return width < 1 ? 1 : width > (double)(INT64_MAX/2) ? INT64_MAX/2 : (int64_t)width;
+}
+
+void cCalendarQueue::resize(int newNumBuckets)
+{
+    std::vector<cEvent*> events;
+    events.reserve(length);
+    for (int i = 0; i < numBuckets; i++) {
+        const Bucket& bucket = buckets[i];
+        for (int k = 0; k < bucket.length; k++)
+            events.push_back(bucket.at(k));
+    }
+
+    int64_t newBucketWidth = calculateBucketWidth(events);
+    directSearchCount = 0;
+    removalsSinceResize = 0;
+    if (newNumBuckets == numBuckets && newBucketWidth == bucketWidth)
+        return;  // nothing would change
+
+    bucketWidth = newBucketWidth;
+    delete[] buckets;
+    numBuckets = newNumBuckets;
+    buckets = new Bucket[numBuckets];
+
+    currentDay = INT64_MAX;
+    for (cEvent *event : events)
+        insertIntoBucket(event); // also updates currentDay
+    if (events.empty())
+        currentDay = 0;
+}
+
+void cCalendarQueue::insert(cEvent *event)
+{
+    take(event);
+    event->insertOrder = insertCount++;
+    insertIntoBucket(event);
+    length++;
+
+    if (length > 2 * numBuckets)
+        resize(2 * numBuckets);
+}
+
+cEvent *cCalendarQueue::peekFirst() const
+{
+    int index = findFirstBucket();
+    return index == -1 ? nullptr : buckets[index].front();
+}
+
+cEvent *cCalendarQueue::removeFirst()
+{
+    int index = findFirstBucket();
+    if (index == -1)
+        return nullptr;
+
+    cEvent *event = buckets[index].popFront();
+    length--;
+    removalsSinceResize++;
+    flattenedValid = false;
+    drop(event);
+    event->heapIndex = -1;
+
+    if (length < numBuckets / 2 && numBuckets > MIN_BUCKETS)
+        resize(numBuckets / 2);
+    else if (directSearchCount > MAX_DIRECT_SEARCHES && removalsSinceResize >= numBuckets)
+        resize(numBuckets);  // bucket width seems to be off, recalculate it; at most once per numBuckets removals, so the cost stays amortized O(1)
+    return event;
+}
+
+cEvent *cCalendarQueue::remove(cEvent *event)
+{
+    // make sure it is really in the FES
+    if (event->heapIndex == -1)
+        return nullptr;
+
+    bool found = buckets[event->heapIndex].remove(event);
+    ASSERT(found);  // sanity check
+    (void)found;
+    length--;
+    flattenedValid = false;
+    drop(event);
+    event->heapIndex = -1;
+
+    if (length < numBuckets / 2 && numBuckets > MIN_BUCKETS)
+        resize(numBuckets / 2);
+    return event;
+}
+
+void cCalendarQueue::putBackFirst(cEvent *event)
+{
+    take(event);
+    insertIntoBucket(event);  // note: insertOrder is preserved
+    length++;
+}
+
+void cCalendarQueue::flatten() const
+{
+    if (flattenedValid)
+        return;
+    flattened.clear();
+    flattened.reserve(length);
+    for (int i = 0; i < numBuckets; i++) {
+        const Bucket& bucket = buckets[i];
+        for (int k = 0; k < bucket.length; k++)
+            flattened.push_back(bucket.at(k));
+    }
+    flattenedValid = true;
+}
+
+cEvent *cCalendarQueue::get(int k)
+{
+    if (k < 0 || k >= length)
+        return nullptr;
+    flatten();
+    return flattened[k];
+}
+
+void cCalendarQueue::sort()
+{
+    flatten();
+    std::sort(flattened.begin(), flattened.end(), precedes);
+}
+
+}  // namespace omnetpp
+
@@ -28,6 +28,7 @@
 #include "omnetpp/cenum.h"
 #include "omnetpp/simutil.h"
 #include "omnetpp/cobjectfactory.h"  // createOne()
+#include "omnetpp/cexception.h"
 #include "omnetpp/platdep/platmisc.h"  // PRId64
 
 using namespace omnetpp::common;
@@ -309,5 +310,15 @@ int cClassDescriptor::findField(const char *fieldName) const
     return -1;
 }
 
+intval_t cClassDescriptor::getFieldValueAsInt(void *object, int field, int i) const
+{
+    throw cRuntimeError("getFieldValueAsInt(): Field '%s' of class '%s' is not of an integer type", getFieldName(field), getName());
+}
+
+double cClassDescriptor::getFieldValueAsDouble(void *object, int field, int i) const
+{
+    throw cRuntimeError("getFieldValueAsDouble(): Field '%s' of class '%s' is not of a floating-point type", getFieldName(field), getName());
+}
+
 }  // namespace omnetpp
 
@@ -14,6 +14,7 @@
 *--------------------------------------------------------------*/
 
 #include <algorithm>
+#include <mutex>
 #include "common/stringutil.h"
 #include "omnetpp/ccomponent.h"
 #include "omnetpp/ccomponenttype.h"
@@ -34,6 +35,9 @@
 #include "omnetpp/cenvir.h"
 #include "omnetpp/cresultrecorder.h"
 #include "omnetpp/cresultfilter.h"
+#include "omnetpp/cprofiler.h"
+#include "omnetpp/simutil.h"
+#include "paralleleventexecutor.h"
 
 using namespace omnetpp::common;
 
@@ -43,28 +47,25 @@ namespace omnetpp {
 Register_PerObjectConfigOption(CFGID_PARAM_RECORD_AS_SCALAR, "param-record-as-scalar", KIND_PARAMETER, CFG_BOOL, "false", "Applicable to module parameters: specifies whether the module parameter should be recorded into the output scalar file. Set it for parameters whose value you will need for result analysis.");
 
 cComponent::SignalNameMapping *cComponent::signalNameMapping = nullptr;
-int cComponent::lastSignalID = -1;
+std::atomic<int> cComponent::lastSignalID(-1);
+static std::mutex signalNameMappingMutex;
 
 static const int NOTIFICATION_STACK_SIZE = 64;
-cIListener **cComponent::notificationStack[NOTIFICATION_STACK_SIZE];
-int cComponent::notificationSP = 0;
+thread_local cComponent::NotificationFrame cComponent::notificationStack[NOTIFICATION_STACK_SIZE];
+thread_local int cComponent::notificationSP = 0;
 
-bool cComponent::checkSignals;
+thread_local std::vector<cComponent::SignalDispatchList*> cComponent::retiredDispatchLists;
 
 simsignal_t PRE_MODEL_CHANGE = cComponent::registerSignal("PRE_MODEL_CHANGE");
 simsignal_t POST_MODEL_CHANGE = cComponent::registerSignal("POST_MODEL_CHANGE");
 
 EXECUTE_ON_SHUTDOWN(cComponent::clearSignalRegistrations());
 
-std::vector<int> cComponent::signalListenerCounts;
-
-// Calling registerSignal in static initializers of runtime loaded dynamic
-// libraries would cause an assertion failure without this:
-EXECUTE_ON_STARTUP(cComponent::clearSignalState());
-
-std::vector<cComponent::ResultRecorderList*> cComponent::cachedResultRecorderLists;
-
-EXECUTE_ON_SHUTDOWN(cComponent::invalidateCachedResultRecorderLists())
+cComponent::SignalState::~SignalState()
+{
+    for (ResultRecorderList *recorderList : cachedResultRecorderLists)
+        delete recorderList;
+}
 
 
 cComponent::cComponent(const char *name) : cDefaultOwner(name)
@@ -81,8 +82,12 @@ cComponent::cComponent(const char *name) : cDefaultOwner(name)
     displayString = nullptr;
 
     signalTable = nullptr;
+    dispatchLists = nullptr;
 
     setLogLevel(LOGLEVEL_TRACE);
+
+    if (!getOwnershipTracking())
+        disableTracking();
 }
 
 cComponent::~cComponent()
@@ -91,6 +96,8 @@ cComponent::~cComponent()
         simulation->deregisterComponent(this);
 
     ASSERT(signalTable == nullptr);  // note: releaseLocalListeners() gets called in subclasses, ~cModule and ~cChannel
+    discardDispatchCache();
+    delete dispatchLists;
     delete[] rngMap;
     delete[] parArray;
     delete displayString;
@@ -149,6 +156,18 @@ void cComponent::refreshDisplay() const
     // Can be redefined by the user.
 }
 
+void cComponent::packCheckpoint(cCommBuffer *) const
+{
+    // Called when writing a checkpoint.
+    // Can be redefined by the user.
+}
+
+void cComponent::unpackCheckpoint(cCommBuffer *)
+{
+    // Called when resuming from a checkpoint.
+    // Can be redefined by the user.
+}
+
 cComponentType *cComponent::getComponentType() const
 {
     if (!componentType)
@@ -168,6 +187,8 @@ cModule *cComponent::getSystemModule() const
 
 cRNG *cComponent::getRNG(int k) const
 {
+    if (simulation->isParallelEventBatchActive())
+        ParallelEventExecutor::throwNotAllowed("Using random number generators");
     return getEnvir()->getRNG(k < rngMapSize ? rngMap[k] : k);
 }
 
@@ -351,6 +372,8 @@ void cComponent::recordParameterAsScalar(cPar *par)
 
 void cComponent::recordScalar(const char *name, double value, const char *unit)
 {
+    if (simulation->isParallelEventBatchActive())
+        ParallelEventExecutor::throwNotAllowed("Recording scalars");
     if (!unit)
         getEnvir()->recordScalar(this, name, value);
     else {
@@ -407,7 +430,7 @@ bool cComponent::SignalListenerList::removeListener(cIListener *l)
         return false;  // not there
 
     // remove listener. note: don't delete listeners[] even if empty,
-    // because fire() relies on it not being nullptr
+    // because hasListener() and fireFinish() rely on it not being nullptr
     int n = countListeners();
     listeners[k] = listeners[n-1];
     listeners[n-1] = nullptr;
@@ -436,6 +459,7 @@ int cComponent::SignalListenerList::findListener(cIListener *l) const
 
 simsignal_t cComponent::registerSignal(const char *name)
 {
+    std::lock_guard<std::mutex> lock(signalNameMappingMutex);
     if (signalNameMapping == nullptr)
         signalNameMapping = new SignalNameMapping;
 
@@ -445,10 +469,6 @@ simsignal_t cComponent::registerSignal(const char *name)
         simsignal_t signalID = ++lastSignalID;
         signalNameMapping->signalNameToID[name] = signalID;
         signalNameMapping->signalIDToName[signalID] = name;
-        if (cStaticFlag::insideMain()) { // otherwise signalListenerCount[] may not have been initialized by C++ yet
-            signalListenerCounts.push_back(0);
-            ASSERT((int)signalListenerCounts.size() == lastSignalID+1);
-        }
         return signalID;
     }
     else {
@@ -458,6 +478,7 @@ simsignal_t cComponent::registerSignal(const char *name)
 
 const char *cComponent::getSignalName(simsignal_t signalID)
 {
+    std::lock_guard<std::mutex> lock(signalNameMappingMutex);
     if (!signalNameMapping)
         return nullptr;
     std::map<simsignal_t,std::string>::iterator it = signalNameMapping->signalIDToName.find(signalID);
@@ -468,17 +489,68 @@ void cComponent::clearSignalState()
 {
     // note: registered signals remain intact
 
+    SignalState& state = getSignalState();
+
     // reset listener counts
-    signalListenerCounts.resize(lastSignalID+1);
-    for (int & listenerCount : signalListenerCounts)
-        listenerCount = 0;
+    state.listenerCounts.assign(lastSignalID+1, 0);
 
     // clear notification stack
     notificationSP = 0;
+    disposeRetiredDispatchLists();
+    state.signalGenerations.assign(lastSignalID+1, ++state.lastGeneration);  // invalidate all dispatch lists
+
+    // reset statistics
+    state.signalStatistics.clear();
+}
+
+void cComponent::setCollectSignalStatistics(bool enabled)
+{
+    SignalState& state = getSignalState();
+    state.collectSignalStatistics = enabled;
+    state.signalStatistics.clear();
+}
+
+bool cComponent::getCollectSignalStatistics()
+{
+    return getSignalState().collectSignalStatistics;
+}
+
+int64_t cComponent::getSignalEmitCount(simsignal_t signalID)
+{
+    const std::vector<SignalStatistics>& signalStatistics = getSignalState().signalStatistics;
+    return signalID >= 0 && signalID < (int)signalStatistics.size() ? signalStatistics[signalID].emitCount : 0;
+}
+
+double cComponent::getSignalEmitTime(simsignal_t signalID)
+{
+    const std::vector<SignalStatistics>& signalStatistics = getSignalState().signalStatistics;
+    return signalID >= 0 && signalID < (int)signalStatistics.size() ? signalStatistics[signalID].emitTimeNsecs / 1e9 : 0;
+}
+
+void cComponent::setCheckSignals(bool b)
+{
+    getSignalState().checkSignals = b;
+}
+
+bool cComponent::getCheckSignals()
+{
+    return getSignalState().checkSignals;
+}
+
+void cComponent::invalidateSignalDispatchCachesRec() const
+{
+    discardDispatchCache();
+    if (const cModule *module = dynamic_cast<const cModule *>(this)) {
+        for (cModule::SubmoduleIterator it(module); !it.end(); ++it)
+            (*it)->invalidateSignalDispatchCachesRec();
+        for (cModule::ChannelIterator it(module); !it.end(); ++it)
+            (*it)->invalidateSignalDispatchCachesRec();
+    }
 }
 
 void cComponent::clearSignalRegistrations()
 {
+    std::lock_guard<std::mutex> lock(signalNameMappingMutex);
     delete signalNameMapping;
     signalNameMapping = nullptr;
 }
@@ -521,18 +593,115 @@ void cComponent::throwInvalidSignalID(simsignal_t signalID) const
     throw cRuntimeError(this, "Invalid signal signalID=%d", signalID);
 }
 
-void cComponent::checkNotFiring(simsignal_t signalID, cIListener **listenerList)
+void cComponent::checkNotFiring(simsignal_t signalID)
 {
-    // Check that the given listener list is not being notified.
-    // NOTE: we use the listener list and not ListenerList* for a reason:
-    // ListenerList may get moved as a result of new signals being subscribed
-    // (they are stored in an std::vector!), so checking for pointer equality
-    // would be no good. Move does not change the listener list pointer.
-    if (listenerList)
-        for (int i = 0; i < notificationSP; i++)
-            if (notificationStack[i] == listenerList)
-                throw cRuntimeError(this, "subscribe()/unsubscribe() failed: Cannot update listener list "
-                                          "while its listeners are being notified, signalID=%d", signalID);
+    // Check that our listeners of the given signal are not being notified.
+    // Listeners of other components in the same dispatch list (e.g. ancestors
+    // while a descendant's listeners are being notified) may be updated.
+    for (int i = 0; i < notificationSP; i++) {
+        const NotificationFrame& frame = notificationStack[i];
+        if (frame.dispatchList->signalID == signalID && frame.dispatchList->owners[frame.listenerIndex] == this)
+            throw cRuntimeError(this, "subscribe()/unsubscribe() failed: Cannot update listener list "
+                                      "while its listeners are being notified, signalID=%d", signalID);
+    }
+}
+
+void cComponent::cancelPendingNotifications(simsignal_t signalID, cIListener *listener) const
+{
+    // The dispatch lists being notified are snapshots; the listener must not
+    // be called from them after it has been unsubscribed (it may even have
+    // been deleted since). Entries already called are cleared as well, that
+    // does no harm.
+    for (int i = 0; i < notificationSP; i++) {
+        SignalDispatchList *dispatchList = notificationStack[i].dispatchList;
+        if (dispatchList->signalID != signalID)
+            continue;
+        int n = dispatchList->listeners.size();
+        for (int k = 0; k < n; k++)
+            if (dispatchList->listeners[k] == listener && dispatchList->owners[k] == this)
+                dispatchList->listeners[k] = nullptr;
+    }
+}
+
+inline cComponent::SignalDispatchList *cComponent::getDispatchList(simsignal_t signalID) const
+{
+    if (dispatchLists) {
+        for (SignalDispatchList *dispatchList : *dispatchLists) {
+            if (dispatchList->signalID == signalID) {
+                const std::vector<uint64_t>& signalGenerations = getSignalState().signalGenerations;
+                uint64_t generation = signalID < (int)signalGenerations.size() ? signalGenerations[signalID] : 0;
+                if (dispatchList->generation == generation)
+                    return dispatchList;
+                break;
+            }
+        }
+    }
+    return buildDispatchList(signalID);
+}
+
+cComponent::SignalDispatchList *cComponent::buildDispatchList(simsignal_t signalID) const
+{
+    const std::vector<uint64_t>& signalGenerations = getSignalState().signalGenerations;
+
+    // collect listeners from this component and its ancestors, in notification order
+    SignalDispatchList *dispatchList = new SignalDispatchList;
+    dispatchList->signalID = signalID;
+    dispatchList->generation = signalID < (int)signalGenerations.size() ? signalGenerations[signalID] : 0;
+    for (const cComponent *component = this; component; component = component->getParentModule()) {
+        SignalListenerList *listenerList = component->findListenerList(signalID);
+        if (listenerList) {
+            for (int i = 0; listenerList->listeners[i]; i++) {
+                dispatchList->listeners.push_back(listenerList->listeners[i]);
+                dispatchList->owners.push_back(component);
+            }
+        }
+    }
+
+    // replace the stale list of the signal, if any
+    if (!dispatchLists)
+        dispatchLists = new std::vector<SignalDispatchList*>;
+    for (SignalDispatchList *& entry : *dispatchLists) {
+        if (entry->signalID == signalID) {
+            retireDispatchList(entry);
+            entry = dispatchList;
+            return dispatchList;
+        }
+    }
+    dispatchLists->push_back(dispatchList);
+    return dispatchList;
+}
+
+void cComponent::retireDispatchList(SignalDispatchList *dispatchList)
+{
+    // lists on the notification stack are still being iterated over
+    if (notificationSP > 0)
+        retiredDispatchLists.push_back(dispatchList);
+    else
+        delete dispatchList;
+}
+
+void cComponent::discardDispatchCache() const
+{
+    if (!dispatchLists)
+        return;
+    for (SignalDispatchList *dispatchList : *dispatchLists)
+        retireDispatchList(dispatchList);
+    dispatchLists->clear();
+}
+
+void cComponent::invalidateDispatchLists(simsignal_t signalID)
+{
+    SignalState& state = getSignalState();
+    if (signalID >= (int)state.signalGenerations.size())
+        state.signalGenerations.resize(lastSignalID+1, 0);
+    state.signalGenerations[signalID] = ++state.lastGeneration;
+}
+
+void cComponent::disposeRetiredDispatchLists()
+{
+    for (SignalDispatchList *dispatchList : retiredDispatchLists)
+        delete dispatchList;
+    retiredDispatchLists.clear();
 }
 
 void cComponent::removeListenerList(simsignal_t signalID)
@@ -559,104 +728,147 @@ void cComponent::removeListenerList(simsignal_t signalID)
 
 bool cComponent::hasListeners(simsignal_t signalID) const
 {
-    // check local listeners
-    if (signalTable) {
-        int n = signalTable->size();
-        for (int i = 0; i < n; i++)
-            if ((*signalTable)[i].signalID == signalID)
-                return true;
-    }
-
-    // if not found, check ancestors
-    cModule *parent = getParentModule();
-    return parent ? parent->hasListeners(signalID) : false;
+    if (signalID < 0 || signalID > lastSignalID)
+        return false;
+    const std::vector<int>& listenerCounts = getSignalState().listenerCounts;
+    if (signalID >= (int)listenerCounts.size() || listenerCounts[signalID] == 0)
+        return false;
+    return !getDispatchList(signalID)->listeners.empty();
 }
 
 void cComponent::emit(simsignal_t signalID, bool b, cObject *details)
 {
-    if (checkSignals)
+    if (getSignalState().checkSignals)
         getComponentType()->checkSignal(signalID, SIMSIGNAL_BOOL);
-    if (mayHaveListeners(signalID))
-        fire(this, signalID, b, details);
+    emitSignal(signalID, b, details);
 }
 
 void cComponent::doEmit(simsignal_t signalID, intval_t i, cObject *details)
 {
-    if (checkSignals)
+    if (getSignalState().checkSignals)
         getComponentType()->checkSignal(signalID, SIMSIGNAL_INT);
-    if (mayHaveListeners(signalID))
-        fire(this, signalID, i, details);
+    emitSignal(signalID, i, details);
 }
 
 void cComponent::doEmit(simsignal_t signalID, uintval_t i, cObject *details)
 {
-    if (checkSignals)
+    if (getSignalState().checkSignals)
         getComponentType()->checkSignal(signalID, SIMSIGNAL_UINT);
-    if (mayHaveListeners(signalID))
-        fire(this, signalID, i, details);
+    emitSignal(signalID, i, details);
 }
 
 void cComponent::emit(simsignal_t signalID, double d, cObject *details)
 {
-    if (checkSignals)
+    if (getSignalState().checkSignals)
         getComponentType()->checkSignal(signalID, SIMSIGNAL_DOUBLE);
-    if (mayHaveListeners(signalID))
-        fire(this, signalID, d, details);
+    emitSignal(signalID, d, details);
 }
 
 void cComponent::emit(simsignal_t signalID, const SimTime& t, cObject *details)
 {
-    if (checkSignals)
+    if (getSignalState().checkSignals)
         getComponentType()->checkSignal(signalID, SIMSIGNAL_SIMTIME);
-    if (mayHaveListeners(signalID))
-        fire(this, signalID, t, details);
+    emitSignal(signalID, t, details);
 }
 
 void cComponent::emit(simsignal_t signalID, const char *s, cObject *details)
 {
     if (s == nullptr)
         throw cRuntimeError(this, "emit(): Emitting nullptr as string (const char *) signal value is not allowed, signalID=%d", signalID);
-    if (checkSignals)
+    if (getSignalState().checkSignals)
         getComponentType()->checkSignal(signalID, SIMSIGNAL_STRING);
-    if (mayHaveListeners(signalID))
-        fire(this, signalID, s, details);
+    emitSignal(signalID, s, details);
 }
 
 void cComponent::emit(simsignal_t signalID, cObject *obj, cObject *details)
 {
-    if (checkSignals)
+    if (getSignalState().checkSignals)
         getComponentType()->checkSignal(signalID, SIMSIGNAL_OBJECT, obj);
-    if (mayHaveListeners(signalID))
-        fire(this, signalID, obj, details);
+    emitSignal(signalID, obj, details);
 }
 
 template<typename T>
-void cComponent::fire(cComponent *source, simsignal_t signalID, T x, cObject *details)
+inline void cComponent::emitSignal(simsignal_t signalID, T x, cObject *details)
 {
-    // notify local listeners if there are any
-    SignalListenerList *listenerList = findListenerList(signalID);
-    if (listenerList) {
-        cIListener **listeners = listenerList->listeners;
-        if (notificationSP >= NOTIFICATION_STACK_SIZE)
-            throw cRuntimeError(this, "emit(): Recursive notification stack overflow, signalID=%d", signalID);
-
-        int oldNotificationSP = notificationSP;
-        try {
-            notificationStack[notificationSP++] = listeners;  // lock against modification
-            for (int i = 0; listeners[i]; i++)
-                listeners[i]->receiveSignal(source, signalID, x, details);  // will crash if listener is already deleted
-            notificationSP--;
+    cSimulation *simulation = cSimulation::getActiveSimulation();
+    if (simulation->isParallelEventBatchActive()) {
+        ParallelEventExecutor::deferEmit(this, signalID, x, details);  // listeners are notified after the batch
+        return;
+    }
+    SignalState& state = simulation->signalState;
+    if (!state.collectSignalStatistics && !simulation->profiler) {
+        if (mayHaveListeners(signalID))
+            fire(signalID, x, details);
+    }
+    else {
+        cProfiler *profiler = simulation->profiler;
+        uint64_t startTicks = profiler ? cProfiler::getTicks() : 0;
+        if (!state.collectSignalStatistics) {
+            if (mayHaveListeners(signalID))
+                fire(signalID, x, details, profiler);
         }
-        catch (std::exception& e) {
-            notificationSP = oldNotificationSP;
-            throw;
+        else {
+            if (signalID < 0 || signalID > lastSignalID)
+                throwInvalidSignalID(signalID);
+            if (signalID >= (int)state.signalStatistics.size())
+                state.signalStatistics.resize(lastSignalID+1);
+            int64_t startTime = opp_get_monotonic_clock_nsecs();
+            if (mayHaveListeners(signalID))
+                fire(signalID, x, details, profiler);
+            SignalStatistics& stats = state.signalStatistics[signalID];  // note: vector may have been resized by nested emits
+            stats.emitCount++;
+            stats.emitTimeNsecs += opp_get_monotonic_clock_nsecs() - startTime;
         }
+        if (profiler)
+            profiler->emitDone(this, signalID, startTicks);
     }
+}
 
-    // notify ancestors recursively
-    cModule *parent = getParentModule();
-    if (parent)
-        parent->fire(source, signalID, x, details);
+template<typename T>
+void cComponent::fire(simsignal_t signalID, T x, cObject *details, cProfiler *profiler)
+{
+    // notify listeners in this component and in ancestors, using the flattened list
+    SignalDispatchList *dispatchList = getDispatchList(signalID);
+    int n = dispatchList->listeners.size();
+    if (n == 0)
+        return;
+    if (notificationSP >= NOTIFICATION_STACK_SIZE)
+        throw cRuntimeError(this, "emit(): Recursive notification stack overflow, signalID=%d", signalID);
+
+    int oldNotificationSP = notificationSP;
+    try {
+        NotificationFrame& frame = notificationStack[notificationSP++];  // lock against modification
+        frame.dispatchList = dispatchList;
+        int& i = frame.listenerIndex;
+        cIListener *const *listeners = dispatchList->listeners.data();  // entries may be cleared by unsubscribe() during the loop
+        if (!profiler || !profiler->getListenerNotificationsEnabled()) {
+            for (i = 0; i < n; i++) {
+                cIListener *listener = listeners[i];
+                if (!listener)
+                    continue;  // unsubscribed meanwhile
+                listener->receiveSignal(this, signalID, x, details);  // will crash if listener is already deleted
+            }
+        }
+        else {
+            for (i = 0; i < n; i++) {
+                cIListener *listener = listeners[i];
+                if (!listener)
+                    continue;  // unsubscribed meanwhile
+                uint64_t startTicks = cProfiler::getTicks();
+                listener->receiveSignal(this, signalID, x, details);
+                profiler->listenerDone(listener, this, signalID, startTicks);
+            }
+        }
+        notificationSP--;
+    }
+    catch (std::exception& e) {
+        notificationSP = oldNotificationSP;
+        if (notificationSP == 0)
+            disposeRetiredDispatchLists();
+        throw;
+    }
+    if (notificationSP == 0 && !retiredDispatchLists.empty())
+        disposeRetiredDispatchLists();
 }
 
 void cComponent::fireFinish()
@@ -676,11 +888,15 @@ void cComponent::subscribe(simsignal_t signalID, cIListener *listener)
         throw cRuntimeError("subscribe(): Not a valid signal: SignalID=%d", signalID);
 
     // add to local listeners
+    checkNotFiring(signalID);
     SignalListenerList *listenerList = findOrCreateListenerList(signalID);
-    checkNotFiring(signalID, listenerList->listeners);
     if (!listenerList->addListener(listener))
         throw cRuntimeError(this, "subscribe(): Listener already subscribed at this component to signal '%s' (id=%d)", getSignalName(signalID), signalID);
-    signalListenerCounts[signalID]++;
+    SignalState& state = getSignalState();
+    if (signalID >= (int)state.listenerCounts.size())
+        state.listenerCounts.resize(lastSignalID+1);
+    state.listenerCounts[signalID]++;
+    invalidateDispatchLists(signalID);
     listener->subscribeCount++;
     listener->subscribedTo(this, signalID);
 }
@@ -695,16 +911,20 @@ void cComponent::unsubscribe(simsignal_t signalID, cIListener *listener)
     SignalListenerList *listenerList = findListenerList(signalID);
     if (!listenerList)
         return;
-    checkNotFiring(signalID, listenerList->listeners);
+    checkNotFiring(signalID);
     if (!listenerList->removeListener(listener))
         return;  // was already removed
 
     if (!listenerList->hasListener())
         removeListenerList(signalID);
+    if (notificationSP > 0)
+        cancelPendingNotifications(signalID, listener);
 
-    signalListenerCounts[signalID]--;
+    SignalState& state = getSignalState();
+    state.listenerCounts[signalID]--;
+    invalidateDispatchLists(signalID);
     listener->subscribeCount--;
-    ASSERT(signalListenerCounts[signalID] >= 0);
+    ASSERT(state.listenerCounts[signalID] >= 0);
     ASSERT(listener->subscribeCount >= 0);
     listener->unsubscribedFrom(this, signalID);
 }
@@ -795,6 +1015,7 @@ void cComponent::releaseLocalListeners()
 const std::vector<cResultRecorder*>& cComponent::getResultRecorders() const
 {
     // return cached copy if exists
+    std::vector<ResultRecorderList*>& cachedResultRecorderLists = getSignalState().cachedResultRecorderLists;
     for (auto & cachedResultRecorderList : cachedResultRecorderLists)
         if (cachedResultRecorderList->component == this)
             return cachedResultRecorderList->recorders;
@@ -832,6 +1053,9 @@ void cComponent::collectResultRecorders(std::vector<cResultRecorder*>& result) c
 
 void cComponent::invalidateCachedResultRecorderLists()
 {
+    if (!cSimulation::getActiveSimulation())
+        return;
+    std::vector<ResultRecorderList*>& cachedResultRecorderLists = getSignalState().cachedResultRecorderLists;
     int n = cachedResultRecorderLists.size();
     for (int i = 0; i < n; i++)
         delete cachedResultRecorderLists[i];
@@ -73,6 +73,8 @@ static SimsignalType getSignalType(const char *name, SimsignalType fallback=SIMS
 
 //----
 
+std::recursive_mutex cComponentType::sharedStateMutex;
+
 cComponentType::cComponentType(const char *qname) : cNoncopyableOwnedObject(qname, false)
 {
     // store fully qualified name, and set name to simple (unqualified) name
@@ -139,6 +141,7 @@ void cComponentType::putSharedParImpl(cParImpl *value)
 
 bool cComponentType::isAvailable()
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     if (!availabilityTested) {
         const char *className = getImplementationClassName();
         available = classes.getInstance()->lookup(className) != nullptr;
@@ -149,6 +152,8 @@ bool cComponentType::isAvailable()
 
 void cComponentType::checkSignal(simsignal_t signalID, SimsignalType type, cObject *obj)
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
+
     // check that this signal is allowed
     std::map<simsignal_t, SignalDesc>::const_iterator it = signalsSeen.find(signalID);
     if (it == signalsSeen.end()) {
@@ -258,6 +263,7 @@ cObjectFactory *cComponentType::lookupClass(const char *className) const
 
 const char *cComponentType::getSourceFileDirectory() const
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     if (!sourceFileDirectoryCached) {
         const char *fname = getSourceFileName();
         sourceFileDirectory = fname ? directoryOf(fname) : "";
@@ -502,6 +508,7 @@ cChannelType *cChannelType::get(const char *qname)
 
 cChannelType *cChannelType::getIdealChannelType()
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     if (!idealChannelType) {
         idealChannelType = find("ned.IdealChannel");
         ASSERT(idealChannelType);
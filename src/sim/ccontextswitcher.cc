@@ -28,6 +28,7 @@
 #include "omnetpp/cmodule.h"
 #include "omnetpp/globals.h"
 #include "omnetpp/cexception.h"
+#include "omnetpp/cprofiler.h"
 
 using namespace omnetpp::common;
 
@@ -43,7 +44,9 @@ cContextSwitcher::cContextSwitcher(const cComponent *newContext)
 
 cContextSwitcher::~cContextSwitcher()
 {
-    // restore old context
+    // restore old context (during parallel event execution, it was not switched, see cSimulation::setContext())
+    if (getSimulation()->isParallelEventBatchActive())
+        return;
     if (!callerContext)
         getSimulation()->setGlobalContext();
     else
@@ -54,12 +57,15 @@ cContextSwitcher::~cContextSwitcher()
 
 static va_list dummy_va;
 
-int cMethodCallContextSwitcher::depth = 0;
+thread_local int cMethodCallContextSwitcher::depth = 0;
 
 cMethodCallContextSwitcher::cMethodCallContextSwitcher(const cComponent *newContext) :
     cContextSwitcher(newContext)
 {
     depth++;
+    profiler = newContext != callerContext ? getSimulation()->getProfiler() : nullptr;
+    if (profiler)
+        profiler->beginMethodCall(const_cast<cComponent *>(newContext));
 }
 
 void cMethodCallContextSwitcher::methodCall(const char *methodFmt, ...)
@@ -93,6 +99,8 @@ void cMethodCallContextSwitcher::methodCallSilent()
 
 cMethodCallContextSwitcher::~cMethodCallContextSwitcher()
 {
+    if (profiler)
+        profiler->endMethodCall();
     depth--;
     cComponent *methodContext = getSimulation()->getContext();
     if (methodContext != callerContext)
@@ -21,10 +21,20 @@
 
 #include <cstring>
 #include <cstdio>
+#include <cstdlib>
+#include <cstdint>
 #include <new>  // bad::alloc
+#include <map>
+#include <vector>
+#include <mutex>
 #include "omnetpp/ccoroutine.h"
 #include "omnetpp/cexception.h"
 
+#ifdef USE_POSIX_COROUTINES
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #ifdef USE_PORTABLE_COROUTINES
 #include "task.h"  // Stig Kofoed's "Portable Multitasking" coroutine library
 #endif
@@ -33,7 +43,7 @@ namespace omnetpp {
 
 #ifdef USE_WIN32_FIBERS
 
-LPVOID cCoroutine::lpMainFiber;
+thread_local LPVOID cCoroutine::lpMainFiber;
 
 void cCoroutine::init(unsigned totalStack, unsigned mainStack)
 {
@@ -47,6 +57,10 @@ void cCoroutine::init(unsigned totalStack, unsigned mainStack)
     }
 }
 
+void cCoroutine::cleanup()
+{
+}
+
 void cCoroutine::switchTo(cCoroutine *cor)
 {
     SwitchToFiber(cor->lpFiber);
@@ -101,22 +115,329 @@ unsigned cCoroutine::getStackUsage() const
 
 #ifdef USE_POSIX_COROUTINES
 
-ucontext_t cCoroutine::mainContext;
-ucontext_t *cCoroutine::curContextPtr;
-unsigned cCoroutine::totalStackUsage;
-unsigned cCoroutine::totalStackLimit;
+#ifdef USE_FAST_CONTEXT_SWITCH
+
+// opp_coroutine_switch(void **fromSp, void *toSp): pushes the callee-saved
+// registers onto the current stack, stores the stack pointer into *fromSp,
+// switches to the toSp stack and pops the registers of the other context
+// from there. The floating-point control registers are also callee-saved.
+// Unlike swapcontext(), it does not touch the signal mask, so no system call.
+//
+// opp_coroutine_start: entry point of new coroutines; the initial stack frame
+// set up by setup() makes opp_coroutine_switch() "return" here, with the
+// coroutine function and its argument in callee-saved registers.
+// The coroutine function must never return.
+
+extern "C" void opp_coroutine_switch(void **fromSp, void *toSp) __asm__("opp_coroutine_switch");
+extern "C" void opp_coroutine_start() __asm__("opp_coroutine_start");
+
+#ifdef __APPLE__
+#define OPP_ASM_TEXT_SECTION  ".pushsection __TEXT,__text\n"
+#else
+#define OPP_ASM_TEXT_SECTION  ".pushsection .text\n"
+#endif
+
+#if defined(__x86_64__)
+
+asm(
+    OPP_ASM_TEXT_SECTION
+    ".p2align 4\n"
+    "opp_coroutine_switch:\n"
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    subq $8, %rsp\n"
+    "    stmxcsr (%rsp)\n"
+    "    fnstcw 4(%rsp)\n"
+    "    movq %rsp, (%rdi)\n"
+    "    movq %rsi, %rsp\n"
+    "    ldmxcsr (%rsp)\n"
+    "    fldcw 4(%rsp)\n"
+    "    addq $8, %rsp\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    ret\n"
+    ".p2align 4\n"
+    "opp_coroutine_start:\n"
+    "    .cfi_startproc\n"
+    "    .cfi_undefined rip\n"
+    "    movq %r13, %rdi\n"
+    "    callq *%r12\n"
+    "    ud2\n"
+    "    .cfi_endproc\n"
+    ".popsection\n"
+    );
+
+static void *initStackFrame(char *stackTop, CoroutineFnp fnp, void *arg)
+{
+    uint32_t mxcsr;
+    uint16_t fpucw;
+    __asm__ __volatile__ ("stmxcsr %0" : "=m" (mxcsr));
+    __asm__ __volatile__ ("fnstcw %0" : "=m" (fpucw));
+
+    // 16 bytes of headroom; keep the 16-byte alignment required by the ABI
+    // (rsp+8 must be aligned at function entry, i.e. after the ret)
+    void **sp = (void **)(((uintptr_t)stackTop & ~(uintptr_t)15) - 16);
+    *--sp = (void *)opp_coroutine_start;  // return address
+    *--sp = nullptr;  // rbp
+    *--sp = nullptr;  // rbx
+    *--sp = (void *)fnp;  // r12
+    *--sp = arg;  // r13
+    *--sp = nullptr;  // r14
+    *--sp = nullptr;  // r15
+    --sp;
+    memcpy(sp, &mxcsr, 4);
+    memcpy((char *)sp + 4, &fpucw, 2);
+    return sp;
+}
+
+#elif defined(__aarch64__)
+
+asm(
+    OPP_ASM_TEXT_SECTION
+    ".p2align 4\n"
+    "opp_coroutine_switch:\n"
+    "    sub sp, sp, #176\n"
+    "    stp x19, x20, [sp, #0]\n"
+    "    stp x21, x22, [sp, #16]\n"
+    "    stp x23, x24, [sp, #32]\n"
+    "    stp x25, x26, [sp, #48]\n"
+    "    stp x27, x28, [sp, #64]\n"
+    "    stp x29, x30, [sp, #80]\n"
+    "    stp d8, d9, [sp, #96]\n"
+    "    stp d10, d11, [sp, #112]\n"
+    "    stp d12, d13, [sp, #128]\n"
+    "    stp d14, d15, [sp, #144]\n"
+    "    mrs x9, fpcr\n"
+    "    str x9, [sp, #160]\n"
+    "    mov x9, sp\n"
+    "    str x9, [x0]\n"
+    "    mov sp, x1\n"
+    "    ldr x9, [sp, #160]\n"
+    "    msr fpcr, x9\n"
+    "    ldp x19, x20, [sp, #0]\n"
+    "    ldp x21, x22, [sp, #16]\n"
+    "    ldp x23, x24, [sp, #32]\n"
+    "    ldp x25, x26, [sp, #48]\n"
+    "    ldp x27, x28, [sp, #64]\n"
+    "    ldp x29, x30, [sp, #80]\n"
+    "    ldp d8, d9, [sp, #96]\n"
+    "    ldp d10, d11, [sp, #112]\n"
+    "    ldp d12, d13, [sp, #128]\n"
+    "    ldp d14, d15, [sp, #144]\n"
+    "    add sp, sp, #176\n"
+    "    ret\n"
+    ".p2align 4\n"
+    "opp_coroutine_start:\n"
+    "    .cfi_startproc\n"
+    "    .cfi_undefined x30\n"
+    "    mov x0, x20\n"
+    "    blr x19\n"
+    "    brk #0\n"
+    "    .cfi_endproc\n"
+    ".popsection\n"
+    );
+
+static void *initStackFrame(char *stackTop, CoroutineFnp fnp, void *arg)
+{
+    uint64_t fpcr;
+    __asm__ __volatile__ ("mrs %0, fpcr" : "=r" (fpcr));
+
+    void **sp = (void **)(((uintptr_t)stackTop & ~(uintptr_t)15) - 176);
+    memset(sp, 0, 176);
+    sp[0] = (void *)fnp;  // x19
+    sp[1] = arg;  // x20
+    sp[11] = (void *)opp_coroutine_start;  // x30 (lr); x29 (fp) is 0
+    sp[20] = (void *)fpcr;
+    return sp;
+}
+
+#endif
+
+thread_local void *cCoroutine::mainStackPointer;
+
+#else
+
+thread_local ucontext_t cCoroutine::mainContext;
+thread_local ucontext_t *cCoroutine::curContextPtr;
+
+#endif
+
+thread_local cCoroutine *cCoroutine::curCoroutine;
+thread_local unsigned cCoroutine::totalStackUsage;
+thread_local unsigned cCoroutine::totalStackLimit;
+struct sigaction cCoroutine::oldSigsegvAction;
+
+// Stacks are mmap'ed, so physical memory is only committed for the pages
+// actually touched. Below each stack there is an inaccessible guard area of
+// several pages, so that large stack frames cannot jump over it. Stacks of
+// deleted coroutines are kept in a pool (by size) for reuse; the pool is
+// shared by all threads.
+static const size_t pageSize = sysconf(_SC_PAGESIZE);
+static const size_t guardSize = (65536 + pageSize - 1) / pageSize * pageSize;
+static std::map<unsigned, std::vector<char *>> stackPool;
+static std::mutex stackPoolMutex;
+
+// The SIGSEGV handler that reports stack overflows is per process; it is
+// installed while at least one thread is between init() and cleanup().
+// It runs on a per-thread alternate signal stack.
+static std::mutex sigsegvHandlerMutex;
+static int sigsegvHandlerUsers = 0;
+static thread_local void *signalStackMemory = nullptr;
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS  MAP_ANON
+#endif
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE  0
+#endif
+
+static char *allocateStack(unsigned stackSize)
+{
+    {
+        std::lock_guard<std::mutex> lock(stackPoolMutex);
+        auto it = stackPool.find(stackSize);
+        if (it != stackPool.end() && !it->second.empty()) {
+            char *stack = it->second.back();
+            it->second.pop_back();
+            return stack;
+        }
+    }
+
+    void *p = mmap(nullptr, guardSize + stackSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED)
+        return nullptr;
+    if (mprotect(p, guardSize, PROT_NONE) != 0) {
+        munmap(p, guardSize + stackSize);
+        return nullptr;
+    }
+    return (char *)p + guardSize;
+}
+
+static void releaseStack(char *stack, unsigned stackSize)
+{
+    // replace the pages with fresh zero-filled ones: this gives back the memory,
+    // and keeps getStackUsage() accurate for the next user of the stack
+    void *p = mmap(stack, stackSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+    if (p == MAP_FAILED)
+        munmap(stack - guardSize, guardSize + stackSize);
+    else {
+        std::lock_guard<std::mutex> lock(stackPoolMutex);
+        stackPool[stackSize].push_back(stack);
+    }
+}
+
+void cCoroutine::sigsegvHandler(int sig, siginfo_t *info, void *context)
+{
+    char *addr = (char *)info->si_addr;
+    if (curCoroutine && addr >= curCoroutine->stackPtr - guardSize && addr < curCoroutine->stackPtr) {
+        const char *msg = "\n<!> Error: Stack overflow in activity() of a simple module: module stack too small? "
+                          "Try increasing it in the module class' constructor\n";
+        ssize_t unused = write(STDERR_FILENO, msg, strlen(msg));
+        (void)unused;
+    }
+
+    // pass the signal on to the previous handler, so that our handler stays
+    // installed; if there was none, perform the default action (terminate)
+    // once we return
+    if ((oldSigsegvAction.sa_flags & SA_SIGINFO) != 0)
+        oldSigsegvAction.sa_sigaction(sig, info, context);
+    else if (oldSigsegvAction.sa_handler != SIG_DFL && oldSigsegvAction.sa_handler != SIG_IGN)
+        oldSigsegvAction.sa_handler(sig);
+    else {
+        signal(SIGSEGV, SIG_DFL);
+        raise(SIGSEGV);  // blocked until the handler returns
+    }
+}
 
 void cCoroutine::init(unsigned totalStack, unsigned mainStack)
 {
+#ifndef USE_FAST_CONTEXT_SWITCH
     curContextPtr = &mainContext;
+#endif
+    curCoroutine = nullptr;
     totalStackUsage = 0;
     totalStackLimit = totalStack;
+
+    // the SIGSEGV handler for stack overflows needs to run on a separate stack;
+    // the alternate signal stack is per thread, the handler is per process
+    if (signalStackMemory)
+        return;  // already done in this thread
+    const size_t signalStackSize = 65536;
+    stack_t signalStack;
+    signalStack.ss_sp = malloc(signalStackSize);
+    signalStack.ss_size = signalStackSize;
+    signalStack.ss_flags = 0;
+    if (!signalStack.ss_sp)
+        return;
+    if (sigaltstack(&signalStack, nullptr) != 0) {
+        free(signalStack.ss_sp);
+        return;
+    }
+    signalStackMemory = signalStack.ss_sp;
+
+    std::lock_guard<std::mutex> lock(sigsegvHandlerMutex);
+    if (sigsegvHandlerUsers++ == 0) {
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_sigaction = sigsegvHandler;
+        action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGSEGV, &action, &oldSigsegvAction);
+    }
 }
 
+void cCoroutine::cleanup()
+{
+    if (!signalStackMemory)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(sigsegvHandlerMutex);
+        if (--sigsegvHandlerUsers == 0)
+            sigaction(SIGSEGV, &oldSigsegvAction, nullptr);
+    }
+
+    stack_t signalStack;
+    memset(&signalStack, 0, sizeof(signalStack));
+    signalStack.ss_flags = SS_DISABLE;
+    sigaltstack(&signalStack, nullptr);
+    free(signalStackMemory);
+    signalStackMemory = nullptr;
+}
+
+#ifdef USE_FAST_CONTEXT_SWITCH
+
+void cCoroutine::switchTo(cCoroutine *cor)
+{
+    void **oldStackPointerPtr = curCoroutine ? &curCoroutine->stackPointer : &mainStackPointer;
+    curCoroutine = cor;
+    opp_coroutine_switch(oldStackPointerPtr, cor->stackPointer);
+}
+
+void cCoroutine::switchToMain()
+{
+    if (curCoroutine == nullptr)
+        return;
+    void **oldStackPointerPtr = &curCoroutine->stackPointer;
+    curCoroutine = nullptr;
+    opp_coroutine_switch(oldStackPointerPtr, mainStackPointer);
+}
+
+#else
+
 void cCoroutine::switchTo(cCoroutine *cor)
 {
     ucontext_t *oldContextPtr = curContextPtr;
     curContextPtr = &(cor->context);
+    curCoroutine = cor;
     swapcontext(oldContextPtr, curContextPtr);
 }
 
@@ -126,46 +447,64 @@ void cCoroutine::switchToMain()
         return;
     ucontext_t *oldContextPtr = curContextPtr;
     curContextPtr = &mainContext;
+    curCoroutine = nullptr;
     swapcontext(oldContextPtr, curContextPtr);
 }
 
+#endif
+
 cCoroutine::cCoroutine()
 {
     stackSize = 0;
     stackPtr = nullptr;
+#ifdef USE_FAST_CONTEXT_SWITCH
+    stackPointer = nullptr;
+#endif
 }
 
 cCoroutine::~cCoroutine()
 {
-    totalStackUsage -= stackSize;
-    delete[] stackPtr;
+    if (stackPtr) {
+        totalStackUsage -= stackSize;
+        releaseStack(stackPtr, stackSize);
+    }
 }
 
 bool cCoroutine::setup(CoroutineFnp fnp, void *arg, unsigned stkSize)
 {
+    // round up to whole pages
+    stkSize = (stkSize + pageSize - 1) / pageSize * pageSize;
+
     if (totalStackLimit != 0 && totalStackUsage + stkSize >= totalStackLimit)
         return false;
 
-    try {
-        stackPtr = new char[stkSize];
-        stackSize = stkSize;
-    }
-    catch (std::bad_alloc& e) {
+    stackPtr = allocateStack(stkSize);
+    if (!stackPtr)
         return false;
-    }
+    stackSize = stkSize;
+    totalStackUsage += stackSize;
+
+#ifdef USE_FAST_CONTEXT_SWITCH
+    stackPointer = initStackFrame(stackPtr + stackSize, fnp, arg);
+#else
     context.uc_stack.ss_sp = stackPtr;
     context.uc_stack.ss_size = stackSize;
     context.uc_link = &mainContext;
-    totalStackUsage += stackSize;
     if (getcontext(&context) != 0)
         return false;
     makecontext(&context, (void (*)(void))fnp, 1, arg);
+#endif
     return true;
 }
 
 bool cCoroutine::hasStackOverflow() const
 {
-    return false;
+    // overflows hit the guard area; here we check whether the stack has been
+    // used down to its last page, by looking at the (initially zero) word at
+    // the page boundary. This is cheap enough to be done after every switch.
+    if (!stackPtr || stackSize <= pageSize)
+        return false;
+    return *(const uint64_t *)(stackPtr + pageSize - sizeof(uint64_t)) != 0;
 }
 
 unsigned cCoroutine::getStackSize() const
@@ -175,7 +514,17 @@ unsigned cCoroutine::getStackSize() const
 
 unsigned cCoroutine::getStackUsage() const
 {
-    return 0;
+    // stacks start out zero-filled and grow downwards, so the lowest nonzero
+    // byte is the high-water mark. Reading untouched pages does not commit them.
+    if (!stackPtr)
+        return 0;
+    const char *p = stackPtr;
+    const char *end = stackPtr + stackSize;
+    while (p < end && *(const uint64_t *)p == 0)
+        p += sizeof(uint64_t);
+    while (p < end && *p == 0)
+        p++;
+    return end - p;
 }
 
 #endif
@@ -187,6 +536,10 @@ void cCoroutine::init(unsigned totalStack, unsigned mainStack)
     task_init(totalStack, mainStack);
 }
 
+void cCoroutine::cleanup()
+{
+}
+
 void cCoroutine::switchTo(cCoroutine *cor)
 {
     task_switchto(((cCoroutine *)cor)->task);
@@ -0,0 +1,322 @@
+//=========================================================================
+//  CDARYEVENTHEAP.CC - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//   Member functions of
+//    cDaryEventHeap : future event set, implemented as 4-ary heap
+//                     with inlined ordering keys
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include "omnetpp/globals.h"
+#include "omnetpp/cevent.h"
+#include "omnetpp/cdaryeventheap.h"
+
+namespace omnetpp {
+
+Register_Class(cDaryEventHeap);
+
+//
+// The heap is 4-ary: children of element i are 4i+1..4i+4, the parent of
+// element i is (i-1)/4. The heap[] pointer is set up so that heap[-3] is at
+// a 128-byte boundary; then every group of siblings (4i+1..4i+4) starts at
+// a 128-byte boundary, and occupies exactly two cache lines.
+//
+#define ARITY          4
+#define HEAP_OFFSET    3
+#define ALIGNMENT      128
+
+#define PARENT(i)      (((i)-1) >> 2)
+#define FIRSTCHILD(i)  (((i) << 2) + 1)
+
+//----
+
+cDaryEventHeap::cDaryEventHeap(const char *name, int initialCapacity) : cFutureEventSet(name)
+{
+    insertCount = 0;
+    heapLength = 0;
+    heap = nullptr;
+    heapAlloc = nullptr;
+    allocateHeap(initialCapacity < 4 ? 4 : initialCapacity);
+
+    positionsCapacity = heapCapacity;
+    positions = new int[positionsCapacity];
+    numHandles = 0;
+    freeHandle = -1;
+}
+
+cDaryEventHeap::cDaryEventHeap(const cDaryEventHeap& other) : cFutureEventSet(other)
+{
+    heap = nullptr;
+    heapAlloc = nullptr;
+    heapLength = 0;
+    positions = nullptr;
+    copy(other);
+}
+
+cDaryEventHeap::~cDaryEventHeap()
+{
+    clear();
+    delete[] heapAlloc;
+    delete[] positions;
+}
+
+std::string cDaryEventHeap::str() const
+{
+    if (isEmpty())
+        return std::string("empty");
+    std::stringstream out;
+    out << "length=" << getLength();
+    return out.str();
+}
+
+void cDaryEventHeap::forEachChild(cVisitor *v)
+{
+    sort();
+
+    for (int i = 0; i < heapLength; i++)
+        v->visit(heap[i].event);
+}
+
+void cDaryEventHeap::clear()
+{
+    for (int i = 0; i < heapLength; i++)
+        dropAndDelete(heap[i].event);
+    heapLength = 0;
+    numHandles = 0;
+    freeHandle = -1;
+}
+
+void cDaryEventHeap::copy(const cDaryEventHeap& other)
+{
+    insertCount = other.insertCount;
+
+    delete[] heapAlloc;
+    allocateHeap(other.heapCapacity);
+    delete[] positions;
+    positionsCapacity = std::max(other.heapLength, 4);
+    positions = new int[positionsCapacity];
+
+    // copy events; handles are renumbered
+    heapLength = other.heapLength;
+    for (int i = 0; i < heapLength; i++) {
+        heap[i] = other.heap[i];
+        cEvent *event = other.heap[i].event->dup();
+        event->insertOrder = other.heap[i].insertOrder;
+        take(event);
+        heap[i].event = event;
+        heap[i].handle = i;
+        event->heapIndex = i;
+        positions[i] = i;
+    }
+    numHandles = heapLength;
+    freeHandle = -1;
+}
+
+cDaryEventHeap& cDaryEventHeap::operator=(const cDaryEventHeap& other)
+{
+    if (this == &other)
+        return *this;
+    cFutureEventSet::operator=(other);
+    clear();
+    copy(other);
+    return *this;
+}
+
+void cDaryEventHeap::allocateHeap(int capacity)
+{
+    heapCapacity = capacity;
+    heapAlloc = new char[(heapCapacity + HEAP_OFFSET) * sizeof(Entry) + ALIGNMENT];
+    uintptr_t base = ((uintptr_t)heapAlloc + ALIGNMENT - 1) & ~(uintptr_t)(ALIGNMENT - 1);
+    heap = (Entry *)base + HEAP_OFFSET;
+}
+
+void cDaryEventHeap::growHeap()
+{
+    Entry *oldHeap = heap;
+    char *oldHeapAlloc = heapAlloc;
+    allocateHeap(2 * heapCapacity);
+    std::copy(oldHeap, oldHeap + heapLength, heap);
+    delete[] oldHeapAlloc;
+}
+
+int cDaryEventHeap::allocateHandle()
+{
+    if (freeHandle != -1) {
+        int handle = freeHandle;
+        freeHandle = positions[handle];
+        return handle;
+    }
+    if (numHandles == positionsCapacity) {
+        int *newPositions = new int[2 * positionsCapacity];
+        std::copy(positions, positions + numHandles, newPositions);
+        delete[] positions;
+        positions = newPositions;
+        positionsCapacity *= 2;
+    }
+    return numHandles++;
+}
+
+inline void cDaryEventHeap::releaseHandle(int handle)
+{
+    positions[handle] = freeHandle;
+    freeHandle = handle;
+}
+
+void cDaryEventHeap::siftUp(int pos, const Entry& entry)
+{
+    // note: we move the hole up instead of swapping
+    while (pos > 0) {
+        int parent = PARENT(pos);
+        if (!(entry < heap[parent]))
+            break;
+        heap[pos] = heap[parent];
+        positions[heap[pos].handle] = pos;
+        pos = parent;
+    }
+    heap[pos] = entry;
+    positions[entry.handle] = pos;
+}
+
+void cDaryEventHeap::siftDown(int pos, const Entry& entry)
+{
+    while (true) {
+        int first = FIRSTCHILD(pos);
+        if (first >= heapLength)
+            break;
+        int last = std::min(first + ARITY, heapLength);
+        int smallest = first;
+        for (int child = first + 1; child < last; child++)
+            if (heap[child] < heap[smallest])
+                smallest = child;
+        if (!(heap[smallest] < entry))
+            break;
+        heap[pos] = heap[smallest];
+        positions[heap[pos].handle] = pos;
+        pos = smallest;
+    }
+    heap[pos] = entry;
+    positions[entry.handle] = pos;
+}
+
+void cDaryEventHeap::doInsert(cEvent *event)
+{
+    if (heapLength == heapCapacity)
+        growHeap();
+
+    Entry entry;
+    entry.arrivalTime = event->getArrivalTime().raw();
+    entry.insertOrder = event->insertOrder;
+    entry.event = event;
+    entry.handle = allocateHandle();
+    entry.priority = event->getSchedulingPriority();
+    event->heapIndex = entry.handle;
+
+    siftUp(heapLength++, entry);
+}
+
+cEvent *cDaryEventHeap::removeAt(int pos)
+{
+    cEvent *event = heap[pos].event;
+    releaseHandle(heap[pos].handle);
+
+    // last element will be used to fill the hole
+    if (pos != --heapLength) {
+        Entry fill = heap[heapLength];
+        if (pos > 0 && fill < heap[PARENT(pos)])
+            siftUp(pos, fill);
+        else
+            siftDown(pos, fill);
+    }
+
+    drop(event);
+    event->heapIndex = -1;
+    return event;
+}
+
+void cDaryEventHeap::insert(cEvent *event)
+{
+    take(event);
+    event->insertOrder = insertCount++;
+    doInsert(event);
+}
+
+cEvent *cDaryEventHeap::peekFirst() const
+{
+    return heapLength != 0 ? heap[0].event : nullptr;
+}
+
+cEvent *cDaryEventHeap::removeFirst()
+{
+    return heapLength != 0 ? removeAt(0) : nullptr;
+}
+
+cEvent *cDaryEventHeap::remove(cEvent *event)
+{
+    // make sure it is really on the heap
+    if (event->heapIndex == -1)
+        return nullptr;
+
+    int pos = positions[event->heapIndex];
+    ASSERT(heap[pos].event == event);  // sanity check
+    return removeAt(pos);
+}
+
+void cDaryEventHeap::reschedule(cEvent *event, simtime_t t)
+{
+    if (event->heapIndex == -1) {
+        cFutureEventSet::reschedule(event, t);
+        return;
+    }
+
+    int pos = positions[event->heapIndex];
+    ASSERT(heap[pos].event == event);  // sanity check
+
+    event->setArrivalTime(t);
+    event->insertOrder = insertCount++;
+
+    Entry entry = heap[pos];
+    entry.arrivalTime = t.raw();
+    entry.insertOrder = event->insertOrder;
+    entry.priority = event->getSchedulingPriority();
+    if (pos > 0 && entry < heap[PARENT(pos)])
+        siftUp(pos, entry);
+    else
+        siftDown(pos, entry);
+}
+
+void cDaryEventHeap::putBackFirst(cEvent *event)
+{
+    take(event);
+    doInsert(event);  // note: insertOrder is preserved
+}
+
+cEvent *cDaryEventHeap::get(int k)
+{
+    if (k < 0 || k >= heapLength)
+        return nullptr;
+    return heap[k].event;
+}
+
+void cDaryEventHeap::sort()
+{
+    // a sorted array is also a valid heap
+    std::sort(heap, heap + heapLength);
+    for (int i = 0; i < heapLength; i++)
+        positions[heap[i].handle] = i;
+}
+
+}  // namespace omnetpp
+
@@ -61,6 +61,28 @@ void cDatarateChannel::finish()
     }
 }
 
+void cDatarateChannel::packCheckpoint(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(txStartTime);
+    buffer->pack(txFinishTime);
+    buffer->pack(lastOrigPacketId);
+#endif
+}
+
+void cDatarateChannel::unpackCheckpoint(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(txStartTime);
+    buffer->unpack(txFinishTime);
+    buffer->unpack(lastOrigPacketId);
+#endif
+}
+
 cDatarateChannel *cDatarateChannel::create(const char *name)
 {
     return dynamic_cast<cDatarateChannel *>(cChannelType::getDatarateChannelType()->create(name));
@@ -36,20 +36,23 @@ namespace omnetpp {
 
 Register_Class(cDefaultOwner);
 
+thread_local bool cDefaultOwner::ownershipTracking = true;
+
 
 cDefaultOwner::cDefaultOwner(const char *name) : cNoncopyableOwnedObject(name)
 {
-    // careful: if we are a global variable (ctor called before main()),
-    // then insert() may get called before constructor and it invoked
-    // construct() already.
-    if (cStaticFlag::insideMain() || capacity == 0)
+    // careful: if we are a global variable (ctor called before main()) or
+    // the thread-local defaultList, then insert() may get called before
+    // constructor and it invoked construct() already.
+    bool isDefaultList = (this == &defaultList);
+    if ((cStaticFlag::insideMain() && !isDefaultList) || capacity == 0)
         construct();
 
     // if we're invoked before main, then we are a global variable (dynamic
     // instances of cDefaultOwner are not supposed to be created
     // before main()) --> remove ourselves from ownership tree because
     // we shouldn't be destroyed via operator delete
-    if (!cStaticFlag::insideMain())
+    if (!cStaticFlag::insideMain() || isDefaultList)
         removeFromOwnershipTree();
 }
 
@@ -60,6 +63,7 @@ void cDefaultOwner::construct()
     objs = new cOwnedObject *[capacity];
     for (int i = 0; i < capacity; i++)
         objs[i] = nullptr;
+    tracking = true;
 #ifdef SIMFRONTEND_SUPPORT
     lastChangeSerial = 0;
 #endif
@@ -97,6 +101,12 @@ void cDefaultOwner::doInsert(cOwnedObject *obj)
 {
     ASSERT(obj != this || this == &defaultList);
 
+    if (!tracking) {
+        obj->owner = this;
+        obj->pos = cOwnedObject::POS_UNTRACKED;
+        return;
+    }
+
     if (numObjs >= capacity) {
         if (capacity == 0) {
             // this is if we're invoked before main, before our ctor run
@@ -123,6 +133,9 @@ void cDefaultOwner::ownedObjectDeleted(cOwnedObject *obj)
 {
     ASSERT(obj && obj->owner == this);
 
+    if (obj->pos == cOwnedObject::POS_UNTRACKED)
+        return;
+
     // move last object to obj's old position
     int pos = obj->pos;
     (objs[pos] = objs[--numObjs])->pos = pos;
@@ -133,11 +146,16 @@ void cDefaultOwner::ownedObjectDeleted(cOwnedObject *obj)
 
 void cDefaultOwner::yieldOwnership(cOwnedObject *obj, cObject *newowner)
 {
-    ASSERT(obj && obj->owner == this && numObjs > 0);
+    ASSERT(obj && obj->owner == this && (numObjs > 0 || obj->pos == cOwnedObject::POS_UNTRACKED));
 
     // give object to its new owner
     obj->owner = newowner;
 
+    if (obj->pos == cOwnedObject::POS_UNTRACKED) {
+        obj->pos = 0;
+        return;
+    }
+
     // move last object to obj's old position
     int pos = obj->pos;
     (objs[pos] = objs[--numObjs])->pos = pos;
@@ -185,7 +203,7 @@ void cDefaultOwner::parsimUnpack(cCommBuffer *buffer)
 void cDefaultOwner::take(cOwnedObject *obj)
 {
     // ask current owner to release it -- if it's a cDefaultOwner, it will.
-    obj->owner->yieldOwnership(obj, this);
+    obj->releaseFromOwner(this);
     doInsert(obj);
 }
 
@@ -194,7 +212,8 @@ void cDefaultOwner::drop(cOwnedObject *obj)
     if (obj->owner != this)
         throw cRuntimeError(this, "drop(): Not owner of object (%s)%s",
                 obj->getClassName(), obj->getFullPath().c_str());
-    // the following 2 lines are actually the same as defaultOwner->take(obj);
+    // the following 2 lines are actually the same as getDefaultOwner()->take(obj);
+    cDefaultOwner *defaultOwner = getDefaultOwner();
     yieldOwnership(obj, defaultOwner);
     defaultOwner->doInsert(obj);
 }
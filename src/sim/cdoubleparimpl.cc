@@ -89,6 +89,7 @@ void cDoubleParImpl::setExpression(cExpression *e)
 {
     deleteOld();
     expr = e;
+    compileIfVolatile(expr);
     flags |= FL_ISEXPR | FL_CONTAINSVALUE | FL_ISSET;
 }
 
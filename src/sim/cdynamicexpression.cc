@@ -15,6 +15,7 @@
   `license' for details on this and other legal matters.
 *--------------------------------------------------------------*/
 
+#include <memory>
 #include "common/expression.h"
 #include "common/exception.h"
 #include "common/unitconversion.h"
@@ -122,13 +123,11 @@ class DynFunctionCallNode : public FunctionNode
 {
   protected:
     cDynamicExpression::IResolver *resolver = nullptr;
-    mutable cValue *buf = nullptr;
   protected:
     virtual ExprValue compute(Context *context, ExprValue argv[], int argc) const override
-        {makeNedValues(buf, argv, argc); return makeExprValue(resolver->callFunction(ctx(context), getName().c_str(), buf, argc));}
+        {std::unique_ptr<cValue[]> buf(makeNedValues(argv, argc)); return makeExprValue(resolver->callFunction(ctx(context), getName().c_str(), buf.get(), argc));}
   public:
     DynFunctionCallNode(const char *name, cDynamicExpression::IResolver *resolver) : FunctionNode(name), resolver(resolver) {}
-    virtual ~DynFunctionCallNode() {delete [] buf;}
     virtual DynFunctionCallNode *dup() const override {return new DynFunctionCallNode(getName().c_str(), resolver);}
 };
 
@@ -136,13 +135,11 @@ class DynMethodCallNode : public MethodNode
 {
   protected:
     cDynamicExpression::IResolver *resolver = nullptr;
-    mutable cValue *buf = nullptr;
   protected:
     virtual ExprValue compute(Context *context, ExprValue& object, ExprValue argv[], int argc) const override
-        {makeNedValues(buf, argv, argc); return makeExprValue(resolver->callMethod(ctx(context), makeNedValue(object), getName().c_str(), buf, argc));}
+        {std::unique_ptr<cValue[]> buf(makeNedValues(argv, argc)); return makeExprValue(resolver->callMethod(ctx(context), makeNedValue(object), getName().c_str(), buf.get(), argc));}
   public:
     DynMethodCallNode(const char *name, cDynamicExpression::IResolver *resolver) : MethodNode(name), resolver(resolver) {}
-    virtual ~DynMethodCallNode() {delete [] buf;}
     virtual DynMethodCallNode *dup() const override {return new DynMethodCallNode(getName().c_str(), resolver);}
 };
 
@@ -218,6 +215,11 @@ void cDynamicExpression::parseNedExpr(const char *text, bool inSubcomponentScope
     expression->parse(text, &translator);
 }
 
+void cDynamicExpression::compile()
+{
+    expression->compile();
+}
+
 std::string cDynamicExpression::str() const
 {
     return expression->str();
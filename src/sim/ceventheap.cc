@@ -340,6 +340,29 @@ cEvent *cEventHeap::remove(cEvent *event)
     return event;
 }
 
+void cEventHeap::reschedule(cEvent *event, simtime_t t)
+{
+    // events in the circular buffer (or not in the FES at all) are handled
+    // by remove+insert; so are events rescheduled to the current time,
+    // because insert() may need to put them into the circular buffer
+    if (event->heapIndex < 0 || (useCb && t == simTime())) {
+        cFutureEventSet::reschedule(event, t);
+        return;
+    }
+
+    event->setArrivalTime(t);
+    event->insertOrder = insertCount++;
+
+    // move event up or down from its current position
+    int father, out = event->heapIndex;
+    while ((father = out>>1) != 0 && *heap[father] > *event) {
+        (heap[out] = heap[father])->heapIndex = out;  // father is moved down
+        out = father;
+    }
+    (heap[out] = event)->heapIndex = out;
+    shiftup(out);
+}
+
 void cEventHeap::putBackFirst(cEvent *event)
 {
     take(event);
@@ -30,6 +30,7 @@
 #include "omnetpp/cconfiguration.h"
 #include "omnetpp/cconfigoption.h"
 #include "omnetpp/regmacros.h"
+#include "omnetpp/checkandcast.h"
 #include "common/stringutil.h"
 
 #ifdef WITH_PARSIM
@@ -81,6 +82,26 @@ bool cOmnetpp4xFingerprintCalculator::checkFingerprint() const
     return false;
 }
 
+void cOmnetpp4xFingerprintCalculator::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(hasher->getHash());
+#endif
+}
+
+void cOmnetpp4xFingerprintCalculator::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    uint32_t hash;
+    buffer->unpack(hash);
+    hasher->setHash(hash);
+#endif
+}
+
 #else // if !USE_OMNETPP4x_FINGERPRINTS
 
 Register_Class(cSingleFingerprintCalculator);
@@ -216,105 +237,164 @@ void cSingleFingerprintCalculator::parseResultMatcher(const char *s)
     }
 }
 
+bool cSingleFingerprintCalculator::matchesEvent(cEvent *event) const
+{
+    const MatchableObject matchableEvent(event);
+    if (eventMatcher != nullptr && !eventMatcher->matches(&matchableEvent))
+        return false;
+    cModule *module = event->isMessage() ? static_cast<cMessage *>(event)->getArrivalModule() : nullptr;
+    MatchableObject matchableModule(module);
+    return module == nullptr || moduleMatcher == nullptr || moduleMatcher->matches(&matchableModule);
+}
+
 void cSingleFingerprintCalculator::addEvent(cEvent *event)
 {
-    if (addEvents) {
-        const MatchableObject matchableEvent(event);
-        if (eventMatcher == nullptr || eventMatcher->matches(&matchableEvent)) {
-            cMessage *message = nullptr;
-            cPacket *packet = nullptr;
-            cObject *controlInfo = nullptr;
-            cModule *module = nullptr;
-            if (event->isMessage()) {
-                message = static_cast<cMessage *>(event);
-                if (message->isPacket())
-                    packet = static_cast<cPacket *>(message);
-                controlInfo = message->getControlInfo();
-                module = message->getArrivalModule();
-            }
+    if (addEvents && matchesEvent(event))
+        for (char & ch : ingredients)
+            addIngredient(event, (FingerprintIngredient) ch);
+}
+
+void cSingleFingerprintCalculator::addIngredient(cEvent *event, FingerprintIngredient ingredient)
+{
+    // note: event is nullptr for the ingredients added by addCapturedEvent()
+    if (event != nullptr && addEventIngredient(event, ingredient))
+        return;
+
+    cMessage *message = nullptr;
+    cPacket *packet = nullptr;
+    cObject *controlInfo = nullptr;
+    cModule *module = nullptr;
+    if (event != nullptr && event->isMessage()) {
+        message = static_cast<cMessage *>(event);
+        if (message->isPacket())
+            packet = static_cast<cPacket *>(message);
+        controlInfo = message->getControlInfo();
+        module = message->getArrivalModule();
+    }
 
-            MatchableObject matchableModule(module);
-            if (module == nullptr || moduleMatcher == nullptr || moduleMatcher->matches(&matchableModule)) {
-                for (char & ch : ingredients) {
-                    FingerprintIngredient ingredient = (FingerprintIngredient) ch;
-                    if (!addEventIngredient(event, ingredient)) {
-                        switch (ingredient) {
-                            case EVENT_NUMBER:
-                                hasher->add(getSimulation()->getEventNumber()); break;
-                            case SIMULATION_TIME:
-                                hasher->add(simTime().raw()); break;
-                            case MESSAGE_FULL_NAME:
-                                hasher->add(event->getFullName()); break;
-                            case MESSAGE_CLASS_NAME:
-                                hasher->add(event->getClassName()); break;
-                            case MESSAGE_KIND:
-                                if (message != nullptr)
-                                    hasher->add(message->getKind());
-                                break;
-                            case MESSAGE_BIT_LENGTH:
-                                if (packet != nullptr)
-                                    hasher->add(packet->getBitLength());
-                                break;
-                            case MESSAGE_CONTROL_INFO_CLASS_NAME:
-                                if (controlInfo != nullptr)
-                                    hasher->add(controlInfo->getClassName());
-                                break;
-                            case MESSAGE_DATA:
-                                if (message != nullptr) {
-                                    // NOTE: workaround for control info and context pointer which cannot be packed
-                                    // TODO: we should rather use a network byte order serialization API
+    switch (ingredient) {
+        case EVENT_NUMBER:
+            hasher->add(getSimulation()->getEventNumber()); break;
+        case SIMULATION_TIME:
+            hasher->add(simTime().raw()); break;
+        case MESSAGE_FULL_NAME:
+            hasher->add(event->getFullName()); break;
+        case MESSAGE_CLASS_NAME:
+            hasher->add(event->getClassName()); break;
+        case MESSAGE_KIND:
+            if (message != nullptr)
+                hasher->add(message->getKind());
+            break;
+        case MESSAGE_BIT_LENGTH:
+            if (packet != nullptr)
+                hasher->add(packet->getBitLength());
+            break;
+        case MESSAGE_CONTROL_INFO_CLASS_NAME:
+            if (controlInfo != nullptr)
+                hasher->add(controlInfo->getClassName());
+            break;
+        case MESSAGE_DATA:
+            if (message != nullptr) {
+                // NOTE: workaround for control info and context pointer which cannot be packed
+                // TODO: we should rather use a network byte order serialization API
 #ifdef WITH_PARSIM
-                                    cMemCommBuffer buffer;
-                                    cMessage *copy = message->dup();
-                                    copy->parsimPack(&buffer);
-                                    hasher->add(buffer.getBuffer(), buffer.getMessageSize());
-                                    delete copy;
+                cMemCommBuffer buffer;
+                cMessage *copy = message->dup();
+                copy->parsimPack(&buffer);
+                hasher->add(buffer.getBuffer(), buffer.getMessageSize());
+                delete copy;
 #else
-                                    throw cRuntimeError("Fingerprint is configured to contain MESSAGE_DATA (d),"
-                                                        " but parallel simulation support is disabled (WITH_PARSIM=no)"
-                                                        " which is required for serialization.");
+                throw cRuntimeError("Fingerprint is configured to contain MESSAGE_DATA (d),"
+                                    " but parallel simulation support is disabled (WITH_PARSIM=no)"
+                                    " which is required for serialization.");
 #endif
-                                }
-                                break;
-                            case MODULE_ID:
-                                if (module != nullptr)
-                                    hasher->add(module->getId());
-                                break;
-                            case MODULE_FULL_NAME:
-                                if (module != nullptr)
-                                    hasher->add(module->getFullName());
-                                break;
-                            case MODULE_FULL_PATH:
-                                if (module != nullptr)
-                                    hasher->add(module->getFullPath().c_str());
-                                break;
-                            case MODULE_CLASS_NAME:
-                                if (module != nullptr)
-                                    hasher->add(module->getComponentType()->getClassName());
-                                break;
-                            case RANDOM_NUMBERS_DRAWN:
-                                for (int i = 0; i < getEnvir()->getNumRNGs(); i++)
-                                    hasher->add(getEnvir()->getRNG(i)->getNumbersDrawn());
-                                break;
-                            case CLEAN_HASHER:
-                                hasher->reset();
-                                break;
-                            case RESULT_SCALAR:
-                            case RESULT_STATISTIC:
-                            case RESULT_VECTOR:
-                            case DISPLAY_STRINGS:
-                            case CANVAS_FIGURES:
-                            case EXTRA_DATA:
-                                // not processed here
-                                break;
-                            default:
-                                throw cRuntimeError("Unknown fingerprint ingredient '%c' (%d)", ingredient, ingredient);
-                        }
-                    }
-                }
+            }
+            break;
+        case MODULE_ID:
+            if (module != nullptr)
+                hasher->add(module->getId());
+            break;
+        case MODULE_FULL_NAME:
+            if (module != nullptr)
+                hasher->add(module->getFullName());
+            break;
+        case MODULE_FULL_PATH:
+            if (module != nullptr)
+                hasher->add(module->getFullPath().c_str());
+            break;
+        case MODULE_CLASS_NAME:
+            if (module != nullptr)
+                hasher->add(module->getComponentType()->getClassName());
+            break;
+        case RANDOM_NUMBERS_DRAWN:
+            for (int i = 0; i < getEnvir()->getNumRNGs(); i++)
+                hasher->add(getEnvir()->getRNG(i)->getNumbersDrawn());
+            break;
+        case CLEAN_HASHER:
+            hasher->reset();
+            break;
+        case RESULT_SCALAR:
+        case RESULT_STATISTIC:
+        case RESULT_VECTOR:
+        case DISPLAY_STRINGS:
+        case CANVAS_FIGURES:
+        case EXTRA_DATA:
+            // not processed here
+            break;
+        default:
+            throw cRuntimeError("Unknown fingerprint ingredient '%c' (%d)", ingredient, ingredient);
+    }
+}
+
+bool cSingleFingerprintCalculator::dependsOnSimulationState(FingerprintIngredient ingredient)
+{
+    return ingredient == EVENT_NUMBER || ingredient == RANDOM_NUMBERS_DRAWN || ingredient == CLEAN_HASHER;
+}
+
+bool cSingleFingerprintCalculator::canCaptureEvents() const
+{
+    // message data is serialized from a copy of the message, whose message id
+    // must be allocated in the original order
+    return ingredients.find(MESSAGE_DATA) == std::string::npos;
+}
+
+cObject *cSingleFingerprintCalculator::captureEvent(cEvent *event)
+{
+    if (!addEvents || !matchesEvent(event))
+        return nullptr;
+
+    // hash the ingredients into separate hashers, skipping those that must be added later
+    CapturedEvent *capture = new CapturedEvent();
+    cHasher *savedHasher = hasher;
+    try {
+        capture->segments.push_back(hasher = new cHasher());
+        for (char & ch : ingredients) {
+            FingerprintIngredient ingredient = (FingerprintIngredient) ch;
+            if (!dependsOnSimulationState(ingredient))
+                addIngredient(event, ingredient);
+            else {
+                capture->laterIngredients += ch;
+                capture->segments.push_back(hasher = new cHasher());
             }
         }
     }
+    catch (std::exception&) {
+        hasher = savedHasher;
+        delete capture;
+        throw;
+    }
+    hasher = savedHasher;
+    return capture;
+}
+
+void cSingleFingerprintCalculator::addCapturedEvent(cObject *object)
+{
+    CapturedEvent *capture = check_and_cast<CapturedEvent *>(object);
+    for (size_t i = 0; i < capture->segments.size(); i++) {
+        hasher->append(*capture->segments[i]);
+        if (i < capture->laterIngredients.size())
+            addIngredient(nullptr, (FingerprintIngredient) capture->laterIngredients[i]);
+    }
 }
 
 bool cSingleFingerprintCalculator::addEventIngredient(cEvent *event, FingerprintIngredient ingredient)
@@ -415,6 +495,26 @@ bool cSingleFingerprintCalculator::checkFingerprint() const
     return false;
 }
 
+void cSingleFingerprintCalculator::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(hasher->getHash());
+#endif
+}
+
+void cSingleFingerprintCalculator::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    uint32_t hash;
+    buffer->unpack(hash);
+    hasher->setHash(hash);
+#endif
+}
+
 //----
 
 cMultiFingerprintCalculator::cMultiFingerprintCalculator(cFingerprintCalculator *prototype) :
@@ -480,6 +580,61 @@ bool cMultiFingerprintCalculator::checkFingerprint() const
     return true;
 }
 
+bool cMultiFingerprintCalculator::canCaptureEvents() const
+{
+    for (auto element: elements)
+        if (!element->canCaptureEvents())
+            return false;
+    return true;
+}
+
+cObject *cMultiFingerprintCalculator::captureEvent(cEvent *event)
+{
+    CapturedEvent *capture = new CapturedEvent();
+    try {
+        for (auto& element: elements)
+            capture->elementCaptures.push_back(element->captureEvent(event));
+    }
+    catch (std::exception&) {
+        delete capture;
+        throw;
+    }
+    return capture;
+}
+
+void cMultiFingerprintCalculator::addCapturedEvent(cObject *object)
+{
+    CapturedEvent *capture = check_and_cast<CapturedEvent *>(object);
+    for (size_t i = 0; i < elements.size(); i++)
+        if (capture->elementCaptures[i])
+            elements[i]->addCapturedEvent(capture->elementCaptures[i]);
+}
+
+void cMultiFingerprintCalculator::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack((int)elements.size());
+    for (auto element: elements)
+        element->parsimPack(buffer);
+#endif
+}
+
+void cMultiFingerprintCalculator::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    int n;
+    buffer->unpack(n);
+    if (n != (int)elements.size())
+        throw cRuntimeError("cMultiFingerprintCalculator: Number of fingerprints does not match the saved state");
+    for (auto element: elements)
+        element->parsimUnpack(buffer);
+#endif
+}
+
 std::string cMultiFingerprintCalculator::str() const
 {
     std::stringstream stream;
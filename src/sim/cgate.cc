@@ -69,8 +69,6 @@ using std::ostream;
 // non-refcounting pool for gate fullnames
 static StringPool gateFullnamePool;
 
-int cGate::lastConnectionId = -1;
-
 cGate::Name::Name(const char *name, Type type)
 {
     this->name = name;
@@ -300,7 +298,7 @@ cChannel *cGate::connectTo(cGate *g, cChannel *chan, bool leaveUninitialized)
     // build new connection
     nextGate = g;
     nextGate->prevGate = this;
-    connectionId = ++lastConnectionId;
+    connectionId = ++getSimulation()->lastConnectionId;
     if (chan)
         installChannel(chan);
 
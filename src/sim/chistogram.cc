@@ -136,12 +136,12 @@ void cHistogram::parsimUnpack(cCommBuffer *buffer)
     size_t n;
     buffer->unpack(n);
     binEdges.resize(n);
-    for (size_t i = 0; i < n; n++)
+    for (size_t i = 0; i < n; i++)
         buffer->unpack(binEdges[i]);
 
     buffer->unpack(n);
     binValues.resize(n);
-    for (size_t i = 0; i < n; n++)
+    for (size_t i = 0; i < n; i++)
         buffer->unpack(binValues[i]);
 
     buffer->unpack(finiteUnderflowSumWeights);
@@ -149,8 +149,13 @@ void cHistogram::parsimUnpack(cCommBuffer *buffer)
     buffer->unpack(negInfSumWeights);
     buffer->unpack(posInfSumWeights);
 
-    if (buffer->checkFlag())
-        setStrategy((cIHistogramStrategy *)buffer->unpackObject());
+    // note: cannot use setStrategy() here, as it refuses non-empty histograms
+    delete strategy;
+    strategy = nullptr;
+    if (buffer->checkFlag()) {
+        strategy = (cIHistogramStrategy *)buffer->unpackObject();
+        strategy->hist = this;
+    }
 #endif
 }
 
@@ -19,6 +19,10 @@
 #include "omnetpp/globals.h"
 #include "omnetpp/chistogramstrategy.h"
 
+#ifdef WITH_PARSIM
+#include "omnetpp/ccommbuffer.h"
+#endif
+
 namespace omnetpp {
 
 Register_Class(cFixedRangeHistogramStrategy);
@@ -49,6 +53,32 @@ cFixedRangeHistogramStrategy& cFixedRangeHistogramStrategy::operator=(const cFix
     return *this;
 }
 
+void cFixedRangeHistogramStrategy::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(lo);
+    buffer->pack(hi);
+    buffer->pack(numBins);
+    buffer->pack((int)mode);
+#endif
+}
+
+void cFixedRangeHistogramStrategy::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(lo);
+    buffer->unpack(hi);
+    buffer->unpack(numBins);
+    int tmp;
+    buffer->unpack(tmp);
+    mode = (Mode)tmp;
+#endif
+}
+
 void cFixedRangeHistogramStrategy::setUpBins()
 {
     // validate parameters
@@ -111,6 +141,53 @@ cPrecollectionBasedHistogramStrategy& cPrecollectionBasedHistogramStrategy::oper
     return *this;
 }
 
+void cPrecollectionBasedHistogramStrategy::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(inPrecollection);
+    buffer->pack(numToPrecollect);
+    buffer->pack(numToCollate);
+    buffer->pack(lastRange);
+    buffer->pack(rangeUnchangedCounter);
+    buffer->pack(rangeUnchangedThreshold);
+    buffer->pack(finiteMinValue);
+    buffer->pack(finiteMaxValue);
+
+    buffer->pack(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        buffer->pack(values[i]);
+        buffer->pack(weights[i]);
+    }
+#endif
+}
+
+void cPrecollectionBasedHistogramStrategy::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(inPrecollection);
+    buffer->unpack(numToPrecollect);
+    buffer->unpack(numToCollate);
+    buffer->unpack(lastRange);
+    buffer->unpack(rangeUnchangedCounter);
+    buffer->unpack(rangeUnchangedThreshold);
+    buffer->unpack(finiteMinValue);
+    buffer->unpack(finiteMaxValue);
+
+    size_t n;
+    buffer->unpack(n);
+    values.resize(n);
+    weights.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        buffer->unpack(values[i]);
+        buffer->unpack(weights[i]);
+    }
+#endif
+}
+
 bool cPrecollectionBasedHistogramStrategy::precollect(double value, double weight)
 {
     // precollect value
@@ -192,6 +269,44 @@ cDefaultHistogramStrategy& cDefaultHistogramStrategy::operator=(const cDefaultHi
     return *this;
 }
 
+void cDefaultHistogramStrategy::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    cPrecollectionBasedHistogramStrategy::parsimPack(buffer);
+
+    buffer->pack(rangeExtensionFactor);
+    buffer->pack(binSize);
+    buffer->pack(numBinsHint);
+    buffer->pack(targetNumBins);
+    buffer->pack(autoExtend);
+    buffer->pack(binMerging);
+    buffer->pack(maxNumBins);
+    buffer->pack((int)mode);
+#endif
+}
+
+void cDefaultHistogramStrategy::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    cPrecollectionBasedHistogramStrategy::parsimUnpack(buffer);
+
+    buffer->unpack(rangeExtensionFactor);
+    buffer->unpack(binSize);
+    buffer->unpack(numBinsHint);
+    buffer->unpack(targetNumBins);
+    buffer->unpack(autoExtend);
+    buffer->unpack(binMerging);
+    buffer->unpack(maxNumBins);
+    int tmp;
+    buffer->unpack(tmp);
+    mode = (Mode)tmp;
+#endif
+}
+
 void cDefaultHistogramStrategy::collect(double value)
 {
     collectWeighted(value, 1);
@@ -470,6 +585,52 @@ cAutoRangeHistogramStrategy& cAutoRangeHistogramStrategy::operator=(const cAutoR
     return *this;
 }
 
+void cAutoRangeHistogramStrategy::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    cPrecollectionBasedHistogramStrategy::parsimPack(buffer);
+
+    buffer->pack(lo);
+    buffer->pack(hi);
+    buffer->pack(rangeExtensionFactor);
+    buffer->pack(numBinsHint);
+    buffer->pack(targetNumBins);
+    buffer->pack(requestedBinSize);
+    buffer->pack(binSize);
+    buffer->pack(binSizeRounding);
+    buffer->pack(autoExtend);
+    buffer->pack(binMerging);
+    buffer->pack(maxNumBins);
+    buffer->pack((int)mode);
+#endif
+}
+
+void cAutoRangeHistogramStrategy::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    cPrecollectionBasedHistogramStrategy::parsimUnpack(buffer);
+
+    buffer->unpack(lo);
+    buffer->unpack(hi);
+    buffer->unpack(rangeExtensionFactor);
+    buffer->unpack(numBinsHint);
+    buffer->unpack(targetNumBins);
+    buffer->unpack(requestedBinSize);
+    buffer->unpack(binSize);
+    buffer->unpack(binSizeRounding);
+    buffer->unpack(autoExtend);
+    buffer->unpack(binMerging);
+    buffer->unpack(maxNumBins);
+    int tmp;
+    buffer->unpack(tmp);
+    mode = (Mode)tmp;
+#endif
+}
+
 void cAutoRangeHistogramStrategy::collect(double value)
 {
     collectWeighted(value, 1.0);
@@ -87,6 +87,7 @@ void cIntParImpl::setExpression(cExpression *e)
 {
     deleteOld();
     expr = e;
+    compileIfVolatile(expr);
     flags |= FL_ISEXPR | FL_CONTAINSVALUE | FL_ISSET;
 }
 
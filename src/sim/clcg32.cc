@@ -24,6 +24,10 @@
 #include "omnetpp/cexception.h"
 #include "omnetpp/cconfigoption.h"
 
+#ifdef WITH_PARSIM
+#include "omnetpp/ccommbuffer.h"
+#endif
+
 namespace omnetpp {
 
 Register_Class(cLCG32);
@@ -173,5 +177,25 @@ long cLCG32::autoSeeds[] = {
     1358844649L, 1115145546L, 1398997376L, 1021484058L, 2035865982L,
 };
 
+void cLCG32::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(numDrawn);
+    buffer->pack(seed);
+#endif
+}
+
+void cLCG32::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(numDrawn);
+    buffer->unpack(seed);
+#endif
+}
+
 }  // namespace omnetpp
 
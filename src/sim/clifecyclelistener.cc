@@ -40,6 +40,8 @@ const char *cISimulationLifecycleListener::getSimulationLifecycleEventName(Simul
         CASE(ON_SIMULATION_RESUME);
         CASE(ON_SIMULATION_SUCCESS);
         CASE(ON_SIMULATION_ERROR);
+        CASE(PRE_STATE_SAVE);
+        CASE(POST_STATE_RESTORE);
         CASE(PRE_NETWORK_FINISH);
         CASE(POST_NETWORK_FINISH);
         CASE(ON_RUN_END);
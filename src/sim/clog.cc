@@ -23,16 +23,16 @@
 
 namespace omnetpp {
 
-LogLevel cLog::logLevel = LOGLEVEL_TRACE;
-cLog::NoncomponentLogPredicate cLog::noncomponentLogPredicate = &cLog::defaultNoncomponentLogPredicate;
-cLog::ComponentLogPredicate cLog::componentLogPredicate = &cLog::defaultComponentLogPredicate;
-
-cLogProxy::LogBuffer cLogProxy::buffer;
-std::ostream cLogProxy::stream(&cLogProxy::buffer);
-cLogEntry cLogProxy::currentEntry;
-LogLevel cLogProxy::previousLogLevel = (LogLevel)-1;
-const char *cLogProxy::previousCategory = nullptr;
-cLogProxy::nullstream cLogProxy::dummyStream;
+thread_local LogLevel cLog::logLevel = LOGLEVEL_TRACE;
+thread_local cLog::NoncomponentLogPredicate cLog::noncomponentLogPredicate = &cLog::defaultNoncomponentLogPredicate;
+thread_local cLog::ComponentLogPredicate cLog::componentLogPredicate = &cLog::defaultComponentLogPredicate;
+
+thread_local cLogProxy::LogBuffer cLogProxy::buffer;
+thread_local std::ostream cLogProxy::stream(&cLogProxy::buffer);
+thread_local cLogEntry cLogProxy::currentEntry;
+thread_local LogLevel cLogProxy::previousLogLevel = (LogLevel)-1;
+thread_local const char *cLogProxy::previousCategory = nullptr;
+thread_local cLogProxy::nullstream cLogProxy::dummyStream;
 
 //----
 
@@ -24,6 +24,10 @@
 #include "omnetpp/cmessage.h"
 #include "omnetpp/cconfigoption.h"
 
+#ifdef WITH_PARSIM
+#include "omnetpp/ccommbuffer.h"
+#endif
+
 namespace omnetpp {
 
 Register_Class(cMersenneTwister);
@@ -112,5 +116,29 @@ double cMersenneTwister::doubleRandIncl1()
     return rng.rand();
 }
 
+void cMersenneTwister::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(numDrawn);
+    MTRand::uint32 state[MTRand::SAVE];
+    rng.save(state);
+    buffer->pack(state, MTRand::SAVE);
+#endif
+}
+
+void cMersenneTwister::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(numDrawn);
+    MTRand::uint32 state[MTRand::SAVE];
+    buffer->unpack(state, MTRand::SAVE);
+    rng.load(state);
+#endif
+}
+
 }  // namespace omnetpp
 
@@ -22,6 +22,7 @@
 #include "omnetpp/cmessage.h"
 #include "omnetpp/cexception.h"
 #include "omnetpp/cenvir.h"
+#include "paralleleventexecutor.h"
 
 #ifdef WITH_PARSIM
 #include "omnetpp/ccommbuffer.h"
@@ -33,11 +34,6 @@ using std::ostream;
 
 Register_Class(cMessage);
 
-// static members of cMessage
-long cMessage::nextMessageId = 0;
-long cMessage::totalMsgCount = 0;
-long cMessage::liveMsgCount = 0;
-
 cMessage::cMessage(const cMessage& msg) : cEvent(msg)
 {
     parList = nullptr;
@@ -45,9 +41,15 @@ cMessage::cMessage(const cMessage& msg) : cEvent(msg)
     heapIndex = -1;
     copy(msg);
 
-    messageId = nextMessageId++;
-    totalMsgCount++;
-    liveMsgCount++;
+    cSimulation *sim = getSimulation();
+    if (sim->isParallelEventBatchActive()) {
+        ParallelEventExecutor::deferMessageCreation(this, const_cast<cMessage *>(&msg));  // the id is assigned after the batch
+        return;
+    }
+
+    messageId = sim->nextMessageId++;
+    sim->totalMessageCount++;
+    sim->liveMessageCount++;
 
     cMessage *nonConstMsg = const_cast<cMessage *>(&msg);
     EVCB.messageCloned(nonConstMsg, this);
@@ -67,12 +69,19 @@ cMessage::cMessage(const char *name, short k) : cEvent(name)
 
     senderModuleId = senderGateId = -1;
     targetModuleId = targetGateId = -1;
-    creationTime = getSimulation()->getSimTime();
+    cSimulation *sim = getSimulation();
+    creationTime = sim->getSimTime();
     sendTime = timestamp = 0;
 
-    messageTreeId = messageId = nextMessageId++;
-    totalMsgCount++;
-    liveMsgCount++;
+    if (sim->isParallelEventBatchActive()) {
+        previousEventNumber = -1;
+        ParallelEventExecutor::deferMessageCreation(this, nullptr);  // the id is assigned after the batch
+        return;
+    }
+
+    messageTreeId = messageId = sim->nextMessageId++;
+    sim->totalMessageCount++;
+    sim->liveMessageCount++;
 
     previousEventNumber = -1;
     EVCB.messageCreated(this);
@@ -83,7 +92,13 @@ cMessage::cMessage(const char *name, short k) : cEvent(name)
 
 cMessage::~cMessage()
 {
-    EVCB.messageDeleted(this);
+    // note: there may be no active simulation when messages are deleted during shutdown
+    cSimulation *sim = getSimulation();
+    bool parallel = sim != nullptr && sim->isParallelEventBatchActive();
+    if (parallel)
+        ParallelEventExecutor::messageDeleted(this);  // also updates the message counters after the batch
+    else
+        EVCB.messageDeleted(this);
 
     if (parList)
         dropAndDelete(parList);
@@ -95,8 +110,8 @@ cMessage::~cMessage()
             delete controlInfo;
     }
 
-    if ((flags & FL_ISPRIVATECOPY) == 0)
-        liveMsgCount--;
+    if ((flags & FL_ISPRIVATECOPY) == 0 && sim != nullptr && !parallel)
+        sim->liveMessageCount--;
 }
 
 #define MODNAME(modp)    ((modp) ? (modp)->getFullPath().c_str() : "<deleted module>")
@@ -245,12 +260,37 @@ cMessage *cMessage::privateDup() const
     ret->messageId = messageId;
     ret->flags |= FL_ISPRIVATECOPY;
     ret->removeFromOwnershipTree();
-    nextMessageId--;
-    totalMsgCount--;
-    liveMsgCount--;
+    cSimulation *sim = getSimulation();
+    sim->nextMessageId--;
+    sim->totalMessageCount--;
+    sim->liveMessageCount--;
     return ret;
 }
 
+void cMessage::leaveSimulation()
+{
+    getSimulation()->liveMessageCount--;
+    liveObjectCount--;
+}
+
+void cMessage::enterSimulation()
+{
+    // same as when the message is created, see the constructor
+    if (getOwner() == nullptr)
+        getDefaultOwner()->doInsert(this);
+    totalObjectCount++;
+    liveObjectCount++;
+
+    cSimulation *sim = getSimulation();
+    messageTreeId = messageId = sim->nextMessageId++;
+    sim->totalMessageCount++;
+    sim->liveMessageCount++;
+
+    previousEventNumber = -1;
+    EVCB.messageCreated(this);
+    previousEventNumber = sim->getEventNumber();
+}
+
 void cMessage::setControlInfo(cObject *p)
 {
     if (!p)
@@ -0,0 +1,65 @@
+//=========================================================================
+//  CMESSAGEPOOL.CC - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//   Member functions of
+//    cMessagePool : recycling memory allocator for messages
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include <new>
+#include "omnetpp/cmessagepool.h"
+
+namespace omnetpp {
+
+thread_local cMessagePool::FreeBlock *cMessagePool::freeLists[NUM_SIZE_CLASSES];
+thread_local long cMessagePool::numBlocksInUse = 0;
+thread_local long cMessagePool::numFreeBlocks = 0;
+thread_local long cMessagePool::numReused = 0;
+
+namespace {
+struct ThreadCleanup {
+    ~ThreadCleanup() {cMessagePool::clear();}
+};
+}  // namespace
+
+void cMessagePool::ensureThreadCleanup()
+{
+    // empties the free lists of this thread when it exits
+    static thread_local ThreadCleanup cleanup;
+    (void)cleanup;
+}
+
+void *cMessagePool::allocateNew(size_t size)
+{
+    // blocks are allocated with the rounded-up size, so that they can be
+    // reused for any object in the same size class
+    size_t k = sizeClassOf(size);
+    void *p = ::operator new(k < NUM_SIZE_CLASSES ? (k+1) * GRANULARITY : size);
+    numBlocksInUse++;
+    return p;
+}
+
+void cMessagePool::clear()
+{
+    for (int k = 0; k < NUM_SIZE_CLASSES; k++) {
+        while (freeLists[k] != nullptr) {
+            FreeBlock *block = freeLists[k];
+            freeLists[k] = block->next;
+            ::operator delete(block);
+        }
+    }
+    numFreeBlocks = 0;
+}
+
+}  // namespace omnetpp
+
@@ -19,6 +19,8 @@
 #include <cstdio>  // sprintf
 #include <cstring>  // strcpy
 #include <algorithm>
+#include <mutex>
+#include <unordered_map>
 #include "common/stringutil.h"
 #include "omnetpp/cmodule.h"
 #include "omnetpp/csimplemodule.h"
@@ -38,6 +40,7 @@
 #include "omnetpp/cosgcanvas.h"
 #include "omnetpp/simutil.h"
 #include "omnetpp/cmodelchange.h"
+#include "paralleleventexecutor.h"
 
 using namespace omnetpp::common;
 
@@ -47,8 +50,47 @@ Register_Class(cModule);
 
 
 // static members:
-std::string cModule::lastModuleFullPath;
-const cModule *cModule::lastModuleFullPathModule = nullptr;
+
+// Submodules and gate descriptors are looked up by linear search as long as
+// there are only a few of them. For larger modules, a hash index is built on
+// the first lookup. The submodule index is then kept up to date as submodules
+// are inserted, removed and renamed; the gate desc index is simply discarded
+// when gates are added or deleted, as that normally only occurs during setup.
+#define SUBMODULE_INDEX_THRESHOLD  16
+#define GATEDESC_INDEX_THRESHOLD   8
+
+static inline size_t hashString(const char *s, size_t h = 0)
+{
+    if (s)
+        for ( ; *s; s++)
+            h = h * 31 + (unsigned char)*s;
+    return h;
+}
+
+struct cModule::SubmoduleIndex {
+    struct Key {
+        const char *name;  // points to the submodule's name
+        int index;         // -1 for non-vector submodules
+        bool operator==(const Key& other) const {return index == other.index && opp_strcmp(name, other.name) == 0;}
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const {return hashString(key.name, key.index);}
+    };
+    std::unordered_map<Key, cModule *, KeyHash> map;
+    bool hasDuplicates = false;  // if true, some submodules are not in the map because of a name+index clash; the first one in submodule order is
+
+    static Key keyOf(const cModule *submodule) {return Key{submodule->getName(), submodule->isVector() ? submodule->getIndex() : -1};}
+};
+
+struct cModule::GateDescIndex {
+    struct Hash {
+        size_t operator()(const char *s) const {return hashString(s);}
+    };
+    struct Equal {
+        bool operator()(const char *s1, const char *s2) const {return strcmp(s1, s2) == 0;}
+    };
+    std::unordered_map<const char *, int, Hash, Equal> map;  // gate name (also "name$i" and "name$o" for inout gates) -> index in gateDescArray; keys point into namePool
+};
 
 #ifdef NDEBUG
 bool cModule::cacheFullPath = false; // in release mode keep memory usage low
@@ -68,6 +110,8 @@ cModule::cModule()
 
     gateDescArraySize = 0;
     gateDescArray = nullptr;
+    submoduleIndex = nullptr;
+    gateDescIndex = nullptr;
 #ifdef USE_OMNETPP4x_FINGERPRINTS
     version4ModuleId = -1;
 #endif
@@ -120,6 +164,7 @@ cModule::~cModule()
 
     delete canvas;
     delete osgCanvas;
+    discardSubmoduleIndex();
 
     delete[] fullName;
     delete[] fullPath;
@@ -145,9 +190,14 @@ void cModule::forEachChild(cVisitor *v)
 void cModule::setNameAndIndex(const char *s, int i, int n)
 {
     // a two-in-one function, so that we don't end up calling updateFullPath() twice
+    cModule *parent = getParentModule();
+    if (parent && parent->submoduleIndex)
+        parent->removeFromSubmoduleIndex(this);
     cOwnedObject::setName(s);
     vectorIndex = i;
     vectorSize = n;
+    if (parent && parent->submoduleIndex)
+        parent->addToSubmoduleIndex(this);
     updateFullName();
 }
 
@@ -172,8 +222,15 @@ void cModule::insertSubmodule(cModule *mod)
         firstSubmodule = mod;
     lastSubmodule = mod;
 
+    if (submoduleIndex)
+        addToSubmoduleIndex(mod);
+
     // cached module getFullPath() possibly became invalid
-    lastModuleFullPathModule = nullptr;
+    if (cSimulation *sim = cSimulation::getActiveSimulation())
+        sim->lastModuleFullPathModule = nullptr;
+
+    // flattened signal listener lists of the subtree no longer reflect the ancestors
+    mod->invalidateSignalDispatchCachesRec();
 }
 
 void cModule::removeSubmodule(cModule *mod)
@@ -195,8 +252,15 @@ void cModule::removeSubmodule(cModule *mod)
     // this is not strictly needed but makes it cleaner
     mod->prevSibling = mod->nextSibling = nullptr;
 
+    if (submoduleIndex)
+        removeFromSubmoduleIndex(mod);
+
     // cached module getFullPath() possibly became invalid
-    lastModuleFullPathModule = nullptr;
+    if (cSimulation *sim = cSimulation::getActiveSimulation())
+        sim->lastModuleFullPathModule = nullptr;
+
+    // flattened signal listener lists of the subtree no longer reflect the ancestors
+    mod->invalidateSignalDispatchCachesRec();
 }
 
 void cModule::insertChannel(cChannel *channel)
@@ -236,7 +300,12 @@ cModule *cModule::getParentModule() const
 
 void cModule::setName(const char *s)
 {
+    cModule *parent = getParentModule();
+    if (parent && parent->submoduleIndex)
+        parent->removeFromSubmoduleIndex(this);
     cOwnedObject::setName(s);
+    if (parent && parent->submoduleIndex)
+        parent->addToSubmoduleIndex(this);
     updateFullName();
 }
 
@@ -252,8 +321,9 @@ void cModule::updateFullName()
         opp_appendindex(fullName, getIndex());
     }
 
-    if (lastModuleFullPathModule == this)
-        lastModuleFullPathModule = nullptr;  // invalidate
+    cSimulation *sim = cSimulation::getActiveSimulation();
+    if (sim && sim->lastModuleFullPathModule == this)
+        sim->lastModuleFullPathModule = nullptr;  // invalidate
 
     if (cacheFullPath)
         updateFullPathRec();
@@ -266,11 +336,12 @@ void cModule::updateFullName()
 void cModule::reassignModuleIdRec()
 {
     int oldId = getId();
-    getSimulation()->deregisterComponent(this);
-    getSimulation()->registerComponent(this);
+    cSimulation *simulation = getSimulation();  // note: deregisterComponent() clears it in the module
+    simulation->deregisterComponent(this);
+    simulation->registerComponent(this);
     int newId = getId();
 
-    cFutureEventSet *fes = getSimulation()->getFES();
+    cFutureEventSet *fes = simulation->getFES();
     int fesLen = fes->getLength();
     for (int i = 0; i < fesLen; i++) {
         cEvent *event = fes->get(i);
@@ -305,16 +376,21 @@ std::string cModule::getFullPath() const
     if (fullPath)
         return fullPath;
 
-    if (lastModuleFullPathModule != this) {
-        // stop at the toplevel module (don't go up to cSimulation);
-        // plus, cache the result, expecting more hits from this module
+    // stop at the toplevel module (don't go up to cSimulation); the cache
+    // cannot be used while the modules of a batch of events run in parallel
+    cSimulation *sim = getSimulation();
+    if (!sim || sim->isParallelEventBatchActive())
+        return getParentModule() == nullptr ? getFullName() : getParentModule()->getFullPath() + "." + getFullName();
+
+    // cache the result, expecting more hits from this module
+    if (sim->lastModuleFullPathModule != this) {
         if (getParentModule() == nullptr)
-            lastModuleFullPath = getFullName();
+            sim->lastModuleFullPath = getFullName();
         else
-            lastModuleFullPath = getParentModule()->getFullPath() + "." + getFullName();
-        lastModuleFullPathModule = this;
+            sim->lastModuleFullPath = getParentModule()->getFullPath() + "." + getFullName();
+        sim->lastModuleFullPathModule = this;
     }
-    return lastModuleFullPath;
+    return sim->lastModuleFullPath;
 }
 
 bool cModule::isSimple() const
@@ -340,6 +416,8 @@ cGate *cModule::createGateObject(cGate::Type)
 }
 
 cModule::NamePool cModule::namePool;
+static std::mutex namePoolMutex;
+static int namePoolUsers = 0;  // number of networks that exist; guarded by namePoolMutex
 
 void cModule::disposeGateObject(cGate *gate, bool checkConnected)
 {
@@ -382,6 +460,7 @@ void cModule::disposeGateDesc(cGate::Desc *desc, bool checkConnected)
     const char *gatename = desc->name->name.c_str();
     cGate::Type gatetype = desc->getType();
     desc->name = nullptr;  // mark as deleted, but leave shared Name struct in the pool
+    discardGateDescIndex();
 #ifdef SIMFRONTEND_SUPPORT
     updateLastChangeSerial();
 #endif
@@ -405,12 +484,22 @@ void cModule::clearGates()
     delete[] gateDescArray;
     gateDescArray = nullptr;
     gateDescArraySize = 0;
+    discardGateDescIndex();
+}
+
+void cModule::acquireNamePools()
+{
+    std::lock_guard<std::mutex> lock(namePoolMutex);
+    namePoolUsers++;
 }
 
-void cModule::clearNamePools()
+void cModule::releaseNamePools()
 {
-    namePool.clear();
-    cGate::clearFullnamePool();
+    std::lock_guard<std::mutex> lock(namePoolMutex);
+    if (--namePoolUsers == 0) {
+        namePool.clear();
+        cGate::clearFullnamePool();
+    }
 }
 
 void cModule::adjustGateDesc(cGate *gate, cGate::Desc *newvec)
@@ -458,12 +547,14 @@ cGate::Desc *cModule::addGateDesc(const char *gatename, cGate::Type type, bool i
     }
 
     // install the new array and get its last element
+    discardGateDescIndex();
     delete[] gateDescArray;
     gateDescArray = newv;
     cGate::Desc *newDesc = gateDescArray + gateDescArraySize++;
 
     // configure this gatedesc with name and type
     cGate::Name key(gatename, type);
+    std::lock_guard<std::mutex> lock(namePoolMutex);
     NamePool::iterator it = namePool.find(key);
     if (it == namePool.end())
         it = namePool.insert(key).first;
@@ -480,7 +571,15 @@ int cModule::findGateDesc(const char *gatename, char& suffix) const
     if (suffix && suffix != 'i' && suffix != 'o')
         return -1;  // invalid suffix ==> no such gate
 
-    // and search accordingly
+    // use the index if there are many gates
+    if (gateDescArraySize > GATEDESC_INDEX_THRESHOLD) {
+        if (!gateDescIndex)
+            buildGateDescIndex();
+        auto it = gateDescIndex->map.find(gatename);
+        return it == gateDescIndex->map.end() ? -1 : it->second;
+    }
+
+    // otherwise search accordingly
     switch (suffix) {
         case '\0':
             for (int i = 0; i < gateDescArraySize; i++) {
@@ -509,6 +608,28 @@ int cModule::findGateDesc(const char *gatename, char& suffix) const
     return -1;
 }
 
+void cModule::buildGateDescIndex() const
+{
+    discardGateDescIndex();
+    gateDescIndex = new GateDescIndex;
+    for (int i = 0; i < gateDescArraySize; i++) {
+        const cGate::Name *name = gateDescArray[i].name;
+        if (name) {
+            gateDescIndex->map[name->name.c_str()] = i;
+            if (name->type == cGate::INOUT) {
+                gateDescIndex->map[name->namei.c_str()] = i;
+                gateDescIndex->map[name->nameo.c_str()] = i;
+            }
+        }
+    }
+}
+
+void cModule::discardGateDescIndex() const
+{
+    delete gateDescIndex;
+    gateDescIndex = nullptr;
+}
+
 cGate::Desc *cModule::gateDesc(const char *gatename, char& suffix) const
 {
     int descIndex = findGateDesc(gatename, suffix);
@@ -1067,24 +1188,70 @@ bool cModule::checkInternalConnections() const
 
 int cModule::findSubmodule(const char *name, int index) const
 {
-    for (SubmoduleIterator it(this); !it.end(); ++it) {
-        cModule *submodule = *it;
-        if (submodule->isName(name) && ((index == -1 && !submodule->isVector()) || submodule->getIndex() == index))
-            return submodule->getId();
+    cModule *submodule = getSubmodule(name, index);
+    return submodule ? submodule->getId() : -1;
+}
+
+cModule *cModule::getSubmodule(const char *name, int index) const
+{
+    if (!submoduleIndex) {
+        // linear search while there are only a few submodules
+        int count = 0;
+        for (SubmoduleIterator it(this); !it.end(); ++it) {
+            if (++count > SUBMODULE_INDEX_THRESHOLD) {
+                buildSubmoduleIndex();
+                break;
+            }
+            cModule *submodule = *it;
+            if (submodule->isName(name) && ((index == -1 && !submodule->isVector()) || submodule->getIndex() == index))
+                return submodule;
+        }
+        if (!submoduleIndex)
+            return nullptr;
     }
 
-    return -1;
+    // note: a non-vector submodule also matches index 0 (its getIndex() is 0)
+    auto& map = submoduleIndex->map;
+    auto it = map.find(SubmoduleIndex::Key{name, index});
+    if (it == map.end() && index == 0)
+        it = map.find(SubmoduleIndex::Key{name, -1});
+    return it == map.end() ? nullptr : it->second;
 }
 
-cModule *cModule::getSubmodule(const char *name, int index) const
+void cModule::buildSubmoduleIndex() const
 {
+    discardSubmoduleIndex();
+    submoduleIndex = new SubmoduleIndex;
     for (SubmoduleIterator it(this); !it.end(); ++it) {
-        cModule *submodule = *it;
-        if (submodule->isName(name) && ((index == -1 && !submodule->isVector()) || submodule->getIndex() == index))
-            return submodule;
+        // in case of duplicates, the first one wins, like with linear search
+        if (!submoduleIndex->map.insert(std::make_pair(SubmoduleIndex::keyOf(*it), *it)).second)
+            submoduleIndex->hasDuplicates = true;
     }
+}
 
-    return nullptr;
+void cModule::addToSubmoduleIndex(cModule *submodule)
+{
+    // if the key is already taken, we would need to know which module comes
+    // first in the submodule list; rather drop the index and rebuild it on demand
+    if (!submoduleIndex->map.insert(std::make_pair(SubmoduleIndex::keyOf(submodule), submodule)).second)
+        discardSubmoduleIndex();
+}
+
+void cModule::removeFromSubmoduleIndex(cModule *submodule)
+{
+    auto it = submoduleIndex->map.find(SubmoduleIndex::keyOf(submodule));
+    if (it != submoduleIndex->map.end() && it->second == submodule) {
+        if (submoduleIndex->hasDuplicates)
+            discardSubmoduleIndex();  // another submodule may need to take its place
+        else
+            submoduleIndex->map.erase(it);
+    }
+}
+
+void cModule::discardSubmoduleIndex() const
+{
+    delete submoduleIndex;
+    submoduleIndex = nullptr;
 }
 
 inline char *nextToken(char *& rest)
@@ -1234,6 +1401,9 @@ void cModule::deleteModule()
     if (getSystemModule() == this && getSimulation()->getSimulationStage() != CTX_CLEANUP)
         throw cRuntimeError(this, "deleteModule(): It is not allowed to delete the system module during simulation");
 
+    if (getSimulation()->isParallelEventBatchActive())
+        ParallelEventExecutor::throwNotAllowed("Deleting modules");
+
     // If a coroutine wants to delete itself (maybe as part of a module subtree),
     // that has to be handled from another coroutine, e.g. from the main one.
     // Control is passed there by throwing an exception that gets transferred
@@ -28,7 +28,7 @@
 namespace omnetpp {
 
 #ifdef SIMFRONTEND_SUPPORT
-int64_t cObject::changeCounter = 0;
+thread_local int64_t cObject::changeCounter = 0;
 #endif
 
 cObject::~cObject()
@@ -103,7 +103,7 @@ void cObject::yieldOwnership(cOwnedObject *obj, cObject *newowner)
 void cObject::take(cOwnedObject *obj)
 {
     // ask current owner to release it -- if it's a cDefaultOwner, it will.
-    obj->owner->yieldOwnership(obj, this);
+    obj->releaseFromOwner(this);
 }
 
 void cObject::drop(cOwnedObject *obj)
@@ -111,7 +111,7 @@ void cObject::drop(cOwnedObject *obj)
     if (obj->owner != this)
         throw cRuntimeError(this, "drop(): Not owner of object (%s)%s",
                 obj->getClassName(), obj->getFullPath().c_str());
-    cOwnedObject::defaultOwner->doInsert(obj);
+    cOwnedObject::getDefaultOwner()->doInsert(obj);
 }
 
 void cObject::dropAndDelete(cOwnedObject *obj)
@@ -107,6 +107,7 @@ void cObjectParImpl::setExpression(cExpression *e)
 {
     deleteExpression();
     expr = e;
+    compileIfVolatile(expr);
     flags |= FL_ISEXPR | FL_CONTAINSVALUE | FL_ISSET;
 }
 
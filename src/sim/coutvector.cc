@@ -27,6 +27,7 @@
 #include "omnetpp/cenvir.h"
 #include "omnetpp/cexception.h"
 #include "omnetpp/cenum.h"
+#include "paralleleventexecutor.h"
 
 #ifdef WITH_PARSIM
 #include "omnetpp/ccommbuffer.h"
@@ -179,6 +180,13 @@ bool cOutVector::record(double value)
 
 bool cOutVector::recordWithTimestamp(simtime_t t, double value)
 {
+    // during parallel event execution, recording is done after the batch
+    cSimulation *sim = getSimulation();
+    if (sim->isParallelEventBatchActive()) {
+        ParallelEventExecutor::deferRecording(this, t, value);
+        return isEnabled();
+    }
+
     // check timestamp
     if (t < lastTimestamp)
         throw cRuntimeError(this, "Cannot record data with an earlier timestamp (t=%s) "
@@ -194,12 +202,12 @@ bool cOutVector::recordWithTimestamp(simtime_t t, double value)
     if (!isEnabled())
         return false;
 
-    if (!getRecordDuringWarmupPeriod() && t < getSimulation()->getWarmupPeriod())
+    if (!getRecordDuringWarmupPeriod() && t < sim->getWarmupPeriod())
         return false;
 
     // initialize if not yet done
     if (!handle)
-        handle = getEnvir()->registerOutputVector(getSimulation()->getContext()->getFullPath().c_str(), getName());
+        handle = getEnvir()->registerOutputVector(sim->getContext()->getFullPath().c_str(), getName());
 
     // pass data to envir for storage
     bool stored = getEnvir()->recordInOutputVector(handle, t, value);
@@ -54,16 +54,16 @@ void printAllObjects()
 #endif
 
 // static class members
-cDefaultOwner *cOwnedObject::defaultOwner = &defaultList;
-long cOwnedObject::totalObjectCount = 0;
-long cOwnedObject::liveObjectCount = 0;
+thread_local cDefaultOwner *cOwnedObject::defaultOwner = nullptr;
+thread_local long cOwnedObject::totalObjectCount = 0;
+thread_local long cOwnedObject::liveObjectCount = 0;
 
-cDefaultOwner defaultList;
+thread_local cDefaultOwner defaultList;
 
 cOwnedObject::cOwnedObject()
 {
     //TODO: in DEBUG mode, assert that this is not a static member / global variable! (using cStaticFlag)
-    defaultOwner->doInsert(this);
+    getDefaultOwner()->doInsert(this);
 
     // statistics
     totalObjectCount++;
@@ -75,7 +75,7 @@ cOwnedObject::cOwnedObject()
 
 cOwnedObject::cOwnedObject(const char *name, bool namepooling) : cNamedObject(name, namepooling)
 {
-    defaultOwner->doInsert(this);
+    getDefaultOwner()->doInsert(this);
 
     // statistics
     totalObjectCount++;
@@ -87,7 +87,7 @@ cOwnedObject::cOwnedObject(const char *name, bool namepooling) : cNamedObject(na
 
 cOwnedObject::cOwnedObject(const cOwnedObject& obj) : cNamedObject(obj)
 {
-    defaultOwner->doInsert(this);
+    getDefaultOwner()->doInsert(this);
     copy(obj);
 
     // statistics
@@ -104,7 +104,7 @@ cOwnedObject::~cOwnedObject()
     objectlist.erase(this);
 #endif
 
-    if (owner)
+    if (owner && pos != POS_UNTRACKED)
         owner->ownedObjectDeleted(this);
 
     // statistics
@@ -115,7 +115,7 @@ void cOwnedObject::removeFromOwnershipTree()
 {
     // set ownership of this object to null
     if (owner)
-        owner->yieldOwnership(this, nullptr);
+        releaseFromOwner(nullptr);
 }
 
 void cOwnedObject::setDefaultOwner(cDefaultOwner *list)
@@ -126,7 +126,7 @@ void cOwnedObject::setDefaultOwner(cDefaultOwner *list)
 
 cDefaultOwner *cOwnedObject::getDefaultOwner()
 {
-    return defaultOwner;
+    return defaultOwner ? defaultOwner : &defaultList;
 }
 
 void cOwnedObject::copy(const cOwnedObject& obj)
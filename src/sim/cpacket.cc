@@ -208,6 +208,24 @@ void cPacket::_detachEncapMsg()
 
 #endif
 
+void cPacket::leaveSimulation()
+{
+    cMessage::leaveSimulation();
+    if (encapsulatedPacket) {
+#ifdef REFCOUNTING
+        _detachEncapMsg();  // a packet shared with others stays in this simulation, we take a copy
+#endif
+        encapsulatedPacket->leaveSimulation();
+    }
+}
+
+void cPacket::enterSimulation()
+{
+    cMessage::enterSimulation();
+    if (encapsulatedPacket)
+        encapsulatedPacket->enterSimulation();
+}
+
 const char *cPacket::getDisplayString() const
 {
     return encapsulatedPacket ? encapsulatedPacket->getDisplayString() : "";
@@ -233,7 +251,10 @@ void cPacket::encapsulate(cPacket *msg)
         throw cRuntimeError(this, "encapsulate(): Another message already encapsulated");
 
     if (msg) {
-        if (msg->getOwner() != getSimulation()->getContextSimpleModule())
+        // note: during parallel event execution, there is no context module, but the default owner is the module
+        cSimulation *sim = getSimulation();
+        cObject *expectedOwner = sim->isParallelEventBatchActive() ? cOwnedObject::getDefaultOwner() : sim->getContextSimpleModule();
+        if (msg->getOwner() != expectedOwner)
             throw cRuntimeError(this, "encapsulate(): Not owner of message (%s)%s, owner is (%s)%s",
                     msg->getClassName(), msg->getFullName(),
                     msg->getOwner()->getClassName(), msg->getOwner()->getFullPath().c_str());
@@ -369,6 +369,7 @@ void cPar::acceptDefault()
         throw cRuntimeError(this, "acceptDefault(): Parameter contains no default value");
 
     beforeChange();
+    std::lock_guard<std::recursive_mutex> lock(cComponentType::sharedStateMutex);  // the value cache is shared
 
     // basically we only need to set the isSet flag to true, but only
     // for ourselves, without affecting the shared parameter prototype.
@@ -394,6 +395,7 @@ void cPar::acceptDefault()
 void cPar::convertToConst()
 {
     beforeChange();
+    std::lock_guard<std::recursive_mutex> lock(cComponentType::sharedStateMutex);  // the value cache is shared
     copyIfShared();
     try {
         p->convertToConst(evalContext);
@@ -428,6 +430,7 @@ void cPar::parse(const char *text, const char *baseDirectory)
     // cParImpl::parse() which throws an error on them.
     //
     beforeChange();
+    std::lock_guard<std::recursive_mutex> lock(cComponentType::sharedStateMutex);  // the value cache is shared
     cComponentType *componentType = ownerComponent->getComponentType();
     std::string key = std::string(getName()) + "|" + text + "|" + opp_nulltoempty(baseDirectory);
     cParImpl *cachedValue = componentType->getSharedParImpl(key.c_str());
@@ -21,6 +21,7 @@
 #include "omnetpp/cproperties.h"
 #include "omnetpp/ccomponent.h"
 #include "omnetpp/csimulation.h"
+#include "omnetpp/cdynamicexpression.h"
 
 #include "omnetpp/cboolparimpl.h"
 #include "omnetpp/cintparimpl.h"
@@ -35,8 +36,8 @@
 
 namespace omnetpp {
 
-long cParImpl::totalParimplObjs;
-long cParImpl::liveParimplObjs;
+thread_local long cParImpl::totalParimplObjs;
+thread_local long cParImpl::liveParimplObjs;
 cStringPool cParImpl::stringPool("cParImpl::stringPool");
 
 cParImpl::cParImpl()
@@ -119,6 +120,14 @@ cValue cParImpl::evaluate(cExpression *expr, cComponent *contextComponent) const
     }
 }
 
+void cParImpl::compileIfVolatile(cExpression *expr) const
+{
+    // only volatile parameters are evaluated often enough to repay the compilation
+    if (isVolatile())
+        if (cDynamicExpression *dynexpr = dynamic_cast<cDynamicExpression *>(expr))
+            dynexpr->compile();
+}
+
 int cParImpl::compare(const cParImpl *other) const
 {
     int res = strcmp(getName(), other->getName());
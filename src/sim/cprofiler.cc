@@ -0,0 +1,178 @@
+//=========================================================================
+//  CPROFILER.CC - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include <algorithm>
+#include <typeinfo>
+#include "common/commonutil.h"
+#include "omnetpp/cprofiler.h"
+#include "omnetpp/csimulation.h"
+#include "omnetpp/cmodule.h"
+#include "omnetpp/cmessage.h"
+
+using namespace omnetpp::common;
+
+namespace omnetpp {
+
+cProfiler::cProfiler()
+{
+    startTicks = getTicks();
+    startNsecs = opp_get_monotonic_clock_nsecs();
+}
+
+double cProfiler::ticksToSeconds(uint64_t ticks) const
+{
+#ifdef OMNETPP_PROFILER_RDTSC
+    // calibrate the time stamp counter against the monotonic clock
+    uint64_t elapsedTicks = getTicks() - startTicks;
+    int64_t elapsedNsecs = opp_get_monotonic_clock_nsecs() - startNsecs;
+    if (elapsedTicks == 0 || elapsedNsecs <= 0)
+        return 0;
+    return ticks * (elapsedNsecs / 1e9 / elapsedTicks);
+#else
+    return ticks / 1e9;
+#endif
+}
+
+cProfiler::Stats& cProfiler::getStatsFor(int componentId)
+{
+    if (componentId >= (int)componentStats.size())
+        componentStats.resize(componentId + 1);
+    return componentStats[componentId];
+}
+
+void cProfiler::push(int componentId, Stats *classStats)
+{
+    stack.push_back(Frame {componentId, classStats, getTicks(), 0});
+}
+
+void cProfiler::pop()
+{
+    ASSERT(!stack.empty());
+    Frame frame = stack.back();
+    stack.pop_back();
+    uint64_t elapsed = getTicks() - frame.startTicks;
+    Stats& stats = getStatsFor(frame.componentId);
+    stats.inclusiveTicks += elapsed;
+    stats.exclusiveTicks += elapsed - frame.childTicks;
+    if (frame.classStats) {
+        frame.classStats->inclusiveTicks += elapsed;
+        frame.classStats->exclusiveTicks += elapsed - frame.childTicks;
+    }
+    if (!stack.empty())
+        stack.back().childTicks += elapsed;
+}
+
+void cProfiler::beginEvent(cMessage *msg)
+{
+    int moduleId = msg->getArrivalModuleId();
+    getStatsFor(moduleId).numEvents++;
+    ClassStats& entry = classStats[std::type_index(typeid(*msg))];
+    if (entry.className.empty())
+        entry.className = msg->getClassName();
+    entry.stats.numEvents++;
+    push(moduleId, &entry.stats);
+}
+
+void cProfiler::beginMethodCall(cComponent *component)
+{
+    int componentId = component->getId();
+    getStatsFor(componentId).numMethodCalls++;
+    push(componentId, nullptr);
+}
+
+void cProfiler::emitDone(const cComponent *component, simsignal_t signalID, uint64_t startTicks)
+{
+    Stats& stats = getStatsFor(component->getId());
+    stats.numEmits++;
+    stats.emitTicks += getTicks() - startTicks;
+}
+
+const cProfiler::Stats& cProfiler::getComponentStats(int componentId) const
+{
+    static const Stats zero;
+    return componentId >= 0 && componentId < (int)componentStats.size() ? componentStats[componentId] : zero;
+}
+
+std::map<std::string, cProfiler::Stats> cProfiler::getMessageClassStats() const
+{
+    std::map<std::string, Stats> result;
+    for (const auto& entry : classStats)
+        result[entry.second.className] = entry.second.stats;
+    return result;
+}
+
+uint64_t cProfiler::getTotalTicks() const
+{
+    uint64_t total = 0;
+    for (const Stats& stats : componentStats)
+        total += stats.exclusiveTicks;
+    return total;
+}
+
+std::vector<int> cProfiler::getHotComponents(int n) const
+{
+    std::vector<int> ids;
+    for (int id = 0; id < (int)componentStats.size(); id++)
+        if (componentStats[id].exclusiveTicks > 0)
+            ids.push_back(id);
+    auto byExclusiveTime = [this](int a, int b) {return componentStats[a].exclusiveTicks > componentStats[b].exclusiveTicks;};
+    if ((int)ids.size() > n) {
+        std::partial_sort(ids.begin(), ids.begin() + n, ids.end(), byExclusiveTime);
+        ids.resize(n);
+    }
+    else {
+        std::sort(ids.begin(), ids.end(), byExclusiveTime);
+    }
+    return ids;
+}
+
+void cProfiler::recordResults(cSimulation *simulation)
+{
+    for (int id = 0; id < (int)componentStats.size(); id++) {
+        const Stats& stats = componentStats[id];
+        cComponent *component = simulation->getComponent(id);
+        if (!component || (stats.numEvents == 0 && stats.numMethodCalls == 0 && stats.numEmits == 0))
+            continue;
+        component->recordScalar("profileEvents", stats.numEvents);
+        component->recordScalar("profileMethodCalls", stats.numMethodCalls);
+        component->recordScalar("profileEmits", stats.numEmits);
+        component->recordScalar("profileInclusiveTime", ticksToSeconds(stats.inclusiveTicks), "s");
+        component->recordScalar("profileExclusiveTime", ticksToSeconds(stats.exclusiveTicks), "s");
+        component->recordScalar("profileEmitTime", ticksToSeconds(stats.emitTicks), "s");
+    }
+
+    cModule *systemModule = simulation->getSystemModule();
+    if (systemModule) {
+        for (const auto& entry : getMessageClassStats()) {
+            const std::string& className = entry.first;
+            const Stats& stats = entry.second;
+            systemModule->recordScalar(("profileEvents:" + className).c_str(), stats.numEvents);
+            systemModule->recordScalar(("profileInclusiveTime:" + className).c_str(), ticksToSeconds(stats.inclusiveTicks), "s");
+            systemModule->recordScalar(("profileExclusiveTime:" + className).c_str(), ticksToSeconds(stats.exclusiveTicks), "s");
+        }
+    }
+}
+
+void cProfiler::clear()
+{
+    ASSERT(stack.empty());
+    componentStats.clear();
+    classStats.clear();
+    startTicks = getTicks();
+    startNsecs = opp_get_monotonic_clock_nsecs();
+}
+
+}  // namespace omnetpp
+
@@ -22,6 +22,7 @@
 #include <cstdio>
 #include <cstring>
 #include <sstream>
+#include <algorithm>
 #include "omnetpp/globals.h"
 #include "omnetpp/cqueue.h"
 #include "omnetpp/cexception.h"
@@ -53,11 +54,13 @@ cQueue::cQueue(const cQueue& queue) : cOwnedObject(queue)
 
 cQueue::cQueue(const char *name, Comparator *cmp) : cOwnedObject(name), comparator(cmp)
 {
+    layout = comparator ? SORTED : LINEAR;
 }
 
 cQueue::cQueue(const char *name, CompareFunc cmp) : cOwnedObject(name),
         comparator(cmp ? new FunctionBasedComparator(cmp) : nullptr)
 {
+    layout = comparator ? SORTED : LINEAR;
 }
 
 cQueue::~cQueue()
@@ -77,8 +80,9 @@ std::string cQueue::str() const
 
 void cQueue::forEachChild(cVisitor *v)
 {
-    for (QElem *p = frontp; p != nullptr; p = p->next)
-        v->visit(p->obj);
+    ensureOrdered();
+    for (int i = 0; i < len; i++)
+        v->visit(at(i).obj);
 }
 
 void cQueue::parsimPack(cCommBuffer *buffer) const
@@ -109,32 +113,42 @@ void cQueue::parsimUnpack(cCommBuffer *buffer)
 #else
     cOwnedObject::parsimUnpack(buffer);
 
-    buffer->unpack(len);
+    clear();
+    int n;
+    buffer->unpack(n);
 
     Comparator *oldCmp = comparator;
     comparator = nullptr;  // temporarily, so that insert() keeps the original order
-    for (int i = 0; i < len; i++) {
+    for (int i = 0; i < n; i++) {
         cObject *obj = buffer->unpackObject();
         insert(obj);
     }
     comparator = oldCmp;
+
+    // the sender has no comparator, so the received order may or may not agree with ours
+    layout = LINEAR;
+    if (comparator) {
+        int i = 1;
+        while (i < len && !less(at(i), at(i - 1)))
+            i++;
+        if (i >= len)
+            layout = SORTED;
+    }
 #endif
 }
 
 void cQueue::clear()
 {
-    while (frontp) {
-        QElem *tmp = frontp->next;
-        cObject *obj = frontp->obj;
+    for (int i = 0; i < len; i++) {
+        cObject *obj = at(i).obj;
         if (!obj->isOwnedObject())
             delete obj;
         else if (obj->getOwner() == this)
             dropAndDelete(static_cast<cOwnedObject *>(obj));
-        delete frontp;
-        frontp = tmp;
     }
-    backp = nullptr;
+    head = 0;
     len = 0;
+    layout = comparator ? SORTED : LINEAR;
 }
 
 void cQueue::copy(const cQueue& queue)
@@ -159,6 +173,7 @@ void cQueue::copy(const cQueue& queue)
     takeOwnership = queue.takeOwnership;
     if (queue.comparator)
         comparator = queue.comparator->dup();
+    layout = queue.layout == HEAP ? SORTED : queue.layout;  // the iteration above sorted the source queue
 }
 
 cQueue& cQueue::operator=(const cQueue& queue)
@@ -173,8 +188,10 @@ cQueue& cQueue::operator=(const cQueue& queue)
 
 void cQueue::setup(Comparator *cmp)
 {
+    ensureOrdered();
     delete comparator;
     comparator = cmp;
+    layout = comparator && len == 0 ? SORTED : LINEAR;
 }
 
 void cQueue::setup(CompareFunc cmp)
@@ -182,63 +199,154 @@ void cQueue::setup(CompareFunc cmp)
     setup(cmp ? new FunctionBasedComparator(cmp) : nullptr);
 }
 
-cQueue::QElem *cQueue::find_qelem(cObject *obj) const
+bool cQueue::less(const Elem& a, const Elem& b) const
 {
-    QElem *p = frontp;
-    while (p && p->obj != obj)
-        p = p->next;
-    return p;
+    // equal elements are ordered by insertion, so the earlier one only has
+    // to be checked for not being greater, and the later one for being less
+    if (a.seq < b.seq)
+        return !comparator->less(b.obj, a.obj);
+    else
+        return comparator->less(a.obj, b.obj);
 }
 
-void cQueue::insbefore_qelem(QElem *p, cObject *obj)
+void cQueue::grow()
 {
-    QElem *e = new QElem;
-    e->obj = obj;
+    // double the capacity, and move the contents to the start of the buffer
+    std::vector<Elem> tmp(elems.empty() ? 16 : 2 * elems.size());
+    for (int i = 0; i < len; i++)
+        tmp[i] = at(i);
+    elems.swap(tmp);
+    head = 0;
+}
 
-    e->prev = p->prev;
-    e->next = p;
-    p->prev = e;
-    if (e->prev)
-        e->prev->next = e;
-    else
-        frontp = e;
-    len++;
+void cQueue::siftUp(int i)
+{
+    Elem e = at(i);
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!less(e, at(parent)))
+            break;
+        at(i) = at(parent);
+        i = parent;
+    }
+    at(i) = e;
 }
 
-void cQueue::insafter_qelem(QElem *p, cObject *obj)
+void cQueue::siftDown(int i)
 {
-    QElem *e = new QElem;
-    e->obj = obj;
+    Elem e = at(i);
+    while (true) {
+        int child = 2 * i + 1;
+        if (child >= len)
+            break;
+        if (child + 1 < len && less(at(child + 1), at(child)))
+            child++;
+        if (!less(at(child), e))
+            break;
+        at(i) = at(child);
+        i = child;
+    }
+    at(i) = e;
+}
 
-    e->next = p->next;
-    e->prev = p;
-    p->next = e;
-    if (e->next)
-        e->next->prev = e;
-    else
-        backp = e;
+void cQueue::ensureOrdered() const
+{
+    if (layout != HEAP)
+        return;
+
+    // a sorted array is also a valid heap, so the queue can stay in this layout
+    if (head + len > (int)elems.size()) {
+        std::rotate(elems.begin(), elems.begin() + head, elems.end());
+        head = 0;
+    }
+    std::sort(elems.begin() + head, elems.begin() + head + len, [this](const Elem& a, const Elem& b) {return less(a, b);});
+    layout = SORTED;
+}
+
+int cQueue::findIndex(cObject *obj) const
+{
+    for (int i = 0; i < len; i++)
+        if (at(i).obj == obj)
+            return i;
+    return -1;
+}
+
+void cQueue::insertAt(int i, cObject *obj)
+{
+    if (len == (int)elems.size())
+        grow();
+
+    // make room by shifting the shorter side of the queue
+    int mask = elems.size() - 1;
+    if (i < len / 2) {
+        head = (head - 1) & mask;
+        for (int j = 0; j < i; j++)
+            at(j) = at(j + 1);
+    }
+    else {
+        for (int j = len; j > i; j--)
+            at(j) = at(j - 1);
+    }
+    at(i) = Elem {obj, ++lastSeq};
     len++;
 }
 
-cObject *cQueue::remove_qelem(QElem *p)
+cObject *cQueue::removeAt(int i)
 {
-    if (p->next)
-        p->next->prev = p->prev;
-    else
-        backp = p->prev;
-    if (p->prev)
-        p->prev->next = p->next;
-    else
-        frontp = p->next;
+    cObject *retobj = at(i).obj;
+    if (layout == HEAP) {
+        at(i) = at(len - 1);
+        len--;
+        if (i < len) {
+            siftDown(i);
+            siftUp(i);
+        }
+    }
+    else if (i < len / 2) {
+        for (int j = i; j > 0; j--)
+            at(j) = at(j - 1);
+        head = (head + 1) & (elems.size() - 1);
+        len--;
+    }
+    else {
+        for (int j = i; j < len - 1; j++)
+            at(j) = at(j + 1);
+        len--;
+    }
+    if (len == 0) {
+        head = 0;
+        layout = comparator ? SORTED : LINEAR;
+    }
 
-    cObject *retobj = p->obj;
-    delete p;
-    len--;
     if (retobj->isOwnedObject() && retobj->getOwner() == this)
         drop(static_cast<cOwnedObject *>(retobj));
     return retobj;
 }
 
+cQueue::QElem *cQueue::find_qelem(cObject *obj) const
+{
+    ensureOrdered();
+    int i = findIndex(obj);
+    return i == -1 ? nullptr : &at(i);
+}
+
+void cQueue::insbefore_qelem(QElem *p, cObject *obj)
+{
+    insertAt(indexOf(p), obj);
+    layout = LINEAR;
+}
+
+void cQueue::insafter_qelem(QElem *p, cObject *obj)
+{
+    insertAt(indexOf(p) + 1, obj);
+    layout = LINEAR;
+}
+
+cObject *cQueue::remove_qelem(QElem *p)
+{
+    return removeAt(indexOf(p));
+}
+
 void cQueue::insert(cObject *obj)
 {
     if (!obj)
@@ -247,26 +355,24 @@ void cQueue::insert(cObject *obj)
     if (obj->isOwnedObject() && getTakeOwnership())
         take(static_cast<cOwnedObject *>(obj));
 
-    if (!backp) {
-        // insert as the only item
-        QElem *e = new QElem;
-        e->obj = obj;
-        e->next = e->prev = nullptr;
-        frontp = backp = e;
-        len = 1;
+    if (comparator == nullptr || len == 0) {
+        insertAt(len, obj);
     }
-    else if (comparator == nullptr) {
-        insafter_qelem(backp, obj);
+    else if (layout == LINEAR) {
+        // contents not known to be sorted: seek insertion place from the back
+        int i = len;
+        while (i > 0 && comparator->less(obj, at(i - 1).obj))
+            i--;
+        insertAt(i, obj);
+    }
+    else if (layout == SORTED && !comparator->less(obj, at(len - 1).obj)) {
+        // does not belong before the back element: the queue remains sorted
+        insertAt(len, obj);
     }
     else {
-        // priority queue: seek insertion place
-        QElem *p = backp;
-        while (p && comparator->less(obj, p->obj))
-            p = p->prev;
-        if (p)
-            insafter_qelem(p, obj);
-        else
-            insbefore_qelem(frontp, obj);
+        insertAt(len, obj);
+        layout = HEAP;
+        siftUp(len - 1);
     }
 }
 
@@ -275,13 +381,15 @@ void cQueue::insertBefore(cObject *where, cObject *obj)
     if (!obj)
         throw cRuntimeError(this, "Cannot insert nullptr");
 
-    QElem *p = find_qelem(where);
-    if (!p)
+    ensureOrdered();
+    int i = findIndex(where);
+    if (i == -1)
         throw cRuntimeError(this, "insertBefore(w,o): Object w='%s' not in the queue", where->getName());
 
     if (obj->isOwnedObject() && getTakeOwnership())
         take(static_cast<cOwnedObject *>(obj));
-    insbefore_qelem(p, obj);
+    insertAt(i, obj);
+    layout = LINEAR;
 }
 
 void cQueue::insertAfter(cObject *where, cObject *obj)
@@ -289,41 +397,53 @@ void cQueue::insertAfter(cObject *where, cObject *obj)
     if (!obj)
         throw cRuntimeError(this, "Cannot insert nullptr");
 
-    QElem *p = find_qelem(where);
-    if (!p)
+    ensureOrdered();
+    int i = findIndex(where);
+    if (i == -1)
         throw cRuntimeError(this, "insertAfter(w,o): Object w='%s' not in the queue", where->getName());
 
     if (obj->isOwnedObject() && getTakeOwnership())
         take(static_cast<cOwnedObject *>(obj));
-    insafter_qelem(p, obj);
+    insertAt(i + 1, obj);
+    layout = LINEAR;
 }
 
 cObject *cQueue::front() const
 {
-    return frontp ? frontp->obj : nullptr;
+    return len > 0 ? at(0).obj : nullptr;
 }
 
 cObject *cQueue::back() const
 {
-    return backp ? backp->obj : nullptr;
+    if (len == 0)
+        return nullptr;
+    if (layout == HEAP) {
+        // the maximum is among the leaves of the heap
+        int maxIndex = len / 2;
+        for (int i = maxIndex + 1; i < len; i++)
+            if (less(at(maxIndex), at(i)))
+                maxIndex = i;
+        return at(maxIndex).obj;
+    }
+    return at(len - 1).obj;
 }
 
 cObject *cQueue::remove(cObject *obj)
 {
     if (!obj)
         return nullptr;
-    QElem *p = find_qelem(obj);
-    if (!p)
+    int i = findIndex(obj);
+    if (i == -1)
         return nullptr;
-    return remove_qelem(p);
+    return removeAt(i);
 }
 
 cObject *cQueue::pop()
 {
-    if (!frontp)
+    if (len == 0)
         throw cRuntimeError(this, "pop(): Queue empty");
 
-    return remove_qelem(frontp);
+    return removeAt(0);
 }
 
 int cQueue::getLength() const
@@ -333,15 +453,41 @@ int cQueue::getLength() const
 
 bool cQueue::contains(cObject *obj) const
 {
-    return find_qelem(obj) != nullptr;
+    return findIndex(obj) != -1;
 }
 
 cObject *cQueue::get(int i) const
 {
-    QElem *p = frontp;
-    while (p != nullptr && i > 0)
-        p = p->next, i--;
-    return p ? p->obj : nullptr;
+    if (i < 0 || i >= len)
+        return nullptr;
+    ensureOrdered();
+    return at(i).obj;
+}
+
+//----
+
+void cQueue::Iterator::init(const cQueue& queue, bool reverse)
+{
+    q = &queue;
+    q->ensureOrdered();
+    pos = reverse ? q->len - 1 : 0;
+    obj = pos >= 0 && pos < q->len ? q->at(pos).obj : nullptr;
+}
+
+void cQueue::Iterator::advance(int delta)
+{
+    q->ensureOrdered();
+
+    // if the queue has changed since, find our object again
+    if (pos >= q->len || q->at(pos).obj != obj) {
+        int i = q->findIndex(obj);
+        if (i != -1)
+            pos = i;
+        else if (delta > 0)
+            delta = 0;  // object was removed, so its successor is now at pos
+    }
+    pos += delta;
+    obj = pos >= 0 && pos < q->len ? q->at(pos).obj : nullptr;
 }
 
 }  // namespace omnetpp
@@ -0,0 +1,284 @@
+//=========================================================================
+//  CREALTIMEIOSCHEDULER.CC - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include "omnetpp/crealtimeioscheduler.h"
+
+#ifdef __linux__
+
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include "omnetpp/cexception.h"
+#include "omnetpp/cmessage.h"
+#include "omnetpp/cmodule.h"
+#include "omnetpp/ccontextswitcher.h"
+#include "omnetpp/csimulation.h"
+#include "omnetpp/cfutureeventset.h"
+#include "omnetpp/cenvir.h"
+#include "omnetpp/globals.h"
+#include "omnetpp/simutil.h"
+
+namespace omnetpp {
+
+Register_Class(cRealTimeIOScheduler);
+
+#define MAX_EVENTS    64
+
+cRealTimeIOScheduler::cRealTimeIOScheduler() : cRealTimeScheduler()
+{
+}
+
+cRealTimeIOScheduler::~cRealTimeIOScheduler()
+{
+    closeFds();
+    delete lateness;
+}
+
+std::string cRealTimeIOScheduler::str() const
+{
+    std::string result = cRealTimeScheduler::str() + " with I/O";
+    result += ", " + std::to_string(registrations.size()) + " fds";
+    return result;
+}
+
+void cRealTimeIOScheduler::startRun()
+{
+    cRealTimeScheduler::startRun();
+
+    closeFds();
+    registrations.clear();
+    fdByMessage.clear();
+    numLateEvents = 0;
+
+    // cStatistic needs an RNG from the context component, so create it
+    // in the context of the network module
+    delete lateness;
+    {
+        cContextSwitcher tmp(sim->getSystemModule());
+        lateness = new cStdDev("realtimeLateness");
+        lateness->removeFromOwnershipTree();
+    }
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd == -1)
+        throw cRuntimeError("cRealTimeIOScheduler: epoll_create1() failed: %s", strerror(errno));
+    timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (timerFd == -1)
+        throw cRuntimeError("cRealTimeIOScheduler: timerfd_create() failed: %s", strerror(errno));
+
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = timerFd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, timerFd, &ev) == -1)
+        throw cRuntimeError("cRealTimeIOScheduler: epoll_ctl() failed: %s", strerror(errno));
+}
+
+void cRealTimeIOScheduler::endRun()
+{
+    closeFds();
+    registrations.clear();
+    fdByMessage.clear();
+}
+
+void cRealTimeIOScheduler::closeFds()
+{
+    if (timerFd != -1)
+        close(timerFd);
+    if (epollFd != -1)
+        close(epollFd);
+    timerFd = epollFd = -1;
+}
+
+void cRealTimeIOScheduler::lifecycleEvent(SimulationLifecycleEventType eventType, cObject *details)
+{
+    cRealTimeScheduler::lifecycleEvent(eventType, details);
+    if (eventType == LF_PRE_NETWORK_FINISH)
+        recordLateness();
+}
+
+void cRealTimeIOScheduler::recordLateness()
+{
+    cModule *networkModule = sim->getSystemModule();
+    if (networkModule && lateness && lateness->getCount() > 0) {
+        // note: cStatistic::record() only works from simple modules
+        opp_string_map attributes;
+        attributes["unit"] = "s";
+        getEnvir()->recordStatistic(networkModule, lateness->getName(), lateness, &attributes);
+        networkModule->recordScalar("realtimeLateEvents", (double)numLateEvents);
+    }
+}
+
+void cRealTimeIOScheduler::addFd(int fd, cModule *module, cMessage *notificationMsg)
+{
+    if (epollFd == -1)
+        throw cRuntimeError("cRealTimeIOScheduler: addFd() may only be called during the simulation, e.g. from initialize()");
+    if (!module || !notificationMsg)
+        throw cRuntimeError("cRealTimeIOScheduler: addFd(): Arguments must be non-nullptr");
+    if (registrations.find(fd) != registrations.end())
+        throw cRuntimeError("cRealTimeIOScheduler: addFd(): File descriptor %d already registered", fd);
+    if (fdByMessage.find(notificationMsg) != fdByMessage.end())
+        throw cRuntimeError("cRealTimeIOScheduler: addFd(): Notification message already used for another file descriptor");
+
+    registrations[fd] = Registration { module, notificationMsg };
+    fdByMessage[notificationMsg] = fd;
+    armFd(fd, true);
+}
+
+void cRealTimeIOScheduler::removeFd(int fd)
+{
+    auto it = registrations.find(fd);
+    if (it == registrations.end())
+        throw cRuntimeError("cRealTimeIOScheduler: removeFd(): File descriptor %d is not registered", fd);
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    fdByMessage.erase(it->second.notificationMsg);
+    registrations.erase(it);
+}
+
+void cRealTimeIOScheduler::armFd(int fd, bool add)
+{
+    // one-shot: the fd is not reported again until it is re-armed after
+    // the notification has been delivered
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.fd = fd;
+    if (epoll_ctl(epollFd, add ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, fd, &ev) == -1)
+        throw cRuntimeError("cRealTimeIOScheduler: Cannot watch file descriptor %d: epoll_ctl() failed: %s", fd, strerror(errno));
+}
+
+void cRealTimeIOScheduler::injectNotification(int fd)
+{
+    auto it = registrations.find(fd);
+    if (it == registrations.end())
+        return;  // removed meanwhile
+    cMessage *msg = it->second.notificationMsg;
+    if (msg->isScheduled())
+        return;  // still pending (was put back); will be re-armed when taken
+
+    // arrival time is the current real time, converted to simulation time
+    int64_t elapsed = opp_get_monotonic_clock_usecs() - baseTime;
+    simtime_t t = doScaling ? SimTime(elapsed / factor / 1e6) : SimTime(elapsed, SIMTIME_US);
+    if (t < sim->getSimTime())
+        t = sim->getSimTime();
+
+    msg->setArrival(it->second.module->getId(), -1, t);
+    sim->getFES()->insert(msg);
+}
+
+int cRealTimeIOScheduler::processReadyFds(int timeoutMillis, bool& timerExpired)
+{
+    epoll_event events[MAX_EVENTS];
+    int n = epoll_wait(epollFd, events, MAX_EVENTS, timeoutMillis);
+    if (n == -1) {
+        if (errno == EINTR)
+            return 0;
+        throw cRuntimeError("cRealTimeIOScheduler: epoll_wait() failed: %s", strerror(errno));
+    }
+
+    int numInjected = 0;
+    for (int i = 0; i < n; i++) {
+        int fd = events[i].data.fd;
+        if (fd == timerFd) {
+            uint64_t expirations;
+            ssize_t unused = read(timerFd, &expirations, sizeof(expirations));
+            (void)unused;
+            timerExpired = true;
+        }
+        else {
+            injectNotification(fd);
+            numInjected++;
+        }
+    }
+    return numInjected;
+}
+
+int cRealTimeIOScheduler::waitForInput(int64_t targetTime)
+{
+    // arm the timer for the target time (zero disarms it, i.e. no event in the FES)
+    itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    if (targetTime != INT64_MAX) {
+        spec.it_value.tv_sec = targetTime / 1000000;
+        spec.it_value.tv_nsec = (targetTime % 1000000) * 1000;
+        if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0)
+            spec.it_value.tv_nsec = 1;
+    }
+    if (timerfd_settime(timerFd, TFD_TIMER_ABSTIME, &spec, nullptr) == -1)
+        throw cRuntimeError("cRealTimeIOScheduler: timerfd_settime() failed: %s", strerror(errno));
+
+    // wake up at least every 100ms to keep the UI responsive
+    while (true) {
+        bool timerExpired = false;
+        int numInjected = processReadyFds(100, timerExpired);
+        if (numInjected > 0)
+            return 1;
+        if (timerExpired)
+            return 0;
+        if (getEnvir()->idle())
+            return -1;
+    }
+}
+
+cEvent *cRealTimeIOScheduler::takeNextEvent()
+{
+    cEvent *event = sim->getFES()->peekFirst();
+    if (!event && registrations.empty())
+        throw cTerminationException(E_ENDEDOK);
+
+    // if no event, wait for input indefinitely
+    int64_t targetTime = event ? baseTime + toUsecs(event->getArrivalTime()) : INT64_MAX;
+    int64_t currentTime = opp_get_monotonic_clock_usecs();
+    if (targetTime > currentTime) {
+        int status = waitForInput(targetTime);
+        if (status == -1)
+            return nullptr;  // user break
+        if (status == 1) {
+            event = sim->getFES()->peekFirst();  // received something
+            targetTime = baseTime + toUsecs(event->getArrivalTime());
+        }
+    }
+    else if (!registrations.empty()) {
+        // we're behind: don't wait, but do not neglect input either
+        bool timerExpired = false;
+        if (processReadyFds(0, timerExpired) > 0)
+            event = sim->getFES()->peekFirst();
+    }
+
+    // lateness statistics
+    int64_t late = opp_get_monotonic_clock_usecs() - targetTime;
+    if (late > 0)
+        numLateEvents++;
+    lateness->collect(late > 0 ? late / 1e6 : 0.0);
+
+    // remove event from FES and return it
+    cEvent *tmp = sim->getFES()->removeFirst();
+    ASSERT(tmp == event);
+
+    // notification is being delivered: watch its fd again
+    if (!fdByMessage.empty()) {
+        auto it = fdByMessage.find(event);
+        if (it != fdByMessage.end())
+            armFd(it->second, false);
+    }
+    return event;
+}
+
+}  // namespace omnetpp
+
+#endif
+
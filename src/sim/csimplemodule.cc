@@ -35,9 +35,11 @@
 #include "omnetpp/carray.h"
 #include "omnetpp/cmsgpar.h"
 #include "omnetpp/cqueue.h"
+#include "omnetpp/cproperties.h"
 #include "omnetpp/cenvir.h"
 #include "omnetpp/cexception.h"
 #include "omnetpp/platdep/platmisc.h"  // for DEBUG_TRAP
+#include "paralleleventexecutor.h"
 
 using namespace omnetpp::common;
 
@@ -55,9 +57,9 @@ const SendOptions SendOptions::DEFAULT;
 
 auto& DURATION_UNSPEC = SendOptions::DURATION_UNSPEC; // shorthand for local use
 
-cMessage *cSimpleModule::msgForActivity;
-bool cSimpleModule::stackCleanupRequested;
-cSimpleModule *cSimpleModule::afterCleanupTransferTo;
+thread_local cMessage *cSimpleModule::msgForActivity;
+thread_local bool cSimpleModule::stackCleanupRequested;
+thread_local cSimpleModule *cSimpleModule::afterCleanupTransferTo;
 
 
 std::string SendOptions::str() const
@@ -360,6 +362,12 @@ void cSimpleModule::send(cMessage *msg, const SendOptions& options, cGate *outGa
                                 msg->getClassName(), msg->getName());
     }
 
+    // during parallel event execution, the rest is done after the batch
+    if (getSimulation()->isParallelEventBatchActive()) {
+        ParallelEventExecutor::deferSending(msg, outGate, options, delayEndTime);
+        return;
+    }
+
     EVCB.beginSend(msg, options);
     bool keepMsg = outGate->deliver(msg, options, delayEndTime);
     if (!keepMsg)
@@ -460,6 +468,12 @@ void cSimpleModule::sendDirect(cMessage *msg, const SendOptions& options, cGate
     }
     result.delay = options.propagationDelay_;
 
+    // during parallel event execution, the rest is done after the batch
+    if (getSimulation()->isParallelEventBatchActive()) {
+        ParallelEventExecutor::deferSendingDirect(msg, toGate, options, result, simTime() + options.sendDelay + result.delay);
+        return;
+    }
+
     EVCB.messageSendDirect(msg, toGate, result);
     bool keepit = toGate->deliver(msg, options, simTime() + options.sendDelay + result.delay);
     if (!keepit)
@@ -537,6 +551,13 @@ void cSimpleModule::scheduleAt(simtime_t t, cMessage *msg)
     // set message parameters and schedule it
     msg->setSentFrom(this, -1, simTime());
     msg->setArrival(getId(), -1, t);
+
+    // during parallel event execution, the rest is done after the batch
+    if (getSimulation()->isParallelEventBatchActive()) {
+        ParallelEventExecutor::deferScheduling(msg);
+        return;
+    }
+
     EVCB.messageScheduled(msg);
     getSimulation()->insertEvent(msg);
 }
@@ -548,14 +569,43 @@ void cSimpleModule::scheduleAfter(simtime_t delay, cMessage *msg)
 
 void cSimpleModule::rescheduleAt(simtime_t t, cMessage *msg)
 {
-    cancelEvent(msg);
-    scheduleAt(t, msg);
+    if (msg == nullptr)
+        throw cRuntimeError("rescheduleAt(): Message pointer is nullptr");
+    if (!msg->isScheduled()) {
+        scheduleAt(t, msg);
+        return;
+    }
+    if (getSimulation()->isParallelEventBatchActive()) {
+        scheduleAt(t, cancelEvent(msg));  // scheduling is buffered during parallel event execution
+        return;
+    }
+
+    // same checks as in cancelEvent() and scheduleAt()
+    if (!msg->isSelfMessage())
+        throw cRuntimeError("rescheduleAt(): Message (%s)%s is not a self-message", msg->getClassName(), msg->getFullName());
+    if (msg->getArrivalModuleId() != getId())
+        throw cRuntimeError("rescheduleAt(): Cannot reschedule another module's self-message");
+    if (t < simTime())
+        throw cRuntimeError(E_BACKSCHED, msg->getClassName(), msg->getName(), SIMTIME_DBL(t));
+    if (this != getSimulation()->getContextModule() && getSimulation()->getContextModule() != nullptr)
+        throw cRuntimeError("rescheduleAt() of module (%s)%s called in the context of "
+                            "module (%s)%s: method called from the latter module "
+                            "lacks Enter_Method() or Enter_Method_Silent()?",
+                            getClassName(), getFullPath().c_str(),
+                            getSimulation()->getContextModule()->getClassName(),
+                            getSimulation()->getContextModule()->getFullPath().c_str());
+
+    // move the message to its new place in the FES; notifications are
+    // the same as with cancelEvent() + scheduleAt()
+    EVCB.messageCancelled(msg);
+    msg->setSentFrom(this, -1, simTime());
+    getSimulation()->insertEvent(msg, t);
+    EVCB.messageScheduled(msg);
 }
 
 void cSimpleModule::rescheduleAfter(simtime_t delay, cMessage *msg)
 {
-    cancelEvent(msg);
-    scheduleAfter(delay, msg);
+    rescheduleAt(simTime() + delay, msg);
 }
 
 cMessage *cSimpleModule::cancelEvent(cMessage *msg)
@@ -571,6 +621,11 @@ cMessage *cSimpleModule::cancelEvent(cMessage *msg)
         if (msg->getArrivalModuleId() != getId())
             throw cRuntimeError("cancelEvent(): Cannot cancel another module's self-message");
 
+        if (getSimulation()->isParallelEventBatchActive()) {
+            ParallelEventExecutor::cancelEvent(msg);
+            return msg;
+        }
+
         getSimulation()->getFES()->remove(msg);
         EVCB.messageCancelled(msg);
         msg->setPreviousEventNumber(getSimulation()->getEventNumber());
@@ -581,7 +636,11 @@ cMessage *cSimpleModule::cancelEvent(cMessage *msg)
 
 void cSimpleModule::cancelAndDelete(cMessage *msg)
 {
-    if (msg)
+    if (!msg)
+        return;
+    if (getSimulation()->isParallelEventBatchActive())
+        ParallelEventExecutor::deleteCancelledMessage(cancelEvent(msg));
+    else
         delete cancelEvent(msg);
 }
 
@@ -791,6 +850,16 @@ void cSimpleModule::doMessageEvent(cMessage *msg)
     }
 }
 
+bool cSimpleModule::isParallel() const
+{
+    if (!(flags & FL_PARALLEL_CHECKED)) {
+        cSimpleModule *self = const_cast<cSimpleModule *>(this);
+        self->setFlag(FL_PARALLEL, getProperties()->getAsBool("parallel"));
+        self->setFlag(FL_PARALLEL_CHECKED, true);
+    }
+    return flags & FL_PARALLEL;
+}
+
 void cSimpleModule::activity()
 {
     // default thread function
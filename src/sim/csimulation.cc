@@ -25,10 +25,15 @@
 #include <cstring>
 #include <cstdio>
 #include <climits>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <thread>
 #include "common/stringutil.h"
 #include "omnetpp/cmodule.h"
 #include "omnetpp/csimplemodule.h"
 #include "omnetpp/cpacket.h"
+#include "omnetpp/cmessagepool.h"
 #include "omnetpp/cchannel.h"
 #include "omnetpp/csimulation.h"
 #include "omnetpp/cscheduler.h"
@@ -40,13 +45,17 @@
 #include "omnetpp/cexception.h"
 #include "omnetpp/cparimpl.h"
 #include "omnetpp/cfingerprint.h"
+#include "omnetpp/cprofiler.h"
 #include "omnetpp/cconfiguration.h"
 #include "omnetpp/ccoroutine.h"
 #include "omnetpp/clifecyclelistener.h"
+#include "omnetpp/cresultfilter.h"
 #include "omnetpp/platdep/platmisc.h"  // for DEBUG_TRAP
+#include "paralleleventexecutor.h"
 
 #ifdef WITH_PARSIM
 #include "omnetpp/ccommbuffer.h"
+#include "parsim/cmemcommbuffer.h"
 #endif
 
 #ifdef WITH_NETBUILDER
@@ -113,6 +122,9 @@ cSimulation::cSimulation(const char *name, cEnvir *env) : cNamedObject(name, fal
     currentEventNumber = 0;
     trapOnNextEvent = false;
 
+    parallelEventThreads = 1;
+    parallelEventExecutor = nullptr;
+
     // install default FES
     setFES(new cEventHeap("fes"));
 
@@ -130,8 +142,10 @@ cSimulation::~cSimulation()
 
     deleteNetwork();
 
+    delete parallelEventExecutor;
     delete envir;
     delete fingerprint;
+    delete profiler;
     delete scheduler;
     dropAndDelete(fes);
 }
@@ -139,7 +153,7 @@ cSimulation::~cSimulation()
 void cSimulation::setActiveSimulation(cSimulation *sim)
 {
     activeSimulation = sim;
-    activeEnvir = sim == nullptr ? staticEnvir : sim->envir;
+    activeEnvir = sim == nullptr ? nullptr : sim->envir;
 }
 
 void cSimulation::setStaticEnvir(cEnvir *env)
@@ -387,6 +401,7 @@ void cSimulation::setupNetwork(cModuleType *network)
     fes->clear();
     cComponent::clearSignalState();
 
+    cModule::acquireNamePools();  // released in deleteNetwork()
     simulationStage = CTX_BUILD;
 
     try {
@@ -446,6 +461,8 @@ void cSimulation::callFinish()
     if (systemModule) {
         getEnvir()->notifyLifecycleListeners(LF_PRE_NETWORK_FINISH);
         systemModule->callFinish();
+        if (profiler)
+            profiler->recordResults(this);
         getEnvir()->notifyLifecycleListeners(LF_POST_NETWORK_FINISH);
     }
 }
@@ -498,13 +515,16 @@ void cSimulation::deleteNetwork()
     networkType = nullptr;
 
     //FIXME todo delete cParImpl caches too (cParImplCache, cParImplCache2)
-    cModule::clearNamePools();
+    cModule::releaseNamePools();
 
     getEnvir()->notifyLifecycleListeners(LF_POST_NETWORK_DELETE);
 
     // clear remaining messages (module dtors may have cancelled & deleted some of them)
     fes->clear();
 
+    // release memory cached for pooled message allocation
+    cMessagePool::clear();
+
     simulationStage = CTX_NONE;
 
 #ifdef DEVELOPER_DEBUG
@@ -569,7 +589,8 @@ void cSimulation::transferTo(cSimpleModule *module)
     currentActivityModule = module;
     cCoroutine::switchTo(module->coroutine);
 
-    if (module->hasStackOverflow())
+    // note: no check while unwinding the stack of a deleted module (it may have been reported already)
+    if (!cSimpleModule::stackCleanupRequested && module->hasStackOverflow())
         throw cRuntimeError("Stack violation in module (%s)%s: Module stack too small? "
                             "Try increasing it in the class' Module_Class_Members() or constructor",
                 module->getClassName(), module->getFullPath().c_str());
@@ -612,12 +633,25 @@ void cSimulation::transferTo(cSimpleModule *module)
 #define DEBUG_TRAP_IF_REQUESTED    { if (trapOnNextEvent) { trapOnNextEvent = false; if (getEnvir()->ensureDebugger()) DEBUG_TRAP; } }
 #endif
 
+namespace {
+// reports the event to the profiler, also when the event throws an exception
+struct ProfiledEvent {
+    cProfiler *profiler;
+    ProfiledEvent(cProfiler *profiler, cEvent *event) : profiler(profiler) {if (profiler) profiler->beginEvent(static_cast<cMessage *>(event));}
+    ~ProfiledEvent() {if (profiler) profiler->endEvent();}
+};
+}  // namespace
+
 void cSimulation::executeEvent(cEvent *event)
 {
 #ifndef NDEBUG
     checkActive();
 #endif
 
+    // try executing it together with the following same-timestamp events
+    if (parallelEventExecutor && event->isMessage() && parallelEventExecutor->executeBatch(static_cast<cMessage *>(event)))
+        return;
+
     setContextType(CTX_EVENT);
 
     // increment event count
@@ -638,6 +672,8 @@ void cSimulation::executeEvent(cEvent *event)
     if (getFingerprintCalculator() && event->isMessage())
         getFingerprintCalculator()->addEvent(event);
 
+    ProfiledEvent profiledEvent(event->isMessage() ? profiler : nullptr, event);
+
     try {
         if (!event->isMessage())
             DEBUG_TRAP_IF_REQUESTED;  // ABOUT TO PROCESS THE EVENT YOU REQUESTED TO DEBUG -- SELECT "STEP INTO" IN YOUR DEBUGGER
@@ -681,12 +717,21 @@ void cSimulation::transferToMain()
 
 void cSimulation::setContext(cComponent *p)
 {
+    if (parallelEventBatchActive) {
+        // the context stays global; only the module of the event may be "entered"
+        ParallelEventExecutor::checkContextSwitch(p);
+        return;
+    }
     contextComponent = p;
     cOwnedObject::setDefaultOwner(p);
 }
 
 cModule *cSimulation::getContextModule() const
 {
+    // the context stays global during parallel event execution, see setContext()
+    if (parallelEventBatchActive)
+        return ParallelEventExecutor::getCurrentModule();
+
     // cannot go inline (upward cast would require including cmodule.h in csimulation.h)
     if (!contextComponent || !contextComponent->isModule())
         return nullptr;
@@ -695,6 +740,9 @@ cModule *cSimulation::getContextModule() const
 
 cSimpleModule *cSimulation::getContextSimpleModule() const
 {
+    if (parallelEventBatchActive)
+        return ParallelEventExecutor::getCurrentModule();
+
     // cannot go inline (upward cast would require including cmodule.h in csimulation.h)
     if (!contextComponent || !contextComponent->isModule() || !((cModule *)contextComponent)->isSimple())
         return nullptr;
@@ -703,9 +751,26 @@ cSimpleModule *cSimulation::getContextSimpleModule() const
 
 unsigned long cSimulation::getUniqueNumber()
 {
+    if (parallelEventBatchActive)
+        ParallelEventExecutor::throwNotAllowed("getUniqueNumber()");
     return getEnvir()->getUniqueNumber();
 }
 
+void cSimulation::setParallelEventThreads(int numThreads)
+{
+    if (parallelEventBatchActive)
+        throw cRuntimeError(this, "setParallelEventThreads(): Cannot be called during parallel event execution");
+    if (numThreads < 0)
+        throw cRuntimeError(this, "setParallelEventThreads(): Invalid number of threads %d", numThreads);
+    if (numThreads == 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    if (numThreads == parallelEventThreads)
+        return;
+    delete parallelEventExecutor;
+    parallelEventExecutor = numThreads > 1 ? new ParallelEventExecutor(this, numThreads) : nullptr;
+    parallelEventThreads = numThreads;
+}
+
 void cSimulation::setFingerprintCalculator(cFingerprintCalculator *f)
 {
     if (fingerprint)
@@ -713,12 +778,313 @@ void cSimulation::setFingerprintCalculator(cFingerprintCalculator *f)
     fingerprint = f;
 }
 
+void cSimulation::setProfiler(cProfiler *p)
+{
+    if (p == profiler)
+        return;
+    delete profiler;
+    profiler = p;
+}
+
 void cSimulation::insertEvent(cEvent *event)
 {
     event->setPreviousEventNumber(currentEventNumber);
     fes->insert(event);
 }
 
+void cSimulation::insertEvent(cEvent *event, simtime_t t)
+{
+    event->setPreviousEventNumber(currentEventNumber);
+    fes->reschedule(event, t);
+}
+
+#ifdef WITH_PARSIM
+static void collectResultListeners(cResultListener *listener, std::vector<cResultListener *>& result, std::set<cResultListener *>& visited)
+{
+    if (!visited.insert(listener).second)
+        return;  // shared by several signals or chains, e.g. an expression filter
+    result.push_back(listener);
+    if (cResultFilter *filter = dynamic_cast<cResultFilter *>(listener))
+        for (cResultListener *delegate : filter->getDelegates())
+            collectResultListeners(delegate, result, visited);
+}
+
+static std::vector<cResultListener *> collectResultListeners(cComponent *component, std::set<cResultListener *>& visited)
+{
+    std::vector<cResultListener *> result;
+    for (simsignal_t signalID : component->getLocalListenedSignals())
+        for (cIListener *listener : component->getLocalSignalListeners(signalID))
+            if (cResultListener *resultListener = dynamic_cast<cResultListener *>(listener))
+                collectResultListeners(resultListener, result, visited);
+    return result;
+}
+
+static std::vector<cEvent *> getEventsInSchedulingOrder(cFutureEventSet *fes)
+{
+    std::vector<cEvent *> events;
+    for (int i = 0; i < fes->getLength(); i++)
+        events.push_back(fes->get(i));
+    std::sort(events.begin(), events.end(), [](cEvent *a, cEvent *b) {return cEvent::compareBySchedulingOrder(a, b) < 0;});
+    return events;
+}
+#endif
+
+void cSimulation::packCheckpoint(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    checkActive();
+    if (!systemModule)
+        throw cRuntimeError("Cannot write checkpoint: No network set up");
+
+    buffer->pack(currentSimtime);
+    buffer->pack(currentEventNumber);
+
+    // network structure, verified on restore
+    buffer->pack(lastComponentId);
+    for (int id = 1; id <= lastComponentId; id++) {
+        cComponent *component = componentv[id];
+        if (buffer->packFlag(component != nullptr)) {
+            if (component->isModule() && ((cModule *)component)->isSimple() && ((cSimpleModule *)component)->usesActivity())
+                throw cRuntimeError("Cannot write checkpoint: Module '%s' uses activity(), whose state cannot be saved", component->getFullPath().c_str());
+            buffer->pack(component->getFullPath().c_str());
+        }
+    }
+
+    // scheduled messages
+    std::vector<cMessage *> msgs;
+    for (cEvent *event : getEventsInSchedulingOrder(fes)) {
+        if (dynamic_cast<cEndSimulationEvent *>(event))
+            continue;  // re-created from the configuration
+        if (!event->isMessage())
+            throw cRuntimeError("Cannot write checkpoint: Scheduled event (%s)%s is not a message", event->getClassName(), event->getFullName());
+        cMessage *msg = (cMessage *)event;
+        if (msg->getContextPointer() != nullptr)  // it cannot be saved, and it would be wrong to restore it as nullptr
+            throw cRuntimeError("Cannot write checkpoint: Scheduled message (%s)%s has a context pointer", msg->getClassName(), msg->getFullName());
+        msgs.push_back(msg);
+    }
+    buffer->pack((int)msgs.size());
+    for (cMessage *msg : msgs) {
+        buffer->pack(msg->getClassName());
+        buffer->pack(msg->getName());
+        buffer->pack(msg->isSelfMessage());
+        buffer->pack(msg->getArrivalModuleId());
+        buffer->pack(msg->messageId);
+        buffer->pack(msg->messageTreeId);
+        try {
+            msg->parsimPack(buffer);
+        }
+        catch (std::exception& e) {
+            throw cRuntimeError("Cannot write checkpoint: Cannot pack scheduled message (%s)%s: %s", msg->getClassName(), msg->getFullName(), e.what());
+        }
+    }
+
+    // parameters, result filters/recorders and model state, per component
+    std::set<cResultListener *> visited;
+    cMemCommBuffer componentBuffer;
+    for (int id = 1; id <= lastComponentId; id++) {
+        cComponent *component = componentv[id];
+        if (!component)
+            continue;
+        componentBuffer.reset();
+
+        int numParams = component->getNumParams();
+        componentBuffer.pack(numParams);
+        for (int i = 0; i < numParams; i++)
+            componentBuffer.pack(component->par(i).str().c_str());
+
+        std::vector<cResultListener *> listeners = collectResultListeners(component, visited);
+        componentBuffer.pack((int)listeners.size());
+        for (cResultListener *listener : listeners) {
+            componentBuffer.pack(listener->getClassName());
+            try {
+                listener->parsimPack(&componentBuffer);
+            }
+            catch (std::exception& e) {
+                throw cRuntimeError("Cannot write checkpoint: Cannot pack result listener %s of '%s': %s", listener->getClassName(), component->getFullPath().c_str(), e.what());
+            }
+        }
+
+        cContextSwitcher tmp(component);
+        try {
+            component->packCheckpoint(&componentBuffer);
+        }
+        catch (std::exception& e) {
+            throw cRuntimeError("Cannot write checkpoint: Cannot pack the state of '%s': %s", component->getFullPath().c_str(), e.what());
+        }
+
+        buffer->pack(componentBuffer.getMessageSize());
+        buffer->pack(componentBuffer.getBuffer(), componentBuffer.getMessageSize());
+    }
+
+    buffer->pack(nextMessageId);
+    buffer->pack(totalMessageCount);
+
+    if (buffer->packFlag(fingerprint != nullptr))
+        fingerprint->parsimPack(buffer);
+#endif
+}
+
+void cSimulation::unpackCheckpoint(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    checkActive();
+    if (!systemModule)
+        throw cRuntimeError("Cannot restore checkpoint: No network set up");
+
+    buffer->unpack(currentSimtime);
+    buffer->unpack(currentEventNumber);
+
+    // verify that the network is the same
+    int savedLastComponentId;
+    buffer->unpack(savedLastComponentId);
+    if (savedLastComponentId != lastComponentId)
+        throw cRuntimeError("Cannot restore checkpoint: The network has %d components instead of %d "
+                            "(were modules or channels created or deleted dynamically?)", lastComponentId, savedLastComponentId);
+    for (int id = 1; id <= lastComponentId; id++) {
+        cComponent *component = componentv[id];
+        bool exists = buffer->checkFlag();
+        if (exists != (component != nullptr))
+            throw cRuntimeError("Cannot restore checkpoint: Component with id=%d %s", id, exists ? "does not exist" : "did not exist in the saved network");
+        if (exists) {
+            opp_string fullPath;
+            buffer->unpack(fullPath);
+            if (component->getFullPath() != fullPath.c_str())
+                throw cRuntimeError("Cannot restore checkpoint: Component with id=%d is '%s' instead of '%s'", id, component->getFullPath().c_str(), fullPath.c_str());
+        }
+    }
+
+    // remove events scheduled during initialization; self-messages are
+    // kept as candidates for holding the restored ones, so that pointers
+    // to them (timers) held by the modules remain valid
+    std::map<int, std::vector<cMessage *>> selfMessages;  // by module id
+    for (cEvent *event : getEventsInSchedulingOrder(fes)) {
+        if (dynamic_cast<cEndSimulationEvent *>(event))
+            continue;
+        cMessage *msg = event->isMessage() ? (cMessage *)event : nullptr;
+        cSimpleModule *module = msg && msg->isSelfMessage() ? dynamic_cast<cSimpleModule *>(getComponent(msg->getArrivalModuleId())) : nullptr;
+        if (module) {
+            cContextSwitcher tmp(module);
+            module->cancelEvent(msg);
+            selfMessages[module->getId()].push_back(msg);
+        }
+        else {
+            fes->remove(event);
+            delete event;
+        }
+    }
+
+    // restore scheduled messages
+    int numMessages;
+    buffer->unpack(numMessages);
+    for (int k = 0; k < numMessages; k++) {
+        opp_string className, name;
+        bool isSelfMessage;
+        int moduleId;
+        long messageId, messageTreeId;
+        buffer->unpack(className);
+        buffer->unpack(name);
+        buffer->unpack(isSelfMessage);
+        buffer->unpack(moduleId);
+        buffer->unpack(messageId);
+        buffer->unpack(messageTreeId);
+
+        cMessage *msg = nullptr;
+        if (isSelfMessage) {
+            std::vector<cMessage *>& candidates = selfMessages[moduleId];
+            for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+                if (!(*it)->isPacket() && opp_strcmp((*it)->getClassName(), className.c_str()) == 0 && opp_strcmp((*it)->getName(), name.c_str()) == 0) {
+                    msg = *it;
+                    candidates.erase(it);
+                    break;
+                }
+            }
+        }
+        if (!msg) {
+            cObject *obj = createOne(className.c_str());
+            msg = dynamic_cast<cMessage *>(obj);
+            if (!msg) {
+                delete obj;
+                throw cRuntimeError("Cannot restore checkpoint: Class '%s' is not a message class", className.c_str());
+            }
+            // a new timer object would not be known to the module, which would
+            // then schedule or cancel its own one; packets sent to self are fine
+            if (isSelfMessage && !msg->isPacket()) {
+                delete msg;
+                throw cRuntimeError("Cannot restore checkpoint: Self-message (%s)%s of '%s' has no counterpart among the self-messages scheduled during initialization",
+                                    className.c_str(), name.c_str(), getComponent(moduleId)->getFullPath().c_str());
+            }
+        }
+        msg->parsimUnpack(buffer);
+        msg->setContextPointer(nullptr);  // was nullptr when saved
+        msg->messageId = messageId;
+        msg->messageTreeId = messageTreeId;
+        insertEvent(msg);
+    }
+
+    // restore parameters, result filters/recorders and model state
+    std::set<cResultListener *> visited;
+    cMemCommBuffer componentBuffer;
+    for (int id = 1; id <= lastComponentId; id++) {
+        cComponent *component = componentv[id];
+        if (!component)
+            continue;
+        int size;
+        buffer->unpack(size);
+        componentBuffer.allocateAtLeast(size);
+        buffer->unpack(componentBuffer.getBuffer(), size);
+        componentBuffer.setMessageSize(size);
+
+        cContextSwitcher tmp(component);
+
+        int numParams;
+        componentBuffer.unpack(numParams);
+        if (numParams != component->getNumParams())
+            throw cRuntimeError("Cannot restore checkpoint: Component '%s' has %d parameters instead of %d", component->getFullPath().c_str(), component->getNumParams(), numParams);
+        for (int i = 0; i < numParams; i++) {
+            opp_string value;
+            componentBuffer.unpack(value);
+            cPar& par = component->par(i);
+            if (par.getType() != cPar::OBJECT && par.getType() != cPar::XML && par.str() != value.c_str())
+                par.parse(value.c_str());
+        }
+
+        std::vector<cResultListener *> listeners = collectResultListeners(component, visited);
+        int numListeners;
+        componentBuffer.unpack(numListeners);
+        if (numListeners != (int)listeners.size())
+            throw cRuntimeError("Cannot restore checkpoint: Component '%s' has %d result filters and recorders instead of %d", component->getFullPath().c_str(), (int)listeners.size(), numListeners);
+        for (cResultListener *listener : listeners) {
+            opp_string className;
+            componentBuffer.unpack(className);
+            if (opp_strcmp(listener->getClassName(), className.c_str()) != 0)
+                throw cRuntimeError("Cannot restore checkpoint: Result listener mismatch in component '%s': %s instead of %s", component->getFullPath().c_str(), listener->getClassName(), className.c_str());
+            listener->parsimUnpack(&componentBuffer);
+        }
+
+        component->unpackCheckpoint(&componentBuffer);
+
+        if (!componentBuffer.isBufferEmpty())
+            throw cRuntimeError("Cannot restore checkpoint: Wrong amount of data unpacked for component '%s', "
+                                "check that its unpackCheckpoint() method matches packCheckpoint()", component->getFullPath().c_str());
+    }
+
+    buffer->unpack(nextMessageId);
+    buffer->unpack(totalMessageCount);
+
+    if (buffer->checkFlag()) {
+        if (!fingerprint)
+            throw cRuntimeError("Cannot restore checkpoint: It contains a fingerprint, but no fingerprint is being calculated");
+        fingerprint->parsimUnpack(buffer);
+    }
+    else if (fingerprint)
+        throw cRuntimeError("Cannot restore checkpoint: It contains no fingerprint, but one is being calculated");
+#endif
+}
+
 //----
 
 /**
@@ -864,10 +1230,10 @@ void StaticEnv::undisposedObject(cObject *obj)
 static StaticEnv staticEnv;
 
 // cSimulation's global variables
-cEnvir *cSimulation::activeEnvir = &staticEnv;
+thread_local cEnvir *cSimulation::activeEnvir = nullptr;
 cEnvir *cSimulation::staticEnvir = &staticEnv;
 
-cSimulation *cSimulation::activeSimulation = nullptr;
+thread_local cSimulation *cSimulation::activeSimulation = nullptr;
 
 }  // namespace omnetpp
 
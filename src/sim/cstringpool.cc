@@ -58,6 +58,7 @@ const char *cStringPool::get(const char *s)
     if (!s)
         return nullptr;
 
+    std::lock_guard<std::mutex> lock(mutex);
     StringIntMap::iterator it = pool.find(const_cast<char *>(s));
     if (it == pool.end()) {
         // allocate new string
@@ -82,6 +83,7 @@ const char *cStringPool::peek(const char *s) const
     if (!s)
         return nullptr;
 
+    std::lock_guard<std::mutex> lock(mutex);
     StringIntMap::const_iterator it = pool.find(const_cast<char *>(s));
     return it == pool.end() ? nullptr : it->first;
 }
@@ -97,6 +99,7 @@ void cStringPool::release(const char *s)
         return;
     }
 
+    std::lock_guard<std::mutex> lock(mutex);
     StringIntMap::iterator it = pool.find(const_cast<char *>(s));
 
     // sanity checks
@@ -23,8 +23,13 @@
 #include <cstring>
 #include <cstdarg>
 #include <deque>
-#include <list>
+#include <queue>
+#include <tuple>
+#include <functional>
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
 #include <sstream>
 #include "common/patternmatcher.h"
 #include "omnetpp/ctopology.h"
@@ -105,6 +110,7 @@ void cTopology::clear()
         delete node;
     }
     nodes.clear();
+    discardAllPairsShortestPaths();
 }
 
 //---
@@ -236,6 +242,7 @@ void cTopology::extractFromNetwork(bool (*predicate)(cModule *, void *), void *d
 
 int cTopology::addNode(Node *node)
 {
+    discardAllPairsShortestPaths();
     if (node->moduleId == -1) {
         // elements without module ID are stored at the end
         nodes.push_back(node);
@@ -251,6 +258,8 @@ int cTopology::addNode(Node *node)
 
 void cTopology::deleteNode(Node *node)
 {
+    discardAllPairsShortestPaths();
+
     // remove outgoing links
     for (auto link : node->outLinks) {
         unlinkFromDestNode(link);
@@ -275,6 +284,8 @@ void cTopology::deleteNode(Node *node)
 
 void cTopology::addLink(Link *link, Node *srcNode, Node *destNode)
 {
+    discardAllPairsShortestPaths();
+
     // remove from graph if it's already in
     if (link->srcNode)
         unlinkFromSourceNode(link);
@@ -294,6 +305,8 @@ void cTopology::addLink(Link *link, Node *srcNode, Node *destNode)
 
 void cTopology::addLink(Link *link, cGate *srcGate, cGate *destGate)
 {
+    discardAllPairsShortestPaths();
+
     // remove from graph if it's already in
     if (link->srcNode)
         unlinkFromSourceNode(link);
@@ -317,6 +330,7 @@ void cTopology::addLink(Link *link, cGate *srcGate, cGate *destGate)
 
 void cTopology::deleteLink(Link *link)
 {
+    discardAllPairsShortestPaths();
     unlinkFromSourceNode(link);
     unlinkFromDestNode(link);
     delete link;
@@ -354,6 +368,189 @@ cTopology::Node *cTopology::getNodeFor(cModule *mod)
     return it == nodes.end() || (*it)->moduleId != mod->getId() ? nullptr : *it;
 }
 
+//---
+
+namespace {
+
+// Compact, index-based copy of the reversed graph (enabled nodes and links
+// only), so that the all-pairs shortest path algorithms can run on several
+// threads. It is built once per all-pairs calculation; the single-target
+// algorithms work on the nodes directly.
+struct ReverseGraph
+{
+    struct InLink {
+        int srcIndex;
+        int srcOutLinkIndex;  // index of the link among the out links of the source node
+        double weight;
+        cTopology::Link *link;
+    };
+
+    int numNodes;
+    std::vector<int> firstInLink;  // in links of node i: inLinks[firstInLink[i]..firstInLink[i+1]-1]
+    std::vector<InLink> inLinks;
+    std::vector<double> nodeWeights;
+};
+
+// Per-thread state of the shortest path algorithms. The priority queue of
+// Dijkstra is an indexed binary heap ordered by (distance, insertion order);
+// the latter keeps equal-distance nodes in FIFO order like a sorted list would.
+struct ShortestPathState
+{
+    std::vector<double> dist;
+    std::vector<int> via;  // index of the in link entry that starts the path, or -1
+    std::vector<int64_t> seq;
+    std::vector<int> heapPos;  // -1 if not in the heap
+    std::vector<int> heap;
+    std::deque<int> queue;
+    int64_t lastSeq = 0;
+
+    explicit ShortestPathState(int n) : dist(n), via(n), seq(n), heapPos(n, -1) {}
+
+    bool less(int a, int b) const {return dist[a] < dist[b] || (dist[a] == dist[b] && seq[a] < seq[b]);}
+
+    void siftUp(int i) {
+        int v = heap[i];
+        while (i > 0) {
+            int parent = (i - 1) / 2;
+            if (!less(v, heap[parent]))
+                break;
+            heap[i] = heap[parent];
+            heapPos[heap[i]] = i;
+            i = parent;
+        }
+        heap[i] = v;
+        heapPos[v] = i;
+    }
+
+    void siftDown(int i) {
+        int n = heap.size();
+        int v = heap[i];
+        while (true) {
+            int child = 2 * i + 1;
+            if (child >= n)
+                break;
+            if (child + 1 < n && less(heap[child + 1], heap[child]))
+                child++;
+            if (!less(heap[child], v))
+                break;
+            heap[i] = heap[child];
+            heapPos[heap[i]] = i;
+            i = child;
+        }
+        heap[i] = v;
+        heapPos[v] = i;
+    }
+
+    void pushOrDecrease(int v) {
+        seq[v] = ++lastSeq;
+        if (heapPos[v] == -1) {
+            heap.push_back(v);
+            siftUp(heap.size() - 1);
+        }
+        else {
+            siftUp(heapPos[v]);
+        }
+    }
+
+    int popMin() {
+        int v = heap[0];
+        heapPos[v] = -1;
+        int last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            siftDown(0);
+        }
+        return v;
+    }
+
+    void calculateUnweighted(const ReverseGraph& graph, int target);
+    void calculateWeighted(const ReverseGraph& graph, int target);
+};
+
+void ShortestPathState::calculateUnweighted(const ReverseGraph& graph, int target)
+{
+    std::fill(dist.begin(), dist.end(), INFINITY);
+    std::fill(via.begin(), via.end(), -1);
+    dist[target] = 0;
+
+    queue.push_back(target);
+    while (!queue.empty()) {
+        int v = queue.front();
+        queue.pop_front();
+
+        // for each w adjacent to v...
+        for (int i = graph.firstInLink[v]; i < graph.firstInLink[v+1]; i++) {
+            int w = graph.inLinks[i].srcIndex;
+            if (dist[w] == INFINITY) {
+                dist[w] = dist[v] + 1;
+                via[w] = i;
+                queue.push_back(w);
+            }
+        }
+    }
+}
+
+void ShortestPathState::calculateWeighted(const ReverseGraph& graph, int target)
+{
+    std::fill(dist.begin(), dist.end(), INFINITY);
+    std::fill(via.begin(), via.end(), -1);
+    dist[target] = 0;
+
+    pushOrDecrease(target);
+    while (!heap.empty()) {
+        int dest = popMin();
+        ASSERT(dest == target || graph.nodeWeights[dest] >= 0.0);  // every node is a target, including disabled ones
+
+        // for each src adjacent to dest...
+        for (int i = graph.firstInLink[dest]; i < graph.firstInLink[dest+1]; i++) {
+            const ReverseGraph::InLink& inLink = graph.inLinks[i];
+            int src = inLink.srcIndex;
+            ASSERT(inLink.weight > 0.0);
+            double newdist = dist[dest] + inLink.weight;
+            if (dest != target)
+                newdist += graph.nodeWeights[dest];  // dest is not the target, uses weight of dest node as price of routing (infinity means dest node doesn't route between interfaces)
+            if (newdist != INFINITY && dist[src] > newdist) {  // it's a valid shorter path from src to target node
+                dist[src] = newdist;
+                via[src] = i;
+                pushOrDecrease(src);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+static void buildReverseGraph(const std::vector<cTopology::Node *>& nodes, ReverseGraph& graph)
+{
+    int n = nodes.size();
+    std::unordered_map<cTopology::Node *, int> nodeIndices;
+    std::unordered_map<cTopology::Link *, int> outLinkIndices;  // index of each link among the out links of its source node
+    for (int i = 0; i < n; i++) {
+        nodeIndices[nodes[i]] = i;
+        for (int j = 0; j < nodes[i]->getNumOutLinks(); j++)
+            outLinkIndices[nodes[i]->getLinkOut(j)] = j;
+    }
+
+    graph.numNodes = n;
+    graph.firstInLink.resize(n + 1);
+    graph.nodeWeights.resize(n);
+    graph.inLinks.clear();
+    for (int i = 0; i < n; i++) {
+        cTopology::Node *dest = nodes[i];
+        graph.firstInLink[i] = graph.inLinks.size();
+        graph.nodeWeights[i] = dest->getWeight();
+        for (int j = 0; j < dest->getNumInLinks(); j++) {
+            cTopology::LinkIn *link = dest->getLinkIn(j);
+            cTopology::Node *src = link->getRemoteNode();
+            if (!link->isEnabled() || !src->isEnabled())
+                continue;
+            graph.inLinks.push_back(ReverseGraph::InLink {nodeIndices[src], outLinkIndices[link], link->getWeight(), link});
+        }
+    }
+    graph.firstInLink[n] = graph.inLinks.size();
+}
+
 void cTopology::calculateUnweightedSingleShortestPathsTo(Node *_target)
 {
     // multiple paths not supported :-(
@@ -408,13 +605,21 @@ void cTopology::calculateWeightedSingleShortestPathsTo(Node *_target)
 
     target->dist = 0;
 
-    std::list<Node *> q;
+    // priority queue ordered by (distance, insertion order), so that nodes of
+    // equal distance are processed in FIFO order; when a node gets a shorter
+    // path, its old entry stays in the queue, and is skipped when popped
+    typedef std::tuple<double, int64_t, Node *> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> q;
+    int64_t lastSeq = 0;
 
-    q.push_back(target);
+    q.push(Entry(0, lastSeq, target));
 
     while (!q.empty()) {
-        Node *dest = q.front();
-        q.pop_front();
+        double dist = std::get<0>(q.top());
+        Node *dest = std::get<2>(q.top());
+        q.pop();
+        if (dist > dest->dist)
+            continue;
 
         ASSERT(dest->getWeight() >= 0.0);
 
@@ -434,20 +639,118 @@ void cTopology::calculateWeightedSingleShortestPathsTo(Node *_target)
             if (dest != target)
                 newdist += dest->getWeight();  // dest is not the target, uses weight of dest node as price of routing (infinity means dest node doesn't route between interfaces)
             if (newdist != INFINITY && src->dist > newdist) {  // it's a valid shorter path from src to target node
-                if (src->dist != INFINITY)
-                    q.remove(src);  // src is in the queue
                 src->dist = newdist;
                 src->outPath = dest->inLinks[i];
+                q.push(Entry(newdist, ++lastSeq, src));
+            }
+        }
+    }
+}
+
+int cTopology::findNodeIndex(Node *node) const
+{
+    // binary search because nodes[] is ordered by module ID (nodes without module ID are at the end)
+    auto it = std::lower_bound(nodes.begin(), nodes.end(), node, lessByModuleId);
+    for ( ; it != nodes.end() && (*it)->moduleId == node->moduleId; ++it)
+        if (*it == node)
+            return it - nodes.begin();
+    throw cRuntimeError(this, "Node is not part of the graph");
+}
+
+void cTopology::calculateUnweightedAllPairsShortestPaths(bool storeDistances, int numThreads)
+{
+    calculateAllPairsShortestPaths(false, storeDistances, numThreads);
+}
+
+void cTopology::calculateWeightedAllPairsShortestPaths(bool storeDistances, int numThreads)
+{
+    calculateAllPairsShortestPaths(true, storeDistances, numThreads);
+}
+
+void cTopology::calculateAllPairsShortestPaths(bool weighted, bool storeDistances, int numThreads)
+{
+    int n = nodes.size();
+    ReverseGraph graph;
+    buildReverseGraph(nodes, graph);
 
-                // insert src node to ordered list
-                std::list<Node *>::iterator it;
-                for (it = q.begin(); it != q.end(); ++it)
-                    if ((*it)->dist > newdist)
-                        break;
+    numAllPairsNodes = n;
+    nextHopTable.assign((size_t)n * n, -1);
+    distanceTable.clear();
+    if (storeDistances)
+        distanceTable.assign((size_t)n * n, INFINITY);
 
-                q.insert(it, src);
+    // targets are handed out in chunks, so that threads write into different cache lines of the tables
+    const int CHUNK_SIZE = 16;
+    std::atomic<int> nextTarget(0);
+    auto calculate = [&]() {
+        ShortestPathState state(n);
+        int chunkStart;
+        while ((chunkStart = nextTarget.fetch_add(CHUNK_SIZE)) < n) {
+            int chunkEnd = std::min(chunkStart + CHUNK_SIZE, n);
+            for (int t = chunkStart; t < chunkEnd; t++) {
+                if (weighted)
+                    state.calculateWeighted(graph, t);
+                else
+                    state.calculateUnweighted(graph, t);
+                for (int i = 0; i < n; i++) {
+                    int via = state.via[i];
+                    nextHopTable[(size_t)i * n + t] = via == -1 ? -1 : graph.inLinks[via].srcOutLinkIndex;
+                    if (storeDistances)
+                        distanceTable[(size_t)i * n + t] = state.dist[i];
+                }
             }
         }
+    };
+
+    if (numThreads <= 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, (n + CHUNK_SIZE - 1) / CHUNK_SIZE);
+    if (numThreads <= 1)
+        calculate();
+    else {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; i++)
+            threads.push_back(std::thread(calculate));
+        for (auto& thread : threads)
+            thread.join();
+    }
+}
+
+int cTopology::getNextHopIndex(int nodeIndex, int targetIndex) const
+{
+    if (nodeIndex < 0 || nodeIndex >= numAllPairsNodes || targetIndex < 0 || targetIndex >= numAllPairsNodes)
+        throw cRuntimeError(this, "getNextHopIndex(): Invalid node index, or no all-pairs shortest paths calculated");
+    return nextHopTable[(size_t)nodeIndex * numAllPairsNodes + targetIndex];
+}
+
+cTopology::LinkOut *cTopology::getNextHop(Node *node, Node *target)
+{
+    int linkIndex = getNextHopIndex(findNodeIndex(node), findNodeIndex(target));
+    return linkIndex == -1 ? nullptr : node->getLinkOut(linkIndex);
+}
+
+double cTopology::getDistance(Node *node, Node *target)
+{
+    if (distanceTable.empty())
+        throw cRuntimeError(this, "getDistance(): No distances stored by the all-pairs shortest path calculation");
+    int nodeIndex = findNodeIndex(node);
+    int targetIndex = findNodeIndex(target);
+    getNextHopIndex(nodeIndex, targetIndex);  // check indices
+    return distanceTable[(size_t)nodeIndex * numAllPairsNodes + targetIndex];
+}
+
+void cTopology::selectShortestPathsTo(Node *_target)
+{
+    if (!_target)
+        throw cRuntimeError(this, "selectShortestPathsTo(): Target node is nullptr");
+    if (distanceTable.empty())
+        throw cRuntimeError(this, "selectShortestPathsTo(): No distances stored by the all-pairs shortest path calculation");
+    int targetIndex = findNodeIndex(_target);
+    target = _target;
+    for (int i = 0; i < (int)nodes.size(); i++) {
+        int linkIndex = getNextHopIndex(i, targetIndex);
+        nodes[i]->dist = distanceTable[(size_t)i * numAllPairsNodes + targetIndex];
+        nodes[i]->outPath = linkIndex == -1 ? nullptr : nodes[i]->outLinks[linkIndex];
     }
 }
 
@@ -96,6 +96,7 @@ void cXMLParImpl::setExpression(cExpression *e)
 {
     deleteOld();
     expr = e;
+    compileIfVolatile(expr);
     flags |= FL_ISEXPR | FL_CONTAINSVALUE | FL_ISSET;
 }
 
@@ -14,11 +14,17 @@
 *--------------------------------------------------------------*/
 
 #include <climits>
+#include <cstring>
 #include "omnetpp/csimulation.h"
 #include "omnetpp/ccomponent.h"
+#include "omnetpp/cclassdescriptor.h"
 #include "expressionfilter.h"
 #include "common/stringpool.h"
 
+#ifdef WITH_PARSIM
+#include "omnetpp/ccommbuffer.h"
+#endif
+
 using namespace omnetpp::common;
 
 namespace omnetpp {
@@ -56,6 +62,51 @@ std::string SignalSource::str() const
 
 //---
 
+ExpressionFilter::ExprValue ExpressionFilter::FieldReader::read(const ExprValue& object, const std::string& fieldName, int index, bool withIndex) const
+{
+    if (object.getType() == ExprValue::UNDEF)
+        return object;
+    if (object.getType() != ExprValue::OBJECT)
+        throw cRuntimeError("Cannot access field '%s': Value %s is not an object", fieldName.c_str(), object.str().c_str());
+    cObject *obj = object.objectValue();
+    if (obj == nullptr)
+        throw cRuntimeError("Cannot access field '%s' of nullptr", fieldName.c_str());
+
+    // look up the field once per object class
+    const std::type_info& type = typeid(*obj);
+    if (lastType == nullptr || *lastType != type) {
+        desc = obj->getDescriptor();
+        fieldIndex = desc ? desc->findField(fieldName.c_str()) : -1;
+        if (fieldIndex == -1)
+            throw cRuntimeError("Cannot access field '%s': Class '%s' has no such field", fieldName.c_str(), obj->getClassName());
+        flags = desc->getFieldTypeFlags(fieldIndex);
+        if (((flags & cClassDescriptor::FD_ISARRAY) != 0) != withIndex)
+            throw cRuntimeError(withIndex ? "Cannot access field '%s' of class '%s' with index: It is not an array" :
+                    "Cannot access field '%s' of class '%s': It is an array, index expected", fieldName.c_str(), obj->getClassName());
+        const char *typeString = desc->getFieldTypeString(fieldIndex);
+        isBool = typeString && strcmp(typeString, "bool") == 0;
+        const char *unitProperty = desc->getFieldProperty(fieldIndex, "unit");
+        unit = unitProperty ? ExprValue::getPooled(unitProperty) : nullptr;
+        lastType = &type;
+    }
+
+    if (withIndex && (index < 0 || index >= desc->getFieldArraySize(obj, fieldIndex)))
+        throw cRuntimeError("Cannot access field '%s[%d]' of class '%s': Index out of bounds", fieldName.c_str(), index, obj->getClassName());
+
+    if (flags & cClassDescriptor::FD_ISINTEGRAL)
+        return ExprValue(desc->getFieldValueAsInt(obj, fieldIndex, index), unit);
+    else if (flags & cClassDescriptor::FD_ISFLOATINGPOINT)
+        return ExprValue(desc->getFieldValueAsDouble(obj, fieldIndex, index), unit);
+    else if (flags & (cClassDescriptor::FD_ISCOBJECT | cClassDescriptor::FD_ISCOWNEDOBJECT))
+        return ExprValue((cObject *)desc->getFieldStructValuePointer(obj, fieldIndex, index));
+    else if (isBool)
+        return ExprValue(desc->getFieldValueAsString(obj, fieldIndex, index) == "true");
+    else
+        return ExprValue(desc->getFieldValueAsString(obj, fieldIndex, index));
+}
+
+//---
+
 ExpressionFilter::FilterInput *ExpressionFilter::find(cResultFilter *prevFilter)
 {
     if (numInputs == 1)
@@ -165,4 +216,89 @@ int ExpressionFilter::addInput(const SignalSource& source, FilterInputNode *filt
     return index;
 }
 
+#ifdef WITH_PARSIM
+static void packValue(cCommBuffer *buffer, const ExpressionFilter::ExprValue& value)
+{
+    typedef ExpressionFilter::ExprValue ExprValue;
+    ExprValue::Type type = value.getType();
+    if (type == ExprValue::OBJECT)
+        type = ExprValue::UNDEF; // objects cannot be saved; the value becomes undefined
+    buffer->pack((char)type);
+    const char *unit = value.getUnit();
+    switch (type) {
+        case ExprValue::UNDEF: break;
+        case ExprValue::BOOL: buffer->pack(value.boolValue()); break;
+        case ExprValue::INT: buffer->pack(value.intValue()); buffer->pack(unit ? unit : ""); break;
+        case ExprValue::DOUBLE: buffer->pack(value.doubleValue()); buffer->pack(unit ? unit : ""); break;
+        case ExprValue::STRING: buffer->pack(value.stringValue()); break;
+        case ExprValue::OBJECT: break;
+    }
+}
+
+static ExpressionFilter::ExprValue unpackValue(cCommBuffer *buffer, const char *(*getPooled)(const char *))
+{
+    typedef ExpressionFilter::ExprValue ExprValue;
+    char type;
+    buffer->unpack(type);
+    switch (type) {
+        case ExprValue::BOOL: {
+            bool b;
+            buffer->unpack(b);
+            return ExprValue(b);
+        }
+        case ExprValue::INT: {
+            intval_t l;
+            opp_string unit;
+            buffer->unpack(l);
+            buffer->unpack(unit);
+            return unit.empty() ? ExprValue(l) : ExprValue(l, getPooled(unit.c_str()));
+        }
+        case ExprValue::DOUBLE: {
+            double d;
+            opp_string unit;
+            buffer->unpack(d);
+            buffer->unpack(unit);
+            return unit.empty() ? ExprValue(d) : ExprValue(d, getPooled(unit.c_str()));
+        }
+        case ExprValue::STRING: {
+            opp_string str;
+            buffer->unpack(str);
+            return ExprValue(str.c_str());
+        }
+        default:
+            return ExprValue();
+    }
+}
+#endif
+
+void ExpressionFilter::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(numInputs);
+    for (int i = 0; i < numInputs; i++)
+        packValue(buffer, numInputs == 1 ? soleInput.lastValue : inputs[i].lastValue);
+    packValue(buffer, lastOutput);
+    buffer->pack(lastTimestamp);
+#endif
+}
+
+void ExpressionFilter::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    int n;
+    buffer->unpack(n);
+    if (n != numInputs)
+        throw cRuntimeError("ExpressionFilter '%s': Number of inputs does not match the saved state", expr.str().c_str());
+    for (int i = 0; i < numInputs; i++)
+        (numInputs == 1 ? soleInput.lastValue : inputs[i].lastValue) = unpackValue(buffer, &getPooled);
+    lastOutput = unpackValue(buffer, &getPooled);
+    buffer->unpack(lastTimestamp);
+#endif
+}
+
+
 }  // namespace omnetpp
@@ -17,6 +17,7 @@
 #ifndef __OMNETPP_EXPRESSIONFILTER_H
 #define __OMNETPP_EXPRESSIONFILTER_H
 
+#include <typeinfo>
 #include "common/expression.h"
 #include "common/exprnodes.h"
 #include "omnetpp/simkerneldefs.h"
@@ -25,6 +26,8 @@
 
 namespace omnetpp {
 
+class cClassDescriptor;
+
 struct SIM_API SignalSource
 {
   public:
@@ -84,6 +87,47 @@ class SIM_API ExpressionFilter : public cResultFilter
             SignalSource& get() {return value;}
         };
 
+        /**
+         * Reads a field of the object the child expression evaluates to, e.g.
+         * "packetReceived.byteLength". The field is looked up via the class
+         * descriptor once per object class, and numeric fields are read via
+         * the typed accessors of the descriptor.
+         */
+        class SIM_API FieldReader
+        {
+          private:
+            mutable const std::type_info *lastType = nullptr;
+            mutable cClassDescriptor *desc = nullptr;
+            mutable int fieldIndex = -1;
+            mutable unsigned int flags = 0;
+            mutable bool isBool = false;
+            mutable const char *unit = nullptr;
+          public:
+            ExprValue read(const ExprValue& object, const std::string& fieldName, int index, bool withIndex) const;
+        };
+
+        class SIM_API FieldNode : public common::expression::MemberNode
+        {
+          private:
+            FieldReader reader;
+          protected:
+            virtual ExprValue getValue(Context *context, const ExprValue& object) const override {return reader.read(object, name, 0, false);}
+          public:
+            FieldNode(const char *name) : MemberNode(name) {}
+            virtual FieldNode *dup() const override {return new FieldNode(name.c_str());}
+        };
+
+        class SIM_API IndexedFieldNode : public common::expression::IndexedMemberNode
+        {
+          private:
+            FieldReader reader;
+          protected:
+            virtual ExprValue getValue(Context *context, const ExprValue& object, intval_t index) const override {return reader.read(object, name, index, true);}
+          public:
+            IndexedFieldNode(const char *name) : IndexedMemberNode(name) {}
+            virtual IndexedFieldNode *dup() const override {return new IndexedFieldNode(name.c_str());}
+        };
+
     protected:
         Expression expr;
 
@@ -135,6 +179,8 @@ class SIM_API ExpressionFilter : public cResultFilter
         SignalSource getInputSource(int k) const {ASSERT(k>=0 && k<numInputs); return numInputs==1 ? soleInput.source : inputs[k].source;}
         ExprValue getLastValue() const {return lastOutput;}
         simtime_t getLastTimestamp() const {return lastTimestamp;}
+        virtual void parsimPack(cCommBuffer *buffer) const override;
+        virtual void parsimUnpack(cCommBuffer *buffer) override;
 };
 
 }  // namespace omnetpp
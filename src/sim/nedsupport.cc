@@ -15,6 +15,7 @@
   `license' for details on this and other legal matters.
 *--------------------------------------------------------------*/
 
+#include <memory>
 #include "common/stringutil.h"
 #include "omnetpp/cdynamicexpression.h"
 #include "omnetpp/cxmlelement.h"
@@ -74,10 +75,9 @@ ExprValue makeExprValue(const cPar& par)
     Assert(false);
 }
 
-cValue *makeNedValues(cValue *&buffer, const ExprValue argv[], int argc)
+cValue *makeNedValues(const ExprValue argv[], int argc)
 {
-    if (!buffer)
-        buffer = new cValue[argc];
+    cValue *buffer = new cValue[argc];
     for (int i = 0; i < argc; i++)
         buffer[i] = makeNedValue(argv[i]);
     return buffer;
@@ -85,31 +85,20 @@ cValue *makeNedValues(cValue *&buffer, const ExprValue argv[], int argc)
 
 //----
 
-std::string NedFunctionNode::getName() const
+NedFunctionNode::NedFunctionNode(cNedFunction *f) : FunctionNode(f->getName()), nedFunction(f)
 {
-    return nedFunction->getName();
 }
 
-std::string NedFunctionNode::makeErrorMessage(std::exception& e) const
-{
-    return getName() + "(): " + e.what();
-}
-
-ExprValue NedFunctionNode::evaluate(Context *context_) const
+ExprValue NedFunctionNode::compute(Context *context_, ExprValue argv[], int argc) const
 {
     cExpression::Context *context = dynamic_cast<cExpression::Context*>(context_->simContext);
     ASSERT(context != nullptr);
-    int argc = children.size();
-    std::unique_ptr<cValue[]> argv(new cValue[argc]);
-    int i = 0;
-    for (ExprNode *child : children)
-        argv[i++] = makeNedValue(child->tryEvaluate(context_));
-    return makeExprValue(nedFunction->invoke(context, argv.get(), argc));
-}
-
-void NedFunctionNode::print(std::ostream& out, int spaciousness) const
-{
-    printFunction(out, spaciousness);
+    cValue localValues[MAX_LOCAL_ARGS];
+    std::unique_ptr<cValue[]> heapValues(argc > MAX_LOCAL_ARGS ? new cValue[argc] : nullptr);
+    cValue *values = heapValues ? heapValues.get() : localValues;
+    for (int i = 0; i < argc; i++)
+        values[i] = makeNedValue(argv[i]);
+    return makeExprValue(nedFunction->invoke(context, values, argc));
 }
 
 //----
@@ -172,6 +161,25 @@ void Typename::print(std::ostream& out, int spaciousness) const
 
 //----
 
+int ParamIndexCache::findPar(cComponent *component, const std::string& paramName) const
+{
+    int k = index.load(std::memory_order_relaxed);
+    if (k >= 0 && k < component->getNumParams() && component->par(k).isName(paramName.c_str()))
+        return k;
+    k = component->findPar(paramName.c_str());
+    if (k >= 0)
+        index.store(k, std::memory_order_relaxed);
+    return k;
+}
+
+cPar& ParamIndexCache::par(cComponent *component, const std::string& paramName) const
+{
+    int k = findPar(component, paramName);
+    return k >= 0 ? component->par(k) : component->par(paramName.c_str()); // the latter throws
+}
+
+//----
+
 ExprValue ParameterRef::evaluate(Context *context_) const
 {
     cExpression::Context *context = dynamic_cast<cExpression::Context*>(context_->simContext);
@@ -181,7 +189,7 @@ ExprValue ParameterRef::evaluate(Context *context_) const
     if (ofThis) {
         // note: same code to do for both inSubcomponentScope=true and =false
         cComponent *component = context->component;
-        return makeExprValue(component->par(paramName.c_str()));
+        return makeExprValue(paramIndex.par(component, paramName));
     }
     else {
         cComponent *component = inSubcomponentScope ? context->component->getParentModule() : context->component;
@@ -189,10 +197,13 @@ ExprValue ParameterRef::evaluate(Context *context_) const
             throw cRuntimeError(context->component, E_ENOPARENT);
         // In inner types, a "paramName" should be first tried as the enclosing type's
         // parameter, only then as local parameter.
-        if (!inSubcomponentScope && component->getComponentType()->isInnerType())
-            if (component->getParentModule() && component->getParentModule()->hasPar(paramName.c_str()))
-                return makeExprValue(component->getParentModule()->par(paramName.c_str()));
-        return makeExprValue(component->par(paramName.c_str()));
+        if (!inSubcomponentScope && component->getComponentType()->isInnerType()) {
+            cModule *parent = component->getParentModule();
+            int k = parent ? outerParamIndex.findPar(parent, paramName) : -1;
+            if (k >= 0)
+                return makeExprValue(parent->par(k));
+        }
+        return makeExprValue(paramIndex.par(component, paramName));
     }
 }
 
@@ -215,7 +226,7 @@ ExprValue SubmoduleParameterRef::evaluate(Context *context_) const
     cModule *submodule = compoundModule->getSubmodule(submoduleName.c_str());
     if (!submodule)
         throw cRuntimeError("'%s': Submodule '%s' not found", getName().c_str(), submoduleName.c_str());
-    return makeExprValue(submodule->par(paramName.c_str()));
+    return makeExprValue(paramIndex.par(submodule, paramName));
 }
 
 void SubmoduleParameterRef::print(std::ostream& out, int spaciousness) const
@@ -251,7 +262,7 @@ ExprValue IndexedSubmoduleParameterRef::evaluate(Context *context_) const
     cModule *submodule = compoundModule->getSubmodule(submoduleName.c_str(), index);
     if (!submodule)
         throw cRuntimeError("'%s': Submodule '%s[%d]' not found", getName().c_str(), submoduleName.c_str(), index);
-    return makeExprValue(submodule->par(paramName.c_str())); //TODO make a copy here??? (and similar places)
+    return makeExprValue(paramIndex.par(submodule, paramName)); //TODO make a copy here??? (and similar places)
 }
 
 void IndexedSubmoduleParameterRef::print(std::ostream& out, int spaciousness) const
@@ -263,9 +274,9 @@ void IndexedSubmoduleParameterRef::print(std::ostream& out, int spaciousness) co
 
 //----
 
-const char *LoopVar::varNames[32];
-long LoopVar::vars[32];
-int LoopVar::varCount = 0;
+thread_local const char *LoopVar::varNames[32];
+thread_local long LoopVar::vars[32];
+thread_local int LoopVar::varCount = 0;
 
 long& LoopVar::pushVar(const char *varName)
 {
@@ -16,6 +16,7 @@
 #ifndef __OMNETPP_NEDSUPPORT_H
 #define __OMNETPP_NEDSUPPORT_H
 
+#include <atomic>
 #include "omnetpp/simkerneldefs.h"
 #include "common/expression.h"
 #include "common/exprnodes.h"
@@ -35,7 +36,7 @@ using omnetpp::common::expression::Context;
 cValue makeNedValue(const ExprValue& value);
 ExprValue makeExprValue(const cValue& value);
 ExprValue makeExprValue(const cPar& par);
-cValue *makeNedValues(cValue *&buffer, const ExprValue argv[], int argc);
+cValue *makeNedValues(const ExprValue argv[], int argc); // returns a new[]'d array
 
 class NedExpressionContext : public cExpression::Context
 {
@@ -47,19 +48,16 @@ class NedExpressionContext : public cExpression::Context
     const char *computedTypename;
 };
 
-class NedFunctionNode : public NaryNode
+class NedFunctionNode : public FunctionNode
 {
   private:
     cNedFunction *nedFunction;
   protected:
-    virtual ExprValue evaluate(Context *context) const override;
-    virtual void print(std::ostream& out, int spaciousness) const override;
-    virtual std::string makeErrorMessage(std::exception& e) const override;
+    virtual ExprValue compute(Context *context, ExprValue argv[], int argc) const override;
+    virtual bool acceptsUndefinedArgs() const override {return true;} // argument checking is done by cNedFunction
   public:
-    NedFunctionNode(cNedFunction *f) : nedFunction(f) {}
+    NedFunctionNode(cNedFunction *f);
     NedFunctionNode *dup() const override {return new NedFunctionNode(nedFunction);}
-    virtual Precedence getPrecedence() const override {return ELEM;}
-    virtual std::string getName() const override;
 };
 
 class ModuleIndex : public LeafNode
@@ -97,6 +95,22 @@ class Typename : public LeafNode
     virtual std::string getName() const override {return "typename";}
 };
 
+/**
+ * @brief Looks up a parameter by name, and remembers its index for the next lookup.
+ *
+ * An expression tree is shared by all components of the NED type, and their
+ * parameters are in the same order, so the remembered index is usually right.
+ * It is verified by name before use.
+ */
+class ParamIndexCache
+{
+  private:
+    mutable std::atomic<int> index{-1};  // atomic because of parallel event execution
+  public:
+    int findPar(cComponent *component, const std::string& paramName) const;
+    cPar& par(cComponent *component, const std::string& paramName) const;
+};
+
 /**
  * @brief Parameter reference, ident and this.ident forms
  */
@@ -106,6 +120,8 @@ class ParameterRef : public LeafNode
     std::string paramName;
     bool inSubcomponentScope;  // if true, operate on context module's parent
     bool ofThis; // if true, "this.ident" form
+    ParamIndexCache paramIndex;
+    ParamIndexCache outerParamIndex;  // in inner types
   protected:
     virtual ExprValue evaluate(Context *context) const override;
     virtual void print(std::ostream& out, int spaciousness) const override;
@@ -125,6 +141,7 @@ class SubmoduleParameterRef : public LeafNode
     std::string submoduleName;
     std::string paramName;
     bool inSubcomponentScope;  // if true, operate on context module's parent
+    ParamIndexCache paramIndex;
   protected:
     virtual ExprValue evaluate(Context *context) const override;
     virtual void print(std::ostream& out, int spaciousness) const override;
@@ -144,6 +161,7 @@ class IndexedSubmoduleParameterRef : public UnaryNode
     std::string submoduleName;
     std::string paramName;
     bool inSubcomponentScope;  // if true, operate on context module's parent
+    ParamIndexCache paramIndex;
   protected:
     virtual ExprValue evaluate(Context *context) const override;
     virtual void print(std::ostream& out, int spaciousness) const override;
@@ -160,10 +178,10 @@ class IndexedSubmoduleParameterRef : public UnaryNode
 class LoopVar : public LeafNode
 {
   private:
-    // the loopvar stack (vars of nested loops are pushed on the stack by cNedNetworkBuilder)
-    static const char *varNames[32];
-    static long vars[32];
-    static int varCount;
+    // the loopvar stack (vars of nested loops are pushed on the stack by cNedNetworkBuilder); per thread
+    static thread_local const char *varNames[32];
+    static thread_local long vars[32];
+    static thread_local int varCount;
   public:
     static long& pushVar(const char *varName);
     static void popVar();
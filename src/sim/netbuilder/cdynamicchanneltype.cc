@@ -28,6 +28,7 @@ namespace omnetpp {
 
 cDynamicChannelType::cDynamicChannelType(const char *name) : cChannelType(name)
 {
+    innerType = getDecl()->isInnerType();
 }
 
 cNedDeclaration *cDynamicChannelType::getDecl() const
@@ -57,23 +58,27 @@ cChannel *cDynamicChannelType::createChannelObject()
 
 void cDynamicChannelType::addParametersTo(cChannel *channel)
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedDeclaration *decl = getDecl();
     cNedNetworkBuilder().addParametersAndGatesTo(channel, decl);  // adds only parameters, because channels have no gates
 }
 
 void cDynamicChannelType::applyPatternAssignments(cComponent *component)
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedNetworkBuilder().assignParametersFromPatterns(component);
 }
 
 cProperties *cDynamicChannelType::getProperties() const
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedDeclaration *decl = getDecl();
     return decl->getProperties();
 }
 
 cProperties *cDynamicChannelType::getParamProperties(const char *paramName) const
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedDeclaration *decl = getDecl();
     return decl->getParamProperties(paramName);
 }
@@ -119,8 +124,7 @@ const char *cDynamicChannelType::getSourceFileName() const
 
 bool cDynamicChannelType::isInnerType() const
 {
-    cNedDeclaration *decl = getDecl();
-    return decl->isInnerType();
+    return innerType;
 }
 
 }  // namespace omnetpp
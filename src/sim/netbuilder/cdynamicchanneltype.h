@@ -30,6 +30,9 @@ namespace omnetpp {
  */
 class SIM_API cDynamicChannelType : public cChannelType
 {
+  private:
+    bool innerType;  // cached, because it is needed at every evaluation of parameter references
+
   protected:
     /** Redefined from cChannelType */
     virtual cChannel *createChannelObject() override;
@@ -28,6 +28,7 @@ namespace omnetpp {
 
 cDynamicModuleType::cDynamicModuleType(const char *name) : cModuleType(name)
 {
+    innerType = getDecl()->isInnerType();
 }
 
 cNedDeclaration *cDynamicModuleType::getDecl() const
@@ -68,53 +69,62 @@ cModule *cDynamicModuleType::createModuleObject()
 
 void cDynamicModuleType::addParametersAndGatesTo(cModule *module)
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedDeclaration *decl = getDecl();
     cNedNetworkBuilder().addParametersAndGatesTo(module, decl);
 }
 
 void cDynamicModuleType::applyPatternAssignments(cComponent *component)
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedNetworkBuilder().assignParametersFromPatterns(component);
 }
 
 void cDynamicModuleType::setupGateVectors(cModule *module)
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedDeclaration *decl = getDecl();
     cNedNetworkBuilder().setupGateVectors(module, decl);
 }
 
 void cDynamicModuleType::buildInside(cModule *module)
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedDeclaration *decl = getDecl();
     cNedNetworkBuilder().buildInside(module, decl);
 }
 
 cProperties *cDynamicModuleType::getProperties() const
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedDeclaration *decl = getDecl();
     return decl->getProperties();
 }
 
 cProperties *cDynamicModuleType::getParamProperties(const char *paramName) const
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedDeclaration *decl = getDecl();
     return decl->getParamProperties(paramName);
 }
 
 cProperties *cDynamicModuleType::getGateProperties(const char *gateName) const
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedDeclaration *decl = getDecl();
     return decl->getGateProperties(gateName);
 }
 
 cProperties *cDynamicModuleType::getSubmoduleProperties(const char *submoduleName, const char *submoduleType) const
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedDeclaration *decl = getDecl();
     return decl->getSubmoduleProperties(submoduleName, submoduleType);
 }
 
 cProperties *cDynamicModuleType::getConnectionProperties(int connectionId, const char *channelType) const
 {
+    std::lock_guard<std::recursive_mutex> lock(sharedStateMutex);
     cNedDeclaration *decl = getDecl();
     return decl->getConnectionProperties(connectionId, channelType);
 }
@@ -145,8 +155,7 @@ const char *cDynamicModuleType::getSourceFileName() const
 
 bool cDynamicModuleType::isInnerType() const
 {
-    cNedDeclaration *decl = getDecl();
-    return decl->isInnerType();
+    return innerType;
 }
 
 }  // namespace omnetpp
@@ -30,6 +30,9 @@ namespace omnetpp {
  */
 class SIM_API cDynamicModuleType : public cModuleType
 {
+  private:
+    bool innerType;  // cached, because it is needed at every evaluation of parameter references
+
   protected:
     /** Redefined from cModuleType */
     virtual cModule *createModuleObject() override;
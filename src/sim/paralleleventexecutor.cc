@@ -0,0 +1,600 @@
+//=========================================================================
+//  PARALLELEVENTEXECUTOR.CC - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include <typeinfo>
+#include <algorithm>
+#include "omnetpp/csimulation.h"
+#include "omnetpp/csimplemodule.h"
+#include "omnetpp/cmessage.h"
+#include "omnetpp/cscheduler.h"
+#include "omnetpp/ccontextswitcher.h"
+#include "omnetpp/cfutureeventset.h"
+#include "omnetpp/cfingerprint.h"
+#include "omnetpp/cdefaultowner.h"
+#include "omnetpp/coutvector.h"
+#include "omnetpp/cgate.h"
+#include "omnetpp/cenvir.h"
+#include "omnetpp/cexception.h"
+#include "omnetpp/simutil.h"
+#include "paralleleventexecutor.h"
+
+namespace omnetpp {
+
+thread_local ParallelEventExecutor::Entry *ParallelEventExecutor::currentEntry = nullptr;
+
+ParallelEventExecutor::ParallelEventExecutor(cSimulation *sim, int numThreads) : sim(sim), numThreads(numThreads)
+{
+    ASSERT(numThreads > 1);
+}
+
+ParallelEventExecutor::~ParallelEventExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        shuttingDown = true;
+    }
+    batchStarted.notify_all();
+    for (auto& thread : threads)
+        thread.join();
+}
+
+void ParallelEventExecutor::startThreads()
+{
+    // the calling (main) thread also takes part in executing batches
+    for (int i = 0; i < numThreads - 1; i++)
+        threads.push_back(std::thread(&ParallelEventExecutor::threadMain, this));
+}
+
+void ParallelEventExecutor::threadMain()
+{
+    // the active simulation is per thread
+    cSimulation::setActiveSimulation(sim);
+
+    uint64_t lastBatchSerial = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            batchStarted.wait(lock, [&] {return shuttingDown || batchSerial != lastBatchSerial;});
+            if (shuttingDown)
+                return;
+            lastBatchSerial = batchSerial;
+        }
+        cDefaultOwner::setOwnershipTracking(ownershipTracking);  // a per-thread setting
+        processEntries();
+        cOwnedObject::setDefaultOwner(&defaultList);  // the last module may be deleted before the next batch
+        bool done;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done = --numBusyWorkers == 0;
+        }
+        if (done)
+            batchDone.notify_all();
+    }
+}
+
+bool ParallelEventExecutor::canExecuteBatch()
+{
+    // Other schedulers may insert events between takeNextEvent() calls
+    // (real-time, parallel simulation), and event-by-event observers need
+    // to see each event separately.
+    cScheduler *scheduler = sim->getScheduler();
+    if (!scheduler || typeid(*scheduler) != typeid(cSequentialScheduler))
+        return false;
+    if (sim->getProfiler() != nullptr)
+        return false;
+    if (sim->getFingerprintCalculator() != nullptr && !sim->getFingerprintCalculator()->canCaptureEvents())
+        return false;
+    cEnvir *envir = sim->getEnvir();
+    return !envir->isGUI() && !envir->isLoggingEnabled();
+}
+
+bool ParallelEventExecutor::canExecuteInBatch(cMessage *msg)
+{
+    cModule *module = msg->getArrivalModule();
+    if (!module || !module->isSimple())
+        return false;
+    cSimpleModule *simpleModule = static_cast<cSimpleModule *>(module);
+    return simpleModule->isParallel() && !simpleModule->usesActivity() && simpleModule->initialized() &&
+           batchModules.find(module) == batchModules.end();
+}
+
+bool ParallelEventExecutor::collectBatch(cMessage *msg)
+{
+    if (!canExecuteInBatch(msg))
+        return false;
+
+    // collect the events that would be executed next by the sequential
+    // scheduler, as long as they are at the same time and priority
+    cFutureEventSet *fes = sim->fes;
+    simtime_t t = msg->getArrivalTime();
+    short priority = msg->getSchedulingPriority();
+    cEvent *event = msg;
+    while (true) {
+        cMessage *eventMsg = static_cast<cMessage *>(event);
+        cSimpleModule *module = static_cast<cSimpleModule *>(eventMsg->getArrivalModule());
+        batchModules.insert(module);
+        batch.emplace_back();
+        batch.back().msg = eventMsg;
+        batch.back().module = module;
+
+        event = fes->peekFirst();
+        while (event && event->getArrivalTime() == t && event->getSchedulingPriority() == priority && event->isStale()) {
+            delete fes->removeFirst();  // like cSequentialScheduler
+            event = fes->peekFirst();
+        }
+        if (!event || event->getArrivalTime() != t || event->getSchedulingPriority() != priority || !event->isMessage())
+            break;
+        if (!canExecuteInBatch(static_cast<cMessage *>(event)))
+            break;
+        fes->removeFirst();
+    }
+
+    if (batch.size() == 1) {
+        clearBatch();
+        return false;
+    }
+    return true;
+}
+
+void ParallelEventExecutor::clearBatch()
+{
+    for (Entry& entry : batch)
+        delete entry.fingerprintCapture;
+    batch.clear();
+    batchModules.clear();
+}
+
+bool ParallelEventExecutor::executeBatch(cMessage *msg)
+{
+    if (!canExecuteBatch() || !collectBatch(msg))
+        return false;
+
+    if (threads.empty())
+        startThreads();
+
+    // the same bookkeeping as in cSimulation::executeEvent(); the handlers
+    // may change or delete their messages, so it is done before they start
+    sim->setContextType(CTX_EVENT);
+    sim->currentSimtime = msg->getArrivalTime();
+    eventnumber_t firstEventNumber = sim->currentEventNumber + 1;
+    cFingerprintCalculator *fingerprint = sim->fingerprint;
+    try {
+        for (size_t i = 0; i < batch.size(); i++) {
+            Entry& entry = batch[i];
+            EVCB.simulationEvent(entry.msg);
+            entry.msg->setPreviousEventNumber(firstEventNumber + i);
+            if (fingerprint)
+                entry.fingerprintCapture = fingerprint->captureEvent(entry.msg);
+            entry.module->take(entry.msg);
+        }
+    }
+    catch (std::exception&) {
+        clearBatch();
+        throw;
+    }
+
+    // run the handlers
+    nextEntry = 0;
+    ownershipTracking = cDefaultOwner::getOwnershipTracking();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        numBusyWorkers = threads.size();
+        batchSerial++;
+        sim->parallelEventBatchActive = true;
+    }
+    batchStarted.notify_all();
+
+    processEntries();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        batchDone.wait(lock, [&] {return numBusyWorkers == 0;});
+        sim->parallelEventBatchActive = false;
+    }
+    restoreCancelledEvents();
+
+    // commit the events in their original order; after an error, the
+    // simulation stops, so the rest of the operations are discarded
+    size_t i = 0;
+    try {
+        for (; i < batch.size(); i++) {
+            sim->currentEventNumber = firstEventNumber + i;
+            commitEntry(batch[i]);
+        }
+    }
+    catch (std::exception& e) {
+        cSimpleModule *module = batch[i].module;
+        for (size_t j = i + 1; j < batch.size(); j++)
+            discardPendingOps(batch[j], 0);
+        clearBatch();
+
+        // the context of the error is the module, like in cSimulation::executeEvent()
+        sim->setContext(module);
+        if (cException *ce = dynamic_cast<cException *>(&e)) {
+            ce->storeContext();
+            sim->setGlobalContext();
+            throw;
+        }
+        cRuntimeError e2("%s: %s", opp_typename(typeid(e)), e.what());
+        sim->setGlobalContext();
+        throw e2;
+    }
+
+    sim->setGlobalContext();
+    clearBatch();
+    return true;
+}
+
+void ParallelEventExecutor::processEntries()
+{
+    size_t index;
+    while ((index = nextEntry++) < batch.size())
+        executeEntry(index);
+}
+
+void ParallelEventExecutor::executeEntry(size_t index)
+{
+    Entry& entry = batch[index];
+    currentEntry = &entry;
+
+    // objects created by the handler belong to the module, like in sequential execution
+    cOwnedObject::setDefaultOwner(entry.module);
+    try {
+        entry.module->handleMessage(entry.msg);
+    }
+    catch (...) {
+        entry.exception = std::current_exception();
+    }
+    cOwnedObject::setDefaultOwner(&defaultList);
+    currentEntry = nullptr;
+}
+
+void ParallelEventExecutor::restoreCancelledEvents()
+{
+    // The FES was not modified during the batch, so the saved heapIndex values
+    // are still valid. They must be put back before the first event is
+    // committed, because committing modifies the FES, which may move the
+    // cancelled messages and update their heapIndex.
+    for (Entry& entry : batch)
+        for (PendingOp& op : entry.pendingOps)
+            if (op.kind == PendingOp::CANCEL)
+                op.msg->heapIndex = op.heapIndex;
+}
+
+void ParallelEventExecutor::commitEntry(Entry& entry)
+{
+    // continue the event as if the handler was executing in sequential execution
+    if (entry.fingerprintCapture)
+        sim->fingerprint->addCapturedEvent(entry.fingerprintCapture);
+    sim->setContext(entry.module);
+    sim->liveMessageCount -= entry.numDeletedMessages;
+    commitPendingOps(entry);
+    if (entry.exception)
+        std::rethrow_exception(entry.exception);
+    sim->setGlobalContext();
+}
+
+void ParallelEventExecutor::commitPendingOps(Entry& entry)
+{
+    std::vector<PendingOp>& ops = entry.pendingOps;
+    std::vector<long> ids(ops.size(), -1);  // ids of the messages created, by op index
+    size_t i = 0;
+    try {
+        for (; i < ops.size(); i++) {
+            PendingOp& op = ops[i];
+            cMessage *msg = op.msg;
+            switch (op.kind) {
+                case PendingOp::CREATE:
+                    // same as in the cMessage constructors
+                    ids[i] = sim->nextMessageId++;
+                    sim->totalMessageCount++;
+                    if (!msg)
+                        break;  // already deleted
+                    sim->liveMessageCount++;
+                    msg->messageId = ids[i];
+                    if (msg->messageTreeId < 0)
+                        msg->messageTreeId = ids[-2 - msg->messageTreeId];  // (duplicate of) a message created earlier in this event
+                    if (op.original) {
+                        EVCB.messageCloned(op.original, msg);
+                        op.original->setPreviousEventNumber(sim->currentEventNumber);
+                    }
+                    else
+                        EVCB.messageCreated(msg);
+                    msg->setPreviousEventNumber(sim->currentEventNumber);
+                    break;
+
+                case PendingOp::SCHEDULE:
+                    // same as in cSimpleModule::scheduleAt()
+                    if (!msg)
+                        break;  // deleted by the handler
+                    msg->heapIndex = -1;
+                    EVCB.messageScheduled(msg);
+                    sim->insertEvent(msg);
+                    break;
+
+                case PendingOp::CANCEL:
+                    // same as in cSimpleModule::cancelEvent() and cancelAndDelete()
+                    sim->fes->remove(msg);
+                    EVCB.messageCancelled(msg);
+                    msg->setPreviousEventNumber(sim->currentEventNumber);
+                    if (op.deleteMessage)
+                        delete msg;
+                    break;
+
+                case PendingOp::SEND: {
+                    // same as in cSimpleModule::send()
+                    if (!msg)
+                        break;  // deleted by the handler
+                    msg->heapIndex = -1;
+                    const SendOptions& options = op.defaultOptions ? SendOptions::DEFAULT : op.options;
+                    EVCB.beginSend(msg, options);
+                    bool keepMsg = op.gate->deliver(msg, options, op.time);
+                    if (!keepMsg)
+                        delete msg;
+                    else
+                        EVCB.endSend(msg);
+                    break;
+                }
+
+                case PendingOp::SEND_DIRECT: {
+                    // same as in cSimpleModule::sendDirect()
+                    if (!msg)
+                        break;  // deleted by the handler
+                    msg->heapIndex = -1;
+                    EVCB.beginSend(msg, op.options);
+                    EVCB.messageSendDirect(msg, op.gate, op.result);
+                    bool keepMsg = op.gate->deliver(msg, op.options, op.time);
+                    if (!keepMsg)
+                        delete msg;
+                    else
+                        EVCB.endSend(msg);
+                    break;
+                }
+
+                case PendingOp::EMIT: {
+                    cSimpleModule *module = entry.module;
+                    switch (op.valueType) {
+                        case SIMSIGNAL_BOOL: module->emit(op.signalID, op.value.b); break;
+                        case SIMSIGNAL_INT: module->emit(op.signalID, op.value.i); break;
+                        case SIMSIGNAL_UINT: module->emit(op.signalID, op.value.u); break;
+                        case SIMSIGNAL_DOUBLE: module->emit(op.signalID, op.value.d); break;
+                        case SIMSIGNAL_SIMTIME: module->emit(op.signalID, op.time); break;
+                        case SIMSIGNAL_STRING: module->emit(op.signalID, op.stringValue.c_str()); break;
+                        default: ASSERT(false);
+                    }
+                    break;
+                }
+
+                case PendingOp::RECORD:
+                    op.vector->recordWithTimestamp(op.time, op.value.d);
+                    break;
+            }
+        }
+    }
+    catch (std::exception&) {
+        discardPendingOps(entry, i + 1);
+        throw;
+    }
+    ops.clear();
+}
+
+void ParallelEventExecutor::discardPendingOps(Entry& entry, size_t from)
+{
+    // messages are left with the module; created messages keep their
+    // temporary (negative) ids, and are not counted as live messages;
+    // cancelled messages are removed from the FES, as the handler expects
+    for (size_t i = from; i < entry.pendingOps.size(); i++) {
+        PendingOp& op = entry.pendingOps[i];
+        if (op.kind == PendingOp::CANCEL) {
+            sim->fes->remove(op.msg);
+            if (op.deleteMessage)
+                delete op.msg;
+        }
+        else if ((op.kind == PendingOp::SCHEDULE || op.kind == PendingOp::SEND || op.kind == PendingOp::SEND_DIRECT) && op.msg)
+            op.msg->heapIndex = -1;
+    }
+    entry.pendingOps.clear();
+}
+
+ParallelEventExecutor::Entry& ParallelEventExecutor::getCurrentEntry()
+{
+    ASSERT(currentEntry != nullptr);  // only the threads executing the handlers may call it
+    return *currentEntry;
+}
+
+ParallelEventExecutor::PendingOp& ParallelEventExecutor::addPendingOp(PendingOp::Kind kind, cMessage *msg)
+{
+    std::vector<PendingOp>& ops = getCurrentEntry().pendingOps;
+    ops.emplace_back(kind);
+    ops.back().msg = msg;
+    return ops.back();
+}
+
+void ParallelEventExecutor::checkNotPending(cMessage *msg, const char *what)
+{
+    // a message being scheduled or sent is still owned by the module, so the usual checks do not catch it
+    if (msg->heapIndex == PENDING_HEAP_INDEX)
+        throw cRuntimeError("%s: Message (%s)%s has already been scheduled or sent by this event",
+                            what, msg->getClassName(), msg->getName());
+}
+
+void ParallelEventExecutor::throwNotAllowed(const char *what)
+{
+    cSimpleModule *module = currentEntry ? currentEntry->module : nullptr;
+    throw cRuntimeError("%s is not allowed during parallel event execution (module '%s' has the @parallel "
+                        "property; see the parallel-event-threads configuration option)",
+                        what, module ? module->getFullPath().c_str() : "n/a");
+}
+
+void ParallelEventExecutor::checkContextSwitch(cComponent *component)
+{
+    if (component != nullptr && component != getCurrentEntry().module)
+        throwNotAllowed("Entering another component (e.g. via Enter_Method())");
+}
+
+void ParallelEventExecutor::deferMessageCreation(cMessage *msg, cMessage *original)
+{
+    // the temporary id refers to the op; duplicates of the message inherit it as tree id
+    Entry& entry = getCurrentEntry();
+    msg->messageId = -2 - (long)entry.pendingOps.size();
+    if (!original)
+        msg->messageTreeId = msg->messageId;
+    addPendingOp(PendingOp::CREATE, msg).original = original;
+}
+
+void ParallelEventExecutor::messageDeleted(cMessage *msg)
+{
+    // forget the message in the pending operations
+    Entry& entry = getCurrentEntry();
+    bool created = false;
+    for (PendingOp& op : entry.pendingOps) {
+        if (op.msg == msg && op.kind == PendingOp::CANCEL) {
+            // the message is still in the FES, and it cannot be removed while other handlers are running
+            // note: C++ forbids throwing in a destructor, and noexcept(false) is not workable
+            getEnvir()->alert(cRuntimeError(entry.module, "Fatal: Message (%s)%s was deleted after cancelEvent() during parallel event execution, "
+                    "use cancelAndDelete() instead; ABORTING", msg->getClassName(), msg->getName()).getFormattedMessage().c_str());
+            abort();
+        }
+        if (op.msg == msg) {
+            created = created || op.kind == PendingOp::CREATE;
+            op.msg = nullptr;
+        }
+        if (op.original == msg)
+            op.original = nullptr;
+    }
+    if (!created && !(msg->flags & cMessage::FL_ISPRIVATECOPY))
+        entry.numDeletedMessages++;
+}
+
+void ParallelEventExecutor::deferScheduling(cMessage *msg)
+{
+    checkNotPending(msg, "scheduleAt()");
+    msg->heapIndex = PENDING_HEAP_INDEX;  // isScheduled() returns true
+    addPendingOp(PendingOp::SCHEDULE, msg);
+}
+
+void ParallelEventExecutor::deferSending(cMessage *msg, cGate *outGate, const SendOptions& options, simtime_t t)
+{
+    checkNotPending(msg, "send()");
+    msg->heapIndex = PENDING_HEAP_INDEX;
+    PendingOp& op = addPendingOp(PendingOp::SEND, msg);
+    op.gate = outGate;
+    op.options = options;
+    op.defaultOptions = &options == &SendOptions::DEFAULT;
+    op.time = t;
+}
+
+void ParallelEventExecutor::deferSendingDirect(cMessage *msg, cGate *toGate, const SendOptions& options, const cChannel::Result& result, simtime_t t)
+{
+    checkNotPending(msg, "sendDirect()");
+    msg->heapIndex = PENDING_HEAP_INDEX;
+    PendingOp& op = addPendingOp(PendingOp::SEND_DIRECT, msg);
+    op.gate = toGate;
+    op.options = options;
+    op.result = result;
+    op.time = t;
+}
+
+void ParallelEventExecutor::cancelEvent(cMessage *msg)
+{
+    Entry& entry = getCurrentEntry();
+    if (msg->heapIndex == PENDING_HEAP_INDEX) {
+        // scheduled by this event: drop the operation
+        auto it = std::find_if(entry.pendingOps.begin(), entry.pendingOps.end(),
+                [msg](const PendingOp& op) {return op.kind == PendingOp::SCHEDULE && op.msg == msg;});
+        if (it == entry.pendingOps.end())
+            throw cRuntimeError("cancelEvent(): Message (%s)%s has been sent by this event", msg->getClassName(), msg->getName());
+        entry.pendingOps.erase(it);
+        msg->heapIndex = -1;
+    }
+    else {
+        // the message is removed from the FES when the event is committed; until
+        // then, it only looks unscheduled (see restoreCancelledEvents()), and
+        // belongs to the module like after removal (see cFutureEventSet::drop())
+        addPendingOp(PendingOp::CANCEL, msg).heapIndex = msg->heapIndex;
+        msg->heapIndex = -1;
+        static_cast<cDefaultOwner *>(entry.module)->doInsert(msg);
+    }
+}
+
+void ParallelEventExecutor::deleteCancelledMessage(cMessage *msg)
+{
+    // a message whose cancellation is pending is still in the FES, so it is deleted together with its removal
+    for (PendingOp& op : getCurrentEntry().pendingOps) {
+        if (op.kind == PendingOp::CANCEL && op.msg == msg) {
+            op.deleteMessage = true;
+            return;
+        }
+    }
+    delete msg;
+}
+
+ParallelEventExecutor::PendingOp& ParallelEventExecutor::addEmitOp(cComponent *component, simsignal_t signalID, SimsignalType type, cObject *details)
+{
+    if (component != getCurrentEntry().module)
+        throwNotAllowed("Emitting signals from other components");
+    if (details != nullptr)
+        throwNotAllowed("Emitting signals with details");
+    PendingOp& op = addPendingOp(PendingOp::EMIT, nullptr);
+    op.signalID = signalID;
+    op.valueType = type;
+    return op;
+}
+
+void ParallelEventExecutor::deferEmit(cComponent *component, simsignal_t signalID, bool b, cObject *details)
+{
+    addEmitOp(component, signalID, SIMSIGNAL_BOOL, details).value.b = b;
+}
+
+void ParallelEventExecutor::deferEmit(cComponent *component, simsignal_t signalID, intval_t i, cObject *details)
+{
+    addEmitOp(component, signalID, SIMSIGNAL_INT, details).value.i = i;
+}
+
+void ParallelEventExecutor::deferEmit(cComponent *component, simsignal_t signalID, uintval_t i, cObject *details)
+{
+    addEmitOp(component, signalID, SIMSIGNAL_UINT, details).value.u = i;
+}
+
+void ParallelEventExecutor::deferEmit(cComponent *component, simsignal_t signalID, double d, cObject *details)
+{
+    addEmitOp(component, signalID, SIMSIGNAL_DOUBLE, details).value.d = d;
+}
+
+void ParallelEventExecutor::deferEmit(cComponent *component, simsignal_t signalID, const SimTime& t, cObject *details)
+{
+    addEmitOp(component, signalID, SIMSIGNAL_SIMTIME, details).time = t;
+}
+
+void ParallelEventExecutor::deferEmit(cComponent *component, simsignal_t signalID, const char *s, cObject *details)
+{
+    addEmitOp(component, signalID, SIMSIGNAL_STRING, details).stringValue = s;
+}
+
+void ParallelEventExecutor::deferEmit(cComponent *component, simsignal_t signalID, cObject *obj, cObject *details)
+{
+    // the object may be changed or deleted by the time the listeners are notified
+    throwNotAllowed("Emitting signals with object values");
+}
+
+void ParallelEventExecutor::deferRecording(cOutVector *vector, simtime_t t, double value)
+{
+    PendingOp& op = addPendingOp(PendingOp::RECORD, nullptr);
+    op.vector = vector;
+    op.time = t;
+    op.value.d = value;
+}
+
+}  // namespace omnetpp
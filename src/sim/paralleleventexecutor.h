@@ -0,0 +1,237 @@
+//=========================================================================
+//  PARALLELEVENTEXECUTOR.H - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_PARALLELEVENTEXECUTOR_H
+#define __OMNETPP_PARALLELEVENTEXECUTOR_H
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <climits>
+#include <exception>
+#include <unordered_set>
+#include <condition_variable>
+#include "omnetpp/simkerneldefs.h"
+#include "omnetpp/csimplemodule.h"
+#include "omnetpp/cchannel.h"
+
+namespace omnetpp {
+
+class cSimulation;
+class cComponent;
+class cMessage;
+class cGate;
+class cOutVector;
+
+/**
+ * Executes batches of events that have the same arrival time and priority
+ * and target different @parallel simple modules, on a pool of threads.
+ * Used internally by cSimulation::executeEvent().
+ *
+ * The handleMessage() calls of a batch run concurrently, and the executor
+ * waits until all of them have returned. This is the only point where the
+ * threads synchronize. While a handler runs, it may only use the parts of
+ * the simulation library listed in the API contract (see the manual and
+ * the parallel-event-threads option). Those that affect shared state
+ * (creating and deleting messages, scheduleAt(), send(), emit(), recording
+ * output vectors) are buffered per event, and are performed ("committed")
+ * on the main thread after the batch, in the original order of the events,
+ * each with its own event number and module context. Results are therefore
+ * the same as with sequential execution.
+ *
+ * The handlers do not see the effects of each other's buffered operations,
+ * which is correct as long as they only access the state of their own module:
+ * in sequential execution, the effects of an event on other modules can only
+ * become visible in later events anyway. The FES is not modified while the
+ * handlers run: cancelled self-messages are only removed when the event is
+ * committed. The global state of the simulation is not updated for each
+ * event either: inside a handler, cSimulation::getEventNumber() returns
+ * the number of the event preceding the batch, and getContext() returns
+ * nullptr (but getContextModule() returns the module of the event).
+ *
+ * The fingerprint ingredients of events that only depend on the message
+ * and the module are captured before the batch starts (see
+ * cFingerprintCalculator::captureEvent()), and added when the event
+ * is committed.
+ */
+class ParallelEventExecutor
+{
+  private:
+    // an operation performed by a handler, see commitPendingOps()
+    struct PendingOp {
+        enum Kind {CREATE, SCHEDULE, CANCEL, SEND, SEND_DIRECT, EMIT, RECORD} kind;
+        cMessage *msg = nullptr;        // all but EMIT and RECORD; nullptr if the message has been deleted since
+        cMessage *original = nullptr;   // CREATE: the message it was duplicated from (nullptr if none or deleted)
+        cGate *gate = nullptr;          // SEND: the output gate; SEND_DIRECT: the destination gate
+        SendOptions options;            // SEND, SEND_DIRECT
+        bool defaultOptions = false;    // SEND: the options were SendOptions::DEFAULT
+        cChannel::Result result;        // SEND_DIRECT
+        simtime_t time;                 // SEND, SEND_DIRECT: the arrival time; EMIT: SIMSIGNAL_SIMTIME value; RECORD: timestamp
+        simsignal_t signalID = -1;      // EMIT
+        SimsignalType valueType = SIMSIGNAL_UNDEF; // EMIT
+        union {bool b; intval_t i; uintval_t u; double d;} value;  // EMIT, RECORD
+        std::string stringValue;        // EMIT: SIMSIGNAL_STRING value
+        cOutVector *vector = nullptr;   // RECORD
+        int heapIndex = -1;             // CANCEL: the heapIndex of the message in the FES, restored before committing
+        bool deleteMessage = false;     // CANCEL: cancelAndDelete()
+
+        PendingOp(Kind kind) : kind(kind) {value.i = 0;}
+    };
+
+    struct Entry {
+        cMessage *msg;
+        cSimpleModule *module;
+        cObject *fingerprintCapture = nullptr; // see cFingerprintCalculator::captureEvent()
+        std::exception_ptr exception;          // thrown by handleMessage()
+        std::vector<PendingOp> pendingOps;     // in their original order
+        long numDeletedMessages = 0;           // messages created before the batch and deleted by the handler
+    };
+
+    // per-thread state: the event being executed by the thread
+    static thread_local Entry *currentEntry;
+
+    // the value of the heapIndex field of messages whose scheduling or sending is pending
+    static const int PENDING_HEAP_INDEX = INT_MIN;
+
+    cSimulation *sim;
+    int numThreads;
+    std::vector<std::thread> threads;
+
+    // the current batch
+    std::vector<Entry> batch;
+    std::unordered_set<const cModule *> batchModules;
+    std::atomic<size_t> nextEntry;
+    bool ownershipTracking = true;  // the setting of the main thread, see cDefaultOwner::setOwnershipTracking()
+
+    std::mutex mutex;
+    std::condition_variable batchStarted;  // wakes up idle workers
+    std::condition_variable batchDone;     // wakes up the main thread
+    uint64_t batchSerial = 0;  // incremented for each batch
+    int numBusyWorkers = 0;    // number of pool threads still working on the current batch
+    bool shuttingDown = false;
+
+  private:
+    bool canExecuteBatch();
+    bool canExecuteInBatch(cMessage *msg);
+    bool collectBatch(cMessage *msg);
+    void clearBatch();
+    void startThreads();
+    void threadMain();
+    void processEntries();
+    void executeEntry(size_t index);
+    void restoreCancelledEvents();
+    void commitEntry(Entry& entry);
+    void commitPendingOps(Entry& entry);
+    void discardPendingOps(Entry& entry, size_t from);
+    static Entry& getCurrentEntry();
+    static PendingOp& addPendingOp(PendingOp::Kind kind, cMessage *msg);
+    static void checkNotPending(cMessage *msg, const char *what);
+    static PendingOp& addEmitOp(cComponent *component, simsignal_t signalID, SimsignalType type, cObject *details);
+
+  public:
+    ParallelEventExecutor(cSimulation *sim, int numThreads);
+    ~ParallelEventExecutor();
+
+    /**
+     * Executes the given event together with the events that immediately
+     * follow it in the FES and may be executed in parallel with it. Returns
+     * false (without executing anything) if there are no such events.
+     */
+    bool executeBatch(cMessage *msg);
+
+    /** @name Buffered operations. They may only be called during a batch (see cSimulation::isParallelEventBatchActive()). */
+    //@{
+    /**
+     * Called by the constructors of cMessage: the message gets its id when
+     * the event is committed.
+     */
+    static void deferMessageCreation(cMessage *msg, cMessage *original);
+
+    /**
+     * Called by the destructor of cMessage.
+     */
+    static void messageDeleted(cMessage *msg);
+
+    /**
+     * Called by cSimpleModule::scheduleAt(), send() and sendDirect() after
+     * checking the arguments.
+     */
+    static void deferScheduling(cMessage *msg);
+    static void deferSending(cMessage *msg, cGate *outGate, const SendOptions& options, simtime_t t);
+    static void deferSendingDirect(cMessage *msg, cGate *toGate, const SendOptions& options, const cChannel::Result& result, simtime_t t);
+
+    /**
+     * Called by cSimpleModule::cancelEvent() after checking the arguments.
+     * A message scheduled by the same event is simply not scheduled.
+     * Other messages are only marked as not scheduled, and are removed
+     * from the FES when the event is committed: other handlers may be
+     * reading the heapIndex fields of their own messages, which removal
+     * would rewrite.
+     */
+    static void cancelEvent(cMessage *msg);
+
+    /**
+     * Called by cSimpleModule::cancelAndDelete() after cancelEvent().
+     * A message that is still in the FES is deleted when the event is
+     * committed.
+     */
+    static void deleteCancelledMessage(cMessage *msg);
+
+    /**
+     * Called by cComponent::emit(). Only the module of the event may emit,
+     * and only non-object values without details.
+     */
+    static void deferEmit(cComponent *component, simsignal_t signalID, bool b, cObject *details);
+    static void deferEmit(cComponent *component, simsignal_t signalID, intval_t i, cObject *details);
+    static void deferEmit(cComponent *component, simsignal_t signalID, uintval_t i, cObject *details);
+    static void deferEmit(cComponent *component, simsignal_t signalID, double d, cObject *details);
+    static void deferEmit(cComponent *component, simsignal_t signalID, const SimTime& t, cObject *details);
+    static void deferEmit(cComponent *component, simsignal_t signalID, const char *s, cObject *details);
+    static void deferEmit(cComponent *component, simsignal_t signalID, cObject *obj, cObject *details);
+
+    /**
+     * Called by cOutVector::recordWithTimestamp().
+     */
+    static void deferRecording(cOutVector *vector, simtime_t t, double value);
+    //@}
+
+    /**
+     * Returns the module of the event being executed by the calling thread,
+     * or nullptr. Used by cSimulation::getContextModule().
+     */
+    static cSimpleModule *getCurrentModule() {return currentEntry ? currentEntry->module : nullptr;}
+
+    /**
+     * Called by cSimulation::setContext(). Throws an error unless the
+     * component is the module of the event, or nullptr.
+     */
+    static void checkContextSwitch(cComponent *component);
+
+    /**
+     * Throws an error that explains that the given operation is not allowed
+     * during parallel event execution. Called from the places where the
+     * simulation library can cheaply detect a violation of the API contract:
+     * entering a component (e.g. via Enter_Method()), using an RNG, deleting
+     * a module, etc.
+     */
+    [[noreturn]] static void throwNotAllowed(const char *what);
+};
+
+}  // namespace omnetpp
+
+
+#endif
@@ -0,0 +1,88 @@
+//=========================================================================
+//  CHANDOVERCOMMBUFFER.CC - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include "omnetpp/cmessage.h"
+#include "omnetpp/cexception.h"
+#include "omnetpp/checkandcast.h"
+#include "omnetpp/regmacros.h"
+#include "chandovercommbuffer.h"
+
+namespace omnetpp {
+
+Register_Class(cHandoverCommBuffer);
+
+cHandoverCommBuffer::~cHandoverCommBuffer()
+{
+    // messages that were never received, e.g. because the partition had already stopped
+    for (size_t i = numUnpacked; i < messages.size(); i++)
+        delete messages[i];
+}
+
+void cHandoverCommBuffer::swap(cCommBufferBase *other)
+{
+    cHandoverCommBuffer *otherBuffer = check_and_cast<cHandoverCommBuffer *>(other);
+    cMemCommBuffer::swap(other);
+    std::swap(messages, otherBuffer->messages);
+    std::swap(numUnpacked, otherBuffer->numUnpacked);
+}
+
+void cHandoverCommBuffer::packObject(cObject *obj)
+{
+    if (depth == 0) {
+        cMessage *msg = dynamic_cast<cMessage *>(obj);
+        if (packFlag(msg != nullptr)) {
+            msg->removeFromOwnershipTree();
+            msg->leaveSimulation();
+            messages.push_back(msg);
+            return;
+        }
+    }
+
+    depth++;
+    try {
+        cMemCommBuffer::packObject(obj);
+    }
+    catch (std::exception&) {
+        depth--;
+        throw;
+    }
+    depth--;
+}
+
+cObject *cHandoverCommBuffer::unpackObject()
+{
+    if (depth == 0 && checkFlag()) {
+        if (numUnpacked == messages.size())
+            throw cRuntimeError("cHandoverCommBuffer: No handed over message left to unpack");
+        cMessage *msg = messages[numUnpacked++];
+        msg->enterSimulation();
+        return msg;
+    }
+
+    depth++;
+    cObject *obj;
+    try {
+        obj = cMemCommBuffer::unpackObject();
+    }
+    catch (std::exception&) {
+        depth--;
+        throw;
+    }
+    depth--;
+    return obj;
+}
+
+}  // namespace omnetpp
+
@@ -0,0 +1,91 @@
+//=========================================================================
+//  CHANDOVERCOMMBUFFER.H - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_CHANDOVERCOMMBUFFER_H
+#define __OMNETPP_CHANDOVERCOMMBUFFER_H
+
+#include <vector>
+#include "cmemcommbuffer.h"
+
+namespace omnetpp {
+
+class cMessage;
+
+/**
+ * @brief Communication buffer that hands over message objects instead of
+ * packing them.
+ *
+ * It can only be used between partitions that run in the same process, see
+ * cSharedMemoryCommunications. When a message is passed to packObject(), the
+ * buffer takes the message object itself: the message is removed from the
+ * ownership tree and the message counters of the sending simulation, and
+ * unpackObject() adds it to the receiving one. The sender must not access or
+ * delete the message afterwards (cProxyGate checks for this). Everything else,
+ * including the objects that a message packs in its parsimPack() method if it
+ * is packed as part of another object, is packed as in cMemCommBuffer.
+ *
+ * The message object is delivered as it is. In particular, its control info
+ * and context pointer are kept (they are lost when the message is packed),
+ * so they must not refer to objects in the sending partition.
+ *
+ * @ingroup Parsim
+ */
+class SIM_API cHandoverCommBuffer : public cMemCommBuffer
+{
+  protected:
+    std::vector<cMessage *> messages;  // handed over messages, in the order of packing
+    size_t numUnpacked = 0;  // the first numUnpacked messages have already been unpacked
+    int depth = 0;           // nesting of packObject()/unpackObject() calls
+
+  public:
+    /**
+     * Constructor.
+     */
+    cHandoverCommBuffer() {}
+
+    /**
+     * Destructor. Deletes the messages that have not been unpacked.
+     */
+    virtual ~cHandoverCommBuffer();
+
+    /**
+     * Returns the number of handed over messages not unpacked yet.
+     */
+    int getNumMessages() const {return messages.size() - numUnpacked;}
+
+    /**
+     * Swaps the contents of the two buffers, including the handed over messages.
+     */
+    virtual void swap(cCommBufferBase *other) override;
+
+    /** @name Redefined cCommBuffer methods */
+    //@{
+    /**
+     * Hands over the object if it is a message and it is not packed as part
+     * of another object; packs it otherwise.
+     */
+    virtual void packObject(cObject *obj) override;
+
+    /**
+     * Returns the next handed over message, or unpacks the object.
+     */
+    virtual cObject *unpackObject() override;
+    //@}
+};
+
+}  // namespace omnetpp
+
+
+#endif
@@ -24,9 +24,11 @@
 #include <cstdio>
 #include "cfilecomm.h"
 #include "cnamedpipecomm.h"
+#include "csharedmemorycomm.h"
 #include "cmpicomm.h"
 #include "cnosynchronization.h"
 #include "cnullmessageprot.h"
+#include "ctimewarpprot.h"
 #include "cispeventlogger.h"
 #include "cidealsimulationprot.h"
 #include "clinkdelaylookahead.h"
@@ -72,11 +74,19 @@ void parsim_dummy()
 {
     cFileCommunications fc;
     cNamedPipeCommunications npc;
+#ifdef WITH_SHAREDMEMORYCOMM
+    cSharedMemoryCommunications smc;
+    (void)smc;
+#endif
 #ifdef WITH_MPI
     cMPICommunications mc;
 #endif
     cNoSynchronization ns;
     cNullMessageProtocol np;
+#ifdef WITH_TIMEWARP
+    cTimeWarpProtocol twp;
+    (void)twp;
+#endif
     cISPEventLogger iel;
     cIdealSimulationProtocol ip;
     cLinkDelayLookahead ldla;
@@ -55,7 +55,11 @@ bool cProxyGate::deliver(cMessage *msg, const SendOptions& options, simtime_t t)
 
     msg->setArrivalTime(t);  // merge arrival time into message
     partition->processOutgoingMessage(msg, options, remoteProcId, remoteModuleId, remoteGateId, data);
-    return false;  // meaning message should be deleted
+
+    // the message object itself may have been handed over to the other partition
+    // instead of a packed copy (see cHandoverCommBuffer); it is then no longer
+    // in our ownership tree, and must not be deleted
+    return msg->getOwner() == nullptr;
 }
 
 void cProxyGate::setRemoteGate(short procId, int moduleId, int gateId)
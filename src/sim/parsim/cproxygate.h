@@ -79,7 +79,8 @@ class SIM_API cProxyGate : public cGate // noncopyable
      * cParsimPartition.
      *
      * Invokes the cParsimPartition::processOutgoingMessage() method
-     * to transmit the message, then deletes the message object.
+     * to transmit the message, then deletes the message object (unless the
+     * message object itself has been handed over to the remote partition).
      */
     virtual bool deliver(cMessage *msg, const SendOptions& options, simtime_t at) override;
     //@}
@@ -0,0 +1,658 @@
+//=========================================================================
+//  CSHAREDMEMORYCOMM.CC - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include "csharedmemorycomm.h"
+
+#ifdef WITH_SHAREDMEMORYCOMM
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <condition_variable>
+#include <cstring>
+#include <cerrno>
+#include <map>
+#include <mutex>
+#include <random>
+#include <vector>
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+#include "omnetpp/cexception.h"
+#include "omnetpp/clog.h"
+#include "omnetpp/globals.h"
+#include "omnetpp/regmacros.h"
+#include "omnetpp/cconfigoption.h"
+#include "omnetpp/cenvir.h"
+#include "omnetpp/csimulation.h"
+#include "omnetpp/cconfiguration.h"
+#include "omnetpp/simutil.h"
+#include "cmemcommbuffer.h"
+#include "chandovercommbuffer.h"
+#include "parsimutil.h"
+
+namespace omnetpp {
+
+Register_Class(cSharedMemoryCommunications);
+
+Register_GlobalConfigOption(CFGID_PARSIM_SHAREDMEMORYCOMM_PREFIX, "parsim-sharedmemorycommunications-prefix", CFG_STRING, "comm/", "When `cSharedMemoryCommunications` is selected as parsim communications class: selects the prefix (directory+potential filename prefix) of the memory-mapped files that hold the message queues. A directory on a memory-backed file system (e.g. `/dev/shm/`) is recommended.");
+Register_GlobalConfigOptionU(CFGID_PARSIM_SHAREDMEMORYCOMM_RINGSIZE, "parsim-sharedmemorycommunications-ringsize", "B", "1MiB", "When `cSharedMemoryCommunications` is selected as parsim communications class: size of the ring buffer for each pair of partitions (rounded up to a power of two). A single message must fit into the ring. In threads mode, the rings only hold pointers (16 bytes per message).");
+Register_GlobalConfigOption(CFGID_PARSIM_SHAREDMEMORYCOMM_MODE, "parsim-sharedmemorycommunications-mode", CFG_STRING, "processes", "When `cSharedMemoryCommunications` is selected as parsim communications class: `processes` if partitions are separate processes (started e.g. with the `-p` option or `opp_prun`), or `threads` if they are threads of a single process, each running its own simulation (see the Embedding chapter of the manual). In threads mode, partitions with the same `parsim-sharedmemorycommunications-prefix` belong together.");
+Register_GlobalConfigOption(CFGID_PARSIM_SHAREDMEMORYCOMM_HANDOVER, "parsim-sharedmemorycommunications-handover", CFG_BOOL, "true", "When `cSharedMemoryCommunications` is used with `parsim-sharedmemorycommunications-mode=threads`: pass message objects to the destination partition as they are, instead of packing them and creating a copy at the destination.");
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "cSharedMemoryCommunications requires lock-free 64-bit atomics");
+
+#define SEGMENT_MAGIC     0x4f505053  // "OPPS"
+#define CACHELINE_SIZE    64
+#define FRAME_ALIGNMENT   8
+
+// Segment layout: SegmentHeader, then for each source partition a RingHeader
+// followed by the ring's data area. Positions are byte counts since the start
+// of the simulation; only the low bits (pos & (capacity-1)) index the data area.
+//
+// Every segment is stamped with a random nonce by its owner. When a partition
+// has mapped a peer's segment, it writes its own nonce into peerNonce of the
+// ring it will produce into (the hello). A partition only starts the simulation
+// when every peer has said hello in its own segment with the nonce of the
+// segment it has mapped for that peer: this proves that both sides use the
+// files of the current run, not stale ones left behind by an earlier run.
+//
+// In threads mode, the segments are allocated in private memory, and frames
+// contain a cMemCommBuffer pointer instead of the packed data. The ring passes
+// the ownership of the buffer to the consumer.
+struct cSharedMemoryCommunications::SegmentHeader {
+    uint32_t magic;
+    int32_t numPartitions;
+    uint64_t ringCapacity;
+    uint64_t nonce;               // random stamp of this incarnation of the segment
+    std::atomic<int32_t> ready;   // set by the owner when the segment is fully initialized
+    char padding[CACHELINE_SIZE - 28];
+};
+
+struct cSharedMemoryCommunications::RingHeader {
+    alignas(CACHELINE_SIZE) std::atomic<uint64_t> writePos;  // only modified by the producer
+    std::atomic<uint64_t> peerNonce;  // nonce of the producer's segment; written by the producer at startup
+    alignas(CACHELINE_SIZE) std::atomic<uint64_t> readPos;   // only modified by the consumer
+};
+
+struct FrameHeader
+{
+    int32_t tag;
+    int32_t contentLength;
+};
+
+static_assert(sizeof(cSharedMemoryCommunications::SegmentHeader) == CACHELINE_SIZE, "unexpected segment header size");
+
+struct cSharedMemoryCommunications::ThreadGroup {
+    int numPartitions;
+    int numActive = 0;     // partitions that have joined and not shut down yet
+    int numJoined = 0;     // partitions that have joined
+    bool closed = false;   // set when the first partition shuts down
+    std::vector<void *> segments;  // index: procId
+    std::vector<size_t> segmentSizes;
+    ThreadGroup(int numPartitions) : numPartitions(numPartitions), segments(numPartitions), segmentSizes(numPartitions) {}
+};
+
+// thread groups in this process; key: prefix
+static std::mutex threadGroupsMutex;
+static std::condition_variable threadGroupsChanged;
+static std::map<std::string, cSharedMemoryCommunications::ThreadGroup *> threadGroups;
+
+static inline uint64_t frameSize(int contentLength)
+{
+    return (sizeof(FrameHeader) + contentLength + FRAME_ALIGNMENT - 1) & ~(uint64_t)(FRAME_ALIGNMENT - 1);
+}
+
+static inline size_t segmentSize(int numPartitions, uint64_t ringCapacity)
+{
+    return sizeof(cSharedMemoryCommunications::SegmentHeader) + numPartitions * (sizeof(cSharedMemoryCommunications::RingHeader) + ringCapacity);
+}
+
+// copy into / out of the ring's data area, with wraparound
+static void copyToRing(char *data, uint64_t capacity, uint64_t pos, const void *src, size_t len)
+{
+    uint64_t offset = pos & (capacity - 1);
+    size_t firstPart = std::min((uint64_t)len, capacity - offset);
+    memcpy(data + offset, src, firstPart);
+    memcpy(data, (const char *)src + firstPart, len - firstPart);
+}
+
+static void copyFromRing(const char *data, uint64_t capacity, uint64_t pos, void *dest, size_t len)
+{
+    uint64_t offset = pos & (capacity - 1);
+    size_t firstPart = std::min((uint64_t)len, capacity - offset);
+    memcpy(dest, data + offset, firstPart);
+    memcpy((char *)dest + firstPart, data, len - firstPart);
+}
+
+// spin for a while, then yield the CPU, then sleep
+static uint64_t generateNonce()
+{
+    std::random_device rd;
+    uint64_t nonce = ((uint64_t)rd() << 32) ^ rd() ^ ((uint64_t)getpid() << 16) ^ (uint64_t)opp_get_monotonic_clock_usecs();
+    return nonce != 0 ? nonce : 1;  // zero means "no hello yet"
+}
+
+static void backoff(int& spins)
+{
+    if (++spins < 64)
+        ;
+    else if (spins < 1024)
+        sched_yield();
+    else
+        usleep(100);
+}
+
+cSharedMemoryCommunications::cSharedMemoryCommunications()
+{
+    prefix = getEnvir()->getConfig()->getAsString(CFGID_PARSIM_SHAREDMEMORYCOMM_PREFIX);
+    double ringSize = getEnvir()->getConfig()->getAsDouble(CFGID_PARSIM_SHAREDMEMORYCOMM_RINGSIZE);
+    if (ringSize < 4096 || ringSize > (double)(1ULL << 40))
+        throw cRuntimeError("cSharedMemoryCommunications: Invalid ring size %g, must be between 4KiB and 1TiB", ringSize);
+    ringCapacity = 4096;
+    while (ringCapacity < (uint64_t)ringSize)
+        ringCapacity *= 2;
+
+    std::string mode = getEnvir()->getConfig()->getAsString(CFGID_PARSIM_SHAREDMEMORYCOMM_MODE);
+    if (mode != "processes" && mode != "threads")
+        throw cRuntimeError("cSharedMemoryCommunications: Invalid mode '%s', must be 'processes' or 'threads'", mode.c_str());
+    threadMode = mode == "threads";
+    handover = threadMode && getEnvir()->getConfig()->getAsBool(CFGID_PARSIM_SHAREDMEMORYCOMM_HANDOVER);
+    threadGroup = nullptr;
+
+    numPartitions = 0;
+    myProcId = -1;
+    segments = nullptr;
+    segmentSizes = nullptr;
+    segmentInodes = nullptr;
+    inRings = nullptr;
+    outRings = nullptr;
+    rrBase = 0;
+}
+
+cSharedMemoryCommunications::~cSharedMemoryCommunications()
+{
+    delete[] segments;
+    delete[] segmentSizes;
+    delete[] segmentInodes;
+    delete[] inRings;
+    delete[] outRings;
+
+    for (auto item : receivedBuffers)
+        delete item.buffer;
+    for (auto item : deferredBuffers)
+        delete item.buffer;
+}
+
+std::string cSharedMemoryCommunications::getSegmentFileName(int procId) const
+{
+    return std::string(prefix.c_str()) + "shm-" + std::to_string(procId);
+}
+
+void *cSharedMemoryCommunications::createSegment(int procId, size_t size)
+{
+    std::string fname = getSegmentFileName(procId);
+    EV << "cSharedMemoryCommunications: creating shared memory segment '" << fname << "' (" << size << " bytes)...\n";
+    unlink(fname.c_str());
+    int fd = open(fname.c_str(), O_RDWR|O_CREAT|O_EXCL, 0600);
+    if (fd == -1)
+        throw cRuntimeError("cSharedMemoryCommunications: Cannot create file '%s': %s", fname.c_str(), strerror(errno));
+    if (ftruncate(fd, size) == -1) {
+        close(fd);
+        throw cRuntimeError("cSharedMemoryCommunications: Cannot resize file '%s': %s", fname.c_str(), strerror(errno));
+    }
+    void *p = mmap(nullptr, size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED)
+        throw cRuntimeError("cSharedMemoryCommunications: Cannot map file '%s': %s", fname.c_str(), strerror(errno));
+    return p;  // note: ftruncate() fills the file with zeroes
+}
+
+void *cSharedMemoryCommunications::openSegment(int procId, size_t& size, uint64_t& inode)
+{
+    std::string fname = getSegmentFileName(procId);
+    EV << "cSharedMemoryCommunications: opening shared memory segment '" << fname << "'...\n";
+
+    // wait for the owner to create and initialize the segment
+    for (int k = 0; k < 300; k++) {
+        int fd = open(fname.c_str(), O_RDWR);
+        if (fd != -1) {
+            struct stat st;
+            if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(SegmentHeader)) {
+                size = st.st_size;
+                inode = st.st_ino;
+                void *p = mmap(nullptr, size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+                close(fd);
+                if (p == MAP_FAILED)
+                    throw cRuntimeError("cSharedMemoryCommunications: Cannot map file '%s': %s", fname.c_str(), strerror(errno));
+                SegmentHeader *header = (SegmentHeader *)p;
+                if (header->ready.load(std::memory_order_acquire))
+                    return p;
+                munmap(p, size);
+            }
+            else {
+                close(fd);
+            }
+        }
+        usleep(100000);
+    }
+    throw cRuntimeError("cSharedMemoryCommunications: Shared memory segment '%s' of procId=%d did not become available", fname.c_str(), procId);
+}
+
+void cSharedMemoryCommunications::mapPeerSegment(int procId)
+{
+    segments[procId] = openSegment(procId, segmentSizes[procId], segmentInodes[procId]);
+    SegmentHeader *header = (SegmentHeader *)segments[procId];
+    if (header->magic != SEGMENT_MAGIC || header->numPartitions != numPartitions ||
+            segmentSizes[procId] != segmentSize(numPartitions, header->ringCapacity))
+        throw cRuntimeError("cSharedMemoryCommunications: Shared memory segment '%s' of procId=%d is incompatible "
+                            "(stale file from an earlier run, or different number of partitions?)", getSegmentFileName(procId).c_str(), procId);
+    setupRing(outRings[procId], segments[procId], myProcId, header->ringCapacity);
+
+    // say hello: tell the peer which incarnation of our segment to expect
+    outRings[procId].header->peerNonce.store(((SegmentHeader *)segments[myProcId])->nonce, std::memory_order_release);
+}
+
+bool cSharedMemoryCommunications::isPeerSegmentReplaced(int procId)
+{
+    struct stat st;
+    return stat(getSegmentFileName(procId).c_str(), &st) == 0 && (uint64_t)st.st_ino != segmentInodes[procId];
+}
+
+void cSharedMemoryCommunications::setupRing(Ring& ring, void *segment, int sourceProcId, uint64_t capacity)
+{
+    char *p = (char *)segment + sizeof(SegmentHeader) + sourceProcId * (sizeof(RingHeader) + capacity);
+    ring.header = (RingHeader *)p;
+    ring.data = p + sizeof(RingHeader);
+}
+
+void cSharedMemoryCommunications::initSegment(void *segment)
+{
+    SegmentHeader *header = (SegmentHeader *)segment;
+    header->magic = SEGMENT_MAGIC;
+    header->numPartitions = numPartitions;
+    header->ringCapacity = ringCapacity;
+    header->nonce = generateNonce();
+    for (int i = 0; i < numPartitions; i++)
+        if (i != myProcId)
+            setupRing(inRings[i], segment, i, ringCapacity);
+    header->ready.store(1, std::memory_order_release);
+}
+
+void cSharedMemoryCommunications::init(int np)
+{
+    // store parameter
+    numPartitions = np;
+
+    // get myProcId from "-p" command-line option
+    myProcId = getProcIdFromCommandLineArgs(numPartitions, "cSharedMemoryCommunications");
+
+    EV << "cSharedMemoryCommunications: started as " << (threadMode ? "thread " : "process ") << myProcId << " out of " << numPartitions << ".\n";
+
+    segments = new void *[numPartitions];
+    segmentSizes = new size_t[numPartitions];
+    segmentInodes = new uint64_t[numPartitions];
+    inRings = new Ring[numPartitions];
+    outRings = new Ring[numPartitions];
+
+    if (threadMode)
+        joinThreadGroup();
+    else
+        connectProcesses();
+}
+
+void cSharedMemoryCommunications::connectProcesses()
+{
+    // create our own segment, which holds our incoming rings
+    size_t size = segmentSize(numPartitions, ringCapacity);
+    void *segment = createSegment(myProcId, size);
+    segments[myProcId] = segment;
+    segmentSizes[myProcId] = size;
+    initSegment(segment);
+
+    // map the other partitions' segments, and locate the rings we write into
+    for (int i = 0; i < numPartitions; i++)
+        if (i != myProcId)
+            mapPeerSegment(i);
+
+    // wait until every peer has said hello with the nonce of the segment we
+    // mapped for it. If a peer's file was replaced since we mapped it (we saw a
+    // stale file from an earlier run, and the peer has recreated it since),
+    // or the peer's hello names a different segment, map it again.
+    int64_t startTime = opp_get_monotonic_clock_usecs();
+    for (int i = 0; i < numPartitions; i++) {
+        if (i == myProcId)
+            continue;
+        for (;;) {
+            uint64_t peerNonce = inRings[i].header->peerNonce.load(std::memory_order_acquire);
+            uint64_t mappedNonce = ((SegmentHeader *)segments[i])->nonce;
+            if (peerNonce == mappedNonce)
+                break;
+            if ((peerNonce != 0 && peerNonce != mappedNonce) || isPeerSegmentReplaced(i)) {
+                EV << "cSharedMemoryCommunications: shared memory segment of procId=" << i << " was stale, remapping\n";
+                munmap(segments[i], segmentSizes[i]);
+                mapPeerSegment(i);
+                continue;
+            }
+            if (opp_get_monotonic_clock_usecs() - startTime > 30000000)
+                throw cRuntimeError("cSharedMemoryCommunications: Timeout waiting for procId=%d to connect", i);
+            usleep(10000);
+        }
+    }
+}
+
+void cSharedMemoryCommunications::joinThreadGroup()
+{
+    std::unique_lock<std::mutex> lock(threadGroupsMutex);
+    ThreadGroup *group = threadGroups[prefix.c_str()];
+    if (!group)
+        group = threadGroups[prefix.c_str()] = new ThreadGroup(numPartitions);
+    else if (group->numPartitions != numPartitions)
+        throw cRuntimeError("cSharedMemoryCommunications: Partitions with prefix '%s' in this process disagree about the number of partitions (%d vs %d)",
+                            prefix.c_str(), group->numPartitions, numPartitions);
+    else if (group->segments[myProcId] != nullptr)
+        throw cRuntimeError("cSharedMemoryCommunications: Partition procId=%d with prefix '%s' already exists in this process", myProcId, prefix.c_str());
+    else if (group->closed)
+        throw cRuntimeError("cSharedMemoryCommunications: The other partitions with prefix '%s' in this process have already stopped", prefix.c_str());
+
+    // create our own segment; it has the same layout as in processes mode
+    size_t size = segmentSize(numPartitions, ringCapacity);
+    void *segment = mmap(nullptr, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (segment == MAP_FAILED)
+        throw cRuntimeError("cSharedMemoryCommunications: Cannot allocate %zu bytes for the ring buffers: %s", size, strerror(errno));
+    initSegment(segment);
+    group->segments[myProcId] = segment;
+    group->segmentSizes[myProcId] = size;
+    group->numJoined++;
+    group->numActive++;
+    threadGroup = group;
+    threadGroupsChanged.notify_all();
+
+    // wait for the other partitions, then locate the rings we write into
+    if (!threadGroupsChanged.wait_for(lock, std::chrono::seconds(30), [&]() {return group->numJoined == numPartitions;}))
+        throw cRuntimeError("cSharedMemoryCommunications: Timeout waiting for the other partitions with prefix '%s' to start", prefix.c_str());
+    for (int i = 0; i < numPartitions; i++) {
+        segments[i] = group->segments[i];
+        segmentSizes[i] = group->segmentSizes[i];
+        if (i != myProcId)
+            setupRing(outRings[i], segments[i], myProcId, ((SegmentHeader *)segments[i])->ringCapacity);
+    }
+}
+
+void cSharedMemoryCommunications::leaveThreadGroup()
+{
+    std::lock_guard<std::mutex> lock(threadGroupsMutex);
+    ThreadGroup *group = threadGroup;
+    threadGroup = nullptr;
+    group->closed = true;
+    if (--group->numActive > 0)
+        return;
+
+    // we are the last one: free the segments, and the buffers that are still in the rings
+    for (int i = 0; i < numPartitions; i++) {
+        if (group->segments[i]) {
+            deleteQueuedBuffers(group->segments[i]);
+            munmap(group->segments[i], group->segmentSizes[i]);
+        }
+    }
+    threadGroups.erase(prefix.c_str());
+    delete group;
+}
+
+void cSharedMemoryCommunications::deleteQueuedBuffers(void *segment)
+{
+    uint64_t capacity = ((SegmentHeader *)segment)->ringCapacity;
+    for (int i = 0; i < numPartitions; i++) {
+        Ring ring;
+        setupRing(ring, segment, i, capacity);
+        uint64_t writePos = ring.header->writePos.load(std::memory_order_acquire);
+        uint64_t pos = ring.header->readPos.load(std::memory_order_relaxed);
+        while (pos != writePos) {
+            FrameHeader fh;
+            cMemCommBuffer *buffer;
+            copyFromRing(ring.data, capacity, pos, &fh, sizeof(fh));
+            copyFromRing(ring.data, capacity, pos + sizeof(fh), &buffer, sizeof(buffer));
+            delete buffer;
+            pos += frameSize(fh.contentLength);
+        }
+    }
+}
+
+void cSharedMemoryCommunications::shutdown()
+{
+    if (!segments)
+        return;
+    if (threadMode) {
+        // nobody would receive these any more
+        for (auto item : deferredBuffers)
+            delete item.buffer;
+        deferredBuffers.clear();
+        if (threadGroup)
+            leaveThreadGroup();
+    }
+    else {
+        for (int i = 0; i < numPartitions; i++)
+            munmap(segments[i], segmentSizes[i]);
+        unlink(getSegmentFileName(myProcId).c_str());
+    }
+    delete[] segments;
+    segments = nullptr;
+}
+
+int cSharedMemoryCommunications::getNumPartitions() const
+{
+    return numPartitions;
+}
+
+int cSharedMemoryCommunications::getProcId() const
+{
+    return myProcId;
+}
+
+cCommBuffer *cSharedMemoryCommunications::createCommBuffer()
+{
+    if (handover)
+        return new cHandoverCommBuffer();
+    return new cMemCommBuffer();
+}
+
+void cSharedMemoryCommunications::recycleCommBuffer(cCommBuffer *buffer)
+{
+    delete buffer;
+}
+
+void cSharedMemoryCommunications::send(cCommBuffer *buffer, int tag, int destination)
+{
+    cMemCommBuffer *b = (cMemCommBuffer *)buffer;
+    if (!threadMode) {
+        writeToRing(destination, b, tag);
+        return;
+    }
+
+    // in threads mode, the destination gets a new buffer object. Handed over
+    // messages can only be passed on once, so such buffers are emptied into it,
+    // and only become visible to the destination later (see class comment).
+    flushDeferredBuffers();
+    cMemCommBuffer *copy = (cMemCommBuffer *)createCommBuffer();
+    if (handover && ((cHandoverCommBuffer *)b)->getNumMessages() > 0) {
+        copy->swap(b);
+        deferredBuffers.push_back({tag, destination, copy});
+    }
+    else {
+        int size = b->getMessageSize();
+        copy->allocateAtLeast(size);
+        if (size > 0)
+            memcpy(copy->getBuffer(), b->getBuffer(), size);
+        copy->setMessageSize(size);
+        writeToRing(destination, copy, tag);
+    }
+}
+
+void cSharedMemoryCommunications::flushDeferredBuffers()
+{
+    while (!deferredBuffers.empty()) {
+        DeferredBuffer& item = deferredBuffers.front();
+        writeToRing(item.destProcId, item.buffer, item.tag);
+        deferredBuffers.pop_front();
+    }
+}
+
+void cSharedMemoryCommunications::writeToRing(int destProcId, cMemCommBuffer *buffer, int tag)
+{
+    Ring& ring = outRings[destProcId];
+    uint64_t capacity = ((SegmentHeader *)segments[destProcId])->ringCapacity;
+
+    // in threads mode, only the pointer is written, and the ring takes over the buffer
+    FrameHeader fh;
+    fh.tag = tag;
+    fh.contentLength = threadMode ? sizeof(buffer) : buffer->getMessageSize();
+    uint64_t size = frameSize(fh.contentLength);
+    if (size > capacity)
+        throw cRuntimeError("cSharedMemoryCommunications: Message of %d bytes does not fit into the ring buffer of %" PRIu64 " bytes, "
+                            "increase parsim-sharedmemorycommunications-ringsize", fh.contentLength, capacity);
+
+    // wait until there is enough free space; meanwhile keep our incoming
+    // rings empty, so that the destination cannot get stuck sending to us
+    uint64_t writePos = ring.header->writePos.load(std::memory_order_relaxed);
+    int spins = 0;
+    while (writePos + size - ring.header->readPos.load(std::memory_order_acquire) > capacity) {
+        drainIncomingRings();
+        backoff(spins);
+    }
+
+    copyToRing(ring.data, capacity, writePos, &fh, sizeof(fh));
+    if (threadMode)
+        copyToRing(ring.data, capacity, writePos + sizeof(fh), &buffer, sizeof(buffer));
+    else
+        copyToRing(ring.data, capacity, writePos + sizeof(fh), buffer->getBuffer(), fh.contentLength);
+    ring.header->writePos.store(writePos + size, std::memory_order_release);
+}
+
+bool cSharedMemoryCommunications::readFromRing(int sourceProcId, cMemCommBuffer *buffer, int& receivedTag)
+{
+    Ring& ring = inRings[sourceProcId];
+    uint64_t readPos = ring.header->readPos.load(std::memory_order_relaxed);
+    if (ring.header->writePos.load(std::memory_order_acquire) == readPos)
+        return false;
+
+    FrameHeader fh;
+    copyFromRing(ring.data, ringCapacity, readPos, &fh, sizeof(fh));
+    receivedTag = fh.tag;
+    if (threadMode) {
+        cMemCommBuffer *received;
+        copyFromRing(ring.data, ringCapacity, readPos + sizeof(fh), &received, sizeof(received));
+        buffer->swap(received);
+        delete received;
+    }
+    else {
+        buffer->reset();
+        buffer->allocateAtLeast(fh.contentLength);
+        buffer->setMessageSize(fh.contentLength);
+        copyFromRing(ring.data, ringCapacity, readPos + sizeof(fh), buffer->getBuffer(), fh.contentLength);
+    }
+    ring.header->readPos.store(readPos + frameSize(fh.contentLength), std::memory_order_release);
+    return true;
+}
+
+void cSharedMemoryCommunications::drainIncomingRings()
+{
+    for (int i = 0; i < numPartitions; i++) {
+        if (i == myProcId)
+            continue;
+        int receivedTag;
+        cMemCommBuffer *buffer = (cMemCommBuffer *)createCommBuffer();
+        while (readFromRing(i, buffer, receivedTag)) {
+            receivedBuffers.push_back({receivedTag, i, buffer});
+            buffer = (cMemCommBuffer *)createCommBuffer();
+        }
+        delete buffer;
+    }
+}
+
+bool cSharedMemoryCommunications::doReceive(cCommBuffer *buffer, int& receivedTag, int& sourceProcId)
+{
+    // query the rings in a round-robin fashion
+    rrBase = (rrBase+1) % numPartitions;
+    for (int k = 0; k < numPartitions; k++) {
+        int i = (rrBase+k) % numPartitions;
+        if (i != myProcId && readFromRing(i, (cMemCommBuffer *)buffer, receivedTag)) {
+            sourceProcId = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool cSharedMemoryCommunications::receive(int filtTag, cCommBuffer *buffer, int& receivedTag, int& sourceProcId)
+{
+    // return one from the previously buffered ones, if exist
+    for (auto it = receivedBuffers.begin(); it != receivedBuffers.end(); ++it) {
+        if (it->receivedTag == filtTag || filtTag == PARSIM_ANY_TAG) {
+            receivedTag = it->receivedTag;
+            sourceProcId = it->sourceProcId;
+            ((cMemCommBuffer*)buffer)->swap(it->buffer);
+            delete it->buffer;
+            receivedBuffers.erase(it);
+            return true;
+        }
+    }
+
+    // receive from the rings
+    bool recv = doReceive(buffer, receivedTag, sourceProcId);
+
+    // if received one with a wrong tag, store it for later and return false
+    if (recv && filtTag != PARSIM_ANY_TAG && filtTag != receivedTag) {
+        cMemCommBuffer *copy = (cMemCommBuffer *)createCommBuffer();
+        ((cMemCommBuffer*)buffer)->swap(copy);
+        receivedBuffers.push_back({receivedTag, sourceProcId, copy});
+        return false;
+    }
+    return recv;
+}
+
+bool cSharedMemoryCommunications::receiveBlocking(int filtTag, cCommBuffer *buffer, int& receivedTag, int& sourceProcId)
+{
+    // poll the rings; back off gradually to leave the CPU to other processes,
+    // and let the user interface process events about 10 times a second
+    flushDeferredBuffers();
+    int spins = 0;
+    int64_t lastIdleTime = opp_get_monotonic_clock_usecs();
+    while (!receive(filtTag, buffer, receivedTag, sourceProcId)) {
+        backoff(spins);
+        if (spins >= 1024) {
+            int64_t now = opp_get_monotonic_clock_usecs();
+            if (now - lastIdleTime > 100000) {
+                lastIdleTime = now;
+                if (getEnvir()->idle())
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool cSharedMemoryCommunications::receiveNonblocking(int filtTag, cCommBuffer *buffer, int& receivedTag, int& sourceProcId)
+{
+    flushDeferredBuffers();
+    return receive(filtTag, buffer, receivedTag, sourceProcId);
+}
+
+}  // namespace omnetpp
+
+#endif /* WITH_SHAREDMEMORYCOMM */
@@ -0,0 +1,220 @@
+//=========================================================================
+//  CSHAREDMEMORYCOMM.H - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+
+#ifndef __OMNETPP_CSHAREDMEMORYCOMM_H
+#define __OMNETPP_CSHAREDMEMORYCOMM_H
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include "omnetpp/opp_string.h"
+#include "omnetpp/cparsimcomm.h"
+
+// shared memory communications is only supported on POSIX systems
+#if !defined(_WIN32)
+#define WITH_SHAREDMEMORYCOMM
+#endif
+
+#ifdef WITH_SHAREDMEMORYCOMM
+
+namespace omnetpp {
+
+class cMemCommBuffer;
+
+/**
+ * @brief Implementation of the communications layer which uses shared memory.
+ *
+ * Each partition (process) creates a memory-mapped file that holds its
+ * incoming message queues, one for every other partition. The queues are
+ * lock-free single-producer single-consumer ring buffers: sending a message
+ * means copying the packed message into the destination's ring and advancing
+ * a write position; no system calls are involved. Receiving is likewise done
+ * by polling the rings. This makes it considerably faster than named pipes or
+ * MPI for running partitions on the cores of a single (multicore) machine.
+ *
+ * Messages are packed into cMemCommBuffer objects as usual. A message must fit
+ * into a ring; the size of the rings can be configured with the
+ * `parsim-sharedmemorycommunications-ringsize` option. When the destination's
+ * ring is full, send() waits until the receiver catches up, and meanwhile
+ * moves messages received from other partitions into a local buffer (so that
+ * partitions sending to each other cannot deadlock).
+ *
+ * Processes are started and assigned partition IDs the same way as with
+ * cNamedPipeCommunications (e.g. with the `-p` command-line option, or via
+ * opp_prun). The memory-mapped files are created in the directory given with
+ * the `parsim-sharedmemorycommunications-prefix` option; a tmpfs directory
+ * such as /dev/shm is recommended. Segments are stamped with a random nonce,
+ * and partitions exchange the nonces before starting, so files left behind
+ * by a crashed earlier run are never used.
+ *
+ * With `parsim-sharedmemorycommunications-mode = threads`, the partitions are
+ * threads of one process instead, each running its own cSimulation and cEnvir
+ * (see the Embedding chapter of the manual; the partition ID is still taken
+ * from the `-p` option in the arguments of the envir). Partitions with the same
+ * prefix form a group; the segments are allocated in memory, and the rings
+ * carry pointers to the communication buffers instead of their contents.
+ * By default (`parsim-sharedmemorycommunications-handover = true`), message
+ * objects are not even packed: the cMessage itself is handed over to the
+ * destination partition (see cHandoverCommBuffer). send() empties buffers
+ * that contain handed over messages. Since the sending code may still access
+ * the message after it has been passed to send(), such messages are only made
+ * visible to the destination at the next call into this object (the next send
+ * or receive).
+ *
+ * @ingroup Parsim
+ */
+class SIM_API cSharedMemoryCommunications : public cParsimCommunications
+{
+  public:
+    // layout of the shared memory segments; see the .cc file
+    struct SegmentHeader;
+    struct RingHeader;
+
+    // the partitions running as threads in this process with the same prefix
+    struct ThreadGroup;
+
+  protected:
+    // a ring buffer, as mapped into this process
+    struct Ring {
+        RingHeader *header = nullptr;
+        char *data = nullptr;
+    };
+
+    int numPartitions;
+    int myProcId;
+    opp_string prefix;
+    uint64_t ringCapacity;    // size of the data area of each ring; power of two
+    bool threadMode;          // whether partitions are threads of this process
+    bool handover;            // threads mode: whether to hand over message objects instead of packing them
+    ThreadGroup *threadGroup; // threads mode: the group we belong to
+
+    // memory-mapped segments; index: procId
+    void **segments;
+    size_t *segmentSizes;
+    uint64_t *segmentInodes;  // to detect when a peer's segment file gets replaced
+
+    Ring *inRings;            // rings we receive from; index: source procId
+    Ring *outRings;           // rings we send to (located in the other partitions' segments); index: destination procId
+    int rrBase;               // for round-robin scanning of incoming rings
+
+    // reordering buffer needed because of tag filtering support (filtTag),
+    // and for messages drained from the rings while send() was waiting
+    struct ReceivedBuffer {int receivedTag; int sourceProcId; cMemCommBuffer *buffer;};
+    std::list<ReceivedBuffer> receivedBuffers;
+
+    // threads mode: buffers with handed over messages, to be written into
+    // the rings at the next call (see class comment)
+    struct DeferredBuffer {int tag; int destProcId; cMemCommBuffer *buffer;};
+    std::list<DeferredBuffer> deferredBuffers;
+
+  protected:
+    std::string getSegmentFileName(int procId) const;
+    void *createSegment(int procId, size_t size);
+    void *openSegment(int procId, size_t& size, uint64_t& inode);
+    void mapPeerSegment(int procId);
+    bool isPeerSegmentReplaced(int procId);
+    void setupRing(Ring& ring, void *segment, int sourceProcId, uint64_t capacity);
+    void initSegment(void *segment);
+    void connectProcesses();
+    void joinThreadGroup();
+    void leaveThreadGroup();
+    void deleteQueuedBuffers(void *segment);
+    void writeToRing(int destProcId, cMemCommBuffer *buffer, int tag);
+    void flushDeferredBuffers();
+    bool readFromRing(int sourceProcId, cMemCommBuffer *buffer, int& receivedTag);
+    bool doReceive(cCommBuffer *buffer, int& receivedTag, int& sourceProcId);
+    bool receive(int filtTag, cCommBuffer *buffer, int& receivedTag, int& sourceProcId);
+    void drainIncomingRings();
+
+  public:
+    /**
+     * Constructor.
+     */
+    cSharedMemoryCommunications();
+
+    /**
+     * Destructor.
+     */
+    virtual ~cSharedMemoryCommunications();
+
+    /** @name Redefined methods from cParsimCommunications */
+    //@{
+    /**
+     * Init the library. Here we create our own shared memory segment, and
+     * map the segments of the other partitions (or in threads mode, wait
+     * for the other partitions of the group to start).
+     */
+    virtual void init(int numPartitions) override;
+
+    /**
+     * Shutdown the communications library. Unmaps the shared memory segments,
+     * and removes our own segment file. In threads mode, the segments are
+     * freed when the last partition of the group shuts down.
+     */
+    virtual void shutdown() override;
+
+    /**
+     * Returns true if the partitions are threads of this process.
+     */
+    bool isThreadMode() const {return threadMode;}
+
+    /**
+     * Returns total number of partitions.
+     */
+    virtual int getNumPartitions() const override;
+
+    /**
+     * Returns the id of this partition.
+     */
+    virtual int getProcId() const override;
+
+    /**
+     * Creates an empty buffer of type cMemCommBuffer, or cHandoverCommBuffer
+     * if message objects are handed over.
+     */
+    virtual cCommBuffer *createCommBuffer() override;
+
+    /**
+     * Recycle communication buffer after use.
+     */
+    virtual void recycleCommBuffer(cCommBuffer *buffer) override;
+
+    /**
+     * Sends packed data with given tag to destination.
+     */
+    virtual void send(cCommBuffer *buffer, int tag, int destination) override;
+
+    /**
+     * Receives packed data, and also returns tag and source procId.
+     * Normally returns true; false is returned if blocking was interrupted by the user.
+     */
+    virtual bool receiveBlocking(int filtTag, cCommBuffer *buffer, int& receivedTag, int& sourceProcId) override;
+
+    /**
+     * Receives packed data, and also returns tag and source procId.
+     * Call is non-blocking -- it returns true if something has been
+     * received, false otherwise.
+     */
+    virtual bool receiveNonblocking(int filtTag, cCommBuffer *buffer,  int& receivedTag, int& sourceProcId) override;
+    //@}
+};
+
+}  // namespace omnetpp
+
+#endif /* WITH_SHAREDMEMORYCOMM */
+
+#endif
+
@@ -0,0 +1,974 @@
+//=========================================================================
+//  CTIMEWARPPROT.CC - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include "omnetpp/cmessage.h"
+#include "omnetpp/cmodule.h"
+#include "omnetpp/cenvir.h"
+#include "omnetpp/cconfiguration.h"
+#include "omnetpp/cparsimcomm.h"
+#include "omnetpp/ccommbuffer.h"
+#include "omnetpp/cfutureeventset.h"
+#include "omnetpp/cexception.h"
+#include "omnetpp/errmsg.h"
+#include "omnetpp/globals.h"
+#include "omnetpp/cconfigoption.h"
+#include "omnetpp/regmacros.h"
+#include "omnetpp/simutil.h"
+#include "omnetpp/csimplemodule.h" // SendOptions
+#include "ctimewarpprot.h"
+
+#ifdef WITH_TIMEWARP
+
+#include <sys/wait.h>
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+#include "cmemcommbuffer.h"
+#include "ccommbufferbase.h"
+#include "cfilecomm.h"
+#include "cmpicomm.h"
+#include "csharedmemorycomm.h"
+#include "cparsimpartition.h"
+#include "messagetags.h"
+
+namespace omnetpp {
+
+Register_Class(cTimeWarpProtocol);
+
+Register_GlobalConfigOption(CFGID_PARSIM_TIMEWARP_CHECKPOINT_INTERVAL, "parsim-timewarp-checkpoint-interval", CFG_INT, "1000", "When `cTimeWarpProtocol` is selected as parsim synchronization class: the number of events between saving the state of the partition. Smaller values make rollbacks cheaper, but state saving more frequent.");
+Register_GlobalConfigOption(CFGID_PARSIM_TIMEWARP_MAX_CHECKPOINTS, "parsim-timewarp-max-checkpoints", CFG_INT, "32", "When `cTimeWarpProtocol` is selected as parsim synchronization class: the maximum number of saved states kept (each one is a suspended copy of the simulation process). When exceeded, the second oldest one is discarded.");
+Register_GlobalConfigOptionU(CFGID_PARSIM_TIMEWARP_GVT_INTERVAL, "parsim-timewarp-gvt-interval", "s", "0.1s", "When `cTimeWarpProtocol` is selected as parsim synchronization class: wall clock time between computations of the global virtual time (GVT). GVT is needed for discarding saved states that are no longer needed, and for ending the simulation.");
+extern cConfigOption *CFGID_PARSIM_DEBUG;  // registered in cparsimpartition.cc
+
+static void flushOutput()
+{
+    // flush buffers before fork(), so that their contents don't get duplicated
+    std::cout.flush();
+    std::cerr.flush();
+    fflush(nullptr);
+}
+
+static void writeFully(int fd, const char *p, int size)
+{
+    while (size > 0) {
+        ssize_t n = write(fd, p, size);
+        if (n == -1 && errno == EINTR)
+            continue;
+        if (n == -1)
+            throw cRuntimeError("cTimeWarpProtocol: Cannot resume checkpoint: %s", strerror(errno));
+        p += n;
+        size -= n;
+    }
+}
+
+static void writeHandover(int fd, cMemCommBuffer *buffer)
+{
+    int size = buffer->getMessageSize();
+    writeFully(fd, (const char *)&size, sizeof(size));
+    writeFully(fd, buffer->getBuffer(), size);
+}
+
+static cMemCommBuffer *readHandover(int fd)
+{
+    int size;
+    char *q = (char *)&size;
+    int remaining = sizeof(size);
+    while (remaining > 0) {
+        ssize_t n = read(fd, q, remaining);
+        if (n == -1 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return nullptr;  // EOF: we've been discarded
+        q += n;
+        remaining -= n;
+    }
+
+    cMemCommBuffer *buffer = new cMemCommBuffer();
+    buffer->allocateAtLeast(size);
+    q = buffer->getBuffer();
+    remaining = size;
+    while (remaining > 0) {
+        ssize_t n = read(fd, q, remaining);
+        if (n == -1 && errno == EINTR)
+            continue;
+        if (n <= 0) {
+            delete buffer;
+            return nullptr;
+        }
+        q += n;
+        remaining -= n;
+    }
+    buffer->setMessageSize(size);
+    return buffer;
+}
+
+cTimeWarpProtocol::cTimeWarpProtocol() : cParsimProtocolBase()
+{
+    numPartitions = 0;
+    myProcId = -1;
+    supervisorStarted = false;
+
+    debug = getEnvir()->getConfig()->getAsBool(CFGID_PARSIM_DEBUG);
+    checkpointInterval = getEnvir()->getConfig()->getAsInt(CFGID_PARSIM_TIMEWARP_CHECKPOINT_INTERVAL);
+    maxCheckpoints = getEnvir()->getConfig()->getAsInt(CFGID_PARSIM_TIMEWARP_MAX_CHECKPOINTS);
+    gvtInterval = getEnvir()->getConfig()->getAsDouble(CFGID_PARSIM_TIMEWARP_GVT_INTERVAL);
+    if (checkpointInterval < 1)
+        throw cRuntimeError("cTimeWarpProtocol: Invalid checkpoint interval %d, must be positive", checkpointInterval);
+    if (maxCheckpoints < 2)
+        throw cRuntimeError("cTimeWarpProtocol: Invalid maximum number of checkpoints %d, must be at least 2", maxCheckpoints);
+}
+
+cTimeWarpProtocol::~cTimeWarpProtocol()
+{
+    while (!checkpoints.empty())
+        discardCheckpoint(checkpoints.size()-1, true);
+}
+
+void cTimeWarpProtocol::startRun()
+{
+    EV << "starting Time Warp Protocol...\n";
+
+    // the communications layer must survive fork(), and we need access to raw buffer contents
+    if (dynamic_cast<cFileCommunications *>(comm))
+        throw cRuntimeError("cTimeWarpProtocol: cFileCommunications is not supported, use cSharedMemoryCommunications or cNamedPipeCommunications");
+#ifdef WITH_MPI
+    if (dynamic_cast<cMPICommunications *>(comm))
+        throw cRuntimeError("cTimeWarpProtocol: cMPICommunications is not supported (MPI does not support fork()), use cSharedMemoryCommunications or cNamedPipeCommunications");
+#endif
+#ifdef WITH_SHAREDMEMORYCOMM
+    cSharedMemoryCommunications *sharedMemoryComm = dynamic_cast<cSharedMemoryCommunications *>(comm);
+    if (sharedMemoryComm && sharedMemoryComm->isThreadMode())
+        throw cRuntimeError("cTimeWarpProtocol: cSharedMemoryCommunications is not supported in threads mode (partitions must be processes, to be able to fork()), set parsim-sharedmemorycommunications-mode=processes");
+#endif
+    cCommBuffer *buffer = comm->createCommBuffer();
+    bool isCommBufferBase = dynamic_cast<cCommBufferBase *>(buffer) != nullptr;
+    comm->recycleCommBuffer(buffer);
+    if (!isCommBufferBase)
+        throw cRuntimeError("cTimeWarpProtocol: Communications buffers must be subclassed from cCommBufferBase");
+
+    numPartitions = comm->getNumPartitions();
+    myProcId = comm->getProcId();
+
+    if (!supervisorStarted) {
+        startSupervisor();
+        supervisorStarted = true;
+    }
+
+    while (!checkpoints.empty())
+        discardCheckpoint(checkpoints.size()-1, true);
+    nextCheckpointId = 0;
+    eventsSinceCheckpoint = 0;
+    sentLog.clear();
+    receivedLog.clear();
+    nextSentSeq = 0;
+    nextReceivedSeq = 0;
+    nextSendId = 0;
+    pendingMessages.clear();
+    pendingMessageKeys.clear();
+    coastUntil = SIMTIME_ZERO;
+    replaying = false;
+    replayQueue.clear();
+    unprocessedBuffers.clear();
+
+    gvt = SIMTIME_ZERO;
+    gvtRound = 0;
+    gvtSnapshotTaken = false;
+    gvtLocalMin = SimTime::getMaxTime();
+    gvtMarkerReceived.assign(numPartitions, false);
+    gvtMarkersPending = 0;
+    gvtReportsPending = 0;
+    gvtReportedMin = SimTime::getMaxTime();
+    lastGvtRoundTime = opp_get_monotonic_clock_usecs();
+
+    loggingSuppressed = false;
+
+    numRollbacks = 0;
+    numRolledBackEvents = 0;
+    numAntiMessages = 0;
+    numCheckpoints = 0;
+    numCoastForwardEvents = 0;
+    numGvtRounds = 0;
+
+    EV << "  setup done.\n";
+}
+
+void cTimeWarpProtocol::endRun()
+{
+    if (loggingSuppressed) {
+        getEnvir()->loggingEnabled = true;
+        loggingSuppressed = false;
+    }
+    while (!checkpoints.empty())
+        discardCheckpoint(checkpoints.size()-1, true);
+}
+
+void cTimeWarpProtocol::lifecycleEvent(SimulationLifecycleEventType eventType, cObject *details)
+{
+    cParsimProtocolBase::lifecycleEvent(eventType, details);
+
+    if (eventType == LF_PRE_NETWORK_FINISH) {
+        cModule *network = sim->getSystemModule();
+        int64_t committedEvents = sim->getEventNumber();
+        int64_t totalEvents = committedEvents + numRolledBackEvents;
+        network->recordScalar("timewarp:rollbacks", numRollbacks);
+        network->recordScalar("timewarp:rolledBackEvents", numRolledBackEvents);
+        network->recordScalar("timewarp:coastForwardEvents", numCoastForwardEvents);
+        network->recordScalar("timewarp:antiMessages", numAntiMessages);
+        network->recordScalar("timewarp:checkpoints", numCheckpoints);
+        network->recordScalar("timewarp:gvtRounds", numGvtRounds);
+        network->recordScalar("timewarp:efficiency", totalEvents == 0 ? 1.0 : committedEvents / (double)totalEvents);
+    }
+}
+
+void cTimeWarpProtocol::startSupervisor()
+{
+    // Rolling back means that the current process exits and a checkpoint
+    // process continues, so the process started by the user might exit long
+    // before the simulation completes. To prevent that, we let a child process
+    // run the simulation, and wait here until all descendants have exited.
+    // On Linux we become the "subreaper" of orphaned descendants, so we can also
+    // collect their exit codes; elsewhere we only see the direct child's.
+    int fds[2];
+    if (pipe(fds) == -1)
+        throw cRuntimeError("cTimeWarpProtocol: Cannot create pipe: %s", strerror(errno));
+    flushOutput();
+#ifdef __linux__
+    prctl(PR_SET_CHILD_SUBREAPER, 1);
+#endif
+    pid_t pid = fork();
+    if (pid == -1)
+        throw cRuntimeError("cTimeWarpProtocol: fork() failed: %s", strerror(errno));
+    if (pid == 0) {
+        // child: the write end stays open in all descendants; nobody ever writes it
+        close(fds[0]);
+        return;
+    }
+
+    close(fds[1]);
+    signal(SIGINT, SIG_IGN);  // Ctrl-C is handled by the simulation process
+    signal(SIGTERM, SIG_IGN);
+    int exitCode = 0;
+    while (true) {
+        int status;
+        pid_t p = waitpid(-1, &status, 0);
+        if (p == -1 && errno == EINTR)
+            continue;
+        if (p == -1)
+            break;
+        if (WIFEXITED(status) && WEXITSTATUS(status) > exitCode)
+            exitCode = WEXITSTATUS(status);
+    }
+    char c;
+    while (read(fds[0], &c, 1) == -1 && errno == EINTR)
+        ;  // wait for EOF, i.e. all descendants to exit
+    _exit(exitCode);
+}
+
+void cTimeWarpProtocol::takeCheckpoint()
+{
+    cMemCommBuffer *handover = nullptr;
+    while (true) {
+        cMemCommBuffer *resumedWith = forkCheckpoint();
+        if (!resumedWith)
+            break;
+
+        // We are a checkpoint process that has just been resumed. Adopt the
+        // state of the process that rolled back, then replace the used-up
+        // checkpoint with a fresh one in the next iteration.
+        delete handover;
+        handover = resumedWith;
+        unpackState(handover);
+    }
+
+    if (handover) {
+        resume(handover);
+        delete handover;
+    }
+}
+
+cMemCommBuffer *cTimeWarpProtocol::forkCheckpoint()
+{
+    int fds[2];
+    if (pipe(fds) == -1)
+        throw cRuntimeError("cTimeWarpProtocol: Cannot create pipe: %s", strerror(errno));
+
+    Checkpoint checkpoint;
+    checkpoint.id = nextCheckpointId++;
+    checkpoint.time = sim->getSimTime();
+    checkpoint.eventNumber = sim->getEventNumber();
+    checkpoint.sentSeq = nextSentSeq;
+    checkpoint.receivedSeq = nextReceivedSeq;
+
+    getEnvir()->notifyLifecycleListeners(LF_PRE_STATE_SAVE);
+    flushOutput();
+    pid_t pid = fork();
+    if (pid == -1) {
+        close(fds[0]);
+        close(fds[1]);
+        throw cRuntimeError("cTimeWarpProtocol: fork() failed: %s", strerror(errno));
+    }
+    if (pid == 0) {
+        // we are the checkpoint: wait until we are resumed or discarded
+        close(fds[1]);
+        cMemCommBuffer *handover = readHandover(fds[0]);
+        close(fds[0]);
+        if (!handover)
+            _exit(0);
+
+        // discard the output of the events rolled back
+        getEnvir()->notifyLifecycleListeners(LF_POST_STATE_RESTORE);
+        return handover;
+    }
+
+    close(fds[0]);
+    checkpoint.pid = pid;
+    checkpoint.fd = fds[1];
+    checkpoints.push_back(checkpoint);
+    numCheckpoints++;
+    eventsSinceCheckpoint = 0;
+
+    if (debug)
+        EV << "checkpoint #" << checkpoint.id << " taken at t=" << checkpoint.time << ", event #" << checkpoint.eventNumber << "\n";
+
+    if ((int)checkpoints.size() > maxCheckpoints)
+        discardCheckpoint(1, true);
+    return nullptr;
+}
+
+void cTimeWarpProtocol::discardCheckpoint(int index, bool kill)
+{
+    Checkpoint& checkpoint = checkpoints[index];
+    if (kill) {
+        ::kill(checkpoint.pid, SIGKILL);
+        waitpid(checkpoint.pid, nullptr, 0);  // fails if not our child, that's OK
+    }
+    close(checkpoint.fd);
+    checkpoints.erase(checkpoints.begin() + index);
+}
+
+void cTimeWarpProtocol::rollback(simtime_t t)
+{
+    // find the newest checkpoint taken before t
+    int k = checkpoints.size() - 1;
+    while (k >= 0 && checkpoints[k].time >= t && checkpoints[k].eventNumber != 0)
+        k--;
+    if (k < 0)
+        throw cRuntimeError("cTimeWarpProtocol: Cannot roll back to t=%s, there is no checkpoint before that time (GVT=%s)",
+                t.str().c_str(), gvt.str().c_str());
+    Checkpoint& checkpoint = checkpoints[k];
+
+    if (debug)
+        EV << "rolling back to checkpoint #" << checkpoint.id << " at t=" << checkpoint.time << " (event #" << checkpoint.eventNumber << ") due to message at t=" << t << "\n";
+
+    numRollbacks++;
+    numRolledBackEvents += sim->getEventNumber() - checkpoint.eventNumber;
+
+    // cancel messages sent at or after t, and discard the checkpoints of the
+    // future we are abandoning
+    cancelSentMessages(t);
+    while ((int)checkpoints.size() > k+1)
+        discardCheckpoint(checkpoints.size()-1, true);
+
+    // also hand over buffers not processed yet: those left over from the
+    // previous rollback, and those the communications layer may have received
+    // while we were sending anti-messages
+    cCommBuffer *buffer = comm->createCommBuffer();
+    ReceivedBuffer item;
+    while (comm->receiveNonblocking(PARSIM_ANY_TAG, buffer, item.tag, item.sourceProcId)) {
+        cCommBufferBase *b = static_cast<cCommBufferBase *>(buffer);
+        item.data.assign(b->getBuffer(), b->getMessageSize());
+        unprocessedBuffers.push_back(item);
+    }
+    comm->recycleCommBuffer(buffer);
+
+    // pack everything the checkpoint process needs to continue from where we are
+    cMemCommBuffer *handover = new cMemCommBuffer();
+    packState(handover, k);
+    handover->pack(t);
+
+    // messages sent after the checkpoint that were not cancelled; they will
+    // be re-created (but not sent again) while coasting forward
+    int count = 0;
+    for (auto& entry : sentLog)
+        if (entry.seq >= checkpoint.sentSeq)
+            count++;
+    handover->pack(count);
+    for (auto& entry : sentLog) {
+        if (entry.seq >= checkpoint.sentSeq) {
+            handover->pack(entry.sendTime);
+            handover->pack(entry.arrivalTime);
+            handover->pack(entry.destProcId);
+            handover->pack(entry.sendId);
+        }
+    }
+
+    // buffers received since the checkpoint, including the one that caused the rollback
+    count = 0;
+    for (auto& entry : receivedLog)
+        if (entry.seq >= checkpoint.receivedSeq)
+            count++;
+    handover->pack(count);
+    for (auto& entry : receivedLog) {
+        if (entry.seq >= checkpoint.receivedSeq) {
+            handover->pack(entry.tag);
+            handover->pack(entry.sourceProcId);
+            handover->pack(entry.arrivalTime);
+            handover->pack(entry.eventNumber);
+            handover->pack((int)entry.data.size());
+            handover->pack(entry.data.data(), entry.data.size());
+        }
+    }
+    handover->pack((int)unprocessedBuffers.size());
+    for (auto& entry : unprocessedBuffers) {
+        handover->pack(entry.tag);
+        handover->pack(entry.sourceProcId);
+        handover->pack((int)entry.data.size());
+        handover->pack(entry.data.data(), entry.data.size());
+    }
+
+    writeHandover(checkpoint.fd, handover);
+
+    // the checkpoint process continues the simulation; this one has no future.
+    // Note: no flushOutput(), as buffered output belongs to rolled back events
+    _exit(0);
+}
+
+void cTimeWarpProtocol::resume(cMemCommBuffer *handover)
+{
+    // note: state has already been unpacked
+    simtime_t t;
+    handover->unpack(t);
+    coastUntil = t;
+
+    if (debug)
+        EV << "resumed at t=" << sim->getSimTime() << " (event #" << sim->getEventNumber() << "), coasting forward until t=" << coastUntil << "\n";
+
+    int count;
+    handover->unpack(count);
+    for (int i = 0; i < count; i++) {
+        SentMessage entry;
+        entry.seq = nextSentSeq++;
+        handover->unpack(entry.sendTime);
+        handover->unpack(entry.arrivalTime);
+        handover->unpack(entry.destProcId);
+        handover->unpack(entry.sendId);
+        sentLog.push_back(entry);
+    }
+
+    // buffers the process that rolled back has already seen; these cannot
+    // cause further rollbacks. They are replayed while coasting forward, see
+    // processDueReplays()
+    handover->unpack(count);
+    for (int i = 0; i < count; i++) {
+        ReceivedBuffer item;
+        int size;
+        item.seq = nextReceivedSeq++;
+        handover->unpack(item.tag);
+        handover->unpack(item.sourceProcId);
+        handover->unpack(item.arrivalTime);
+        handover->unpack(item.eventNumber);
+        handover->unpack(size);
+        item.data.resize(size);
+        handover->unpack(&item.data[0], size);
+        receivedLog.push_back(item);
+        replayQueue.push_back(item);
+    }
+    processDueReplays(false);
+
+    // then the ones it has not processed; these may cause a rollback again,
+    // which will hand over the rest
+    handover->unpack(count);
+    unprocessedBuffers.resize(count);
+    for (auto& item : unprocessedBuffers) {
+        int size;
+        handover->unpack(item.tag);
+        handover->unpack(item.sourceProcId);
+        handover->unpack(size);
+        item.data.resize(size);
+        handover->unpack(&item.data[0], size);
+    }
+    handover->assertBufferEmpty();
+
+    while (!unprocessedBuffers.empty()) {
+        ReceivedBuffer item = unprocessedBuffers.front();
+        unprocessedBuffers.pop_front();
+        replayBuffer(item.tag, item.sourceProcId, item.data);
+    }
+}
+
+void cTimeWarpProtocol::replayBuffer(int tag, int sourceProcId, const std::string& data)
+{
+    cCommBuffer *buffer = comm->createCommBuffer();
+    cCommBufferBase *b = static_cast<cCommBufferBase *>(buffer);
+    b->reset();
+    b->allocateAtLeast(data.size());
+    memcpy(b->getBuffer(), data.data(), data.size());
+    b->setMessageSize(data.size());
+    processReceivedBuffer(buffer, tag, sourceProcId);
+    comm->recycleCommBuffer(buffer);
+}
+
+void cTimeWarpProtocol::processDueReplays(bool all)
+{
+    // Buffers received before the rollback are replayed at the same point of
+    // the event sequence as they were originally processed, so that messages
+    // get the same insertion order in the FES as the first time, and events
+    // are re-executed in the same order. A buffer is due when the event after
+    // which it was originally received has been re-executed, or when its
+    // message would be earlier than the next event (as for the straggler).
+    // An anti-message is also due if its message is about to be executed.
+    // When coasting forward is over, the rest is processed at once.
+    // The queue is processed in order.
+    replaying = true;
+    while (!replayQueue.empty()) {
+        int last = -1;
+        if (all || sim->getSimTime() >= coastUntil)
+            last = replayQueue.size() - 1;
+        else {
+            cEvent *next = sim->getFES()->peekFirst();
+            simtime_t nextTime = next ? next->getArrivalTime() : SimTime::getMaxTime();
+            for (int i = 0; i < (int)replayQueue.size(); i++) {
+                ReceivedBuffer& item = replayQueue[i];
+                if (item.eventNumber <= sim->getEventNumber() || item.arrivalTime < nextTime ||
+                        (item.tag == TAG_TIMEWARP_ANTIMESSAGE && item.arrivalTime == nextTime))
+                    last = i;
+            }
+        }
+        if (last == -1)
+            break;
+        for (int i = 0; i <= last; i++) {
+            ReceivedBuffer item = replayQueue.front();
+            replayQueue.pop_front();
+            replayBuffer(item.tag, item.sourceProcId, item.data);
+        }
+    }
+    replaying = false;
+}
+
+void cTimeWarpProtocol::packState(cCommBuffer *buffer, int numCheckpointsKept)
+{
+    // checkpoints that are still alive
+    buffer->pack(nextSendId);
+    buffer->pack(nextCheckpointId);
+    buffer->pack(numCheckpointsKept);
+    for (int i = 0; i < numCheckpointsKept; i++)
+        buffer->pack(checkpoints[i].id);
+
+    // GVT computation
+    buffer->pack(gvt);
+    buffer->pack(gvtRound);
+    buffer->pack(gvtSnapshotTaken);
+    buffer->pack(gvtLocalMin);
+    for (int i = 0; i < numPartitions; i++)
+        buffer->pack((bool)gvtMarkerReceived[i]);
+    buffer->pack(gvtMarkersPending);
+    buffer->pack(gvtReportsPending);
+    buffer->pack(gvtReportedMin);
+    buffer->pack((long long)lastGvtRoundTime);
+
+    // statistics
+    buffer->pack((long long)numRollbacks);
+    buffer->pack((long long)numRolledBackEvents);
+    buffer->pack((long long)numAntiMessages);
+    buffer->pack((long long)numCheckpoints);
+    buffer->pack((long long)numCoastForwardEvents);
+    buffer->pack((long long)numGvtRounds);
+}
+
+void cTimeWarpProtocol::unpackState(cCommBuffer *buffer)
+{
+    // forget checkpoints discarded by the process that rolled back (they
+    // are not necessarily our children, so just close the pipe)
+    int count;
+    buffer->unpack(nextSendId);
+    buffer->unpack(nextCheckpointId);
+    buffer->unpack(count);
+    std::vector<int> aliveIds(count);
+    for (int i = 0; i < count; i++)
+        buffer->unpack(aliveIds[i]);
+    for (int i = checkpoints.size()-1; i >= 0; i--)
+        if (std::find(aliveIds.begin(), aliveIds.end(), checkpoints[i].id) == aliveIds.end())
+            discardCheckpoint(i, false);
+
+    long long tmp;
+    bool flag;
+    buffer->unpack(gvt);
+    buffer->unpack(gvtRound);
+    buffer->unpack(gvtSnapshotTaken);
+    buffer->unpack(gvtLocalMin);
+    for (int i = 0; i < numPartitions; i++) {
+        buffer->unpack(flag);
+        gvtMarkerReceived[i] = flag;
+    }
+    buffer->unpack(gvtMarkersPending);
+    buffer->unpack(gvtReportsPending);
+    buffer->unpack(gvtReportedMin);
+    buffer->unpack(tmp); lastGvtRoundTime = tmp;
+
+    buffer->unpack(tmp); numRollbacks = tmp;
+    buffer->unpack(tmp); numRolledBackEvents = tmp;
+    buffer->unpack(tmp); numAntiMessages = tmp;
+    buffer->unpack(tmp); numCheckpoints = tmp;
+    buffer->unpack(tmp); numCoastForwardEvents = tmp;
+    buffer->unpack(tmp); numGvtRounds = tmp;
+}
+
+void cTimeWarpProtocol::cancelSentMessages(simtime_t t)
+{
+    // sentLog is in nondecreasing order of send time
+    cCommBuffer *buffer = comm->createCommBuffer();
+    while (!sentLog.empty() && sentLog.back().sendTime >= t) {
+        SentMessage& entry = sentLog.back();
+        {if (debug) EV << "sending anti-message for send id=" << entry.sendId << " (arrival time " << entry.arrivalTime << ") to " << entry.destProcId << "\n";}
+        static_cast<cCommBufferBase *>(buffer)->reset();
+        buffer->pack(entry.arrivalTime);
+        buffer->pack(entry.sendId);
+        comm->send(buffer, TAG_TIMEWARP_ANTIMESSAGE, entry.destProcId);
+        numAntiMessages++;
+        sentLog.pop_back();
+    }
+    comm->recycleCommBuffer(buffer);
+}
+
+void cTimeWarpProtocol::logReceivedBuffer(cCommBuffer *buffer, int tag, int sourceProcId, simtime_t arrivalTime)
+{
+    cCommBufferBase *b = static_cast<cCommBufferBase *>(buffer);
+    receivedLog.push_back(ReceivedBuffer());
+    ReceivedBuffer& item = receivedLog.back();
+    item.seq = nextReceivedSeq++;
+    item.tag = tag;
+    item.sourceProcId = sourceProcId;
+    item.arrivalTime = arrivalTime;
+    item.eventNumber = sim->getEventNumber();
+    item.data.assign(b->getBuffer(), b->getMessageSize());
+}
+
+void cTimeWarpProtocol::processOutgoingMessage(cMessage *msg, const SendOptions& options, int destProcId, int destModuleId, int destGateId, void *data)
+{
+    // while coasting forward, messages have already been sent before the rollback
+    simtime_t now = sim->getSimTime();
+    if (now < coastUntil)
+        return;
+
+    SentMessage entry;
+    entry.seq = nextSentSeq++;
+    entry.sendTime = now;
+    entry.arrivalTime = msg->getArrivalTime();
+    entry.destProcId = destProcId;
+    entry.sendId = nextSendId++;
+    sentLog.push_back(entry);
+
+    cCommBuffer *buffer = comm->createCommBuffer();
+    buffer->pack(entry.arrivalTime);
+    buffer->pack(entry.sendId);
+    buffer->pack(destModuleId);
+    buffer->pack(destGateId);
+    packOptions(buffer, options);
+    buffer->packObject(msg);
+    comm->send(buffer, TAG_TIMEWARP_MESSAGE, destProcId);
+    comm->recycleCommBuffer(buffer);
+}
+
+void cTimeWarpProtocol::processReceivedBuffer(cCommBuffer *buffer, int tag, int sourceProcId)
+{
+    switch (tag) {
+        case TAG_TIMEWARP_MESSAGE:
+        case TAG_TIMEWARP_ANTIMESSAGE: {
+            simtime_t t;
+            long long sendId;
+            buffer->unpack(t);
+            buffer->unpack(sendId);
+            MessageKey key(sourceProcId, sendId);
+
+            // replayed buffers have been logged on resume
+            if (!replaying)
+                logReceivedBuffer(buffer, tag, sourceProcId, t);
+
+            // the message being cancelled may be still waiting to be replayed
+            if (!replaying && tag == TAG_TIMEWARP_ANTIMESSAGE && !replayQueue.empty() && pendingMessages.find(key) == pendingMessages.end())
+                processDueReplays(true);
+
+            bool alreadyProcessed = tag == TAG_TIMEWARP_ANTIMESSAGE && pendingMessages.find(key) == pendingMessages.end();
+            if (replaying) {
+                if (t < sim->getSimTime() || alreadyProcessed)
+                    throw cRuntimeError("cTimeWarpProtocol: Internal error: Replayed message from procId=%d (t=%s) would cause a rollback", sourceProcId, t.str().c_str());
+            }
+            else {
+                // message in transit during the GVT computation
+                if (gvtSnapshotTaken && !gvtMarkerReceived[sourceProcId] && t < gvtLocalMin)
+                    gvtLocalMin = t;
+
+                // straggler, or cancelling a message we have already processed
+                if (t < sim->getSimTime() || alreadyProcessed)
+                    rollback(t);
+
+                // affects events we are about to re-execute: stop coasting there
+                if (t < coastUntil) {
+                    cancelSentMessages(t);
+                    coastUntil = t;
+                }
+            }
+
+            if (tag == TAG_TIMEWARP_MESSAGE) {
+                int destModuleId;
+                int destGateId;
+                buffer->unpack(destModuleId);
+                buffer->unpack(destGateId);
+                SendOptions options = unpackOptions(buffer);
+                cMessage *msg = (cMessage *)buffer->unpackObject();
+                processReceivedMessage(msg, options, destModuleId, destGateId, sourceProcId);
+                pendingMessages[key] = msg;  // note: destination gate is the end of the path, so msg is in the FES now
+                pendingMessageKeys[msg] = key;
+            }
+            else {
+                auto it = pendingMessages.find(key);
+                cMessage *msg = it->second;
+                {if (debug) EV << "anti-message from " << sourceProcId << " annihilates '" << msg->getName() << "' (arrival time " << t << ")\n";}
+                pendingMessageKeys.erase(msg);
+                pendingMessages.erase(it);
+                sim->getFES()->remove(msg);
+                delete msg;
+            }
+            break;
+        }
+
+        case TAG_TIMEWARP_GVTMARKER: {
+            int round;
+            buffer->unpack(round);
+            processGvtMarker(round, sourceProcId);
+            break;
+        }
+
+        case TAG_TIMEWARP_GVTREPORT: {
+            simtime_t localMin;
+            buffer->unpack(localMin);
+            processGvtReport(localMin);
+            break;
+        }
+
+        case TAG_TIMEWARP_GVT: {
+            simtime_t newGvt;
+            buffer->unpack(newGvt);
+            processGvt(newGvt);
+            break;
+        }
+
+        default: {
+            partition->processReceivedBuffer(buffer, tag, sourceProcId);
+            break;
+        }
+    }
+    buffer->assertBufferEmpty();
+}
+
+simtime_t cTimeWarpProtocol::getLocalMinTime()
+{
+    cEvent *event = sim->getFES()->peekFirst();
+    simtime_t t = event ? event->getArrivalTime() : SimTime::getMaxTime();
+    for (auto& item : replayQueue)
+        if (item.arrivalTime < t)
+            t = item.arrivalTime;
+    return t;
+}
+
+void cTimeWarpProtocol::startGvtRound()
+{
+    // only on procId 0
+    numGvtRounds++;
+    lastGvtRoundTime = opp_get_monotonic_clock_usecs();
+    gvtRound++;
+    gvtReportsPending = numPartitions;
+    gvtReportedMin = SimTime::getMaxTime();
+    takeGvtSnapshot();
+}
+
+void cTimeWarpProtocol::takeGvtSnapshot()
+{
+    // Record our local minimum, and send a marker to everyone. Until the marker
+    // from a partition arrives, messages received from it were in transit at
+    // the time of the snapshot, and have to be counted as well.
+    gvtSnapshotTaken = true;
+    gvtLocalMin = getLocalMinTime();
+    gvtMarkersPending = numPartitions - 1;
+    for (int i = 0; i < numPartitions; i++)
+        gvtMarkerReceived[i] = (i == myProcId);
+
+    cCommBuffer *buffer = comm->createCommBuffer();
+    buffer->pack(gvtRound);
+    comm->broadcast(buffer, TAG_TIMEWARP_GVTMARKER);
+    comm->recycleCommBuffer(buffer);
+
+    if (gvtMarkersPending == 0)
+        gvtSnapshotCompleted();
+}
+
+void cTimeWarpProtocol::processGvtMarker(int round, int sourceProcId)
+{
+    if (round != gvtRound) {
+        // first marker in this round
+        ASSERT(!gvtSnapshotTaken);
+        gvtRound = round;
+        takeGvtSnapshot();
+    }
+    ASSERT(gvtSnapshotTaken && !gvtMarkerReceived[sourceProcId]);
+    gvtMarkerReceived[sourceProcId] = true;
+    if (--gvtMarkersPending == 0)
+        gvtSnapshotCompleted();
+}
+
+void cTimeWarpProtocol::gvtSnapshotCompleted()
+{
+    gvtSnapshotTaken = false;
+    if (myProcId == 0) {
+        processGvtReport(gvtLocalMin);
+    }
+    else {
+        cCommBuffer *buffer = comm->createCommBuffer();
+        buffer->pack(gvtLocalMin);
+        comm->send(buffer, TAG_TIMEWARP_GVTREPORT, 0);
+        comm->recycleCommBuffer(buffer);
+    }
+}
+
+void cTimeWarpProtocol::processGvtReport(simtime_t localMin)
+{
+    // only on procId 0
+    if (localMin < gvtReportedMin)
+        gvtReportedMin = localMin;
+    if (--gvtReportsPending == 0) {
+        if (numPartitions > 1) {
+            cCommBuffer *buffer = comm->createCommBuffer();
+            buffer->pack(gvtReportedMin);
+            comm->broadcast(buffer, TAG_TIMEWARP_GVT);
+            comm->recycleCommBuffer(buffer);
+        }
+        processGvt(gvtReportedMin);
+    }
+}
+
+void cTimeWarpProtocol::processGvt(simtime_t newGvt)
+{
+    if (newGvt <= gvt)
+        return;
+    {if (debug) EV << "new GVT=" << newGvt << "\n";}
+    gvt = newGvt;
+    fossilCollect();
+}
+
+void cTimeWarpProtocol::fossilCollect()
+{
+    // we can never roll back to earlier than GVT, so only the newest
+    // checkpoint taken before GVT and the ones after it are needed
+    int k = checkpoints.size() - 1;
+    while (k >= 0 && checkpoints[k].time >= gvt && checkpoints[k].eventNumber != 0)
+        k--;
+    for (int i = 0; i < k; i++)
+        discardCheckpoint(0, true);
+
+    if (!checkpoints.empty()) {
+        while (!sentLog.empty() && sentLog.front().seq < checkpoints[0].sentSeq)
+            sentLog.pop_front();
+        while (!receivedLog.empty() && receivedLog.front().seq < checkpoints[0].receivedSeq)
+            receivedLog.pop_front();
+    }
+}
+
+bool cTimeWarpProtocol::waitForMessages()
+{
+    return receiveBlocking();
+}
+
+cEvent *cTimeWarpProtocol::takeNextEvent()
+{
+    cEvent *event;
+    while (true) {
+        // process messages from other partitions (this may roll us back),
+        // and those from before the rollback that are due; the latter must
+        // be done before taking a checkpoint
+        receiveNonblocking();
+        processDueReplays(false);
+
+        // save the state from time to time; not while coasting forward, because
+        // the sent messages log contains messages "from the future" then
+        if ((checkpoints.empty() && sim->getEventNumber() == 0) || (eventsSinceCheckpoint >= checkpointInterval && sim->getSimTime() >= coastUntil))
+            takeCheckpoint();
+
+        bool gvtRoundInProgress = gvtReportsPending > 0;
+        if (myProcId == 0 && !gvtRoundInProgress && opp_get_monotonic_clock_usecs() - lastGvtRoundTime >= gvtInterval*1e6)
+            startGvtRound();
+
+        // a resumed checkpoint may have changed the FES since the above
+        processDueReplays(false);
+
+        // messages can be processed optimistically; other events (e.g. the
+        // end of the simulation) cannot be undone, so they have to wait for GVT
+        event = sim->getFES()->peekFirst();
+        if (event && (event->isMessage() || event->getArrivalTime() <= gvt))
+            break;
+        if (!event && gvt == SimTime::getMaxTime())
+            throw cTerminationException(E_ENDEDOK);
+
+        // nothing to do until GVT advances or messages arrive
+        if (myProcId == 0 && gvtReportsPending == 0)
+            startGvtRound();
+        {if (debug) EV << "waiting for messages or GVT to advance (GVT=" << gvt << ")\n";}
+        if (!waitForMessages())
+            return nullptr;
+    }
+
+    // remove event from FES and return it
+    cEvent *tmp = sim->getFES()->removeFirst();
+    ASSERT(tmp == event);
+    if (event->isMessage()) {
+        auto it = pendingMessageKeys.find(static_cast<cMessage *>(event));
+        if (it != pendingMessageKeys.end()) {
+            pendingMessages.erase(it->second);
+            pendingMessageKeys.erase(it);
+        }
+    }
+    if (event->getArrivalTime() < coastUntil)
+        numCoastForwardEvents++;
+    eventsSinceCheckpoint++;
+
+    // suppress the log output of events that may be rolled back, and that of
+    // events re-executed while coasting forward, as it cannot be taken back
+    bool mayBeUndone = event->getArrivalTime() >= gvt || event->getArrivalTime() < coastUntil;
+    if (mayBeUndone && getEnvir()->loggingEnabled) {
+        getEnvir()->loggingEnabled = false;
+        loggingSuppressed = true;
+    }
+    else if (!mayBeUndone && loggingSuppressed) {
+        getEnvir()->loggingEnabled = true;
+        loggingSuppressed = false;
+    }
+    return event;
+}
+
+void cTimeWarpProtocol::putBackEvent(cEvent *event)
+{
+    throw cRuntimeError("cTimeWarpProtocol: \"Run Until Event/Module\" functionality "
+                        "cannot be used with this scheduler (putBackEvent() not implemented)");
+}
+
+}  // namespace omnetpp
+
+#endif /* WITH_TIMEWARP */
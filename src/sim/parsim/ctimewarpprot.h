@@ -0,0 +1,257 @@
+//=========================================================================
+//  CTIMEWARPPROT.H - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_CTIMEWARPPROT_H
+#define __OMNETPP_CTIMEWARPPROT_H
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "cparsimprotocolbase.h"
+
+// state saving relies on fork(), so Time Warp is only supported on POSIX systems
+#if !defined(_WIN32)
+#define WITH_TIMEWARP
+#endif
+
+#ifdef WITH_TIMEWARP
+
+#include <sys/types.h>
+
+namespace omnetpp {
+
+class cCommBuffer;
+class cMemCommBuffer;
+
+/**
+ * @brief Implements optimistic synchronization (Time Warp).
+ *
+ * Partitions process events without waiting for each other. When a message
+ * arrives with a timestamp smaller than the current simulation time (a
+ * "straggler"), or an anti-message cancels a message that has already been
+ * processed, the partition rolls back to an earlier saved state, cancels
+ * the messages it sent after that point by sending anti-messages, and
+ * re-executes the events.
+ *
+ * State saving is done by checkpointing the whole process with fork():
+ * every `parsim-timewarp-checkpoint-interval` events, a copy of the process
+ * is created which remains suspended (its memory is shared with the running
+ * process copy-on-write). Rolling back means handing over the messages
+ * received since the checkpoint to the checkpoint process and letting it
+ * continue, while the current process exits. Between the checkpoint and the
+ * time of the straggler, events are re-executed without sending messages
+ * ("coast forward"), as those messages have already been sent. This requires
+ * that re-executing the same events produces the same outgoing messages.
+ *
+ * Global virtual time (GVT), the time before which no rollback can occur,
+ * is computed periodically (every `parsim-timewarp-gvt-interval` seconds of
+ * wall clock time) with a marker-based distributed snapshot coordinated by
+ * partition 0. Checkpoints that can no longer be rolled back to are discarded
+ * (fossil collection). Events that cannot be undone, like the one that ends
+ * the simulation at `sim-time-limit`, are only executed after GVT has
+ * passed them.
+ *
+ * Processes that roll back may exit before the simulation completes, so the
+ * process started by the user stays around until the simulation completes,
+ * and returns its exit code. The communications library must survive fork(),
+ * so cSharedMemoryCommunications or cNamedPipeCommunications are required.
+ *
+ * Log output cannot be taken back once written, so it is suppressed for
+ * events that may still be rolled back (i.e. all events GVT has not passed
+ * yet), and for events re-executed while coasting forward. Output files are
+ * rolled back instead: LF_PRE_STATE_SAVE is fired before a checkpoint is
+ * taken, and LF_POST_STATE_RESTORE when a checkpoint process is resumed,
+ * upon which the text-based output vector and scalar managers and the
+ * eventlog manager truncate their files to their sizes at the checkpoint.
+ * Output written by rolled back events is thereby discarded, and written
+ * again when the events are re-executed.
+ *
+ * Statistics about rollbacks and efficiency are recorded as scalars of the
+ * network module.
+ *
+ * @ingroup Parsim
+ */
+class SIM_API cTimeWarpProtocol : public cParsimProtocolBase
+{
+  protected:
+    // identifies a message: source procId, send ID in the source partition
+    typedef std::pair<int,long long> MessageKey;
+
+    // a saved state: a suspended copy of this process
+    struct Checkpoint {
+        int id;
+        pid_t pid;
+        int fd;                     // write end of the pipe the checkpoint process waits on
+        simtime_t time;             // simulation time when the checkpoint was taken
+        eventnumber_t eventNumber;  // event number when the checkpoint was taken; 0 for the initial checkpoint
+        uint64_t sentSeq;           // sentLog position when the checkpoint was taken
+        uint64_t receivedSeq;       // receivedLog position when the checkpoint was taken
+    };
+
+    // a message sent to another partition, which may need to be cancelled
+    struct SentMessage {
+        uint64_t seq;
+        simtime_t sendTime;
+        simtime_t arrivalTime;
+        int destProcId;
+        long long sendId;           // never reused, not even after rollbacks
+    };
+
+    // a buffer received from another partition, to be replayed after a rollback
+    struct ReceivedBuffer {
+        uint64_t seq;
+        int tag;
+        int sourceProcId;
+        simtime_t arrivalTime;      // of the message, or of the message cancelled by the anti-message
+        eventnumber_t eventNumber;  // the number of the last event executed before it was received
+        std::string data;
+    };
+
+    int numPartitions;
+    int myProcId;
+    bool debug;
+
+    // configuration
+    int checkpointInterval;     // in events
+    int maxCheckpoints;
+    double gvtInterval;         // in seconds (wall clock)
+
+    // state saving
+    bool supervisorStarted;
+    std::vector<Checkpoint> checkpoints;  // oldest first
+    int nextCheckpointId;
+    int eventsSinceCheckpoint;
+    std::deque<SentMessage> sentLog;      // since the oldest checkpoint
+    std::deque<ReceivedBuffer> receivedLog;  // since the oldest checkpoint
+    uint64_t nextSentSeq;
+    uint64_t nextReceivedSeq;
+    long long nextSendId;
+    std::map<MessageKey,cMessage*> pendingMessages;  // received but not yet processed messages
+    std::unordered_map<cMessage*,MessageKey> pendingMessageKeys;  // reverse of pendingMessages
+    simtime_t coastUntil;       // after a rollback, events before this time are re-executed without sending messages
+    bool replaying;             // true while replaying received buffers after a rollback
+    std::deque<ReceivedBuffer> replayQueue;  // received before the rollback, to be replayed at the same point of the event sequence
+    std::deque<ReceivedBuffer> unprocessedBuffers;  // handed over on rollback, not processed yet
+
+    // GVT computation
+    simtime_t gvt;
+    int gvtRound;
+    bool gvtSnapshotTaken;      // true between taking our local snapshot and receiving all markers
+    simtime_t gvtLocalMin;      // our local minimum in the current round
+    std::vector<bool> gvtMarkerReceived;  // index: source procId
+    int gvtMarkersPending;
+    int gvtReportsPending;      // procId 0 only: reports (including our own) still to arrive
+    simtime_t gvtReportedMin;   // procId 0 only: minimum of the reports so far
+    int64_t lastGvtRoundTime;   // procId 0 only: wall clock time the last round was started
+
+    bool loggingSuppressed;     // whether we have turned off logging in cEnvir
+
+    // statistics
+    int64_t numRollbacks;
+    int64_t numRolledBackEvents;
+    int64_t numAntiMessages;
+    int64_t numCheckpoints;
+    int64_t numCoastForwardEvents;
+    int64_t numGvtRounds;
+
+  protected:
+    // records statistics before the network's finish()
+    virtual void lifecycleEvent(SimulationLifecycleEventType eventType, cObject *details) override;
+
+    // process buffers coming from other partitions
+    virtual void processReceivedBuffer(cCommBuffer *buffer, int tag, int sourceProcId) override;
+
+    // keeps the process started by the user around until the simulation completes
+    virtual void startSupervisor();
+
+    // state saving
+    virtual void takeCheckpoint();
+    virtual cMemCommBuffer *forkCheckpoint();
+    virtual void discardCheckpoint(int index, bool kill);
+    virtual void rollback(simtime_t t);  // does not return
+    virtual void resume(cMemCommBuffer *handover);
+    virtual void cancelSentMessages(simtime_t t);
+    virtual void logReceivedBuffer(cCommBuffer *buffer, int tag, int sourceProcId, simtime_t arrivalTime);
+    virtual void replayBuffer(int tag, int sourceProcId, const std::string& data);
+    virtual void processDueReplays(bool all);
+    virtual void packState(cCommBuffer *buffer, int numCheckpointsKept);
+    virtual void unpackState(cCommBuffer *buffer);
+
+    // GVT computation
+    virtual simtime_t getLocalMinTime();
+    virtual void startGvtRound();
+    virtual void takeGvtSnapshot();
+    virtual void processGvtMarker(int round, int sourceProcId);
+    virtual void gvtSnapshotCompleted();
+    virtual void processGvtReport(simtime_t localMin);
+    virtual void processGvt(simtime_t newGvt);
+    virtual void fossilCollect();
+
+    // waits until something arrives or the user interrupts (returns false then)
+    virtual bool waitForMessages();
+
+  public:
+    /**
+     * Constructor.
+     */
+    cTimeWarpProtocol();
+
+    /**
+     * Destructor.
+     */
+    virtual ~cTimeWarpProtocol();
+
+    /**
+     * Called at the beginning of a simulation run.
+     */
+    virtual void startRun() override;
+
+    /**
+     * Called at the end of a simulation run. Discards all checkpoints.
+     */
+    virtual void endRun() override;
+
+    /**
+     * Scheduler function. Takes checkpoints, processes messages from
+     * other partitions (possibly rolling back), and participates in the
+     * GVT computation.
+     */
+    virtual cEvent *takeNextEvent() override;
+
+    /**
+     * Undo takeNextEvent() -- it comes from the cScheduler interface.
+     */
+    virtual void putBackEvent(cEvent *event) override;
+
+    /**
+     * Sends the message to the given partition, and remembers it so that
+     * it can be cancelled with an anti-message on rollback.
+     */
+    virtual void processOutgoingMessage(cMessage *msg, const SendOptions& options, int procId, int moduleId, int gateId, void *data) override;
+
+    /**
+     * Returns the last computed global virtual time.
+     */
+    simtime_t getGvt() const {return gvt;}
+};
+
+}  // namespace omnetpp
+
+#endif /* WITH_TIMEWARP */
+
+#endif
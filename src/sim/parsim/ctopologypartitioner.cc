@@ -0,0 +1,391 @@
+//=========================================================================
+//  CTOPOLOGYPARTITIONER.CC - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#include <algorithm>
+#include "omnetpp/cmodule.h"
+#include "omnetpp/cgate.h"
+#include "omnetpp/cchannel.h"
+#include "omnetpp/cpar.h"
+#include "omnetpp/ctopology.h"
+#include "omnetpp/cexception.h"
+#include "ctopologypartitioner.h"
+
+namespace omnetpp {
+
+static bool isNetworkSubmodule(cModule *module, void *network)
+{
+    return module->getParentModule() == (cModule *)network;
+}
+
+static double countSimpleModules(cModule *module)
+{
+    if (!module->isSimple() && !module->isPlaceholder()) {
+        double count = 0;
+        for (cModule::SubmoduleIterator it(module); !it.end(); ++it)
+            count += countSimpleModules(*it);
+        return count;
+    }
+    return 1;
+}
+
+static simtime_t collectPathDelay(cGate *srcGate, cGate *destGate)
+{
+    simtime_t sum = SIMTIME_ZERO;
+    for (cGate *g = srcGate; g && g != destGate; g = g->getNextGate()) {
+        cChannel *chan = g->getChannel();
+        if (chan && chan->hasPar("delay"))
+            sum += chan->par("delay").doubleValue();
+    }
+    return sum;
+}
+
+cTopologyPartitioner::cTopologyPartitioner()
+{
+    numPartitions = 0;
+    maxImbalance = 0.05;
+}
+
+void cTopologyPartitioner::extractFromNetwork(cModule *network)
+{
+    networkName = network->getFullPath();
+    nodes.clear();
+    edges.clear();
+    numPartitions = 0;
+
+    cTopology topo;
+    topo.extractFromNetwork(isNetworkSubmodule, (void *)network);
+
+    for (int i = 0; i < topo.getNumNodes(); i++) {
+        cModule *module = topo.getNode(i)->getModule();
+        Node node;
+        node.fullPath = module->getFullPath();
+        node.cost = std::max(1.0, countSimpleModules(module));
+        node.partition = -1;
+        nodes.push_back(node);
+    }
+
+    // merge parallel links (in both directions) into one edge
+    std::map<cTopology::Node *,int> nodeIndex;
+    for (int i = 0; i < topo.getNumNodes(); i++)
+        nodeIndex[topo.getNode(i)] = i;
+    std::map<std::pair<int,int>,int> edgeIndex;
+    for (int i = 0; i < topo.getNumNodes(); i++) {
+        cTopology::Node *srcNode = topo.getNode(i);
+        for (int j = 0; j < srcNode->getNumOutLinks(); j++) {
+            cTopology::LinkOut *link = srcNode->getLinkOut(j);
+            int destIndex = nodeIndex[link->getRemoteNode()];
+            if (destIndex == i)
+                continue;  // loopback within a submodule: irrelevant for partitioning
+            simtime_t delay = collectPathDelay(link->getLocalGate(), link->getRemoteGate());
+            std::pair<int,int> key(std::min(i, destIndex), std::max(i, destIndex));
+            auto it = edgeIndex.find(key);
+            if (it == edgeIndex.end()) {
+                Edge edge;
+                edge.node1 = key.first;
+                edge.node2 = key.second;
+                edge.numLinks = 1;
+                edge.minDelay = delay;
+                edge.weight = 0;
+                edgeIndex[key] = edges.size();
+                edges.push_back(edge);
+            }
+            else {
+                Edge& edge = edges[it->second];
+                edge.numLinks++;
+                if (delay < edge.minDelay)
+                    edge.minDelay = delay;
+            }
+        }
+    }
+
+    adjacentEdges.assign(nodes.size(), std::vector<int>());
+    for (int i = 0; i < (int)edges.size(); i++) {
+        adjacentEdges[edges[i].node1].push_back(i);
+        adjacentEdges[edges[i].node2].push_back(i);
+    }
+    computeEdgeWeights();
+}
+
+void cTopologyPartitioner::computeEdgeWeights()
+{
+    // Each link costs maxDelay/delay: the link with the longest delay costs 1,
+    // a link with one tenth of that delay costs 10. Zero-delay links cost
+    // more than all other links together, so they are only cut if unavoidable.
+    simtime_t maxDelay = SIMTIME_ZERO;
+    for (auto& edge : edges)
+        if (edge.minDelay > maxDelay)
+            maxDelay = edge.minDelay;
+    double sum = 0;
+    for (auto& edge : edges) {
+        if (edge.minDelay > SIMTIME_ZERO) {
+            edge.weight = edge.numLinks * (maxDelay / edge.minDelay);
+            sum += edge.weight;
+        }
+    }
+    for (auto& edge : edges)
+        if (edge.minDelay <= SIMTIME_ZERO)
+            edge.weight = edge.numLinks * (sum + 1);
+}
+
+double cTopologyPartitioner::getConnectivity(int node, int partition) const
+{
+    double sum = 0;
+    for (int e : adjacentEdges[node]) {
+        const Edge& edge = edges[e];
+        int other = edge.node1 == node ? edge.node2 : edge.node1;
+        if (nodes[other].partition == partition)
+            sum += edge.weight;
+    }
+    return sum;
+}
+
+void cTopologyPartitioner::partition(int n)
+{
+    if (n < 1)
+        throw cRuntimeError("cTopologyPartitioner: Invalid number of partitions %d", n);
+    if (n > (int)nodes.size())
+        throw cRuntimeError("cTopologyPartitioner: Cannot distribute %d submodules of '%s' among %d partitions",
+                (int)nodes.size(), networkName.c_str(), n);
+    numPartitions = n;
+    for (auto& node : nodes)
+        node.partition = -1;
+    growPartitions();
+    refine();
+}
+
+void cTopologyPartitioner::growPartitions()
+{
+    const int UNASSIGNED = -1;
+    double totalCost = 0;
+    for (auto& node : nodes)
+        totalCost += node.cost;
+
+    int numUnassigned = nodes.size();
+    double remainingCost = totalCost;
+    for (int p = 0; p < numPartitions-1; p++) {
+        // leave at least one node for each of the remaining partitions
+        double target = remainingCost / (numPartitions - p);
+        int maxNodes = numUnassigned - (numPartitions - p - 1);
+
+        // start from the node least connected to the rest, i.e. from the "edge" of the graph
+        int seed = -1;
+        double seedConnectivity = 0;
+        for (int i = 0; i < (int)nodes.size(); i++) {
+            if (nodes[i].partition == UNASSIGNED) {
+                double connectivity = getConnectivity(i, UNASSIGNED);
+                if (seed == -1 || connectivity < seedConnectivity) {
+                    seed = i;
+                    seedConnectivity = connectivity;
+                }
+            }
+        }
+
+        // grow the partition by adding the node most strongly connected to it
+        double load = 0;
+        int count = 0;
+        int next = seed;
+        while (next != -1) {
+            nodes[next].partition = p;
+            load += nodes[next].cost;
+            count++;
+            numUnassigned--;
+            if (count == maxNodes)
+                break;
+
+            next = -1;
+            double nextConnectivity = -1;
+            for (int i = 0; i < (int)nodes.size(); i++) {
+                if (nodes[i].partition == UNASSIGNED) {
+                    double connectivity = getConnectivity(i, p);
+                    if (connectivity > nextConnectivity) {
+                        next = i;
+                        nextConnectivity = connectivity;
+                    }
+                }
+            }
+            // stop if adding the node would overshoot the target more than stopping undershoots it
+            if (next != -1 && load + nodes[next].cost/2 > target)
+                next = -1;
+        }
+        remainingCost -= load;
+    }
+
+    for (auto& node : nodes)
+        if (node.partition == UNASSIGNED)
+            node.partition = numPartitions - 1;
+}
+
+void cTopologyPartitioner::refine()
+{
+    std::vector<double> load(numPartitions, 0);
+    std::vector<int> count(numPartitions, 0);
+    double totalCost = 0, maxNodeCost = 0;
+    for (auto& node : nodes) {
+        load[node.partition] += node.cost;
+        count[node.partition]++;
+        totalCost += node.cost;
+        maxNodeCost = std::max(maxNodeCost, node.cost);
+    }
+    double maxLoad = std::max(totalCost / numPartitions * (1 + maxImbalance), maxNodeCost);
+
+    auto moveNode = [&](int i, int to) {
+        int from = nodes[i].partition;
+        load[from] -= nodes[i].cost;
+        count[from]--;
+        load[to] += nodes[i].cost;
+        count[to]++;
+        nodes[i].partition = to;
+    };
+
+    // First, fix overloaded partitions, moving the nodes which cost the least
+    // cut weight. Then do passes that move nodes with positive gain, or with
+    // zero gain if that improves balance. Each move strictly decreases the
+    // cut weight, or keeps it and reduces the larger of the two loads involved,
+    // so the loop terminates; the pass limit is just a safety net.
+    const int MAX_PASSES = 100;
+    for (int pass = 0; pass < MAX_PASSES; pass++) {
+        bool moved = false;
+        for (int p = 0; p < numPartitions; p++) {
+            while (load[p] > maxLoad && count[p] > 1) {
+                int bestNode = -1, bestTo = -1;
+                double bestGain = 0;
+                for (int i = 0; i < (int)nodes.size(); i++) {
+                    if (nodes[i].partition != p)
+                        continue;
+                    double own = getConnectivity(i, p);
+                    for (int q = 0; q < numPartitions; q++) {
+                        if (q == p || load[q] + nodes[i].cost > maxLoad)
+                            continue;
+                        double gain = getConnectivity(i, q) - own;
+                        if (bestNode == -1 || gain > bestGain) {
+                            bestNode = i;
+                            bestTo = q;
+                            bestGain = gain;
+                        }
+                    }
+                }
+                if (bestNode == -1)
+                    break;  // cannot be balanced better
+                moveNode(bestNode, bestTo);
+                moved = true;
+            }
+        }
+
+        for (int i = 0; i < (int)nodes.size(); i++) {
+            int from = nodes[i].partition;
+            if (count[from] == 1)
+                continue;  // keep partitions nonempty
+            double own = getConnectivity(i, from);
+            int bestTo = -1;
+            double bestGain = 0;
+            for (int q = 0; q < numPartitions; q++) {
+                if (q == from || load[q] + nodes[i].cost > maxLoad)
+                    continue;
+                double gain = getConnectivity(i, q) - own;
+                bool improvesBalance = load[q] + nodes[i].cost < load[from];
+                if (gain > bestGain || (gain == 0 && bestTo == -1 && improvesBalance && own > 0)) {
+                    bestTo = q;
+                    bestGain = gain;
+                }
+            }
+            if (bestTo != -1) {
+                moveNode(i, bestTo);
+                moved = true;
+            }
+        }
+
+        if (!moved)
+            break;
+    }
+}
+
+std::map<std::string,int> cTopologyPartitioner::getAssignment() const
+{
+    std::map<std::string,int> result;
+    for (auto& node : nodes)
+        result[node.fullPath] = node.partition;
+    return result;
+}
+
+double cTopologyPartitioner::getPartitionCost(int partition) const
+{
+    double sum = 0;
+    for (auto& node : nodes)
+        if (node.partition == partition)
+            sum += node.cost;
+    return sum;
+}
+
+int cTopologyPartitioner::getCutSize() const
+{
+    int sum = 0;
+    for (auto& edge : edges)
+        if (nodes[edge.node1].partition != nodes[edge.node2].partition)
+            sum += edge.numLinks;
+    return sum;
+}
+
+double cTopologyPartitioner::getCutWeight() const
+{
+    double sum = 0;
+    for (auto& edge : edges)
+        if (nodes[edge.node1].partition != nodes[edge.node2].partition)
+            sum += edge.weight;
+    return sum;
+}
+
+simtime_t cTopologyPartitioner::getLookahead() const
+{
+    simtime_t lookahead = SIMTIME_MAX;
+    for (auto& edge : edges)
+        if (nodes[edge.node1].partition != nodes[edge.node2].partition && edge.minDelay < lookahead)
+            lookahead = edge.minDelay;
+    return lookahead;
+}
+
+void cTopologyPartitioner::printReport(std::ostream& out) const
+{
+    int numLinks = 0;
+    for (auto& edge : edges)
+        numLinks += edge.numLinks;
+    out << "Partitioning of network " << networkName << " into " << numPartitions << " partitions ("
+        << nodes.size() << " submodules, " << numLinks << " links between them):\n";
+    for (int p = 0; p < numPartitions; p++) {
+        int count = 0;
+        for (auto& node : nodes)
+            if (node.partition == p)
+                count++;
+        out << "  partition " << p << ": " << count << " submodules, cost " << getPartitionCost(p) << "\n";
+    }
+    out << "  cut size: " << getCutSize() << " links\n";
+    simtime_t lookahead = getLookahead();
+    if (lookahead == SIMTIME_MAX)
+        out << "  lookahead: unlimited (no links between partitions)\n";
+    else if (lookahead == SIMTIME_ZERO)
+        out << "  lookahead: 0s -- WARNING: zero-delay links between partitions, conservative synchronization is not possible\n";
+    else
+        out << "  lookahead: " << lookahead << "s (smallest delay on links between partitions)\n";
+}
+
+void cTopologyPartitioner::printIniLines(std::ostream& out) const
+{
+    for (auto& node : nodes) {
+        // replace the network name with "*"
+        std::string path = node.fullPath.substr(networkName.size());
+        out << "*" << path << ".partition-id = " << node.partition << "\n";
+    }
+}
+
+}  // namespace omnetpp
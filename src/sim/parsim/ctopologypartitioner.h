@@ -0,0 +1,164 @@
+//=========================================================================
+//  CTOPOLOGYPARTITIONER.H - part of
+//
+//                  OMNeT++/OMNEST
+//           Discrete System Simulation in C++
+//
+//=========================================================================
+
+/*--------------------------------------------------------------*
+  Copyright (C) 2026 OpenSim Ltd.
+
+  This file is distributed WITHOUT ANY WARRANTY. See the file
+  `license' for details on this and other legal matters.
+*--------------------------------------------------------------*/
+
+#ifndef __OMNETPP_CTOPOLOGYPARTITIONER_H
+#define __OMNETPP_CTOPOLOGYPARTITIONER_H
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include "omnetpp/simkerneldefs.h"
+#include "omnetpp/simtime_t.h"
+
+namespace omnetpp {
+
+class cModule;
+
+/**
+ * @brief Computes a partitioning for parallel simulation from the topology
+ * of the network.
+ *
+ * The units of partitioning are the submodules of the network, i.e. the
+ * modules whose `partition-id` must be specified when partitioning by hand.
+ * The graph is extracted with cTopology. Links between submodules are weighted
+ * by their delay: cutting a link with a short delay reduces the lookahead
+ * available to the Null Message Algorithm, so the shorter the delay,
+ * the more expensive it is to cut the link. Zero-delay links are only cut if
+ * balancing makes it unavoidable. The cost of a submodule (i.e. its expected
+ * share of the simulation load) defaults to the number of simple modules in it
+ * (but at least 1), and can be overridden with setNodeCost().
+ *
+ * The algorithm greedily grows the partitions one by one from the
+ * heaviest-connected nodes, then improves the cut with Fiduccia-Mattheyses
+ * style passes that move single nodes between partitions as long as that
+ * decreases the cut weight and keeps the partitions balanced. The result
+ * is deterministic, so all partitions of a parallel simulation arrive
+ * at the same assignment independently.
+ *
+ * @ingroup Parsim
+ */
+class SIM_API cTopologyPartitioner
+{
+  public:
+    struct Node {
+        std::string fullPath;
+        double cost;
+        int partition;
+    };
+
+    struct Edge {
+        int node1, node2;
+        int numLinks;        // links between the two nodes, in either direction
+        simtime_t minDelay;  // smallest delay of those links
+        double weight;       // cost of cutting the edge
+    };
+
+  protected:
+    std::string networkName;
+    std::vector<Node> nodes;
+    std::vector<Edge> edges;
+    std::vector<std::vector<int>> adjacentEdges;  // index: node; values: edge indices
+    int numPartitions;
+    double maxImbalance;
+
+  protected:
+    virtual void computeEdgeWeights();
+    virtual void growPartitions();
+    virtual void refine();
+    double getConnectivity(int node, int partition) const;
+
+  public:
+    /**
+     * Constructor.
+     */
+    cTopologyPartitioner();
+
+    /**
+     * Destructor.
+     */
+    virtual ~cTopologyPartitioner() {}
+
+    /**
+     * Builds the graph from the submodules of the given network and
+     * the links between them.
+     */
+    virtual void extractFromNetwork(cModule *network);
+
+    /**
+     * Sets the allowed imbalance: the cost of a partition may exceed the
+     * average by this fraction (or by the cost of its largest node, if that
+     * is more). The default is 0.05.
+     */
+    void setMaxImbalance(double d) {maxImbalance = d;}
+
+    /**
+     * Computes the assignment for the given number of partitions.
+     */
+    virtual void partition(int numPartitions);
+
+    /** @name Accessing the graph and the result. */
+    //@{
+    int getNumNodes() const {return nodes.size();}
+    const Node& getNode(int i) const {return nodes.at(i);}
+    void setNodeCost(int i, double cost) {nodes.at(i).cost = cost;}
+    int getNumEdges() const {return edges.size();}
+    const Edge& getEdge(int i) const {return edges.at(i);}
+    int getNumPartitions() const {return numPartitions;}
+
+    /**
+     * Returns the assignment as a map from the full paths of the submodules
+     * to partition IDs.
+     */
+    std::map<std::string,int> getAssignment() const;
+
+    /**
+     * Returns the total cost of the nodes in the given partition.
+     */
+    double getPartitionCost(int partition) const;
+
+    /**
+     * Returns the number of links between different partitions.
+     */
+    int getCutSize() const;
+
+    /**
+     * Returns the total weight of the edges between different partitions.
+     */
+    double getCutWeight() const;
+
+    /**
+     * Returns the smallest delay among the links between different partitions,
+     * i.e. the lookahead the Null Message Algorithm can expect with
+     * cLinkDelayLookahead. Returns SIMTIME_MAX if there are no such links.
+     */
+    simtime_t getLookahead() const;
+    //@}
+
+    /**
+     * Prints a human-readable summary of the result: per-partition costs,
+     * cut size and lookahead.
+     */
+    virtual void printReport(std::ostream& out) const;
+
+    /**
+     * Prints the result as `partition-id` settings for omnetpp.ini.
+     */
+    virtual void printIniLines(std::ostream& out) const;
+};
+
+}  // namespace omnetpp
+
+#endif
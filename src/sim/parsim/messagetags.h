@@ -31,7 +31,12 @@ enum {
      TAG_NULLMESSAGE,
      TAG_CMESSAGE_WITH_NULLMESSAGE,
      TAG_TERMINATIONEXCEPTION,
-     TAG_EXCEPTION
+     TAG_EXCEPTION,
+     TAG_TIMEWARP_MESSAGE,
+     TAG_TIMEWARP_ANTIMESSAGE,
+     TAG_TIMEWARP_GVTMARKER,
+     TAG_TIMEWARP_GVTREPORT,
+     TAG_TIMEWARP_GVT
 };
 
 #endif
@@ -39,14 +39,15 @@
  *    of a program that executes in parallel, and hides details of
  *    the communications library (MPI, PVM, ...). Subclasses implemented
  *    here are cMPICommunications, cNamedPipeCommunications,
- *    cFileCommunications.
+ *    cSharedMemoryCommunications, cFileCommunications.
  *    -# Partition layer, represented by cParsimPartition. This encapsulates
  *    the task of distributing the simulation model over several
  *    partitions, and handles messaging between these partitions.
  *    It relies on layer 1 for this.
  *    -# Synchronization layer, represented by cParsimSynchronizer.
  *    It encapsulates the different parallel simulation algorithms
- *    like the conservative null message algorithm. This layer
+ *    like the conservative null message algorithm (cNullMessageProtocol)
+ *    and optimistic Time Warp (cTimeWarpProtocol). This layer
  *    heavily cooperates with the message scheduler of the simulation.
  *
  * See corresponding classes for more information.
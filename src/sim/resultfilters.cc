@@ -20,6 +20,10 @@
 #include "omnetpp/checkandcast.h"
 #include "omnetpp/resultfilters.h"
 
+#ifdef WITH_PARSIM
+#include "omnetpp/ccommbuffer.h"
+#endif
+
 namespace omnetpp {
 
 #define SIGNALTYPE_TO_NUMERIC_CONVERSIONS \
@@ -455,5 +459,203 @@ std::string SumPerDurationFilter::str() const
     return os.str();
 }
 
+//----
+
+void TotalCountFilter::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(count);
+#endif
+}
+
+void TotalCountFilter::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(count);
+#endif
+}
+
+void CountNanFilter::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(count);
+#endif
+}
+
+void CountNanFilter::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(count);
+#endif
+}
+
+void SumFilter::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(sum);
+#endif
+}
+
+void SumFilter::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(sum);
+#endif
+}
+
+void MeanFilter::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(count);
+    buffer->pack(lastValue);
+    buffer->pack(lastTime);
+    buffer->pack(weightedSum);
+    buffer->pack(totalTime);
+#endif
+}
+
+void MeanFilter::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(count);
+    buffer->unpack(lastValue);
+    buffer->unpack(lastTime);
+    buffer->unpack(weightedSum);
+    buffer->unpack(totalTime);
+#endif
+}
+
+void MinFilter::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(min);
+#endif
+}
+
+void MinFilter::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(min);
+#endif
+}
+
+void MaxFilter::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(max);
+#endif
+}
+
+void MaxFilter::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(max);
+#endif
+}
+
+void AverageFilter::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(count);
+    buffer->pack(sum);
+#endif
+}
+
+void AverageFilter::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(count);
+    buffer->unpack(sum);
+#endif
+}
+
+void TimeAverageFilter::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(lastValue);
+    buffer->pack(lastTime);
+    buffer->pack(weightedSum);
+    buffer->pack(totalTime);
+#endif
+}
+
+void TimeAverageFilter::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(lastValue);
+    buffer->unpack(lastTime);
+    buffer->unpack(weightedSum);
+    buffer->unpack(totalTime);
+#endif
+}
+
+void RemoveRepeatsFilter::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(prev);
+#endif
+}
+
+void RemoveRepeatsFilter::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(prev);
+#endif
+}
+
+void SumPerDurationFilter::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(sum);
+#endif
+}
+
+void SumPerDurationFilter::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(sum);
+#endif
+}
+
 }  // namespace omnetpp
 
@@ -25,6 +25,10 @@
 #include "omnetpp/resultrecorders.h"
 #include "common/stringutil.h"
 
+#ifdef WITH_PARSIM
+#include "omnetpp/ccommbuffer.h"
+#endif
+
 namespace omnetpp {
 
 using namespace omnetpp::common;
@@ -518,5 +522,209 @@ void KSplitRecorder::init(cComponent *component, const char *statsName, const ch
     setStatistic(new cKSplit("ksplit"));
 }
 
+//----
+
+void VectorRecorder::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(lastTime);
+    buffer->pack(lastValue);
+#endif
+}
+
+void VectorRecorder::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(lastTime);
+    buffer->unpack(lastValue);
+#endif
+}
+
+void TotalCountRecorder::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(count);
+#endif
+}
+
+void TotalCountRecorder::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(count);
+#endif
+}
+
+void LastValueRecorder::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(lastValue);
+#endif
+}
+
+void LastValueRecorder::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(lastValue);
+#endif
+}
+
+void SumRecorder::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(sum);
+#endif
+}
+
+void SumRecorder::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(sum);
+#endif
+}
+
+void MeanRecorder::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(count);
+    buffer->pack(lastValue);
+    buffer->pack(lastTime);
+    buffer->pack(weightedSum);
+    buffer->pack(totalTime);
+#endif
+}
+
+void MeanRecorder::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(count);
+    buffer->unpack(lastValue);
+    buffer->unpack(lastTime);
+    buffer->unpack(weightedSum);
+    buffer->unpack(totalTime);
+#endif
+}
+
+void MinRecorder::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(min);
+#endif
+}
+
+void MinRecorder::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(min);
+#endif
+}
+
+void MaxRecorder::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(max);
+#endif
+}
+
+void MaxRecorder::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(max);
+#endif
+}
+
+void AverageRecorder::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(count);
+    buffer->pack(sum);
+#endif
+}
+
+void AverageRecorder::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(count);
+    buffer->unpack(sum);
+#endif
+}
+
+void TimeAverageRecorder::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(lastValue);
+    buffer->pack(lastTime);
+    buffer->pack(weightedSum);
+    buffer->pack(totalTime);
+#endif
+}
+
+void TimeAverageRecorder::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(lastValue);
+    buffer->unpack(lastTime);
+    buffer->unpack(weightedSum);
+    buffer->unpack(totalTime);
+#endif
+}
+
+void StatisticsRecorder::parsimPack(cCommBuffer *buffer) const
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->pack(lastValue);
+    buffer->pack(lastTime);
+    statistic->parsimPack(buffer);
+#endif
+}
+
+void StatisticsRecorder::parsimUnpack(cCommBuffer *buffer)
+{
+#ifndef WITH_PARSIM
+    throw cRuntimeError(this, E_NOPARSIM);
+#else
+    buffer->unpack(lastValue);
+    buffer->unpack(lastTime);
+    statistic->parsimUnpack(buffer);
+#endif
+}
+
 }  // namespace omnetpp
 
@@ -91,6 +91,7 @@ SignalSource StatisticRecorderAstTranslator::makeSignalSource(ExprNode *subtree)
         ExpressionFilter *expressionFilter = new ExpressionFilter;
         expressionFilter->getExpression().setExpressionTree(subtree);
         subscribeExpressionFilterToSources(subtree, expressionFilter);
+        expressionFilter->getExpression().compile();
         signalSource = SignalSource(expressionFilter);
     }
     return signalSource;
@@ -55,6 +55,7 @@ class StatisticSourceAstTranslator : public Expression::AstTranslator
     virtual WrappedSignalSource *subscribeToSignal(cComponent *component, const char *signalName);
     virtual std::string collectDottedPath(AstNode *astNode);
     virtual cModule *resolveSubscriptionModule(const char *modulePath);
+    virtual bool isFieldAccess(AstNode *objectAstNode);
 
   public:
     StatisticSourceAstTranslator(cComponent *component, cProperty *statisticProperty, const char *statisticName, TristateBool checkSignalDecl, bool needWarmupFilter) :
@@ -106,6 +107,7 @@ SignalSource StatisticSourceAstTranslator::makeSignalSource(ExprNode *subtree)
         ExpressionFilter *expressionFilter = new ExpressionFilter;
         expressionFilter->getExpression().setExpressionTree(subtree);
         subscribeExpressionFilterToSources(subtree, expressionFilter);
+        expressionFilter->getExpression().compile();
         if (expressionFilter->getNumInputs() == 0)
             throw cRuntimeError("Expression has no signal input");
         signalSource = SignalSource(expressionFilter);
@@ -166,6 +168,24 @@ WrappedSignalSource *StatisticSourceAstTranslator::subscribeToSignal(cComponent
     }
 }
 
+bool StatisticSourceAstTranslator::isFieldAccess(AstNode *objectAstNode)
+{
+    // "a.b" denotes signal "b" of submodule "a" if such submodule exists; it is
+    // a field access if "a" is a signal declared on the component, or if the
+    // object is not a module path at all (e.g. a filter call)
+    if (objectAstNode->type == AstNode::IDENT) {
+        const char *name = objectAstNode->name.c_str();
+        cModule *module = dynamic_cast<cModule*>(component);
+        if (module && module->getSubmodule(name) != nullptr)
+            return false;
+        return component->getComponentType()->getSignalDeclaration(name) != nullptr;
+    }
+    else if (isMember(objectAstNode))
+        return isFieldAccess(objectAstNode->children[0]);  // chained field access
+    else
+        return objectAstNode->type != AstNode::IDENT_W_INDEX;  // submodule vector element
+}
+
 cModule *StatisticSourceAstTranslator::resolveSubscriptionModule(const char *modulePath)
 {
     cModule *module = dynamic_cast<cModule*>(component);
@@ -185,6 +205,16 @@ ExprNode *StatisticSourceAstTranslator::translateToExpressionTree(AstNode *astNo
         const char *signalName = astNode->name.c_str();
         return subscribeToSignal(component, signalName);
     }
+    else if (isMember(astNode) && isFieldAccess(astNode->children[0])) {
+        // signalname.fieldname or filter(...).fieldname: read a field of the object emitted as signal value
+        ExprNode *node;
+        if (astNode->type == AstNode::MEMBER)
+            node = new ExpressionFilter::FieldNode(astNode->name.c_str());
+        else
+            node = new ExpressionFilter::IndexedFieldNode(astNode->name.c_str());
+        translateChildren(astNode, node, translatorForChildren);
+        return node;
+    }
     else if (astNode->type == AstNode::MEMBER) {
         // likely submodulepath.signalname
         ASSERT(astNode->children.size() == 1);
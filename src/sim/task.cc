@@ -21,9 +21,9 @@
 
 namespace omnetpp {
 
-_Task main_task;
-_Task *current_task = nullptr;
-JMP_BUF tmp_jmpb;
+thread_local _Task main_task;
+thread_local _Task *current_task = nullptr;
+thread_local JMP_BUF tmp_jmpb;
 
 unsigned dist(_Task *from, _Task *to)
 {
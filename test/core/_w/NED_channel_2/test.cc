@@ -0,0 +1,15 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_channel_2 {
+
+class TestChannel : public cIdealChannel
+{
+};
+
+Register_Class(TestChannel);
+
+}; //namespace
+
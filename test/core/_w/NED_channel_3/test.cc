@@ -0,0 +1,19 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_channel_3 {
+
+namespace foo {
+
+class TestChannelClass : public cIdealChannel
+{
+};
+
+Register_Class(TestChannelClass);
+
+};
+
+}; //namespace
+
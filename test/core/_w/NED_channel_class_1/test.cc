@@ -0,0 +1,39 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+class ChannelWithoutNamespace: public cIdealChannel
+{
+  public:
+    ChannelWithoutNamespace() { }
+    virtual Result processMessage(cMessage *msg, const SendOptions& options, simtime_t t) override;
+};
+
+Define_Channel(ChannelWithoutNamespace);
+
+cChannel::Result ChannelWithoutNamespace::processMessage(cMessage *msg, const SendOptions& options, simtime_t t)
+{
+    EV << "ChannelWithoutNamespace\n";
+    return cIdealChannel::processMessage(msg, options, t);
+}
+
+namespace NED_channel_class_1 {
+
+class Simple : public cSimpleModule
+{
+  public:
+    Simple() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Simple);
+
+void Simple::activity()
+{
+    send(new cMessage(), gate("g$o"));
+    delete receive();
+}
+
+}; // namespace
+
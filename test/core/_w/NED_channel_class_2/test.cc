@@ -0,0 +1,39 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_channel_class_2 {
+
+class ChannelWithNamespace: public cIdealChannel
+{
+  public:
+    ChannelWithNamespace() { }
+    virtual Result processMessage(cMessage *msg, const SendOptions& options, simtime_t t) override;
+};
+
+Define_Channel(ChannelWithNamespace);
+
+cChannel::Result ChannelWithNamespace::processMessage(cMessage *msg, const SendOptions& options, simtime_t t)
+{
+    EV << "ChannelWithNamespace\n";
+    return cIdealChannel::processMessage(msg, options, t);
+}
+
+class Simple : public cSimpleModule
+{
+  public:
+    Simple() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Simple);
+
+void Simple::activity()
+{
+    send(new cMessage(), gate("g$o"));
+    delete receive();
+}
+
+}; // namespace
+
@@ -0,0 +1,13 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+class CompoundModuleClassWithoutNamespace : public cModule
+{
+  protected:
+    void initialize() override {EV << "Hello from " << getClassName() << "\n";}
+};
+
+Define_Module(CompoundModuleClassWithoutNamespace);
+
@@ -0,0 +1,17 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_compound_class_2 {
+
+class ClassWithNamespace : public cModule
+{
+  protected:
+    void initialize() override {EV << "Hello from " << getClassName() << "\n";}
+};
+
+Define_Module(ClassWithNamespace);
+
+}; //namespace
+
@@ -0,0 +1,17 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_compound_class_3 {
+
+class BaseModuleClass : public cModule
+{
+  protected:
+    void initialize() override {EV << "Hello from " << getClassName() << "\n";}
+};
+
+Define_Module(BaseModuleClass);
+
+}; //namespace
+
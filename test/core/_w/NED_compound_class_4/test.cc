@@ -0,0 +1,17 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_compound_class_4 {
+
+class DerivedModuleClass : public cModule
+{
+  protected:
+    void initialize() override {EV << "Hello from " << getClassName() << "\n";}
+};
+
+Define_Module(DerivedModuleClass);
+
+}; //namespace
+
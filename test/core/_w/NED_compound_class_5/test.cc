@@ -0,0 +1,19 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_compound_class_5 {
+namespace foo {
+
+class ClassWithNamespace : public cModule
+{
+  protected:
+    void initialize() override {EV << "Hello from " << getClassName() << "\n";}
+};
+
+Define_Module(ClassWithNamespace);
+
+}; //namespace foo
+}; //namespace NED_compound_class_5
+
@@ -0,0 +1,59 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_conn_1 {
+
+class Gen : public cSimpleModule
+{
+  public:
+    Gen() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Gen);
+
+void Gen::activity()
+{
+    for (int i=0; i<gateSize("out"); i++)
+    {
+        EV << i << ":";
+        cGate *g = gate("out",i);
+        cChannel *ch = g->getChannel();
+        if (ch)
+            EV << ch->getClassName();
+        if (dynamic_cast<cDelayChannel *>(ch))
+        {
+            cDelayChannel *sch = check_and_cast<cDelayChannel *>(ch);
+            EV << " disabled=" << sch->isDisabled();
+            if (sch->getDelay() != 0)  EV << " delay=" << sch->getDelay();
+        }
+        if (dynamic_cast<cDatarateChannel *>(ch))
+        {
+            cDatarateChannel *sch = check_and_cast<cDatarateChannel *>(ch);
+            EV << " disabled=" << sch->isDisabled();
+            if (sch->getDelay() != 0)  EV << " delay=" << sch->getDelay();
+            if (sch->getDatarate())  EV << " datarate=" << sch->getDatarate();
+            if (sch->getBitErrorRate())  EV << " ber=" << sch->getBitErrorRate();
+            if (sch->getPacketErrorRate())  EV << " per=" << sch->getPacketErrorRate();
+        }
+        EV << endl;
+    }
+}
+
+class Sink : public cSimpleModule
+{
+  public:
+    virtual void handleMessage(cMessage *msg) override;
+};
+
+Define_Module(Sink);
+
+void Sink::handleMessage(cMessage *msg)
+{
+    delete msg;
+}
+
+}; //namespace
+
@@ -0,0 +1,22 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_conns_check_2 {
+
+class Simple : public cSimpleModule
+{
+  public:
+    Simple() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Simple);
+
+void Simple::activity()
+{
+}
+
+}; //namespace
+
@@ -0,0 +1,2 @@
+// prevent "no object files" linker error if test is run alone
+
@@ -0,0 +1,28 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_display_1 {
+
+class Dump : public cSimpleModule
+{
+  public:
+    Dump() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Dump);
+
+void Dump::activity()
+{
+    cDisplayString& ds = getParentModule()->getDisplayString();
+    EV << "t1[0]:" << endl << ds.getTagArg("t1",0) << endl << endl;
+    EV << "t2[0]:" << endl << ds.getTagArg("t2",0) << endl << endl;
+    EV << "t3[0]:" << endl << ds.getTagArg("t3",0) << endl << endl;
+    EV << "t4[0]:" << endl << ds.getTagArg("t4",0) << endl << endl;
+    EV << "." << endl;
+}
+
+} // namespace
+
@@ -0,0 +1,35 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_expr_1 {
+
+class Test : public cSimpleModule
+{
+  public:
+    Test() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+    for (int i=0; i<getNumParams(); i++) {
+        cPar& p = par(i);
+        EV << p.getName() << "=";
+        switch (p.getType()) {
+            case cPar::BOOL: EV << p.boolValue(); break;
+            case cPar::DOUBLE: EV << p.doubleValue(); break;
+            case cPar::INT: EV << p.intValue(); break;
+            case cPar::STRING: EV << p.stringValue(); break;
+            case cPar::XML: EV << p.xmlValue()->str(); break;
+        }
+        EV << endl;
+    }
+    EV << ".\n";
+}
+
+}; //namespace
+
@@ -0,0 +1,25 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_expr_4 {
+
+class Test : public cSimpleModule
+{
+  public:
+    Test() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+    for (int i=0; i<getNumParams(); i++)
+        EV << par(i).getName() << "=" << par(i).str() << endl;
+    EV << ".\n";
+}
+
+}; //namespace
+
@@ -0,0 +1,80 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace NED_expr_expon_1 {
+
+
+void test(const char *expr)
+{
+    cDynamicExpression e;
+    e.parse(expr);
+    std::string result;
+    try {
+        cValue v = e.evaluate();
+        result = v.str();
+    } catch (std::exception& e) {
+        result = e.what();
+    }
+    EV << expr << " ==> " << result << "\n";
+}
+
+void test(const char *s1, const std::string& s2, const char *s3)
+{
+    test((std::string(s1) + " " + s2 + " " + s3).c_str());
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+test("2^0");
+test("2^1");
+test("2^2");
+test("2^3");
+test("2^4");
+test("2^5");
+test("2^6");
+test("2^7");
+test("2^8");
+test("2^9");
+test("2^10");
+test("2^15");
+test("2^16");
+test("2^31");
+test("2^32");
+test("2^60");
+test("2^61");
+test("2^62");
+test("2^63");
+
+// negative exponent
+test("2^-1");
+test("2^-2");
+
+// negative base
+test("-2^0");
+test("-2^1");
+test("-2^2");
+test("-2^3");
+test("-2^63");
+test("-2^64");
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
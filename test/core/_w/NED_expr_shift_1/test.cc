@@ -0,0 +1,122 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace NED_expr_shift_1 {
+
+
+void test(const char *expr)
+{
+    cDynamicExpression e;
+    e.parse(expr);
+    std::string result;
+    try {
+        cValue v = e.evaluate();
+        result = v.str();
+    } catch (std::exception& e) {
+        result = e.what();
+    }
+    EV << expr << " ==> " << result << "\n";
+}
+
+void test(const char *s1, const std::string& s2, const char *s3)
+{
+    test((std::string(s1) + " " + s2 + " " + s3).c_str());
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+// left-shift, normal usage
+test("1<<0");
+test("1<<1");
+test("1<<16");
+test("1<<62");
+test("1<<63");
+
+// shift by 64 or more places
+test("1<<64");
+test("1<<10000");
+
+// negative shift shifts right
+test("4<<-1");
+test("4<<-2");
+test("4<<-3");
+
+// negative shift by 64 or more places
+test("2<<-64");
+test("2<<-10000");
+
+// negative values
+test("-1<<1");
+test("-1<<16");
+test("-1<<62");
+test("-1<<63");
+
+// shifting negative values by 64 or more places
+test("-1<<64");
+
+// negative shift of negative values
+test("-4<<-1");
+test("-4<<-2");
+test("-4<<-3");
+test("-4<<-4");
+test("-4<<-64");
+
+EV << "====================\n";
+
+// right-shift, normal usage
+test("4>>0");
+test("4>>1");
+test("4>>2");
+test("4>>3");
+
+// shift by 64 or more places
+test("4>>64");
+test("4>>10000");
+
+// negative shift shifts left
+test("1>>-1");
+test("1>>-2");
+test("1>>-62");
+test("1>>-63");
+
+// negative shift by 64 or more places
+test("1>>-64");
+test("1>>-10000");
+
+// negative values
+test("-4>>1");
+test("-4>>2");
+test("-4>>3");
+test("-4>>63");
+
+// shifting negative values by 64 or more places
+test("-1>>64");
+
+// negative shift of negative values
+test("-1>>-1");
+test("-1>>-2");
+test("-1>>-3");
+test("-1>>-63");
+test("-1>>-64");
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
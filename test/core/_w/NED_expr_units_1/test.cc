@@ -0,0 +1,60 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace NED_expr_units_1 {
+
+
+void test(const char *expr)
+{
+    cDynamicExpression e;
+    e.parse(expr);
+    std::string result;
+    try {
+        cValue v = e.evaluate();
+        result = v.str() + "  (" + cValue::getTypeName(v.getType()) + ")";
+    } catch (std::exception& e) {
+        result = e.what();
+    }
+    EV << expr << " ==> " << result << "\n";
+}
+
+void test(const char *s1, const std::string& s2, const char *s3)
+{
+    test((std::string(s1) + " " + s2 + " " + s3).c_str());
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+test("1MiB");
+test("1.1MiB");
+test("1KiB 1B");
+test("1B 1KiB");
+
+test("1MiB+1KiB");
+test("1KiB+1MiB");
+
+test("1MiB-1KiB");
+test("1KiB-1MiB");
+
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,35 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_funcdef_2 {
+
+double testfunc0() {return 0;}
+double testfunc1(double a) {return a;}
+double testfunc2(double a, double b) {return a+b;}
+double testfunc3(double a, double b, double c) {return a+b+c;}
+double testfunc4(double a, double b, double c, double d) {return a+b+c+d;}
+
+Define_NED_Math_Function(testfunc0,0);
+Define_NED_Math_Function(testfunc1,1);
+Define_NED_Math_Function(testfunc2,2);
+Define_NED_Math_Function(testfunc3,3);
+Define_NED_Math_Function(testfunc4,4);
+
+class Simple : public cSimpleModule
+{
+  public:
+    Simple() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Simple);
+
+void Simple::activity()
+{
+    //FIXME: should check channel or something like that...
+}
+
+}; //namespace
+
@@ -0,0 +1,198 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace NED_functions_1 {
+
+
+void test(const char *expr)
+{
+    cDynamicExpression e;
+    e.parse(expr);
+    std::string result;
+    try {
+        cValue v = e.evaluate();
+        result = v.str();
+    } catch (std::exception& e) {
+        result = e.what();
+    }
+    EV << expr << " ==> " << result << "\n";
+}
+
+#define P(expr)  test(#expr)
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+P( W(150mW));
+
+P( min(3, 2));
+P( min(3m, 2m));
+P( min(3m, 2km));
+P( min(2km, 3m));
+P( min(1m, 1));
+P( min(1m, 1s));
+EV << "\n";
+
+P( max(3, 2));
+P( max(3m, 2m));
+P( max(3m, 2km));
+P( max(2km, 3m));
+P( max(1m, 1));
+P( max(1m, 1s));
+EV << "\n";
+
+P( convertUnit(1.5h, "s"));
+P( convertUnit(1.5h, ""));
+P( convertUnit(1.5h, "kg"));
+EV << "\n";
+
+P( replaceUnit(1.5h, "s"));
+P( replaceUnit(1.5h, "kg"));
+P( replaceUnit(1.5h, ""));
+EV << "\n";
+
+P( dropUnit(1.5h));
+P( dropUnit(1.5));
+EV << "\n";
+
+P( unitOf(1km));
+P( unitOf(5 kilometers));
+EV << "\n";
+
+P( length(""));
+P( length("Hello"));
+EV << "\n";
+
+P( contains("", ""));
+P( contains("", "bubu"));
+P( contains("Hello", ""));
+P( contains("Hello", "ell"));
+P( contains("Hello", "bubu"));
+EV << "\n";
+
+P( substring("Hello", 0));
+P( substring("Hello", 3));
+P( substring("Hello", 5));
+P( substring("Hello", -1));
+P( substring("Hello", 6));
+EV << "\n";
+
+P( substring("Hello", 0, 2));
+P( substring("Hello", 1, 3));
+P( substring("Hello", 1, 0));
+P( substring("Hello", 1, 10));
+P( substring("Hello", 1, -1));
+P( substring("Hello", -1, 3));
+P( substring("Hello", -1, 10));
+EV << "\n";
+
+P( substringBefore("this and this and that", "and"));  // note: two "and"'s
+P( substringBefore("this and this and that", "XXX"));
+P( substringAfter("this and this and that", "and"));
+P( substringAfter("this and this and that", "XXX"));
+EV << "\n";
+
+P( substringBeforeLast("this and this and that", "and"));
+P( substringBeforeLast("this and this and that", "XXX"));
+P( substringAfterLast("this and this and that", "and"));
+P( substringAfterLast("this and this and that", "XXX"));
+EV << "\n";
+
+P( startsWith("", ""));
+P( startsWith("Hello", ""));
+P( startsWith("Hello", "He"));
+P( startsWith("Hello", "ell"));
+EV << "\n";
+
+P( endsWith("", ""));
+P( endsWith("Hello", ""));
+P( endsWith("Hello", "lo"));
+P( endsWith("Hello", "ell"));
+EV << "\n";
+
+P( tail("Hello", 0));
+P( tail("Hello", 2));
+P( tail("Hello", 100));
+EV << "\n";
+
+P( replace("Hello", "ell", "******"));
+P( replace("Hello", "ell", ""));
+P( replace("Hello", "e", "x"));
+P( replace("Hello", "l", "x"));
+P( replace("Hello", "e", "e"));
+P( replace("Hello", "e", ""));
+P( replace("Hello", "", "x"));
+EV << "\n";
+
+P( replaceFirst("Hello", "l", "(_)"));
+P( replaceFirst("Hello", "X", "(_)"));
+EV << "\n";
+
+P( indexOf("", ""));
+P( indexOf("Hello", ""));
+P( indexOf("Hello", "ell"));
+P( indexOf("Hello", "bubu"));
+EV << "\n";
+
+P( toUpper("Hello"));
+P( toLower("HeLLo"));
+EV << "\n";
+
+P( trim("  \tfoo \n "));
+P( trim("foo"));
+EV << "\n";
+
+P( choose(0, "Zero One Two Three"));
+P( choose(2, "Zero One Two Three"));
+P( choose(3, "Zero One Two Three"));
+P( choose(-1, "Zero One Two Three"));
+P( choose(4, "Zero One Two Three"));
+EV << "\n";
+
+P( int(true));
+P( int(3.14));
+P( int(-3.14));
+P( int("6.28"));
+P( int("-6.28"));
+P( double(false));
+P( double(7.54));
+P( double(-7.54));
+P( double("4.53"));
+P( double("-4.53"));
+P( string(false));
+P( string(13));
+P( string(4.72));
+P( string(-4.72));
+EV << "\n";
+
+P( s(0.5));
+P( ms(0.5s));
+P( W(0.15));
+P( W(150mW));
+P( W(0dBm));
+P( dBm(10W));
+P( ratio(-10dB));
+P( ratio(0dB));
+P( milliseconds(0.5s));
+P( kilowatt_hour(1500Wh));
+P( kilometer_per_hour(10mps));
+EV << ".\n";
+
+
+}
+
+}; //namespace
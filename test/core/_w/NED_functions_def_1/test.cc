@@ -0,0 +1,38 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_functions_def_1 {
+
+cValue nedf_haveClass(cComponent *context, cValue argv[], int argc)
+{
+    return cObjectFactory::find(argv[0].stringValue()) != nullptr;
+}
+
+Define_NED_Function2(nedf_haveClass,
+        "bool NED_functions_def_1_haveClass(string className)",
+        "NED_functions_def_1",
+        "Returns true if the given C++ class exists"
+);
+
+cValue nedf_lindex(cComponent *context, cValue argv[], int argc)
+{
+    int index = (int)argv[0].doubleValue();
+    if (index < 0)
+        throw cRuntimeError("lindex(): negative index");
+    if (index > argc)
+        throw cRuntimeError("lindex(): index out of bounds: %d", index);
+    return argv[index];
+}
+
+Define_NED_Function2(nedf_lindex,
+        "any NED_functions_def_1_lindex(long index, any item1, ...)",
+        "NED_functions_def_1",
+        "Returns the indexth item from the arg list item1, item2, etc."
+);
+
+}; //namespace
+
+//%extraargs: --debug-on-errors=true
+
@@ -0,0 +1 @@
+// prevent "no object files" linker error if test is run alone
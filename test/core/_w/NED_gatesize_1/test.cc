@@ -0,0 +1,36 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_gatesize_1 {
+
+class GenMod : public cSimpleModule
+{
+  public:
+    GenMod() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(GenMod);
+
+#define PRINT(name)  EV << name << (isGateVector(name) ? "[]" : "") << ":" \
+                        << gateSize(name) << "," << gateSize(name) << "\n"
+
+void GenMod::activity()
+{
+   PRINT("in");
+   PRINT("in1");
+   PRINT("in2");
+   PRINT("in3");
+   PRINT("in4");
+   PRINT("out");
+   PRINT("out1");
+   PRINT("out2");
+   PRINT("out3");
+   PRINT("out4");
+}
+
+}; //namespace
+
+
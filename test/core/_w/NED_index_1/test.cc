@@ -0,0 +1,26 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_index_1 {
+
+class Simple : public cSimpleModule
+{
+  public:
+    Simple() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Simple);
+
+void Simple::activity()
+{
+    for (int i=0; i<getNumParams(); i++)
+        EV << getFullName() << "." << par(i).getName() << "=" << (double)par(i) << endl;
+    EV << getFullName() << ".in1[] size=" << gateSize("in1") << endl;
+    EV << getFullName() << ".in2[] size=" << gateSize("in2") << endl;
+}
+
+}; //namespace
+
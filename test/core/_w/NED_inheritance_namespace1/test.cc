@@ -0,0 +1,24 @@
+
+#include <string.h>
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_inheritance_namespace1_ns1 {
+
+class Test : public cSimpleModule
+{
+  public:
+    Test() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+    EV << getFullPath() << "::activity() called\n";
+}
+
+}; //namespace
+
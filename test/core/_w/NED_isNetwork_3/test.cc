@@ -0,0 +1,23 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_isNetwork_3 {
+
+class Test : public cSimpleModule
+{
+  public:
+    Test() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+    EV << "Hello\n";
+}
+
+}; //namespace
+
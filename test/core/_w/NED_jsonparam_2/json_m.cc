@@ -0,0 +1,1547 @@
+//
+// Generated file, do not edit! Created by nedtool 6.0 from NED_jsonparam_2/json.msg.
+//
+
+// Disable warnings about unused variables, empty switch stmts, etc:
+#ifdef _MSC_VER
+#  pragma warning(disable:4101)
+#  pragma warning(disable:4065)
+#endif
+
+#if defined(__clang__)
+#  pragma clang diagnostic ignored "-Wshadow"
+#  pragma clang diagnostic ignored "-Wconversion"
+#  pragma clang diagnostic ignored "-Wunused-parameter"
+#  pragma clang diagnostic ignored "-Wc++98-compat"
+#  pragma clang diagnostic ignored "-Wunreachable-code-break"
+#  pragma clang diagnostic ignored "-Wold-style-cast"
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic ignored "-Wshadow"
+#  pragma GCC diagnostic ignored "-Wconversion"
+#  pragma GCC diagnostic ignored "-Wunused-parameter"
+#  pragma GCC diagnostic ignored "-Wold-style-cast"
+#  pragma GCC diagnostic ignored "-Wsuggest-attribute=noreturn"
+#  pragma GCC diagnostic ignored "-Wfloat-conversion"
+#endif
+
+#include <iostream>
+#include <sstream>
+#include <memory>
+#include "json_m.h"
+
+namespace omnetpp {
+
+// Template pack/unpack rules. They are declared *after* a1l type-specific pack functions for multiple reasons.
+// They are in the omnetpp namespace, to allow them to be found by argument-dependent lookup via the cCommBuffer argument
+
+// Packing/unpacking an std::vector
+template<typename T, typename A>
+void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::vector<T,A>& v)
+{
+    int n = v.size();
+    doParsimPacking(buffer, n);
+    for (int i = 0; i < n; i++)
+        doParsimPacking(buffer, v[i]);
+}
+
+template<typename T, typename A>
+void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::vector<T,A>& v)
+{
+    int n;
+    doParsimUnpacking(buffer, n);
+    v.resize(n);
+    for (int i = 0; i < n; i++)
+        doParsimUnpacking(buffer, v[i]);
+}
+
+// Packing/unpacking an std::list
+template<typename T, typename A>
+void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::list<T,A>& l)
+{
+    doParsimPacking(buffer, (int)l.size());
+    for (typename std::list<T,A>::const_iterator it = l.begin(); it != l.end(); ++it)
+        doParsimPacking(buffer, (T&)*it);
+}
+
+template<typename T, typename A>
+void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::list<T,A>& l)
+{
+    int n;
+    doParsimUnpacking(buffer, n);
+    for (int i = 0; i < n; i++) {
+        l.push_back(T());
+        doParsimUnpacking(buffer, l.back());
+    }
+}
+
+// Packing/unpacking an std::set
+template<typename T, typename Tr, typename A>
+void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::set<T,Tr,A>& s)
+{
+    doParsimPacking(buffer, (int)s.size());
+    for (typename std::set<T,Tr,A>::const_iterator it = s.begin(); it != s.end(); ++it)
+        doParsimPacking(buffer, *it);
+}
+
+template<typename T, typename Tr, typename A>
+void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::set<T,Tr,A>& s)
+{
+    int n;
+    doParsimUnpacking(buffer, n);
+    for (int i = 0; i < n; i++) {
+        T x;
+        doParsimUnpacking(buffer, x);
+        s.insert(x);
+    }
+}
+
+// Packing/unpacking an std::map
+template<typename K, typename V, typename Tr, typename A>
+void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::map<K,V,Tr,A>& m)
+{
+    doParsimPacking(buffer, (int)m.size());
+    for (typename std::map<K,V,Tr,A>::const_iterator it = m.begin(); it != m.end(); ++it) {
+        doParsimPacking(buffer, it->first);
+        doParsimPacking(buffer, it->second);
+    }
+}
+
+template<typename K, typename V, typename Tr, typename A>
+void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::map<K,V,Tr,A>& m)
+{
+    int n;
+    doParsimUnpacking(buffer, n);
+    for (int i = 0; i < n; i++) {
+        K k; V v;
+        doParsimUnpacking(buffer, k);
+        doParsimUnpacking(buffer, v);
+        m[k] = v;
+    }
+}
+
+// Default pack/unpack function for arrays
+template<typename T>
+void doParsimArrayPacking(omnetpp::cCommBuffer *b, const T *t, int n)
+{
+    for (int i = 0; i < n; i++)
+        doParsimPacking(b, t[i]);
+}
+
+template<typename T>
+void doParsimArrayUnpacking(omnetpp::cCommBuffer *b, T *t, int n)
+{
+    for (int i = 0; i < n; i++)
+        doParsimUnpacking(b, t[i]);
+}
+
+// Default rule to prevent compiler from choosing base class' doParsimPacking() function
+template<typename T>
+void doParsimPacking(omnetpp::cCommBuffer *, const T& t)
+{
+    throw omnetpp::cRuntimeError("Parsim error: No doParsimPacking() function for type %s", omnetpp::opp_typename(typeid(t)));
+}
+
+template<typename T>
+void doParsimUnpacking(omnetpp::cCommBuffer *, T& t)
+{
+    throw omnetpp::cRuntimeError("Parsim error: No doParsimUnpacking() function for type %s", omnetpp::opp_typename(typeid(t)));
+}
+
+}  // namespace omnetpp
+
+namespace {
+template <class T> inline
+typename std::enable_if<std::is_polymorphic<T>::value && std::is_base_of<omnetpp::cObject,T>::value, void *>::type
+toVoidPtr(T* t)
+{
+    return (void *)(static_cast<const omnetpp::cObject *>(t));
+}
+
+template <class T> inline
+typename std::enable_if<std::is_polymorphic<T>::value && !std::is_base_of<omnetpp::cObject,T>::value, void *>::type
+toVoidPtr(T* t)
+{
+    return (void *)dynamic_cast<const void *>(t);
+}
+
+template <class T> inline
+typename std::enable_if<!std::is_polymorphic<T>::value, void *>::type
+toVoidPtr(T* t)
+{
+    return (void *)static_cast<const void *>(t);
+}
+
+}
+
+namespace NED_jsonparam_2 {
+
+// forward
+template<typename T, typename A>
+std::ostream& operator<<(std::ostream& out, const std::vector<T,A>& vec);
+
+// Template rule to generate operator<< for shared_ptr<T>
+template<typename T>
+inline std::ostream& operator<<(std::ostream& out,const std::shared_ptr<T>& t) { return out << t.get(); }
+
+// Template rule which fires if a struct or class doesn't have operator<<
+template<typename T>
+inline std::ostream& operator<<(std::ostream& out,const T&) {return out;}
+
+// operator<< for std::vector<T>
+template<typename T, typename A>
+inline std::ostream& operator<<(std::ostream& out, const std::vector<T,A>& vec)
+{
+    out.put('{');
+    for(typename std::vector<T,A>::const_iterator it = vec.begin(); it != vec.end(); ++it)
+    {
+        if (it != vec.begin()) {
+            out.put(','); out.put(' ');
+        }
+        out << *it;
+    }
+    out.put('}');
+
+    char buf[32];
+    sprintf(buf, " (size=%u)", (unsigned int)vec.size());
+    out.write(buf, strlen(buf));
+    return out;
+}
+
+Register_Class(Data)
+
+Data::Data() : ::omnetpp::cObject()
+{
+}
+
+Data::Data(const Data& other) : ::omnetpp::cObject(other)
+{
+    copy(other);
+}
+
+Data::~Data()
+{
+}
+
+Data& Data::operator=(const Data& other)
+{
+    if (this == &other) return *this;
+    ::omnetpp::cObject::operator=(other);
+    copy(other);
+    return *this;
+}
+
+void Data::copy(const Data& other)
+{
+    this->foo = other.foo;
+    this->bar = other.bar;
+}
+
+void Data::parsimPack(omnetpp::cCommBuffer *b) const
+{
+    doParsimPacking(b,this->foo);
+    doParsimPacking(b,this->bar);
+}
+
+void Data::parsimUnpack(omnetpp::cCommBuffer *b)
+{
+    doParsimUnpacking(b,this->foo);
+    doParsimUnpacking(b,this->bar);
+}
+
+int Data::getFoo() const
+{
+    return this->foo;
+}
+
+void Data::setFoo(int foo)
+{
+    this->foo = foo;
+}
+
+const char * Data::getBar() const
+{
+    return this->bar.c_str();
+}
+
+void Data::setBar(const char * bar)
+{
+    this->bar = bar;
+}
+
+class DataDescriptor : public omnetpp::cClassDescriptor
+{
+  private:
+    mutable const char **propertynames;
+    enum FieldConstants {
+        FIELD_foo,
+        FIELD_bar,
+    };
+  public:
+    DataDescriptor();
+    virtual ~DataDescriptor();
+
+    virtual bool doesSupport(omnetpp::cObject *obj) const override;
+    virtual const char **getPropertyNames() const override;
+    virtual const char *getProperty(const char *propertyname) const override;
+    virtual int getFieldCount() const override;
+    virtual const char *getFieldName(int field) const override;
+    virtual int findField(const char *fieldName) const override;
+    virtual unsigned int getFieldTypeFlags(int field) const override;
+    virtual const char *getFieldTypeString(int field) const override;
+    virtual const char **getFieldPropertyNames(int field) const override;
+    virtual const char *getFieldProperty(int field, const char *propertyname) const override;
+    virtual int getFieldArraySize(void *object, int field) const override;
+    virtual void setFieldArraySize(void *object, int field, int size) const override;
+
+    virtual const char *getFieldDynamicTypeString(void *object, int field, int i) const override;
+    virtual std::string getFieldValueAsString(void *object, int field, int i) const override;
+    virtual omnetpp::intval_t getFieldValueAsInt(void *object, int field, int i) const override;
+    virtual double getFieldValueAsDouble(void *object, int field, int i) const override;
+    virtual void setFieldValueAsString(void *object, int field, int i, const char *value) const override;
+
+    virtual const char *getFieldStructName(int field) const override;
+    virtual void *getFieldStructValuePointer(void *object, int field, int i) const override;
+    virtual void setFieldStructValuePointer(void *object, int field, int i, void *ptr) const override;
+};
+
+Register_ClassDescriptor(DataDescriptor)
+
+DataDescriptor::DataDescriptor() : omnetpp::cClassDescriptor(omnetpp::opp_typename(typeid(NED_jsonparam_2::Data)), "omnetpp::cObject")
+{
+    propertynames = nullptr;
+}
+
+DataDescriptor::~DataDescriptor()
+{
+    delete[] propertynames;
+}
+
+bool DataDescriptor::doesSupport(omnetpp::cObject *obj) const
+{
+    return dynamic_cast<Data *>(obj)!=nullptr;
+}
+
+const char **DataDescriptor::getPropertyNames() const
+{
+    if (!propertynames) {
+        static const char *names[] = {  nullptr };
+        omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+        const char **basenames = basedesc ? basedesc->getPropertyNames() : nullptr;
+        propertynames = mergeLists(basenames, names);
+    }
+    return propertynames;
+}
+
+const char *DataDescriptor::getProperty(const char *propertyname) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    return basedesc ? basedesc->getProperty(propertyname) : nullptr;
+}
+
+int DataDescriptor::getFieldCount() const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    return basedesc ? 2+basedesc->getFieldCount() : 2;
+}
+
+unsigned int DataDescriptor::getFieldTypeFlags(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldTypeFlags(field);
+        field -= basedesc->getFieldCount();
+    }
+    static unsigned int fieldTypeFlags[] = {
+        FD_ISEDITABLE | FD_ISINTEGRAL,    // FIELD_foo
+        FD_ISEDITABLE,    // FIELD_bar
+    };
+    return (field >= 0 && field < 2) ? fieldTypeFlags[field] : 0;
+}
+
+const char *DataDescriptor::getFieldName(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldName(field);
+        field -= basedesc->getFieldCount();
+    }
+    static const char *fieldNames[] = {
+        "foo",
+        "bar",
+    };
+    return (field >= 0 && field < 2) ? fieldNames[field] : nullptr;
+}
+
+int DataDescriptor::findField(const char *fieldName) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    static const struct { const char *name; int index; } fieldsByHash[4] = {
+        { "bar", FIELD_bar },
+        { "foo", FIELD_foo },
+        { nullptr, -1 },
+        { nullptr, -1 },
+    };
+    int slot = hashFieldName(fieldName, 0u) & 3;
+    if (fieldsByHash[slot].name != nullptr && strcmp(fieldName, fieldsByHash[slot].name) == 0)
+        return (basedesc ? basedesc->getFieldCount() : 0) + fieldsByHash[slot].index;
+    return basedesc ? basedesc->findField(fieldName) : -1;
+}
+
+const char *DataDescriptor::getFieldTypeString(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldTypeString(field);
+        field -= basedesc->getFieldCount();
+    }
+    static const char *fieldTypeStrings[] = {
+        "int",    // FIELD_foo
+        "string",    // FIELD_bar
+    };
+    return (field >= 0 && field < 2) ? fieldTypeStrings[field] : nullptr;
+}
+
+const char **DataDescriptor::getFieldPropertyNames(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldPropertyNames(field);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+const char *DataDescriptor::getFieldProperty(int field, const char *propertyname) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldProperty(field, propertyname);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+int DataDescriptor::getFieldArraySize(void *object, int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldArraySize(object, field);
+        field -= basedesc->getFieldCount();
+    }
+    Data *pp = (Data *)object; (void)pp;
+    switch (field) {
+        default: return 0;
+    }
+}
+
+void DataDescriptor::setFieldArraySize(void *object, int field, int size) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldArraySize(object, field, size);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Data *pp = (Data *)object; (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set array size of field %d of class 'Data'", field);
+    }
+}
+
+const char *DataDescriptor::getFieldDynamicTypeString(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldDynamicTypeString(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Data *pp = (Data *)object; (void)pp;
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+std::string DataDescriptor::getFieldValueAsString(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsString(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Data *pp = (Data *)object; (void)pp;
+    switch (field) {
+        case FIELD_foo: return long2string(pp->getFoo());
+        case FIELD_bar: return oppstring2string(pp->getBar());
+        default: return "";
+    }
+}
+
+omnetpp::intval_t DataDescriptor::getFieldValueAsInt(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsInt(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Data *pp = (Data *)object; (void)pp;
+    switch (field) {
+        case FIELD_foo: return (omnetpp::intval_t)(pp->getFoo());
+        default: return omnetpp::cClassDescriptor::getFieldValueAsInt(object, field + (basedesc ? basedesc->getFieldCount() : 0), i);
+    }
+}
+
+double DataDescriptor::getFieldValueAsDouble(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsDouble(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Data *pp = (Data *)object; (void)pp;
+    switch (field) {
+        default: return omnetpp::cClassDescriptor::getFieldValueAsDouble(object, field + (basedesc ? basedesc->getFieldCount() : 0), i);
+    }
+}
+
+void DataDescriptor::setFieldValueAsString(void *object, int field, int i, const char *value) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldValueAsString(object, field, i, value);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Data *pp = (Data *)object; (void)pp;
+    switch (field) {
+        case FIELD_foo: pp->setFoo(string2long(value)); break;
+        case FIELD_bar: pp->setBar((value)); break;
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'Data'", field);
+    }
+}
+
+const char *DataDescriptor::getFieldStructName(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldStructName(field);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    };
+}
+
+void *DataDescriptor::getFieldStructValuePointer(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldStructValuePointer(object, field, i);
+        field -= basedesc->getFieldCount();
+    }
+    Data *pp = (Data *)object; (void)pp;
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+void DataDescriptor::setFieldStructValuePointer(void *object, int field, int i, void *ptr) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldStructValuePointer(object, field, i, ptr);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Data *pp = (Data *)object; (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'Data'", field);
+    }
+}
+
+Register_Class(DataVector)
+
+DataVector::DataVector() : ::omnetpp::cObject()
+{
+}
+
+DataVector::DataVector(const DataVector& other) : ::omnetpp::cObject(other)
+{
+    copy(other);
+}
+
+DataVector::~DataVector()
+{
+    for (size_t i = 0; i < data_arraysize; i++)
+        delete this->data[i];
+    delete [] this->data;
+}
+
+DataVector& DataVector::operator=(const DataVector& other)
+{
+    if (this == &other) return *this;
+    ::omnetpp::cObject::operator=(other);
+    copy(other);
+    return *this;
+}
+
+void DataVector::copy(const DataVector& other)
+{
+    for (size_t i = 0; i < data_arraysize; i++)
+        delete this->data[i];
+    delete [] this->data;
+    this->data = (other.data_arraysize==0) ? nullptr : new Data *[other.data_arraysize];
+    data_arraysize = other.data_arraysize;
+    for (size_t i = 0; i < data_arraysize; i++) {
+        this->data[i] = other.data[i];
+        if (this->data[i] != nullptr) {
+            this->data[i] = this->data[i]->dup();
+        }
+    }
+}
+
+void DataVector::parsimPack(omnetpp::cCommBuffer *b) const
+{
+    b->pack(data_arraysize);
+    doParsimArrayPacking(b,this->data,data_arraysize);
+}
+
+void DataVector::parsimUnpack(omnetpp::cCommBuffer *b)
+{
+    delete [] this->data;
+    b->unpack(data_arraysize);
+    if (data_arraysize == 0) {
+        this->data = nullptr;
+    } else {
+        this->data = new Data *[data_arraysize];
+        doParsimArrayUnpacking(b,this->data,data_arraysize);
+    }
+}
+
+size_t DataVector::getDataArraySize() const
+{
+    return data_arraysize;
+}
+
+const Data * DataVector::getData(size_t k) const
+{
+    if (k >= data_arraysize) throw omnetpp::cRuntimeError("Array of size data_arraysize indexed by %lu", (unsigned long)k);
+    return this->data[k];
+}
+
+void DataVector::setDataArraySize(size_t newSize)
+{
+    Data * *data2 = (newSize==0) ? nullptr : new Data *[newSize];
+    size_t minSize = data_arraysize < newSize ? data_arraysize : newSize;
+    for (size_t i = 0; i < minSize; i++)
+        data2[i] = this->data[i];
+    for (size_t i = minSize; i < newSize; i++)
+        data2[i] = nullptr;
+    for (size_t i = newSize; i < data_arraysize; i++)
+        delete data[i];
+    delete [] this->data;
+    this->data = data2;
+    data_arraysize = newSize;
+}
+
+void DataVector::setData(size_t k, Data * data)
+{
+    if (k >= data_arraysize) throw omnetpp::cRuntimeError("Array of size  indexed by %lu", (unsigned long)k);
+    if (this->data[k] != nullptr) throw omnetpp::cRuntimeError("setData(): a value is already set, remove it first with dropData()");
+    this->data[k] = data;
+}
+
+Data * DataVector::dropData(size_t k)
+{
+    if (k >= data_arraysize) throw omnetpp::cRuntimeError("Array of size  indexed by %lu", (unsigned long)k);
+    Data * retval = this->data[k];
+    this->data[k] = nullptr;
+    return retval;
+}
+
+void DataVector::insertData(size_t k, Data * data)
+{
+    if (k > data_arraysize) throw omnetpp::cRuntimeError("Array of size  indexed by %lu", (unsigned long)k);
+    size_t newSize = data_arraysize + 1;
+    Data * *data2 = new Data *[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        data2[i] = this->data[i];
+    data2[k] = data;
+    for (i = k + 1; i < newSize; i++)
+        data2[i] = this->data[i-1];
+    delete [] this->data;
+    this->data = data2;
+    data_arraysize = newSize;
+}
+
+void DataVector::insertData(Data * data)
+{
+    insertData(data_arraysize, data);
+}
+
+void DataVector::eraseData(size_t k)
+{
+    if (k >= data_arraysize) throw omnetpp::cRuntimeError("Array of size  indexed by %lu", (unsigned long)k);
+    size_t newSize = data_arraysize - 1;
+    Data * *data2 = (newSize == 0) ? nullptr : new Data *[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        data2[i] = this->data[i];
+    for (i = k; i < newSize; i++)
+        data2[i] = this->data[i+1];
+    delete this->data[k];
+    delete [] this->data;
+    this->data = data2;
+    data_arraysize = newSize;
+}
+
+class DataVectorDescriptor : public omnetpp::cClassDescriptor
+{
+  private:
+    mutable const char **propertynames;
+    enum FieldConstants {
+        FIELD_data,
+    };
+  public:
+    DataVectorDescriptor();
+    virtual ~DataVectorDescriptor();
+
+    virtual bool doesSupport(omnetpp::cObject *obj) const override;
+    virtual const char **getPropertyNames() const override;
+    virtual const char *getProperty(const char *propertyname) const override;
+    virtual int getFieldCount() const override;
+    virtual const char *getFieldName(int field) const override;
+    virtual int findField(const char *fieldName) const override;
+    virtual unsigned int getFieldTypeFlags(int field) const override;
+    virtual const char *getFieldTypeString(int field) const override;
+    virtual const char **getFieldPropertyNames(int field) const override;
+    virtual const char *getFieldProperty(int field, const char *propertyname) const override;
+    virtual int getFieldArraySize(void *object, int field) const override;
+    virtual void setFieldArraySize(void *object, int field, int size) const override;
+
+    virtual const char *getFieldDynamicTypeString(void *object, int field, int i) const override;
+    virtual std::string getFieldValueAsString(void *object, int field, int i) const override;
+    virtual omnetpp::intval_t getFieldValueAsInt(void *object, int field, int i) const override;
+    virtual double getFieldValueAsDouble(void *object, int field, int i) const override;
+    virtual void setFieldValueAsString(void *object, int field, int i, const char *value) const override;
+
+    virtual const char *getFieldStructName(int field) const override;
+    virtual void *getFieldStructValuePointer(void *object, int field, int i) const override;
+    virtual void setFieldStructValuePointer(void *object, int field, int i, void *ptr) const override;
+};
+
+Register_ClassDescriptor(DataVectorDescriptor)
+
+DataVectorDescriptor::DataVectorDescriptor() : omnetpp::cClassDescriptor(omnetpp::opp_typename(typeid(NED_jsonparam_2::DataVector)), "omnetpp::cObject")
+{
+    propertynames = nullptr;
+}
+
+DataVectorDescriptor::~DataVectorDescriptor()
+{
+    delete[] propertynames;
+}
+
+bool DataVectorDescriptor::doesSupport(omnetpp::cObject *obj) const
+{
+    return dynamic_cast<DataVector *>(obj)!=nullptr;
+}
+
+const char **DataVectorDescriptor::getPropertyNames() const
+{
+    if (!propertynames) {
+        static const char *names[] = {  nullptr };
+        omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+        const char **basenames = basedesc ? basedesc->getPropertyNames() : nullptr;
+        propertynames = mergeLists(basenames, names);
+    }
+    return propertynames;
+}
+
+const char *DataVectorDescriptor::getProperty(const char *propertyname) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    return basedesc ? basedesc->getProperty(propertyname) : nullptr;
+}
+
+int DataVectorDescriptor::getFieldCount() const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    return basedesc ? 1+basedesc->getFieldCount() : 1;
+}
+
+unsigned int DataVectorDescriptor::getFieldTypeFlags(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldTypeFlags(field);
+        field -= basedesc->getFieldCount();
+    }
+    static unsigned int fieldTypeFlags[] = {
+        FD_ISARRAY | FD_ISCOMPOUND | FD_ISPOINTER | FD_ISCOBJECT | FD_ISREPLACEABLE | FD_ISRESIZABLE,    // FIELD_data
+    };
+    return (field >= 0 && field < 1) ? fieldTypeFlags[field] : 0;
+}
+
+const char *DataVectorDescriptor::getFieldName(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldName(field);
+        field -= basedesc->getFieldCount();
+    }
+    static const char *fieldNames[] = {
+        "data",
+    };
+    return (field >= 0 && field < 1) ? fieldNames[field] : nullptr;
+}
+
+int DataVectorDescriptor::findField(const char *fieldName) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    static const struct { const char *name; int index; } fieldsByHash[2] = {
+        { "data", FIELD_data },
+        { nullptr, -1 },
+    };
+    int slot = hashFieldName(fieldName, 0u) & 1;
+    if (fieldsByHash[slot].name != nullptr && strcmp(fieldName, fieldsByHash[slot].name) == 0)
+        return (basedesc ? basedesc->getFieldCount() : 0) + fieldsByHash[slot].index;
+    return basedesc ? basedesc->findField(fieldName) : -1;
+}
+
+const char *DataVectorDescriptor::getFieldTypeString(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldTypeString(field);
+        field -= basedesc->getFieldCount();
+    }
+    static const char *fieldTypeStrings[] = {
+        "NED_jsonparam_2::Data",    // FIELD_data
+    };
+    return (field >= 0 && field < 1) ? fieldTypeStrings[field] : nullptr;
+}
+
+const char **DataVectorDescriptor::getFieldPropertyNames(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldPropertyNames(field);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        case FIELD_data: {
+            static const char *names[] = { "owned",  nullptr };
+            return names;
+        }
+        default: return nullptr;
+    }
+}
+
+const char *DataVectorDescriptor::getFieldProperty(int field, const char *propertyname) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldProperty(field, propertyname);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        case FIELD_data:
+            if (!strcmp(propertyname, "owned")) return "";
+            return nullptr;
+        default: return nullptr;
+    }
+}
+
+int DataVectorDescriptor::getFieldArraySize(void *object, int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldArraySize(object, field);
+        field -= basedesc->getFieldCount();
+    }
+    DataVector *pp = (DataVector *)object; (void)pp;
+    switch (field) {
+        case FIELD_data: return pp->getDataArraySize();
+        default: return 0;
+    }
+}
+
+void DataVectorDescriptor::setFieldArraySize(void *object, int field, int size) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldArraySize(object, field, size);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    DataVector *pp = (DataVector *)object; (void)pp;
+    switch (field) {
+        case FIELD_data: pp->setDataArraySize(size); break;
+        default: throw omnetpp::cRuntimeError("Cannot set array size of field %d of class 'DataVector'", field);
+    }
+}
+
+const char *DataVectorDescriptor::getFieldDynamicTypeString(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldDynamicTypeString(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    DataVector *pp = (DataVector *)object; (void)pp;
+    switch (field) {
+        case FIELD_data: { const Data * value = pp->getData(i); return omnetpp::opp_typename(typeid(*value)); }
+        default: return nullptr;
+    }
+}
+
+std::string DataVectorDescriptor::getFieldValueAsString(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsString(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    DataVector *pp = (DataVector *)object; (void)pp;
+    switch (field) {
+        case FIELD_data: {std::stringstream out; out << pp->getData(i); return out.str();}
+        default: return "";
+    }
+}
+
+omnetpp::intval_t DataVectorDescriptor::getFieldValueAsInt(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsInt(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    DataVector *pp = (DataVector *)object; (void)pp;
+    switch (field) {
+        default: return omnetpp::cClassDescriptor::getFieldValueAsInt(object, field + (basedesc ? basedesc->getFieldCount() : 0), i);
+    }
+}
+
+double DataVectorDescriptor::getFieldValueAsDouble(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsDouble(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    DataVector *pp = (DataVector *)object; (void)pp;
+    switch (field) {
+        default: return omnetpp::cClassDescriptor::getFieldValueAsDouble(object, field + (basedesc ? basedesc->getFieldCount() : 0), i);
+    }
+}
+
+void DataVectorDescriptor::setFieldValueAsString(void *object, int field, int i, const char *value) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldValueAsString(object, field, i, value);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    DataVector *pp = (DataVector *)object; (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'DataVector'", field);
+    }
+}
+
+const char *DataVectorDescriptor::getFieldStructName(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldStructName(field);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        case FIELD_data: return omnetpp::opp_typename(typeid(Data));
+        default: return nullptr;
+    };
+}
+
+void *DataVectorDescriptor::getFieldStructValuePointer(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldStructValuePointer(object, field, i);
+        field -= basedesc->getFieldCount();
+    }
+    DataVector *pp = (DataVector *)object; (void)pp;
+    switch (field) {
+        case FIELD_data: return toVoidPtr(pp->getData(i)); break;
+        default: return nullptr;
+    }
+}
+
+void DataVectorDescriptor::setFieldStructValuePointer(void *object, int field, int i, void *ptr) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldStructValuePointer(object, field, i, ptr);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    DataVector *pp = (DataVector *)object; (void)pp;
+    switch (field) {
+        case FIELD_data: pp->setData(i,(Data *)ptr); break;
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'DataVector'", field);
+    }
+}
+
+Register_Class(Messages)
+
+Messages::Messages() : ::omnetpp::cObject()
+{
+    if (this->msg != nullptr) take(this->msg);
+}
+
+Messages::Messages(const Messages& other) : ::omnetpp::cObject(other)
+{
+    copy(other);
+}
+
+Messages::~Messages()
+{
+    dropAndDelete(this->msg);
+    for (size_t i = 0; i < list_arraysize; i++)
+        dropAndDelete(this->list[i]);
+    delete [] this->list;
+}
+
+Messages& Messages::operator=(const Messages& other)
+{
+    if (this == &other) return *this;
+    ::omnetpp::cObject::operator=(other);
+    copy(other);
+    return *this;
+}
+
+void Messages::copy(const Messages& other)
+{
+    dropAndDelete(this->msg);
+    this->msg = other.msg;
+    if (this->msg != nullptr) {
+        this->msg = this->msg->dup();
+        take(this->msg);
+        this->msg->setName(other.msg->getName());
+    }
+    for (size_t i = 0; i < list_arraysize; i++)
+        dropAndDelete(this->list[i]);
+    delete [] this->list;
+    this->list = (other.list_arraysize==0) ? nullptr : new cMessage *[other.list_arraysize];
+    list_arraysize = other.list_arraysize;
+    for (size_t i = 0; i < list_arraysize; i++) {
+        this->list[i] = other.list[i];
+        if (this->list[i] != nullptr) {
+            this->list[i] = this->list[i]->dup();
+            take(this->list[i]);
+            this->list[i]->setName(other.list[i]->getName());
+        }
+    }
+}
+
+void Messages::parsimPack(omnetpp::cCommBuffer *b) const
+{
+    doParsimPacking(b,this->msg);
+    b->pack(list_arraysize);
+    doParsimArrayPacking(b,this->list,list_arraysize);
+}
+
+void Messages::parsimUnpack(omnetpp::cCommBuffer *b)
+{
+    doParsimUnpacking(b,this->msg);
+    delete [] this->list;
+    b->unpack(list_arraysize);
+    if (list_arraysize == 0) {
+        this->list = nullptr;
+    } else {
+        this->list = new cMessage *[list_arraysize];
+        doParsimArrayUnpacking(b,this->list,list_arraysize);
+    }
+}
+
+const cMessage * Messages::getMsg() const
+{
+    return this->msg;
+}
+
+void Messages::setMsg(cMessage * msg)
+{
+    if (this->msg != nullptr) throw omnetpp::cRuntimeError("setMsg(): a value is already set, remove it first with dropMsg()");
+    this->msg = msg;
+    if (this->msg != nullptr)
+        take(this->msg);
+}
+
+cMessage * Messages::dropMsg()
+{
+    cMessage * retval = this->msg;
+    if (retval != nullptr)
+        drop(retval);
+    this->msg = nullptr;
+    return retval;
+}
+
+size_t Messages::getListArraySize() const
+{
+    return list_arraysize;
+}
+
+const cMessage * Messages::getList(size_t k) const
+{
+    if (k >= list_arraysize) throw omnetpp::cRuntimeError("Array of size list_arraysize indexed by %lu", (unsigned long)k);
+    return this->list[k];
+}
+
+void Messages::setListArraySize(size_t newSize)
+{
+    cMessage * *list2 = (newSize==0) ? nullptr : new cMessage *[newSize];
+    size_t minSize = list_arraysize < newSize ? list_arraysize : newSize;
+    for (size_t i = 0; i < minSize; i++)
+        list2[i] = this->list[i];
+    for (size_t i = minSize; i < newSize; i++)
+        list2[i] = nullptr;
+    for (size_t i = newSize; i < list_arraysize; i++)
+        dropAndDelete(list[i]);
+    delete [] this->list;
+    this->list = list2;
+    list_arraysize = newSize;
+}
+
+void Messages::setList(size_t k, cMessage * list)
+{
+    if (k >= list_arraysize) throw omnetpp::cRuntimeError("Array of size  indexed by %lu", (unsigned long)k);
+    if (this->list[k] != nullptr) throw omnetpp::cRuntimeError("setList(): a value is already set, remove it first with dropList()");
+    this->list[k] = list;
+    if (this->list[k] != nullptr)
+        take(this->list[k]);
+}
+
+cMessage * Messages::dropList(size_t k)
+{
+    if (k >= list_arraysize) throw omnetpp::cRuntimeError("Array of size  indexed by %lu", (unsigned long)k);
+    cMessage * retval = this->list[k];
+    if (retval != nullptr)
+        drop(retval);
+    this->list[k] = nullptr;
+    return retval;
+}
+
+void Messages::insertList(size_t k, cMessage * list)
+{
+    if (k > list_arraysize) throw omnetpp::cRuntimeError("Array of size  indexed by %lu", (unsigned long)k);
+    size_t newSize = list_arraysize + 1;
+    cMessage * *list2 = new cMessage *[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        list2[i] = this->list[i];
+    list2[k] = list;
+    if (list2[k] != nullptr)
+        take(list2[k]);
+    for (i = k + 1; i < newSize; i++)
+        list2[i] = this->list[i-1];
+    delete [] this->list;
+    this->list = list2;
+    list_arraysize = newSize;
+}
+
+void Messages::insertList(cMessage * list)
+{
+    insertList(list_arraysize, list);
+}
+
+void Messages::eraseList(size_t k)
+{
+    if (k >= list_arraysize) throw omnetpp::cRuntimeError("Array of size  indexed by %lu", (unsigned long)k);
+    size_t newSize = list_arraysize - 1;
+    cMessage * *list2 = (newSize == 0) ? nullptr : new cMessage *[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        list2[i] = this->list[i];
+    for (i = k; i < newSize; i++)
+        list2[i] = this->list[i+1];
+    dropAndDelete(this->list[k]);
+    delete [] this->list;
+    this->list = list2;
+    list_arraysize = newSize;
+}
+
+class MessagesDescriptor : public omnetpp::cClassDescriptor
+{
+  private:
+    mutable const char **propertynames;
+    enum FieldConstants {
+        FIELD_msg,
+        FIELD_list,
+    };
+  public:
+    MessagesDescriptor();
+    virtual ~MessagesDescriptor();
+
+    virtual bool doesSupport(omnetpp::cObject *obj) const override;
+    virtual const char **getPropertyNames() const override;
+    virtual const char *getProperty(const char *propertyname) const override;
+    virtual int getFieldCount() const override;
+    virtual const char *getFieldName(int field) const override;
+    virtual int findField(const char *fieldName) const override;
+    virtual unsigned int getFieldTypeFlags(int field) const override;
+    virtual const char *getFieldTypeString(int field) const override;
+    virtual const char **getFieldPropertyNames(int field) const override;
+    virtual const char *getFieldProperty(int field, const char *propertyname) const override;
+    virtual int getFieldArraySize(void *object, int field) const override;
+    virtual void setFieldArraySize(void *object, int field, int size) const override;
+
+    virtual const char *getFieldDynamicTypeString(void *object, int field, int i) const override;
+    virtual std::string getFieldValueAsString(void *object, int field, int i) const override;
+    virtual omnetpp::intval_t getFieldValueAsInt(void *object, int field, int i) const override;
+    virtual double getFieldValueAsDouble(void *object, int field, int i) const override;
+    virtual void setFieldValueAsString(void *object, int field, int i, const char *value) const override;
+
+    virtual const char *getFieldStructName(int field) const override;
+    virtual void *getFieldStructValuePointer(void *object, int field, int i) const override;
+    virtual void setFieldStructValuePointer(void *object, int field, int i, void *ptr) const override;
+};
+
+Register_ClassDescriptor(MessagesDescriptor)
+
+MessagesDescriptor::MessagesDescriptor() : omnetpp::cClassDescriptor(omnetpp::opp_typename(typeid(NED_jsonparam_2::Messages)), "omnetpp::cObject")
+{
+    propertynames = nullptr;
+}
+
+MessagesDescriptor::~MessagesDescriptor()
+{
+    delete[] propertynames;
+}
+
+bool MessagesDescriptor::doesSupport(omnetpp::cObject *obj) const
+{
+    return dynamic_cast<Messages *>(obj)!=nullptr;
+}
+
+const char **MessagesDescriptor::getPropertyNames() const
+{
+    if (!propertynames) {
+        static const char *names[] = {  nullptr };
+        omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+        const char **basenames = basedesc ? basedesc->getPropertyNames() : nullptr;
+        propertynames = mergeLists(basenames, names);
+    }
+    return propertynames;
+}
+
+const char *MessagesDescriptor::getProperty(const char *propertyname) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    return basedesc ? basedesc->getProperty(propertyname) : nullptr;
+}
+
+int MessagesDescriptor::getFieldCount() const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    return basedesc ? 2+basedesc->getFieldCount() : 2;
+}
+
+unsigned int MessagesDescriptor::getFieldTypeFlags(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldTypeFlags(field);
+        field -= basedesc->getFieldCount();
+    }
+    static unsigned int fieldTypeFlags[] = {
+        FD_ISCOMPOUND | FD_ISPOINTER | FD_ISCOBJECT | FD_ISCOWNEDOBJECT | FD_ISREPLACEABLE,    // FIELD_msg
+        FD_ISARRAY | FD_ISCOMPOUND | FD_ISPOINTER | FD_ISCOBJECT | FD_ISCOWNEDOBJECT | FD_ISREPLACEABLE | FD_ISRESIZABLE,    // FIELD_list
+    };
+    return (field >= 0 && field < 2) ? fieldTypeFlags[field] : 0;
+}
+
+const char *MessagesDescriptor::getFieldName(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldName(field);
+        field -= basedesc->getFieldCount();
+    }
+    static const char *fieldNames[] = {
+        "msg",
+        "list",
+    };
+    return (field >= 0 && field < 2) ? fieldNames[field] : nullptr;
+}
+
+int MessagesDescriptor::findField(const char *fieldName) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    static const struct { const char *name; int index; } fieldsByHash[4] = {
+        { nullptr, -1 },
+        { nullptr, -1 },
+        { "msg", FIELD_msg },
+        { "list", FIELD_list },
+    };
+    int slot = hashFieldName(fieldName, 0u) & 3;
+    if (fieldsByHash[slot].name != nullptr && strcmp(fieldName, fieldsByHash[slot].name) == 0)
+        return (basedesc ? basedesc->getFieldCount() : 0) + fieldsByHash[slot].index;
+    return basedesc ? basedesc->findField(fieldName) : -1;
+}
+
+const char *MessagesDescriptor::getFieldTypeString(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldTypeString(field);
+        field -= basedesc->getFieldCount();
+    }
+    static const char *fieldTypeStrings[] = {
+        "omnetpp::cMessage",    // FIELD_msg
+        "omnetpp::cMessage",    // FIELD_list
+    };
+    return (field >= 0 && field < 2) ? fieldTypeStrings[field] : nullptr;
+}
+
+const char **MessagesDescriptor::getFieldPropertyNames(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldPropertyNames(field);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        case FIELD_msg: {
+            static const char *names[] = { "owned",  nullptr };
+            return names;
+        }
+        case FIELD_list: {
+            static const char *names[] = { "owned",  nullptr };
+            return names;
+        }
+        default: return nullptr;
+    }
+}
+
+const char *MessagesDescriptor::getFieldProperty(int field, const char *propertyname) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldProperty(field, propertyname);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        case FIELD_msg:
+            if (!strcmp(propertyname, "owned")) return "";
+            return nullptr;
+        case FIELD_list:
+            if (!strcmp(propertyname, "owned")) return "";
+            return nullptr;
+        default: return nullptr;
+    }
+}
+
+int MessagesDescriptor::getFieldArraySize(void *object, int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldArraySize(object, field);
+        field -= basedesc->getFieldCount();
+    }
+    Messages *pp = (Messages *)object; (void)pp;
+    switch (field) {
+        case FIELD_list: return pp->getListArraySize();
+        default: return 0;
+    }
+}
+
+void MessagesDescriptor::setFieldArraySize(void *object, int field, int size) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldArraySize(object, field, size);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Messages *pp = (Messages *)object; (void)pp;
+    switch (field) {
+        case FIELD_list: pp->setListArraySize(size); break;
+        default: throw omnetpp::cRuntimeError("Cannot set array size of field %d of class 'Messages'", field);
+    }
+}
+
+const char *MessagesDescriptor::getFieldDynamicTypeString(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldDynamicTypeString(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Messages *pp = (Messages *)object; (void)pp;
+    switch (field) {
+        case FIELD_msg: { const cMessage * value = pp->getMsg(); return omnetpp::opp_typename(typeid(*value)); }
+        case FIELD_list: { const cMessage * value = pp->getList(i); return omnetpp::opp_typename(typeid(*value)); }
+        default: return nullptr;
+    }
+}
+
+std::string MessagesDescriptor::getFieldValueAsString(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsString(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Messages *pp = (Messages *)object; (void)pp;
+    switch (field) {
+        case FIELD_msg: {std::stringstream out; out << pp->getMsg(); return out.str();}
+        case FIELD_list: {std::stringstream out; out << pp->getList(i); return out.str();}
+        default: return "";
+    }
+}
+
+omnetpp::intval_t MessagesDescriptor::getFieldValueAsInt(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsInt(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Messages *pp = (Messages *)object; (void)pp;
+    switch (field) {
+        default: return omnetpp::cClassDescriptor::getFieldValueAsInt(object, field + (basedesc ? basedesc->getFieldCount() : 0), i);
+    }
+}
+
+double MessagesDescriptor::getFieldValueAsDouble(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsDouble(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Messages *pp = (Messages *)object; (void)pp;
+    switch (field) {
+        default: return omnetpp::cClassDescriptor::getFieldValueAsDouble(object, field + (basedesc ? basedesc->getFieldCount() : 0), i);
+    }
+}
+
+void MessagesDescriptor::setFieldValueAsString(void *object, int field, int i, const char *value) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldValueAsString(object, field, i, value);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Messages *pp = (Messages *)object; (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'Messages'", field);
+    }
+}
+
+const char *MessagesDescriptor::getFieldStructName(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldStructName(field);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        case FIELD_msg: return omnetpp::opp_typename(typeid(cMessage));
+        case FIELD_list: return omnetpp::opp_typename(typeid(cMessage));
+        default: return nullptr;
+    };
+}
+
+void *MessagesDescriptor::getFieldStructValuePointer(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldStructValuePointer(object, field, i);
+        field -= basedesc->getFieldCount();
+    }
+    Messages *pp = (Messages *)object; (void)pp;
+    switch (field) {
+        case FIELD_msg: return toVoidPtr(pp->getMsg()); break;
+        case FIELD_list: return toVoidPtr(pp->getList(i)); break;
+        default: return nullptr;
+    }
+}
+
+void MessagesDescriptor::setFieldStructValuePointer(void *object, int field, int i, void *ptr) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldStructValuePointer(object, field, i, ptr);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Messages *pp = (Messages *)object; (void)pp;
+    switch (field) {
+        case FIELD_msg: pp->setMsg((cMessage *)ptr); break;
+        case FIELD_list: pp->setList(i,(cMessage *)ptr); break;
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'Messages'", field);
+    }
+}
+
+} // namespace NED_jsonparam_2
+
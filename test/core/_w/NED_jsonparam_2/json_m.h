@@ -0,0 +1,174 @@
+//
+// Generated file, do not edit! Created by nedtool 6.0 from NED_jsonparam_2/json.msg.
+//
+
+#ifndef __NED_JSONPARAM_2_JSON_M_H
+#define __NED_JSONPARAM_2_JSON_M_H
+
+#if defined(__clang__)
+#  pragma clang diagnostic ignored "-Wreserved-id-macro"
+#endif
+#include <omnetpp.h>
+
+// nedtool version check
+#define MSGC_VERSION 0x0600
+#if (MSGC_VERSION!=OMNETPP_VERSION)
+#    error Version mismatch! Probably this file was generated by an earlier version of nedtool: 'make clean' should help.
+#endif
+
+
+namespace NED_jsonparam_2 {
+
+class Data;
+class DataVector;
+class Messages;
+} // namespace NED_jsonparam_2
+
+
+namespace NED_jsonparam_2 {
+
+// cplusplus {{
+ using namespace omnetpp; 
+// }}
+
+/**
+ * Class generated from <tt>NED_jsonparam_2/json.msg:7</tt> by nedtool.
+ * <pre>
+ * class Data extends cObject
+ * {
+ *     int foo;
+ *     string bar;
+ * }
+ * </pre>
+ */
+class Data : public ::omnetpp::cObject
+{
+  protected:
+    int foo = 0;
+    omnetpp::opp_string bar;
+
+  private:
+    void copy(const Data& other);
+
+  protected:
+    bool operator==(const Data&) = delete;
+
+  public:
+    Data();
+    Data(const Data& other);
+    virtual ~Data();
+    Data& operator=(const Data& other);
+    virtual Data *dup() const override {return new Data(*this);}
+    virtual void parsimPack(omnetpp::cCommBuffer *b) const override;
+    virtual void parsimUnpack(omnetpp::cCommBuffer *b) override;
+
+    // field getter/setter methods
+    virtual int getFoo() const;
+    virtual void setFoo(int foo);
+    virtual const char * getBar() const;
+    virtual void setBar(const char * bar);
+};
+
+inline void doParsimPacking(omnetpp::cCommBuffer *b, const Data& obj) {obj.parsimPack(b);}
+inline void doParsimUnpacking(omnetpp::cCommBuffer *b, Data& obj) {obj.parsimUnpack(b);}
+
+/**
+ * Class generated from <tt>NED_jsonparam_2/json.msg:13</tt> by nedtool.
+ * <pre>
+ * class DataVector extends cObject
+ * {
+ *     Data *data[] \@owned;
+ * }
+ * </pre>
+ */
+class DataVector : public ::omnetpp::cObject
+{
+  protected:
+    Data * *data = nullptr;
+    size_t data_arraysize = 0;
+
+  private:
+    void copy(const DataVector& other);
+
+  protected:
+    bool operator==(const DataVector&) = delete;
+
+  public:
+    DataVector();
+    DataVector(const DataVector& other);
+    virtual ~DataVector();
+    DataVector& operator=(const DataVector& other);
+    virtual DataVector *dup() const override {return new DataVector(*this);}
+    virtual void parsimPack(omnetpp::cCommBuffer *b) const override;
+    virtual void parsimUnpack(omnetpp::cCommBuffer *b) override;
+
+    // field getter/setter methods
+    virtual void setDataArraySize(size_t size);
+    virtual size_t getDataArraySize() const;
+    virtual const Data * getData(size_t k) const;
+    virtual Data * getDataForUpdate(size_t k) { return const_cast<Data *>(const_cast<DataVector*>(this)->getData(k));}
+    virtual Data * dropData(size_t k);
+    virtual void setData(size_t k, Data * data);
+    virtual void insertData(Data * data);
+    virtual void insertData(size_t k, Data * data);
+    virtual void eraseData(size_t k);
+};
+
+inline void doParsimPacking(omnetpp::cCommBuffer *b, const DataVector& obj) {obj.parsimPack(b);}
+inline void doParsimUnpacking(omnetpp::cCommBuffer *b, DataVector& obj) {obj.parsimUnpack(b);}
+
+/**
+ * Class generated from <tt>NED_jsonparam_2/json.msg:18</tt> by nedtool.
+ * <pre>
+ * class Messages extends cObject
+ * {
+ *     cMessage *msg \@owned;
+ *     cMessage *list[] \@owned;
+ * }
+ * </pre>
+ */
+class Messages : public ::omnetpp::cObject
+{
+  protected:
+    cMessage * msg = nullptr;
+    cMessage * *list = nullptr;
+    size_t list_arraysize = 0;
+
+  private:
+    void copy(const Messages& other);
+
+  protected:
+    bool operator==(const Messages&) = delete;
+
+  public:
+    Messages();
+    Messages(const Messages& other);
+    virtual ~Messages();
+    Messages& operator=(const Messages& other);
+    virtual Messages *dup() const override {return new Messages(*this);}
+    virtual void parsimPack(omnetpp::cCommBuffer *b) const override;
+    virtual void parsimUnpack(omnetpp::cCommBuffer *b) override;
+
+    // field getter/setter methods
+    virtual const cMessage * getMsg() const;
+    virtual cMessage * getMsgForUpdate() { return const_cast<cMessage *>(const_cast<Messages*>(this)->getMsg());}
+    virtual cMessage * dropMsg();
+    virtual void setMsg(cMessage * msg);
+    virtual void setListArraySize(size_t size);
+    virtual size_t getListArraySize() const;
+    virtual const cMessage * getList(size_t k) const;
+    virtual cMessage * getListForUpdate(size_t k) { return const_cast<cMessage *>(const_cast<Messages*>(this)->getList(k));}
+    virtual cMessage * dropList(size_t k);
+    virtual void setList(size_t k, cMessage * list);
+    virtual void insertList(cMessage * list);
+    virtual void insertList(size_t k, cMessage * list);
+    virtual void eraseList(size_t k);
+};
+
+inline void doParsimPacking(omnetpp::cCommBuffer *b, const Messages& obj) {obj.parsimPack(b);}
+inline void doParsimUnpacking(omnetpp::cCommBuffer *b, Messages& obj) {obj.parsimUnpack(b);}
+
+} // namespace NED_jsonparam_2
+
+#endif // ifndef __NED_JSONPARAM_2_JSON_M_H
+
@@ -0,0 +1,34 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_jsonparam_3 {
+
+class Node : public cSimpleModule
+{
+  public:
+    Node() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Node);
+
+void Node::activity()
+{
+    for (int i=0; i<getNumParams(); i++) {
+        cPar& p = par(i);
+        cObject *obj = p.objectValue();
+        if (p.isVolatile()) {
+            // verify that volatile parameters actually yield a new object each time
+            cObject *prevObj = obj;
+            obj = p.objectValue();
+            ASSERT(obj != prevObj);
+        }
+        EV << p.getFullPath() << " = " << obj->str() << endl;
+    }
+    EV << ".\n";
+}
+
+}; //namespace
+
@@ -0,0 +1,962 @@
+//
+// Generated file, do not edit! Created by nedtool 6.0 from NED_jsonparam_4/json.msg.
+//
+
+// Disable warnings about unused variables, empty switch stmts, etc:
+#ifdef _MSC_VER
+#  pragma warning(disable:4101)
+#  pragma warning(disable:4065)
+#endif
+
+#if defined(__clang__)
+#  pragma clang diagnostic ignored "-Wshadow"
+#  pragma clang diagnostic ignored "-Wconversion"
+#  pragma clang diagnostic ignored "-Wunused-parameter"
+#  pragma clang diagnostic ignored "-Wc++98-compat"
+#  pragma clang diagnostic ignored "-Wunreachable-code-break"
+#  pragma clang diagnostic ignored "-Wold-style-cast"
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic ignored "-Wshadow"
+#  pragma GCC diagnostic ignored "-Wconversion"
+#  pragma GCC diagnostic ignored "-Wunused-parameter"
+#  pragma GCC diagnostic ignored "-Wold-style-cast"
+#  pragma GCC diagnostic ignored "-Wsuggest-attribute=noreturn"
+#  pragma GCC diagnostic ignored "-Wfloat-conversion"
+#endif
+
+#include <iostream>
+#include <sstream>
+#include <memory>
+#include "json_m.h"
+
+namespace omnetpp {
+
+// Template pack/unpack rules. They are declared *after* a1l type-specific pack functions for multiple reasons.
+// They are in the omnetpp namespace, to allow them to be found by argument-dependent lookup via the cCommBuffer argument
+
+// Packing/unpacking an std::vector
+template<typename T, typename A>
+void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::vector<T,A>& v)
+{
+    int n = v.size();
+    doParsimPacking(buffer, n);
+    for (int i = 0; i < n; i++)
+        doParsimPacking(buffer, v[i]);
+}
+
+template<typename T, typename A>
+void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::vector<T,A>& v)
+{
+    int n;
+    doParsimUnpacking(buffer, n);
+    v.resize(n);
+    for (int i = 0; i < n; i++)
+        doParsimUnpacking(buffer, v[i]);
+}
+
+// Packing/unpacking an std::list
+template<typename T, typename A>
+void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::list<T,A>& l)
+{
+    doParsimPacking(buffer, (int)l.size());
+    for (typename std::list<T,A>::const_iterator it = l.begin(); it != l.end(); ++it)
+        doParsimPacking(buffer, (T&)*it);
+}
+
+template<typename T, typename A>
+void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::list<T,A>& l)
+{
+    int n;
+    doParsimUnpacking(buffer, n);
+    for (int i = 0; i < n; i++) {
+        l.push_back(T());
+        doParsimUnpacking(buffer, l.back());
+    }
+}
+
+// Packing/unpacking an std::set
+template<typename T, typename Tr, typename A>
+void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::set<T,Tr,A>& s)
+{
+    doParsimPacking(buffer, (int)s.size());
+    for (typename std::set<T,Tr,A>::const_iterator it = s.begin(); it != s.end(); ++it)
+        doParsimPacking(buffer, *it);
+}
+
+template<typename T, typename Tr, typename A>
+void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::set<T,Tr,A>& s)
+{
+    int n;
+    doParsimUnpacking(buffer, n);
+    for (int i = 0; i < n; i++) {
+        T x;
+        doParsimUnpacking(buffer, x);
+        s.insert(x);
+    }
+}
+
+// Packing/unpacking an std::map
+template<typename K, typename V, typename Tr, typename A>
+void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::map<K,V,Tr,A>& m)
+{
+    doParsimPacking(buffer, (int)m.size());
+    for (typename std::map<K,V,Tr,A>::const_iterator it = m.begin(); it != m.end(); ++it) {
+        doParsimPacking(buffer, it->first);
+        doParsimPacking(buffer, it->second);
+    }
+}
+
+template<typename K, typename V, typename Tr, typename A>
+void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::map<K,V,Tr,A>& m)
+{
+    int n;
+    doParsimUnpacking(buffer, n);
+    for (int i = 0; i < n; i++) {
+        K k; V v;
+        doParsimUnpacking(buffer, k);
+        doParsimUnpacking(buffer, v);
+        m[k] = v;
+    }
+}
+
+// Default pack/unpack function for arrays
+template<typename T>
+void doParsimArrayPacking(omnetpp::cCommBuffer *b, const T *t, int n)
+{
+    for (int i = 0; i < n; i++)
+        doParsimPacking(b, t[i]);
+}
+
+template<typename T>
+void doParsimArrayUnpacking(omnetpp::cCommBuffer *b, T *t, int n)
+{
+    for (int i = 0; i < n; i++)
+        doParsimUnpacking(b, t[i]);
+}
+
+// Default rule to prevent compiler from choosing base class' doParsimPacking() function
+template<typename T>
+void doParsimPacking(omnetpp::cCommBuffer *, const T& t)
+{
+    throw omnetpp::cRuntimeError("Parsim error: No doParsimPacking() function for type %s", omnetpp::opp_typename(typeid(t)));
+}
+
+template<typename T>
+void doParsimUnpacking(omnetpp::cCommBuffer *, T& t)
+{
+    throw omnetpp::cRuntimeError("Parsim error: No doParsimUnpacking() function for type %s", omnetpp::opp_typename(typeid(t)));
+}
+
+}  // namespace omnetpp
+
+namespace {
+template <class T> inline
+typename std::enable_if<std::is_polymorphic<T>::value && std::is_base_of<omnetpp::cObject,T>::value, void *>::type
+toVoidPtr(T* t)
+{
+    return (void *)(static_cast<const omnetpp::cObject *>(t));
+}
+
+template <class T> inline
+typename std::enable_if<std::is_polymorphic<T>::value && !std::is_base_of<omnetpp::cObject,T>::value, void *>::type
+toVoidPtr(T* t)
+{
+    return (void *)dynamic_cast<const void *>(t);
+}
+
+template <class T> inline
+typename std::enable_if<!std::is_polymorphic<T>::value, void *>::type
+toVoidPtr(T* t)
+{
+    return (void *)static_cast<const void *>(t);
+}
+
+}
+
+namespace NED_jsonparam_4 {
+
+// forward
+template<typename T, typename A>
+std::ostream& operator<<(std::ostream& out, const std::vector<T,A>& vec);
+
+// Template rule to generate operator<< for shared_ptr<T>
+template<typename T>
+inline std::ostream& operator<<(std::ostream& out,const std::shared_ptr<T>& t) { return out << t.get(); }
+
+// Template rule which fires if a struct or class doesn't have operator<<
+template<typename T>
+inline std::ostream& operator<<(std::ostream& out,const T&) {return out;}
+
+// operator<< for std::vector<T>
+template<typename T, typename A>
+inline std::ostream& operator<<(std::ostream& out, const std::vector<T,A>& vec)
+{
+    out.put('{');
+    for(typename std::vector<T,A>::const_iterator it = vec.begin(); it != vec.end(); ++it)
+    {
+        if (it != vec.begin()) {
+            out.put(','); out.put(' ');
+        }
+        out << *it;
+    }
+    out.put('}');
+
+    char buf[32];
+    sprintf(buf, " (size=%u)", (unsigned int)vec.size());
+    out.write(buf, strlen(buf));
+    return out;
+}
+
+Point::Point()
+{
+}
+
+void __doPacking(omnetpp::cCommBuffer *b, const Point& a)
+{
+    doParsimPacking(b,a.x);
+    doParsimPacking(b,a.y);
+}
+
+void __doUnpacking(omnetpp::cCommBuffer *b, Point& a)
+{
+    doParsimUnpacking(b,a.x);
+    doParsimUnpacking(b,a.y);
+}
+
+class PointDescriptor : public omnetpp::cClassDescriptor
+{
+  private:
+    mutable const char **propertynames;
+    enum FieldConstants {
+        FIELD_x,
+        FIELD_y,
+    };
+  public:
+    PointDescriptor();
+    virtual ~PointDescriptor();
+
+    virtual bool doesSupport(omnetpp::cObject *obj) const override;
+    virtual const char **getPropertyNames() const override;
+    virtual const char *getProperty(const char *propertyname) const override;
+    virtual int getFieldCount() const override;
+    virtual const char *getFieldName(int field) const override;
+    virtual int findField(const char *fieldName) const override;
+    virtual unsigned int getFieldTypeFlags(int field) const override;
+    virtual const char *getFieldTypeString(int field) const override;
+    virtual const char **getFieldPropertyNames(int field) const override;
+    virtual const char *getFieldProperty(int field, const char *propertyname) const override;
+    virtual int getFieldArraySize(void *object, int field) const override;
+    virtual void setFieldArraySize(void *object, int field, int size) const override;
+
+    virtual const char *getFieldDynamicTypeString(void *object, int field, int i) const override;
+    virtual std::string getFieldValueAsString(void *object, int field, int i) const override;
+    virtual omnetpp::intval_t getFieldValueAsInt(void *object, int field, int i) const override;
+    virtual double getFieldValueAsDouble(void *object, int field, int i) const override;
+    virtual void setFieldValueAsString(void *object, int field, int i, const char *value) const override;
+
+    virtual const char *getFieldStructName(int field) const override;
+    virtual void *getFieldStructValuePointer(void *object, int field, int i) const override;
+    virtual void setFieldStructValuePointer(void *object, int field, int i, void *ptr) const override;
+};
+
+Register_ClassDescriptor(PointDescriptor)
+
+PointDescriptor::PointDescriptor() : omnetpp::cClassDescriptor(omnetpp::opp_typename(typeid(NED_jsonparam_4::Point)), "")
+{
+    propertynames = nullptr;
+}
+
+PointDescriptor::~PointDescriptor()
+{
+    delete[] propertynames;
+}
+
+bool PointDescriptor::doesSupport(omnetpp::cObject *obj) const
+{
+    return dynamic_cast<Point *>(obj)!=nullptr;
+}
+
+const char **PointDescriptor::getPropertyNames() const
+{
+    if (!propertynames) {
+        static const char *names[] = {  nullptr };
+        omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+        const char **basenames = basedesc ? basedesc->getPropertyNames() : nullptr;
+        propertynames = mergeLists(basenames, names);
+    }
+    return propertynames;
+}
+
+const char *PointDescriptor::getProperty(const char *propertyname) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    return basedesc ? basedesc->getProperty(propertyname) : nullptr;
+}
+
+int PointDescriptor::getFieldCount() const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    return basedesc ? 2+basedesc->getFieldCount() : 2;
+}
+
+unsigned int PointDescriptor::getFieldTypeFlags(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldTypeFlags(field);
+        field -= basedesc->getFieldCount();
+    }
+    static unsigned int fieldTypeFlags[] = {
+        FD_ISEDITABLE | FD_ISFLOATINGPOINT,    // FIELD_x
+        FD_ISEDITABLE | FD_ISFLOATINGPOINT,    // FIELD_y
+    };
+    return (field >= 0 && field < 2) ? fieldTypeFlags[field] : 0;
+}
+
+const char *PointDescriptor::getFieldName(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldName(field);
+        field -= basedesc->getFieldCount();
+    }
+    static const char *fieldNames[] = {
+        "x",
+        "y",
+    };
+    return (field >= 0 && field < 2) ? fieldNames[field] : nullptr;
+}
+
+int PointDescriptor::findField(const char *fieldName) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    static const struct { const char *name; int index; } fieldsByHash[4] = {
+        { "y", FIELD_y },
+        { nullptr, -1 },
+        { nullptr, -1 },
+        { "x", FIELD_x },
+    };
+    int slot = hashFieldName(fieldName, 0u) & 3;
+    if (fieldsByHash[slot].name != nullptr && strcmp(fieldName, fieldsByHash[slot].name) == 0)
+        return (basedesc ? basedesc->getFieldCount() : 0) + fieldsByHash[slot].index;
+    return basedesc ? basedesc->findField(fieldName) : -1;
+}
+
+const char *PointDescriptor::getFieldTypeString(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldTypeString(field);
+        field -= basedesc->getFieldCount();
+    }
+    static const char *fieldTypeStrings[] = {
+        "double",    // FIELD_x
+        "double",    // FIELD_y
+    };
+    return (field >= 0 && field < 2) ? fieldTypeStrings[field] : nullptr;
+}
+
+const char **PointDescriptor::getFieldPropertyNames(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldPropertyNames(field);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+const char *PointDescriptor::getFieldProperty(int field, const char *propertyname) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldProperty(field, propertyname);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+int PointDescriptor::getFieldArraySize(void *object, int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldArraySize(object, field);
+        field -= basedesc->getFieldCount();
+    }
+    Point *pp = (Point *)object; (void)pp;
+    switch (field) {
+        default: return 0;
+    }
+}
+
+void PointDescriptor::setFieldArraySize(void *object, int field, int size) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldArraySize(object, field, size);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Point *pp = (Point *)object; (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set array size of field %d of class 'Point'", field);
+    }
+}
+
+const char *PointDescriptor::getFieldDynamicTypeString(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldDynamicTypeString(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Point *pp = (Point *)object; (void)pp;
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+std::string PointDescriptor::getFieldValueAsString(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsString(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Point *pp = (Point *)object; (void)pp;
+    switch (field) {
+        case FIELD_x: return double2string(pp->x);
+        case FIELD_y: return double2string(pp->y);
+        default: return "";
+    }
+}
+
+omnetpp::intval_t PointDescriptor::getFieldValueAsInt(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsInt(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Point *pp = (Point *)object; (void)pp;
+    switch (field) {
+        default: return omnetpp::cClassDescriptor::getFieldValueAsInt(object, field + (basedesc ? basedesc->getFieldCount() : 0), i);
+    }
+}
+
+double PointDescriptor::getFieldValueAsDouble(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsDouble(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Point *pp = (Point *)object; (void)pp;
+    switch (field) {
+        case FIELD_x: return (double)(pp->x);
+        case FIELD_y: return (double)(pp->y);
+        default: return omnetpp::cClassDescriptor::getFieldValueAsDouble(object, field + (basedesc ? basedesc->getFieldCount() : 0), i);
+    }
+}
+
+void PointDescriptor::setFieldValueAsString(void *object, int field, int i, const char *value) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldValueAsString(object, field, i, value);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Point *pp = (Point *)object; (void)pp;
+    switch (field) {
+        case FIELD_x: pp->x = string2double(value); break;
+        case FIELD_y: pp->y = string2double(value); break;
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'Point'", field);
+    }
+}
+
+const char *PointDescriptor::getFieldStructName(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldStructName(field);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    };
+}
+
+void *PointDescriptor::getFieldStructValuePointer(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldStructValuePointer(object, field, i);
+        field -= basedesc->getFieldCount();
+    }
+    Point *pp = (Point *)object; (void)pp;
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+void PointDescriptor::setFieldStructValuePointer(void *object, int field, int i, void *ptr) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldStructValuePointer(object, field, i, ptr);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Point *pp = (Point *)object; (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'Point'", field);
+    }
+}
+
+Register_Class(Trail)
+
+Trail::Trail() : ::omnetpp::cObject()
+{
+}
+
+Trail::Trail(const Trail& other) : ::omnetpp::cObject(other)
+{
+    copy(other);
+}
+
+Trail::~Trail()
+{
+    delete [] this->points;
+}
+
+Trail& Trail::operator=(const Trail& other)
+{
+    if (this == &other) return *this;
+    ::omnetpp::cObject::operator=(other);
+    copy(other);
+    return *this;
+}
+
+void Trail::copy(const Trail& other)
+{
+    delete [] this->points;
+    this->points = (other.points_arraysize==0) ? nullptr : new Point[other.points_arraysize];
+    points_arraysize = other.points_arraysize;
+    for (size_t i = 0; i < points_arraysize; i++) {
+        this->points[i] = other.points[i];
+    }
+}
+
+void Trail::parsimPack(omnetpp::cCommBuffer *b) const
+{
+    b->pack(points_arraysize);
+    doParsimArrayPacking(b,this->points,points_arraysize);
+}
+
+void Trail::parsimUnpack(omnetpp::cCommBuffer *b)
+{
+    delete [] this->points;
+    b->unpack(points_arraysize);
+    if (points_arraysize == 0) {
+        this->points = nullptr;
+    } else {
+        this->points = new Point[points_arraysize];
+        doParsimArrayUnpacking(b,this->points,points_arraysize);
+    }
+}
+
+size_t Trail::getPointsArraySize() const
+{
+    return points_arraysize;
+}
+
+const Point& Trail::getPoints(size_t k) const
+{
+    if (k >= points_arraysize) throw omnetpp::cRuntimeError("Array of size points_arraysize indexed by %lu", (unsigned long)k);
+    return this->points[k];
+}
+
+void Trail::setPointsArraySize(size_t newSize)
+{
+    Point *points2 = (newSize==0) ? nullptr : new Point[newSize];
+    size_t minSize = points_arraysize < newSize ? points_arraysize : newSize;
+    for (size_t i = 0; i < minSize; i++)
+        points2[i] = this->points[i];
+    delete [] this->points;
+    this->points = points2;
+    points_arraysize = newSize;
+}
+
+void Trail::setPoints(size_t k, const Point& points)
+{
+    if (k >= points_arraysize) throw omnetpp::cRuntimeError("Array of size  indexed by %lu", (unsigned long)k);
+    this->points[k] = points;
+}
+
+void Trail::insertPoints(size_t k, const Point& points)
+{
+    if (k > points_arraysize) throw omnetpp::cRuntimeError("Array of size  indexed by %lu", (unsigned long)k);
+    size_t newSize = points_arraysize + 1;
+    Point *points2 = new Point[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        points2[i] = this->points[i];
+    points2[k] = points;
+    for (i = k + 1; i < newSize; i++)
+        points2[i] = this->points[i-1];
+    delete [] this->points;
+    this->points = points2;
+    points_arraysize = newSize;
+}
+
+void Trail::insertPoints(const Point& points)
+{
+    insertPoints(points_arraysize, points);
+}
+
+void Trail::erasePoints(size_t k)
+{
+    if (k >= points_arraysize) throw omnetpp::cRuntimeError("Array of size  indexed by %lu", (unsigned long)k);
+    size_t newSize = points_arraysize - 1;
+    Point *points2 = (newSize == 0) ? nullptr : new Point[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        points2[i] = this->points[i];
+    for (i = k; i < newSize; i++)
+        points2[i] = this->points[i+1];
+    delete [] this->points;
+    this->points = points2;
+    points_arraysize = newSize;
+}
+
+class TrailDescriptor : public omnetpp::cClassDescriptor
+{
+  private:
+    mutable const char **propertynames;
+    enum FieldConstants {
+        FIELD_points,
+    };
+  public:
+    TrailDescriptor();
+    virtual ~TrailDescriptor();
+
+    virtual bool doesSupport(omnetpp::cObject *obj) const override;
+    virtual const char **getPropertyNames() const override;
+    virtual const char *getProperty(const char *propertyname) const override;
+    virtual int getFieldCount() const override;
+    virtual const char *getFieldName(int field) const override;
+    virtual int findField(const char *fieldName) const override;
+    virtual unsigned int getFieldTypeFlags(int field) const override;
+    virtual const char *getFieldTypeString(int field) const override;
+    virtual const char **getFieldPropertyNames(int field) const override;
+    virtual const char *getFieldProperty(int field, const char *propertyname) const override;
+    virtual int getFieldArraySize(void *object, int field) const override;
+    virtual void setFieldArraySize(void *object, int field, int size) const override;
+
+    virtual const char *getFieldDynamicTypeString(void *object, int field, int i) const override;
+    virtual std::string getFieldValueAsString(void *object, int field, int i) const override;
+    virtual omnetpp::intval_t getFieldValueAsInt(void *object, int field, int i) const override;
+    virtual double getFieldValueAsDouble(void *object, int field, int i) const override;
+    virtual void setFieldValueAsString(void *object, int field, int i, const char *value) const override;
+
+    virtual const char *getFieldStructName(int field) const override;
+    virtual void *getFieldStructValuePointer(void *object, int field, int i) const override;
+    virtual void setFieldStructValuePointer(void *object, int field, int i, void *ptr) const override;
+};
+
+Register_ClassDescriptor(TrailDescriptor)
+
+TrailDescriptor::TrailDescriptor() : omnetpp::cClassDescriptor(omnetpp::opp_typename(typeid(NED_jsonparam_4::Trail)), "omnetpp::cObject")
+{
+    propertynames = nullptr;
+}
+
+TrailDescriptor::~TrailDescriptor()
+{
+    delete[] propertynames;
+}
+
+bool TrailDescriptor::doesSupport(omnetpp::cObject *obj) const
+{
+    return dynamic_cast<Trail *>(obj)!=nullptr;
+}
+
+const char **TrailDescriptor::getPropertyNames() const
+{
+    if (!propertynames) {
+        static const char *names[] = {  nullptr };
+        omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+        const char **basenames = basedesc ? basedesc->getPropertyNames() : nullptr;
+        propertynames = mergeLists(basenames, names);
+    }
+    return propertynames;
+}
+
+const char *TrailDescriptor::getProperty(const char *propertyname) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    return basedesc ? basedesc->getProperty(propertyname) : nullptr;
+}
+
+int TrailDescriptor::getFieldCount() const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    return basedesc ? 1+basedesc->getFieldCount() : 1;
+}
+
+unsigned int TrailDescriptor::getFieldTypeFlags(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldTypeFlags(field);
+        field -= basedesc->getFieldCount();
+    }
+    static unsigned int fieldTypeFlags[] = {
+        FD_ISARRAY | FD_ISCOMPOUND | FD_ISRESIZABLE,    // FIELD_points
+    };
+    return (field >= 0 && field < 1) ? fieldTypeFlags[field] : 0;
+}
+
+const char *TrailDescriptor::getFieldName(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldName(field);
+        field -= basedesc->getFieldCount();
+    }
+    static const char *fieldNames[] = {
+        "points",
+    };
+    return (field >= 0 && field < 1) ? fieldNames[field] : nullptr;
+}
+
+int TrailDescriptor::findField(const char *fieldName) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    static const struct { const char *name; int index; } fieldsByHash[2] = {
+        { "points", FIELD_points },
+        { nullptr, -1 },
+    };
+    int slot = hashFieldName(fieldName, 0u) & 1;
+    if (fieldsByHash[slot].name != nullptr && strcmp(fieldName, fieldsByHash[slot].name) == 0)
+        return (basedesc ? basedesc->getFieldCount() : 0) + fieldsByHash[slot].index;
+    return basedesc ? basedesc->findField(fieldName) : -1;
+}
+
+const char *TrailDescriptor::getFieldTypeString(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldTypeString(field);
+        field -= basedesc->getFieldCount();
+    }
+    static const char *fieldTypeStrings[] = {
+        "NED_jsonparam_4::Point",    // FIELD_points
+    };
+    return (field >= 0 && field < 1) ? fieldTypeStrings[field] : nullptr;
+}
+
+const char **TrailDescriptor::getFieldPropertyNames(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldPropertyNames(field);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+const char *TrailDescriptor::getFieldProperty(int field, const char *propertyname) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldProperty(field, propertyname);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+int TrailDescriptor::getFieldArraySize(void *object, int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldArraySize(object, field);
+        field -= basedesc->getFieldCount();
+    }
+    Trail *pp = (Trail *)object; (void)pp;
+    switch (field) {
+        case FIELD_points: return pp->getPointsArraySize();
+        default: return 0;
+    }
+}
+
+void TrailDescriptor::setFieldArraySize(void *object, int field, int size) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldArraySize(object, field, size);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Trail *pp = (Trail *)object; (void)pp;
+    switch (field) {
+        case FIELD_points: pp->setPointsArraySize(size); break;
+        default: throw omnetpp::cRuntimeError("Cannot set array size of field %d of class 'Trail'", field);
+    }
+}
+
+const char *TrailDescriptor::getFieldDynamicTypeString(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldDynamicTypeString(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Trail *pp = (Trail *)object; (void)pp;
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+std::string TrailDescriptor::getFieldValueAsString(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsString(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Trail *pp = (Trail *)object; (void)pp;
+    switch (field) {
+        case FIELD_points: {std::stringstream out; out << pp->getPoints(i); return out.str();}
+        default: return "";
+    }
+}
+
+omnetpp::intval_t TrailDescriptor::getFieldValueAsInt(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsInt(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Trail *pp = (Trail *)object; (void)pp;
+    switch (field) {
+        default: return omnetpp::cClassDescriptor::getFieldValueAsInt(object, field + (basedesc ? basedesc->getFieldCount() : 0), i);
+    }
+}
+
+double TrailDescriptor::getFieldValueAsDouble(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldValueAsDouble(object,field,i);
+        field -= basedesc->getFieldCount();
+    }
+    Trail *pp = (Trail *)object; (void)pp;
+    switch (field) {
+        default: return omnetpp::cClassDescriptor::getFieldValueAsDouble(object, field + (basedesc ? basedesc->getFieldCount() : 0), i);
+    }
+}
+
+void TrailDescriptor::setFieldValueAsString(void *object, int field, int i, const char *value) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldValueAsString(object, field, i, value);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Trail *pp = (Trail *)object; (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'Trail'", field);
+    }
+}
+
+const char *TrailDescriptor::getFieldStructName(int field) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldStructName(field);
+        field -= basedesc->getFieldCount();
+    }
+    switch (field) {
+        case FIELD_points: return omnetpp::opp_typename(typeid(Point));
+        default: return nullptr;
+    };
+}
+
+void *TrailDescriptor::getFieldStructValuePointer(void *object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount())
+            return basedesc->getFieldStructValuePointer(object, field, i);
+        field -= basedesc->getFieldCount();
+    }
+    Trail *pp = (Trail *)object; (void)pp;
+    switch (field) {
+        case FIELD_points: return toVoidPtr(&pp->getPoints(i)); break;
+        default: return nullptr;
+    }
+}
+
+void TrailDescriptor::setFieldStructValuePointer(void *object, int field, int i, void *ptr) const
+{
+    omnetpp::cClassDescriptor *basedesc = getBaseClassDescriptor();
+    if (basedesc) {
+        if (field < basedesc->getFieldCount()) {
+            basedesc->setFieldStructValuePointer(object, field, i, ptr);
+            return;
+        }
+        field -= basedesc->getFieldCount();
+    }
+    Trail *pp = (Trail *)object; (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'Trail'", field);
+    }
+}
+
+} // namespace NED_jsonparam_4
+
@@ -0,0 +1,110 @@
+//
+// Generated file, do not edit! Created by nedtool 6.0 from NED_jsonparam_4/json.msg.
+//
+
+#ifndef __NED_JSONPARAM_4_JSON_M_H
+#define __NED_JSONPARAM_4_JSON_M_H
+
+#if defined(__clang__)
+#  pragma clang diagnostic ignored "-Wreserved-id-macro"
+#endif
+#include <omnetpp.h>
+
+// nedtool version check
+#define MSGC_VERSION 0x0600
+#if (MSGC_VERSION!=OMNETPP_VERSION)
+#    error Version mismatch! Probably this file was generated by an earlier version of nedtool: 'make clean' should help.
+#endif
+
+
+namespace NED_jsonparam_4 {
+
+struct Point;
+class Trail;
+} // namespace NED_jsonparam_4
+
+
+namespace NED_jsonparam_4 {
+
+// cplusplus {{
+ using namespace omnetpp; 
+// }}
+
+/**
+ * Struct generated from NED_jsonparam_4/json.msg:6 by nedtool.
+ */
+struct Point
+{
+    Point();
+    double x = 0;
+    double y = 0;
+
+    std::string str() const {
+      char buf[128];
+      sprintf(buf, "(%g,%g)", x, y);
+      return buf;
+    }
+};
+
+// helpers for local use
+void __doPacking(omnetpp::cCommBuffer *b, const Point& a);
+void __doUnpacking(omnetpp::cCommBuffer *b, Point& a);
+
+inline void doParsimPacking(omnetpp::cCommBuffer *b, const Point& obj) { __doPacking(b, obj); }
+inline void doParsimUnpacking(omnetpp::cCommBuffer *b, Point& obj) { __doUnpacking(b, obj); }
+
+/**
+ * Class generated from <tt>NED_jsonparam_4/json.msg:11</tt> by nedtool.
+ * <pre>
+ * class Trail extends cObject
+ * {
+ *     Point points[];
+ * }
+ * </pre>
+ */
+class Trail : public ::omnetpp::cObject
+{
+  protected:
+    Point *points = nullptr;
+    size_t points_arraysize = 0;
+
+  private:
+    void copy(const Trail& other);
+
+  protected:
+    bool operator==(const Trail&) = delete;
+
+  public:
+    Trail();
+    Trail(const Trail& other);
+    virtual ~Trail();
+    Trail& operator=(const Trail& other);
+    virtual Trail *dup() const override {return new Trail(*this);}
+    virtual void parsimPack(omnetpp::cCommBuffer *b) const override;
+    virtual void parsimUnpack(omnetpp::cCommBuffer *b) override;
+
+    // field getter/setter methods
+    virtual void setPointsArraySize(size_t size);
+    virtual size_t getPointsArraySize() const;
+    virtual const Point& getPoints(size_t k) const;
+    virtual Point& getPointsForUpdate(size_t k) { return const_cast<Point&>(const_cast<Trail*>(this)->getPoints(k));}
+    virtual void setPoints(size_t k, const Point& points);
+    virtual void insertPoints(const Point& points);
+    virtual void insertPoints(size_t k, const Point& points);
+    virtual void erasePoints(size_t k);
+
+    std::string str() const override {
+      std::stringstream os;
+      for (int i=0; i<getPointsArraySize(); i++)
+        os << " " << getPoints(i).str();
+      return os.str();
+    }
+};
+
+inline void doParsimPacking(omnetpp::cCommBuffer *b, const Trail& obj) {obj.parsimPack(b);}
+inline void doParsimUnpacking(omnetpp::cCommBuffer *b, Trail& obj) {obj.parsimUnpack(b);}
+
+} // namespace NED_jsonparam_4
+
+#endif // ifndef __NED_JSONPARAM_4_JSON_M_H
+
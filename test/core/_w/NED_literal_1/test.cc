@@ -0,0 +1,34 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_literal_1 {
+
+class Test : public cSimpleModule
+{
+  public:
+    Test() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+    for (int i=0; i<getNumParams(); i++)
+    {
+        EV << cPar::getTypeName(par(i).getType()) << " " << par(i).getName() << "=";
+        switch (par(i).getType()) {
+          case cPar::STRING: EV << par(i).stringValue(); break;
+          case cPar::INT:    EV << par(i).intValue(); break;
+          case cPar::DOUBLE: EV << par(i).doubleValue(); break;
+          case cPar::BOOL:   EV << (par(i).boolValue() ? "true" : "false"); break;
+          case cPar::XML:    EV << "some xml"; break; // unused in this test
+        }
+        EV << "/" << par(i).str() << endl;
+    }
+}
+
+}; //namespace
+
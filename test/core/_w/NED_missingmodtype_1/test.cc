@@ -0,0 +1,2 @@
+// needed so that linker gets at least one object file
+
@@ -0,0 +1,2 @@
+// so that linker gets at least one file
+
@@ -0,0 +1,56 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace NED_par_overflow_1 {
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+#define TRY(code)  try { EV << #code << " --> "; code; EV << x << "\n"; } catch(std::exception& e) {EV << "ERROR: " << e.what() << "\n";}
+
+TRY(unsigned char x = par("minus1"));
+TRY(unsigned char x = par("plus256"));
+
+TRY(char x = par("minus129"));
+TRY(char x = par("plus128"));
+
+TRY(unsigned short x = par("minus1"));
+TRY(unsigned int x = par("minus1"));
+TRY(unsigned long x = par("minus1"));
+TRY(unsigned long long x = par("minus1"));
+
+TRY(unsigned short x = par("plus128"));
+TRY(unsigned int x = par("plus128"));
+TRY(unsigned long x = par("plus128"));
+TRY(unsigned long long x = par("plus128"));
+
+TRY(short x = par("minus1"));
+TRY(int x = par("minus1"));
+TRY(long x = par("minus1"));
+TRY(long long x = par("minus1"));
+
+TRY(int x = par("big"));
+TRY(int x = par("minusBig"));
+TRY(int64_t x = par("big"));
+TRY(int64_t x = par("minusBig"));
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
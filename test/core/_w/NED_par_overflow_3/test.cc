@@ -0,0 +1,30 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace NED_par_overflow_3 {
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+int64_t size = par("size");
+EV << "size=" << size << endl;
+EV << ".\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,21 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_paramref_5 {
+
+class Checker : public cSimpleModule
+{
+  protected:
+    virtual void initialize() override {
+        cModule *network = getParentModule();
+        for (int i = 0; i < 3; i++)
+            EV << "sum=" << network->par("sum").intValue() << " diff=" << network->par("diff").intValue() << "\n";
+    }
+};
+
+Define_Module(Checker);
+
+}; //namespace
+
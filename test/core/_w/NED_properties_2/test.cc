@@ -0,0 +1,68 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_properties_2 {
+
+class Tester : public cSimpleModule
+{
+  public:
+    Tester() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Tester);
+
+const char *_(const char *s) {return s ? s : "nullptr";}
+
+#define P(x)  EV << #x << ": " << (x) << "\n"
+
+void Tester::activity()
+{
+    cModule *foo = getParentModule()->getSubmodule("foo");
+    cProperties *props = foo->getProperties();
+
+    // number of properties
+    EV << props->getNumProperties() << " properties:\n";
+    for (int i=0; i<props->getNumProperties(); i++)
+        EV << " " << i << ": " << props->get(i)->getName() << "[" << _(props->get(i)->getIndex()) << "]\n";
+    EV << "\n";
+
+    // by property names and indices
+    std::vector<const char *> names = props->getNames();
+    EV << names.size() << " names:\n";
+    for (int i=0; i<(int)names.size(); i++) {
+        EV << " " << i << ": " << names[i] << "\n";
+        std::vector<const char *> indices = props->getIndicesFor(names[i]);
+        for (int ii=0; ii<(int)indices.size(); ii++) {
+            EV << "  [" << _(indices[ii]) << "]\n";
+            cProperty *prop = props->get(names[i], indices[ii]);
+            ASSERT(opp_strcmp(prop->getName(), names[i])==0);
+            ASSERT(opp_strcmp(prop->getIndex(), indices[ii])==0);
+        }
+    }
+    EV << "\n";
+
+    // print individual keys and value-lists for each property
+    for (int i=0; i<props->getNumProperties(); i++)
+    {
+        EV << props->get(i)->getName() << "[" << _(props->get(i)->getIndex()) << "]:\n";
+        cProperty *prop = props->get(i);
+        const std::vector<const char *>& keys = prop->getKeys();
+        for (int ii=0; ii<(int)keys.size(); ii++) {
+            const char *key = keys[ii];
+            EV << " '" << _(key) << "'=";
+            int n = prop->getNumValues(key);
+            for (int k=0; k<n; k++) {
+                EV << " '" << _(prop->getValue(key,k)) << "'";
+            }
+            EV << "\n";
+        }
+    }
+
+    EV << ".\n";
+}
+
+} //namespace
+
@@ -0,0 +1,26 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_properties_4 {
+
+class Dump : public cSimpleModule
+{
+  public:
+    Dump() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Dump);
+
+void Dump::activity()
+{
+    cModule *network = getParentModule();
+    EV << "@foo:\n" << network->getProperties()->get("foo")->getValue() << endl << endl;
+    EV << "par foo:\n" << network->par("foo").stringValue() << endl;
+    EV << "." << endl;
+}
+
+} // namespace
+
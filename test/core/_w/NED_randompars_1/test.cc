@@ -0,0 +1,28 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_randompars_1 {
+
+class Test : public cSimpleModule
+{
+  public:
+    Test() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+    for (int i=0; i<getNumParams(); i++)
+    {
+        double p2 = par(i).doubleValue();
+        double p1 = par(i).doubleValue();
+        EV << par(i).getName() << ":" << (par(i).isExpression()?0:1) << ":" << p1 << "," << p2 << endl;
+    }
+}
+
+}; //namespace
+
@@ -0,0 +1,19 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+class ClassWithoutNamespace : public cSimpleModule
+{
+  public:
+    ClassWithoutNamespace() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(ClassWithoutNamespace);
+
+void ClassWithoutNamespace::activity()
+{
+    EV << "ClassWithoutNamespace\n";
+}
+
@@ -0,0 +1,23 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_simple_class_2 {
+
+class ClassWithNamespace : public cSimpleModule
+{
+  public:
+    ClassWithNamespace() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(ClassWithNamespace);
+
+void ClassWithNamespace::activity()
+{
+    EV << "ClassWithNamespace\n";
+}
+
+}; //namespace
+
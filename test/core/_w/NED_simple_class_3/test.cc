@@ -0,0 +1,23 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_simple_class_3 {
+
+class SuperClass : public cSimpleModule
+{
+  public:
+    SuperClass() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(SuperClass);
+
+void SuperClass::activity()
+{
+    EV << "SuperClass\n";
+}
+
+};
+
@@ -0,0 +1,23 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_simple_class_4 {
+
+class OverrideClass : public cSimpleModule
+{
+  public:
+    OverrideClass() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(OverrideClass);
+
+void OverrideClass::activity()
+{
+    EV << "OverrideClass\n";
+}
+
+}; //namespace
+
@@ -0,0 +1,23 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace ClassNamespace {
+
+class SimpleClass : public cSimpleModule
+{
+  public:
+    SimpleClass() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(SimpleClass);
+
+void SimpleClass::activity()
+{
+    EV << "SimpleClass\n";
+}
+
+}; //namespace
+
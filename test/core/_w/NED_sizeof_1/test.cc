@@ -0,0 +1,30 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_sizeof_1 {
+
+class Simple : public cSimpleModule
+{
+  public:
+    Simple() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Simple);
+
+void Simple::activity()
+{
+    for (int i=0; i<getNumParams(); i++)
+        EV << getFullName() << "." << par(i).getName() << "=" << (double)par(i) << endl;
+    for (cModule::GateIterator it(this); !it.end(); it++)
+        if ((*it)->getIndex()==0)
+            EV << (*it)->getName() << " size=" << (*it)->getVectorSize() << endl;
+    for (cModule::SubmoduleIterator it(getParentModule()); !it.end(); it++)
+        if ((*it)->getIndex()==0)
+            EV << (*it)->getName() << " size=" << (*it)->getVectorSize() << endl;
+}
+
+}; //namespace
+
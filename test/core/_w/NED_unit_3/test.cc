@@ -0,0 +1,27 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_unit_3 {
+
+class Test : public cSimpleModule
+{
+  public:
+    Test() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+   const double p1 = 1.234567890123456789;
+   const double p2 = 1 + 0.234567890123456789;
+
+   EV << "p1: " << (par("p1").doubleValue()==p1) << "\n";
+   EV << "p2: " << (par("p2").doubleValue()==p2) << "\n";
+}
+
+}; //namespace
+
@@ -0,0 +1,28 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_unit_4 {
+
+class Test : public cSimpleModule
+{
+  public:
+    Test() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+#define P(x) EV << #x << "=" << par(#x).doubleValue() << "\n"
+    P(p0);
+    P(p1);
+    P(p2);
+    P(p3);
+    P(p4);
+}
+
+}; //namespace
+
@@ -0,0 +1,30 @@
+
+#include <string.h>
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace NED_xml_1 {
+
+class Test : public cSimpleModule
+{
+  public:
+    Test() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+    cXMLElement *node1 = par("xmlconfig1");
+    ASSERT(node1);
+    EV << node1->getTagName() << " at " << node1->getSourceLocation() << endl;
+
+    cXMLElement *node2 = par("xmlconfig2");
+    ASSERT(node2);
+    EV << node2->getTagName() << " at " << node2->getSourceLocation() << endl;
+}
+
+}; //namespace
+
@@ -0,0 +1,48 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace SimTime_1 {
+
+// make protected SimTime::resetScale() accessible via subclassing
+class SimTimeExt : SimTime {
+  public: static void reset() {resetScale();}
+};
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+
+for (int i=-18; i<=0; i++)
+{
+    SimTimeExt::reset();
+    SimTime::setScaleExp(i);
+
+    const char *u="";
+    if (SimTime::getScaleExp()==SIMTIME_S)  u =  "s";
+    if (SimTime::getScaleExp()==SIMTIME_MS) u = "ms";
+    if (SimTime::getScaleExp()==SIMTIME_US) u = "us";
+    if (SimTime::getScaleExp()==SIMTIME_NS) u = "ns";
+    if (SimTime::getScaleExp()==SIMTIME_PS) u = "ps";
+    if (SimTime::getScaleExp()==SIMTIME_FS) u = "fs";
+    EV << i << ": scale=" << SimTime::getScale() << " " << u << "\n";
+}
+EV << ".\n";
+
+
+}
+
+}; //namespace
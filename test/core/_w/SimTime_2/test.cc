@@ -0,0 +1,45 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace SimTime_2 {
+
+// make protected SimTime::resetScale() accessible via subclassing
+class SimTimeExt : SimTime {
+  public: static void reset() {resetScale();}
+};
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+SimTimeExt::reset();
+SimTime::setScaleExp(SIMTIME_NS);
+
+SimTime t, t2, tmp;
+
+#define P(x) if (x <= SimTime::getMaxTime().dbl()) {t=(x); EV << #x << " -> " << t << "\n";}
+
+P(1e-15); P(1e-14); P(1e-13); P(1e-12); P(1e-11); P(1e-10); P(1e-9);
+P(1e-8); P(1e-7); P(1e-6); P(1e-5); P(1e-4); P(1e-3); P(1e-2); P(1e0);
+P(1e1); P(1e2); P(1e3); P(1e4); P(1e5); P(1e6); P(1e7); P(1e8); P(1e9);
+P(1e10); P(1e11); P(1e12); P(1e13); P(1e14); P(1e15); P(1e16); P(1e17);
+P(1e18); P(1e19); P(1e20);
+EV << ".\n";
+
+
+}
+
+}; //namespace
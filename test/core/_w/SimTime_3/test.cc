@@ -0,0 +1,105 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace SimTime_3 {
+
+// make protected SimTime::resetScale() accessible via subclassing
+class SimTimeExt : SimTime {
+  public: static void reset() {resetScale();}
+};
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+SimTimeExt::reset();
+SimTime::setScaleExp(SIMTIME_NS);
+EV << "using nanosecond precision: scale=" << SimTime::getScale() << "\n";
+
+SimTime t, t2, tmp;
+
+// basic arithmetic
+#define P(x) {EV << #x << " -> " << (x) << "\n";}
+t=1;
+t2=1.0/3.0;
+P(t);
+P(t2);
+
+P(t+0.1);
+P(t-0.1);
+P(0.1+t);
+P(0.1-t);
+
+P(t+t2);
+P(t-t2);
+
+P(t*3);
+P(t/3);
+P(3*t);
+#undef P
+
+// assignments
+#define P(x) {t=1; t2=1.0/3.0; tmp=(x); EV << #x << " -> " << tmp << ", t=" << t << "\n";}
+P(t=5);
+P(t=t2);
+
+P(t+=0.1);
+P(t+=-1);
+P(t+=-1.3);
+
+P(t-=0.1);
+P(t-=1);
+P(t-=1.3);
+
+P(t+=t2);
+P(t-=t2);
+
+P(t*=3);
+P(t/=3);
+#undef P
+
+// comparison
+#define P(x) {EV << #x << " -> " << (x) << "\n";}
+t=1;
+t2=1.0/3.0;
+P(t==1);
+P(t!=1);
+P(t==2);
+P(t!=2);
+P(t==t2);
+P(t!=t2);
+
+P(t<1);
+P(t<=1);
+P(t>1);
+P(t>=1);
+
+P(t<t);
+P(t<=t);
+P(t>t);
+P(t>=t);
+
+P(t<t2);
+P(t<=t2);
+P(t>t2);
+P(t>=t2);
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,82 @@
+
+#include <omnetpp.h>
+
+#include <algorithm>
+
+
+
+using namespace omnetpp;
+
+namespace SimTime_4 {
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+SimTime t, t2;
+
+#define P(x) {EV << #x << " -> " << (x) << "\n";}
+
+// floor(t)
+P((t=1.862, floor(t)));
+P((t=-1.862, floor(t)));
+
+// floor(t,unit,offset)
+P((t=1.862, floor(t,0.1)));
+P((t=-1.862, floor(t,0.1)));
+P((t=186.2, floor(t,10)));
+P((t=-186.2, floor(t,10)));
+
+P((t=1.862, floor(t,0.1,0.0001)));
+P((t=-1.862, floor(t,0.1,0.0001)));
+P((t=186.2, floor(t,10,0.0001)));
+P((t=-186.2, floor(t,10,0.0001)));
+
+// ceil(t)
+P((t=1.862, ceil(t)));
+P((t=-1.862, ceil(t)));
+
+// ceil(t,unit,offset)
+P((t=1.345, ceil(t,0.1)));
+P((t=-1.345, ceil(t,0.1)));
+P((t=134.5, ceil(t,10)));
+P((t=-134.5, ceil(t,10)));
+
+P((t=1.345, ceil(t,0.1,0.0001)));
+P((t=-1.345, ceil(t,0.1,0.0001)));
+P((t=134.5, ceil(t,10,0.0001)));
+P((t=-134.5, ceil(t,10,0.0001)));
+
+// fabs(t)
+P((t=1.862, fabs(t)));
+P((t=-1.862, fabs(t)));
+
+// fmod()
+P((t=2.6, t2=0.5, fmod(t,t2)));
+P((t=-2.6, t2=0.5, fmod(t,t2)));
+P((t=2.6, t2=-0.5, fmod(t,t2)));
+P((t=-2.6, t2=-0.5, fmod(t,t2)));
+
+// min(t2,t2)
+P((t=1, t2=2, std::min(t,t2)));
+P((t=1, t2=-2, std::min(t,t2)));
+
+// max(t2,t2)
+P((t=1, t2=2, std::max(t,t2)));
+P((t=1, t2=-2, std::max(t,t2)));
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,50 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace SimTime_5 {
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+SimTime t, t2;
+
+#define P(x) {EV << #x << " -> " << (x) << "\n";}
+
+double dmax = floor(SimTime::getMaxTime().dbl());
+
+ASSERT(SimTime::getScaleExp()==-12);
+
+P((t=0.99, t*=2.5, t));
+P((t=0.99, t*=-2.5, t));
+P((t=0.99, t*=1e-6, t));
+P((t=0.99, t*=-1e-6, t));
+P((t=0.99, t*=dmax, t));
+P((t=0.99, t*=-dmax, t));
+
+P((t=0.99, t/=2.5, t));
+P((t=0.99, t/=-2.5, t));
+P((t=0.99, t/=1e6, t));
+P((t=0.99, t/=-1e6, t));
+P((t=0.99, t/=(1/dmax), t));
+P((t=0.99, t/=-(1/dmax), t));
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
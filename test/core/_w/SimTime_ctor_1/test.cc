@@ -0,0 +1,51 @@
+
+#include <omnetpp.h>
+
+#include <math.h>
+
+
+
+using namespace omnetpp;
+
+namespace SimTime_ctor_1 {
+
+
+void test(int64_t value, int exponent)
+{
+    double d = value * pow(10.0, exponent);
+    EV << value << "*10^" << exponent << " = ~" << d << " -> ";
+    try {
+        SimTime t(value, (SimTimeUnit)exponent);
+        bool nearlyEqual = fabs(t/d-1.0) < 0.001;
+        EV << t << " (int64:" << t.raw() << ") " << (nearlyEqual?"ok":"WRONG") << "\n";
+    } catch (std::exception& e) {
+        EV << "ERROR: " << e.what() << "\n";
+    }
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+ASSERT(SimTime::getScaleExp()==SIMTIME_NS);
+
+for (int exp = -20; exp < 15; exp++)
+    test(96000, exp);
+for (int exp = -20; exp < 15; exp++)
+    test(-96000, exp);
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
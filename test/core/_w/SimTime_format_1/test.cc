@@ -0,0 +1,49 @@
+
+#include <omnetpp.h>
+
+#include <iomanip>
+
+
+
+using namespace omnetpp;
+
+namespace SimTime_format_1 {
+
+
+static void print(SimTime t)
+{
+    EV << t << ":" << endl;
+    for (int prec=-18; prec<=0; prec++) {
+        EV << "prec=" << std::setw(3) << prec << " --> ";
+        EV << t.format(prec) << " | "
+           << t.format(prec, ".", "'") << " | "
+           << t.format(prec, ".", ",", true) << " | "
+           << t.format(prec, ".", ",", true, "[", "] ") << endl;
+    }
+    EV << endl;
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+print(SimTime(555666777888, SIMTIME_NS));  // both integral and fractional part
+print(SimTime(123, SIMTIME_US));  // fractional part only
+print(SimTime(12340, SIMTIME_S)); // integral part only
+print(SimTime(0, SIMTIME_S)); // zero
+print(SimTime(-555666777888, SIMTIME_NS));  // negative number
+EV << ".\n";
+
+
+}
+
+}; //namespace
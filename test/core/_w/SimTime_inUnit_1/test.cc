@@ -0,0 +1,59 @@
+
+#include <omnetpp.h>
+
+#include <math.h>
+
+
+
+using namespace omnetpp;
+
+namespace SimTime_inUnit_1 {
+
+
+inline double trunc(double d)
+{
+    return d > 0 ? floor(d) : ceil(d);
+}
+
+void test(simtime_t t, int exponent)
+{
+    double d = trunc(t.dbl() / pow(10.0, exponent));
+    EV << t << "s in units of 10^" << exponent << "s = ~" << d << " -> ";
+    try {
+        int64_t x = t.inUnit((SimTimeUnit)exponent);
+        bool nearlyEqual = (x==0 && d==0) || fabs(x/d-1.0) < 0.001;
+        EV << x << " " << (nearlyEqual?"ok":"WRONG") << "\n";
+    } catch (std::exception& e) {
+        EV << "ERROR: " << e.what() << "\n";
+    }
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+ASSERT(SimTime::getScaleExp()==SIMTIME_NS);
+
+simtime_t t = 3000.0 / 7.0;
+for (int exp = -20; exp < 15; exp++)
+    test(t, exp);
+
+t = -t;
+for (int exp = -20; exp < 15; exp++)
+    test(t, exp);
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,75 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace SimTime_preciseDiv_1 {
+
+
+static void test(int64_t x, SimTime t)
+{
+    EV << "preciseDiv(" << x << ", " << t << ")";
+
+    int64_t num, denom;
+    int64_t intres;
+    try {
+        intres = preciseDiv(x, t, num, denom);
+    } catch (std::exception& e) {
+        EV << " ==> " << e.what() << endl;
+        return;
+    }
+
+    double dblres = intres + num/(double)denom;
+
+    EV << " = " << intres;
+    if (num != 0)
+        EV << " " << num << "/" << denom << ", ~" << dblres;
+    EV << endl;
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+
+test(1, SIMTIME_ZERO);
+
+test(1, SimTime(1,SIMTIME_S));
+test(1, SimTime(1,SIMTIME_MS));
+test(1, SimTime(1,SIMTIME_US));
+test(1, SimTime(1,SIMTIME_NS));
+
+test(-1, SimTime(1,SIMTIME_MS));
+test(1, SimTime(-1,SIMTIME_MS));
+test(-1, SimTime(-1,SIMTIME_MS));
+
+test(500, SimTime(1000,SIMTIME_S));
+test(99, SimTime(1000,SIMTIME_S));
+test(1, SimTime(1000,SIMTIME_S));
+test(1, SimTime(999,SIMTIME_S));
+test(5, SimTime(999,SIMTIME_US));
+
+test(1, SimTime(5,SIMTIME_MS));
+test(1, SimTime(3,SIMTIME_MS));
+
+test(-1, SimTime(3,SIMTIME_MS));
+test(1, SimTime(-3,SIMTIME_MS));
+test(-1, SimTime(-3,SIMTIME_MS));
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,56 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace SimTime_ttoa_1 {
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+char *endp;
+char buf[64];
+
+int64_t t = 0;
+EV << "zero0:  " << SimTime::ttoa(buf, t, 0, endp) << "\n";
+EV << "zero10: " << SimTime::ttoa(buf, t, -10, endp) << "\n";
+EV << "zero18: " << SimTime::ttoa(buf, t, -18, endp) << "\n";
+
+t = INT64_MIN;
+EV << "-max0:  " << SimTime::ttoa(buf, t, 0, endp) << "\n";
+EV << "-max10: " << SimTime::ttoa(buf, t, -10, endp) << "\n";
+EV << "-max18: " << SimTime::ttoa(buf, t, -18, endp) << "\n";
+
+t = INT64_MAX;
+EV << "max0:  " << SimTime::ttoa(buf, t, 0, endp) << "\n";
+EV << "max10: " << SimTime::ttoa(buf, t, -10, endp) << "\n";
+EV << "max18: " << SimTime::ttoa(buf, t, -18, endp) << "\n";
+
+t = 12345;
+for (int exp=0; exp<=18; exp++)
+{
+    EV << "exp=" << -exp << ":\n";
+    EV << " " << SimTime::ttoa(buf, -t, -exp, endp) << "\n";
+    EV << " " << SimTime::ttoa(buf, t, -exp, endp) << "\n";
+    EV << " " << SimTime::ttoa(buf, t*10, -exp, endp) << "\n";
+    EV << " " << SimTime::ttoa(buf, t*100, -exp, endp) << "\n";
+    EV << " " << SimTime::ttoa(buf, t*1000, -exp, endp) << "\n";
+}
+EV << ".\n";
+
+
+}
+
+}; //namespace
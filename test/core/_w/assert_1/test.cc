@@ -0,0 +1,35 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace assert_1 {
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+
+ASSERT(true); // should pass
+ASSERT(1); // should pass
+EV << "checkpoint\n";
+
+ASSERT(false); // should fail
+EV << "fell through\n";
+EV << "NOTE: debug must be ON for this test to pass!\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,49 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cArray_size_1 {
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+
+#define REMOVE(i)  a.remove(i); EV << "removed " << i << ", size=" << a.size() << "\n";
+cArray a;
+
+int i;
+for (i=0; i<10; i++)
+    a.add(new cMessage());
+
+REMOVE(0);
+REMOVE(5);
+REMOVE(6);
+REMOVE(7);
+
+REMOVE(9);
+REMOVE(8);
+
+REMOVE(4);
+REMOVE(3);
+REMOVE(2);
+REMOVE(1);
+
+EV << ".";
+
+
+}
+
+}; //namespace
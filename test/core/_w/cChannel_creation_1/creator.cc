@@ -0,0 +1,25 @@
+#include <omnetpp.h>
+
+using namespace omnetpp;
+namespace cChannel_creation_1 {
+
+class Creator : public cSimpleModule {
+  public:
+    Creator() : cSimpleModule(16384) { }
+    void activity() override;
+};
+
+Define_Module(Creator);
+
+void Creator::activity() {
+    cChannelType *channelType = cChannelType::get("testlib.TestChannel");
+    cChannel *channel = channelType->create("ch");
+
+    cModule *sink = getParentModule()->getSubmodule("sink");
+    gate("out")->connectTo(sink->gate("in"), channel);
+
+    send(new cMessage("hello"), "out");
+}
+
+};
+
@@ -0,0 +1,93 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace cCoroutineModule_1 {
+
+class Source : public cSimpleModule
+{
+  protected:
+    int count = 0;
+    virtual void initialize() override {
+        scheduleAt(1, new cMessage("timer"));
+    }
+    virtual void handleMessage(cMessage *msg) override {
+        char name[16];
+        sprintf(name, "job-%d", ++count);
+        send(new cMessage(name), "out");
+        if (count < 3)
+            scheduleAt(simTime() + 1, msg);
+        else
+            delete msg;
+    }
+};
+Define_Module(Source);
+
+#ifdef OPP_HAVE_STACKLESS_COROUTINES
+
+class Noisy {
+  public: ~Noisy() {EV << "Noisy destructor called\n";}
+};
+
+class Server : public cCoroutineModule
+{
+  protected:
+    virtual cTask run() override;
+    cTask serve(cMessage *msg);
+    virtual void finish() override {
+        EV << getFullName() << " terminated: " << isTerminated() << endl;
+    }
+};
+Define_Module(Server);
+
+cTask Server::run()
+{
+    EV << "started at t=" << simTime() << endl;
+    co_await waitAsync(0.5);
+    EV << "waited until t=" << simTime() << endl;
+    for (int i = 0; i < 3; i++) {
+        cMessage *msg = co_await receiveAsync();
+        EV << "received " << msg->getName() << " at t=" << simTime() << endl;
+        co_await serve(msg);
+    }
+    cMessage *msg = co_await receiveAsync(10);
+    EV << (msg ? "received" : "timeout") << " at t=" << simTime() << endl;
+}
+
+cTask Server::serve(cMessage *msg)
+{
+    co_await waitAsync(0.1);
+    EV << "served " << msg->getName() << " at t=" << simTime() << endl;
+    delete msg;
+}
+
+class Waiter : public cCoroutineModule
+{
+  protected:
+    virtual cTask run() override {
+        Noisy noisy;
+        co_await receiveAsync();
+    }
+};
+Define_Module(Waiter);
+
+#else
+
+class Server : public cSimpleModule
+{
+  protected:
+    virtual void initialize() override {
+        EV << "#UNRESOLVED: C++20 coroutines are not available in this build\n";
+    }
+    virtual void handleMessage(cMessage *msg) override {delete msg;}
+};
+Define_Module(Server);
+
+class Waiter : public Server {};
+Define_Module(Waiter);
+
+#endif
+
+}; //namespace
+
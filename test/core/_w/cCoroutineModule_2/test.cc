@@ -0,0 +1,51 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace cCoroutineModule_2 {
+
+class Source : public cSimpleModule
+{
+  protected:
+    virtual void initialize() override {
+        scheduleAt(0.5, new cMessage("timer"));
+    }
+    virtual void handleMessage(cMessage *msg) override {
+        send(msg, "out");
+    }
+};
+Define_Module(Source);
+
+#ifdef OPP_HAVE_STACKLESS_COROUTINES
+
+class Server : public cCoroutineModule
+{
+  protected:
+    virtual cTask run() override {
+        EV << "started at t=" << simTime() << endl;
+        delete co_await receiveAsync();
+    }
+  public:
+    virtual void scheduleStart(simtime_t t) override {
+        cCoroutineModule::scheduleStart(t + 1);
+    }
+};
+Define_Module(Server);
+
+#else
+
+class Server : public cSimpleModule
+{
+  protected:
+    virtual void initialize() override {
+        EV << "#UNRESOLVED: C++20 coroutines are not available in this build\n";
+    }
+    virtual void handleMessage(cMessage *msg) override {delete msg;}
+};
+Define_Module(Server);
+
+#endif
+
+}; //namespace
+
@@ -0,0 +1,60 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace cDatarateChannel_create_1 {
+
+class Node1 : public cSimpleModule
+{
+  public:
+    Node1() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Node1);
+
+static void dumpParams(const char *label, cComponent *c)
+{
+    EV << label << ":\n";
+    for (int i=0; i<c->getNumParams(); i++)
+        EV << " " << c->par(i).getFullName() << "=" << c->par(i).str() << "\n";
+}
+
+void Node1::activity()
+{
+    cDatarateChannel *ch = cDatarateChannel::create("channel");
+    dumpParams("After creation", ch);
+
+    ch->setDisabled(true);
+    ch->setDelay(0.001);
+    ch->setDatarate(10000);
+    ch->setBitErrorRate(0.001);
+    dumpParams("After setting pars", ch);
+
+    cModule *node2 = getParentModule()->getSubmodule("node2");
+    gate("out")->connectTo(node2->gate("in"), ch);
+    dumpParams("After connecting", ch);
+
+    ch->setDisabled(false);
+    ch->setDelay(0.002);
+    ch->setDatarate(20000);
+    ch->setBitErrorRate(0.002);
+    dumpParams("After changing pars", ch);
+
+    EV << ".\n";
+
+    send(new cPacket("pk"), "out");
+}
+
+
+class Node2 : public cSimpleModule
+{
+  public:
+    virtual void handleMessage(cMessage *msg) override { delete msg; }
+};
+
+Define_Module(Node2);
+
+}; //namespace
+
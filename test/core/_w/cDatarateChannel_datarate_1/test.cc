@@ -0,0 +1,79 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace cDatarateChannel_datarate_1 {
+
+class Node1 : public cSimpleModule
+{
+  public:
+    Node1() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Node1);
+
+#define PRINTGATESTATE()  EV << "t=" << simTime() << ": busy:" << g->getTransmissionChannel()->isBusy() << ", finishes:" << g->getTransmissionChannel()->getTransmissionFinishTime() << endl;
+
+void Node1::activity()
+{
+    cPacket *pkt;
+    cGate *g = gate("out");
+
+    PRINTGATESTATE();
+
+    wait(1.0);
+
+    PRINTGATESTATE();
+
+    pkt = new cPacket("pkt1");
+    pkt->setBitLength(500);
+    send(pkt, g);
+
+    PRINTGATESTATE();
+
+    wait(1.0);
+    PRINTGATESTATE();
+
+    pkt = new cPacket("pkt2");
+    pkt->setBitLength(300);
+    send(pkt, g);
+
+    PRINTGATESTATE();
+    wait(0.004);
+    PRINTGATESTATE();
+
+    pkt = new cPacket("pkt3");
+    pkt->setBitLength(200);
+    send(pkt, g);
+
+    wait(0.002);
+    PRINTGATESTATE();
+
+    wait(1.0);
+    PRINTGATESTATE();
+}
+
+class Node2 : public cSimpleModule
+{
+  public:
+    Node2() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Node2);
+
+
+void Node2::activity()
+{
+    for (;;)
+    {
+        cMessage *msg = receive();
+        EV << "t=" << simTime() << ": " << msg->getName() << " arrived" << endl;
+        delete msg;
+    }
+}
+
+}; //namespace
+
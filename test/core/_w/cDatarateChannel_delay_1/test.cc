@@ -0,0 +1,52 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace cDatarateChannel_delay_1 {
+
+class Node1 : public cSimpleModule
+{
+  public:
+    Node1() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Node1);
+
+void Node1::activity()
+{
+    for (int i=0; i<100; i++)
+    {
+        cPacket *pkt = new cPacket();
+        pkt->setBitLength((long)exponential(1000));  // delay should not depend on message length
+        send(pkt, "out");
+        wait(10+exponential(1.0));
+    }
+}
+
+class Node2 : public cSimpleModule
+{
+  public:
+    Node2() : cSimpleModule(16384) { }
+    virtual void initialize() override { gate("in")->setDeliverImmediately(true); }
+    virtual void activity() override;
+};
+
+Define_Module(Node2);
+
+void Node2::activity()
+{
+    for(;;)
+    {
+        cPacket *pkt = check_and_cast<cPacket *>(receive());
+        simtime_t delay = simTime() - pkt->getSendingTime();
+        EV << "delay=" << delay << ", (diff-0.004)=" << (delay-0.004) << endl;
+        if (delay != 0.004)
+            EV << "wrong delay" << endl;
+        delete pkt;
+    }
+}
+
+}; //namespace
+
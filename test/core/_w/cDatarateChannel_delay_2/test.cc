@@ -0,0 +1,47 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace cDatarateChannel_delay_2 {
+
+class Sender : public cSimpleModule
+{
+  public:
+    Sender() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Sender);
+
+void Sender::activity()
+{
+   // create and set channel
+   cDatarateChannel *ch = cDatarateChannel::create("chan");
+   ch->setDelay(0.1);
+   ch->setDatarate(1000);
+   gate("out")->reconnectWith(ch);
+
+   // send message
+   cPacket *msg = new cPacket();
+   send(msg, "out");
+}
+
+class Receiver : public cSimpleModule
+{
+  public:
+    Receiver() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Receiver);
+
+void Receiver::activity()
+{
+   cMessage *msg = receive();
+   simtime_t diff = simTime() - msg->getSendingTime();
+   EV << "diff: " << diff << endl;
+}
+
+}; //namespace
+
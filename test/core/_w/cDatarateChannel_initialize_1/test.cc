@@ -0,0 +1,42 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace cDatarateChannel_initialize_1 {
+
+class Node1 : public cSimpleModule
+{
+    virtual void initialize() override;
+    virtual void handleMessage(cMessage *msg) override;
+};
+
+Define_Module(Node1);
+
+void Node1::initialize()
+{
+    cPacket *pkt = new cPacket();
+    pkt->setBitLength(100); // so transmission time = 0.1s
+    send(pkt, "out");
+}
+
+void Node1::handleMessage(cMessage *msg)
+{
+    ASSERT(false);
+}
+
+class Node2 : public cSimpleModule
+{
+    virtual void handleMessage(cMessage *msg) override;
+};
+
+Define_Module(Node2);
+
+void Node2::handleMessage(cMessage *msg)
+{
+    EV << "msg arrived at t=" << simTime();
+    delete msg;
+}
+
+}; //namespace
+
@@ -0,0 +1,67 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace cDatarateChannel_per_1 {
+
+#define NUM_MSGS           2000
+#define PACKET_ERROR_RATE   0.2
+
+class Node1 : public cSimpleModule
+{
+  public:
+    Node1() : cSimpleModule(16384) { }
+    virtual void activity() override;
+};
+
+Define_Module(Node1);
+
+void Node1::activity()
+{
+    for (int i=0; i<NUM_MSGS; i++)
+    {
+        cPacket *pkt = new cPacket();
+        send(pkt, "out");
+        wait(1+exponential(1.0));
+    }
+}
+
+
+class Node2 : public cSimpleModule
+{
+    int numErrors;
+
+  public:
+    Node2() : cSimpleModule(16384) { }
+    virtual void activity() override;
+    virtual void finish() override;
+};
+
+Define_Module(Node2);
+
+void Node2::activity()
+{
+    numErrors = 0;
+
+    for(;;)
+    {
+        cPacket *pkt = check_and_cast<cPacket *>(receive());
+        if (pkt->hasBitError())
+            numErrors++;
+        delete pkt;
+    }
+}
+
+void Node2::finish()
+{
+    double erate = numErrors / (double)NUM_MSGS;
+    EV << "error rate: measured: " << erate << ", expected: " << PACKET_ERROR_RATE << endl;
+
+    if (fabs(erate-PACKET_ERROR_RATE) > PACKET_ERROR_RATE/10)
+        throw cRuntimeError("wrong packet error rate");
+    EV << "OK\n";
+}
+
+}; //namespace
+
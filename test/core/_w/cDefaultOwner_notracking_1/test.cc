@@ -0,0 +1,62 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace cDefaultOwner_notracking_1 {
+
+class Node : public cSimpleModule
+{
+  private:
+    cQueue queue;
+    cMessage *timer = nullptr;
+    int count = 0;
+  public:
+    virtual ~Node() {cancelAndDelete(timer);}
+    virtual void initialize() override;
+    virtual void handleMessage(cMessage *msg) override;
+};
+
+Define_Module(Node);
+
+void Node::initialize()
+{
+    timer = new cMessage("timer");
+    ASSERT(timer->getOwner() == this);
+    ASSERT(defaultListSize() == 0);
+    scheduleAt(0.5, timer);
+    if (strcmp(getName(), "a") == 0)
+        send(new cPacket("pk"), "out");
+}
+
+void Node::handleMessage(cMessage *msg)
+{
+    ASSERT(msg->getOwner() == this);
+    ASSERT(defaultListSize() == 0);
+
+    if (msg == timer) {
+        // keep some objects, and create garbage
+        cMessage *tmp = new cMessage("tmp");
+        queue.insert(tmp);
+        ASSERT(tmp->getOwner() == &queue);
+        if (queue.getLength() > 3)
+            delete queue.pop();
+        delete new cPacket("garbage");
+        scheduleAt(simTime() + 0.5, timer);
+    }
+    else if (++count < 5) {
+        cPacket *pk = check_and_cast<cPacket *>(msg);
+        cPacket *outer = new cPacket("outer");
+        outer->encapsulate(pk);
+        ASSERT(pk->getOwner() == outer);
+        send(outer->dup(), "out");
+        delete outer;
+    }
+    else {
+        EV << getFullPath() << " received " << msg->getName() << " at t=" << simTime() << endl;
+        delete msg;
+    }
+}
+
+}; //namespace
+
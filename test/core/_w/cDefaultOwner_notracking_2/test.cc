@@ -0,0 +1,54 @@
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace cDefaultOwner_notracking_2 {
+
+class Tracer : public cOwnedObject
+{
+  public:
+    Tracer(const char *name) : cOwnedObject(name) {}
+    virtual ~Tracer() {std::cout << "deleting " << getName() << std::endl;}
+};
+
+static Tracer *leftover = nullptr;
+
+class Cleanup : public cISimulationLifecycleListener
+{
+  public:
+    virtual void lifecycleEvent(SimulationLifecycleEventType eventType, cObject *details) override {
+        if (eventType == LF_PRE_NETWORK_DELETE)
+            std::cout << "deleting network" << std::endl;
+        else if (eventType == LF_POST_NETWORK_DELETE && leftover) {
+            std::cout << "network deleted, " << leftover->getName() << " still alive" << std::endl;
+            delete leftover;
+            leftover = nullptr;
+        }
+    }
+    virtual void listenerRemoved() override {delete this;}
+};
+
+class Node : public cSimpleModule
+{
+  private:
+    Tracer *member = nullptr;
+  public:
+    virtual ~Node() {delete member;}
+    virtual void initialize() override;
+    virtual void handleMessage(cMessage *msg) override {}
+};
+
+Define_Module(Node);
+
+void Node::initialize()
+{
+    member = new Tracer("member");
+    leftover = new Tracer("leftover");  // the destructor forgets about it
+    ASSERT(leftover->getOwner() == this);
+    ASSERT(defaultListSize() == 0);
+    getEnvir()->addLifecycleListener(new Cleanup());
+}
+
+}; //namespace
+
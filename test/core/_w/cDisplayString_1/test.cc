@@ -0,0 +1,46 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cDisplayString_1 {
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+cDisplayString ds;
+const char *s;
+
+s="a=foo";
+ds.parse(s); EV << ds.str() << endl;
+
+s="a=foo;b=22";
+ds.parse(s); EV << ds.str() << endl;
+
+s="a=,foo,22;;b=,bar,,453";
+ds.parse(s); EV << ds.str() << endl;
+
+s="a=;b=";
+ds.parse(s); EV << ds.str() << endl;
+
+s="";
+ds.parse(s); EV << ds.str() << endl;
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,38 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cDisplayString_2 {
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+cDisplayString ds("a=,a2,a3;b=,b2,,b4");
+
+ds.insertTag("x",1); EV << ds.str() << endl;
+ds.setTagArg("x",0,"joe"); EV << ds.str() << endl;
+ds.setTagArg("x",1,"jim"); EV << ds.str() << endl;
+ds.setTagArg("b",0,"b0"); EV << ds.str() << endl;
+ds.setTagArg("b",7,"b7"); EV << ds.str() << endl;
+ds.setTagArg("b",8,"b8"); EV << ds.str() << endl;
+ds.setTagArg("c",3,"c3"); EV << ds.str() << endl;
+ds.removeTag("a"); EV << ds.str() << endl;
+EV << ".\n";
+
+
+}
+
+}; //namespace
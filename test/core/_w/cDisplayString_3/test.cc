@@ -0,0 +1,41 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cDisplayString_3 {
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+
+#define P(s) {ds.parse(s); EV << "'" << s << "' --> t[0]='" << ds.getTagArg("t",0) << "'" << endl; }
+
+cDisplayString ds;
+P("t=foo");
+P("t=foo,bar");
+P("t=foo\\,bar");
+P("t=foo;bar=1");
+P("t=foo\\;bar=1");
+P("t=fo\\o\\\\b\\ar");
+P("t=foo\\,bar;baz=1;t2=more stuff");
+
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,85 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cDynamicExpression_cast_1 {
+
+
+void test(const char *expr)
+{
+    std::string result;
+    try {
+        cDynamicExpression e;
+        e.parse(expr);
+        cValue v = e.evaluate(cSimulation::getActiveSimulation()->getContextModule());
+        result = v.str();
+    } catch (std::exception& e) {
+        result = e.what();
+    }
+    EV << expr << " ==> " << result << "\n";
+}
+
+void test(const char *s1, const std::string& s2, const char *s3)
+{
+    test((std::string(s1) + " " + s2 + " " + s3).c_str());
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+// no implicit double-to-int cast --> error
+test("~3.0");
+test("1.0 & 3");
+test("1 & 3.0");
+test("1.0 | 3");
+test("1 | 3.0");
+test("1.0 # 3");
+test("1 # 3.0");
+test("1 << 1.0");
+test("1.0 << 1");
+test("1 >> 1.0");
+test("1.0 >> 1");
+test("intuniform(1.0, 3)");
+test("intuniform(1, 3.0)");
+EV << endl;
+
+// using int() to convert from double
+test("int(3.0)");
+test("int(3.1)");
+test("int(3.9)");
+test("int(-3.1)");
+test("int(-3.9)");
+test("int(9.5e18)"); // error: overflow
+test("int(-9.5e18)"); // error: overflow
+EV << endl;
+
+// int-to-double conversion is implicit
+test("3.14 + 1");
+test("3.14 + 1234567890123456");
+test("3.14 + 12345678901234567"); // error: precision loss (does not fit into double's 52-bit mantissa)
+test("3.14 - 12345678901234567"); // error: precision loss (does not fit into double's 52-bit mantissa)
+EV << endl;
+
+// using double() to force conversion, ignoring possible precision loss
+test("double(1234567890123456789)");
+test("double(-1234567890123456789)");
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,81 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cDynamicExpression_nan_1 {
+
+
+void test(const char *expr)
+{
+    cDynamicExpression e;
+    std::string result;
+    try {
+        e.parse(expr);
+        cValue v = e.evaluate();
+        result = v.str();
+    } catch (std::exception& ex) {
+        result = ex.what();
+    }
+    EV << expr << " ==> " << result << "\n";
+}
+
+void test(const char *s1, const std::string& s2, const char *s3)
+{
+    test((std::string(s1) + " " + s2 + " " + s3).c_str());
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+// constants
+test("nan");
+test("inf");
+test("-inf");
+
+// ...with unit
+test("nan s");
+test("inf ms");
+test("-inf ns");
+EV << "\n";
+
+// some operators
+test("1+inf");
+test("-inf+inf");
+test("2*nan");
+EV << "\n";
+
+// ...with unit
+test("1s + inf s");
+test("-inf s + inf ms");
+test("2*nan s");
+EV << "\n";
+
+// comparison
+test("1+inf == 1/0.0");
+test("1+nan == nan");
+test("nan == nan");
+EV << "\n";
+
+// ...with unit
+test("1s + inf ms == 1s/0.0");
+test("nan s == nan");
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,75 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cDynamicExpression_overflow_1 {
+
+
+void test(const char *expr)
+{
+    std::string result;
+    try {
+        cDynamicExpression e;
+        e.parse(expr);
+        cValue v = e.evaluate(cSimulation::getActiveSimulation()->getContextModule());
+        result = v.str();
+    } catch (std::exception& e) {
+        result = e.what();
+    }
+    EV << expr << " ==> " << result << "\n";
+}
+
+void test(const char *s1, const std::string& s2, const char *s3)
+{
+    test((std::string(s1) + " " + s2 + " " + s3).c_str());
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+// large integer constants
+test("1234567890123456789"); // OK
+test("12345678901234567890"); // error (overflow)
+test("12345678901234567890123"); // error (overflow)
+test("9223372036854775807"); // 2^63-1, int64_max
+test("-9223372036854775807"); // -2^63-1, int64_min+1
+test("-9223372036854775808"); // -2^63, int64_min --> should be OK, but oh well...
+
+// integer overflow
+test("9223372036854775806 + 1"); // ok
+test("9223372036854775807 + 1"); // error (overflow)
+test("-9223372036854775807 - 1"); // ok
+test("-9223372036854775807 - 2"); // error (overflow)
+test("0 - (-9223372036854775807-1)"); // error (overflow)
+test("2147483648 * 4294967295"); // ok
+test("2147483648 * 4294967296"); // error (overflow)
+test("2^61"); // ok
+test("2^62"); // ok
+test("2^63"); // error (overflow)
+test("2^64"); // error (overflow)
+
+// overflow in cast to double
+test("int(9.22e18)"); // ok
+test("int(-9.22e18)"); // ok
+test("int(9.23e18)"); // error (overflow)
+test("int(-9.23e18)"); // error (overflow)
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
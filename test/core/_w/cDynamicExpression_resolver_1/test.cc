@@ -0,0 +1,95 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cDynamicExpression_resolver_1 {
+
+
+std::string str(const char *s) {return std::string(s);}
+std::string str(intval_t x) {return std::to_string(x);}
+
+static cExpression::Context gContext(nullptr, nullptr);
+
+
+class TestResolver : public cDynamicExpression::ResolverBase {
+public:
+    typedef cExpression::Context Context;
+
+    virtual TestResolver *dup() const override {return new TestResolver();}
+
+    virtual cValue readVariable(Context *context, const char *name) override {
+        ASSERT(context == &gContext);
+        return str(name);
+    }
+
+    virtual cValue readVariable(Context *context, const char *name, intval_t index) override {
+        ASSERT(context == &gContext);
+        return str(name) + str(index);
+    }
+
+    virtual cValue readMember(Context *context, const cValue& object, const char *name) override {
+        ASSERT(context == &gContext);
+        return object.str() + "->" + name;
+    }
+
+    virtual cValue readMember(Context *context, const cValue& object, const char *name, intval_t index) override {
+        ASSERT(context == &gContext);
+        return object.str() + "->" + name + str(index);
+    }
+
+    virtual cValue callFunction(Context *context, const char *name, cValue argv[], int argc) override {
+        ASSERT(context == &gContext);
+        return str(name) + "(....)";
+    }
+
+    virtual cValue callMethod(Context *context, const cValue& object, const char *name, cValue argv[], int argc) override {
+        ASSERT(context == &gContext);
+        return object.str() + "->" + name + "(....)";
+    }
+};
+
+void test(const char *expr)
+{
+    std::string result;
+    try {
+        cDynamicExpression e;
+        e.parse(expr, new TestResolver());
+        cValue v = e.evaluate(&gContext);
+        result = v.str();
+    } catch (std::exception& e) {
+        result = e.what();
+    }
+    EV << expr << " ==> " << result << "\n";
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+test("foo");
+test("foo[3]");
+test("obj.foo");
+test("obj.foo[3]");
+test("fun(1,2,3)");
+test("obj.fun(1,2,3)");
+
+test("(foo + bar[99] + baz).fun()");
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
@@ -0,0 +1,52 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cDynamicExpression_symboltable_1 {
+
+typedef std::map<std::string, cValue> Variables;
+
+void test(const char *expr, const Variables& variables)
+{
+    std::string result;
+    try {
+        cDynamicExpression e;
+        e.parse(expr, variables);
+        cValue v = e.evaluate();
+        result = v.str();
+    } catch (std::exception& e) {
+        result = e.what();
+    }
+    EV << expr << " ==> " << result << "\n";
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+std::map<std::string, cValue> variables;
+variables["a"] = 2;
+variables["b"] = 1;
+
+test("3*a+b", variables);
+test("3*double(a) + cos(b-1)", variables); // make sure functions remain accessible
+test("3*a+b+c", variables); // unknown variable
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
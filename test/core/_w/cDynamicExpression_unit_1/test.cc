@@ -0,0 +1,110 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cDynamicExpression_unit_1 {
+
+
+void test(const char *expr)
+{
+    cDynamicExpression e;
+    std::string result;
+    try {
+        e.parse(expr);
+        cValue v = e.evaluate();
+        result = v.str();
+    } catch (std::exception& ex) {
+        result = ex.what();
+    }
+    EV << expr << " ==> " << result << "\n";
+}
+
+void test(const char *s1, const std::string& s2, const char *s3)
+{
+    test((std::string(s1) + " " + s2 + " " + s3).c_str());
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+// constants
+test("2m");
+test("2 meter");
+test("2 meters");
+test("3km");
+test("3 kilometer");
+test("3 kilometers");
+test("10dBm");
+test("1dBW 10dBm");
+EV << "\n";
+
+// negative constants
+test("-2m");
+test("-2 meter");
+test("-10dBm");
+EV << "\n";
+
+// unary operators
+test("-(10dBm)");
+test("-(1+1)");
+test("-(1m+1m)");
+test("-(1km+1km)");
+EV << "\n";
+
+test("~(1+1)");
+test("~(1m+1m)");
+test("~(1km+1km)");
+EV << "\n";
+
+// binary operators
+std::vector<std::string> ops = cStringTokenizer("+ - * / % ^  & | # << >> == != > >= < <=").asVector();
+for (int i=0; i<(int)ops.size(); i++)
+{
+    std::string op = ops[i];
+    test("3",  op, "-2");
+    test("3",  op, "2");
+    test("3m", op, "2m");
+    test("3m", op, "2km");
+    test("3km",op, "2m");
+    test("3",  op, "2m");
+    test("3m", op, "2");
+    test("3m", op, "2s");
+    test("2",  op, "10dBm");
+    test("10dBm", op, "2");
+    test("10dBm", op, "10dBm");
+    EV << "\n";
+}
+
+// tertiary operators
+test("true ? 2 : 3");
+test("true ? 2m : 3m");
+test("true ? 2m : 3km");
+test("true ? 2km : 3m");
+test("true ? 2 : 3m");
+test("true ? 2m : 3");
+test("true ? 2m : 3s");
+
+EV << "\n";
+
+test("3km == 3000m");
+test("3km != 3000m");
+
+EV << ".\n";
+
+
+}
+
+}; //namespace
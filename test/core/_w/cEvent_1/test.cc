@@ -0,0 +1,61 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cEvent_1 {
+
+
+class SayHelloEvent : public cEvent
+{
+  public:
+    SayHelloEvent(const char *name, simtime_t t);
+    virtual cEvent *dup() const override {copyNotSupported(); return nullptr;}
+    virtual cObject *getTargetObject() const override {return nullptr;}
+    virtual void execute() override;
+};
+
+SayHelloEvent::SayHelloEvent(const char *name, simtime_t t) : cEvent(name)
+{
+    setArrivalTime(t);
+}
+
+void SayHelloEvent::execute()
+{
+    EV << getName() << " at " << simTime() << "s" << endl;
+    delete this;
+}
+
+class Module : public cSimpleModule
+{
+  public:
+    virtual void initialize() override;
+    virtual void handleMessage(cMessage *msg) override;
+    virtual void finish() override;
+};
+
+Define_Module(Module);
+
+void Module::initialize()
+{
+    scheduleAt(5.0, new cMessage("msg1"));
+    getSimulation()->insertEvent(new SayHelloEvent("hello", 5.0));
+    scheduleAt(5.0, new cMessage("msg2"));
+}
+void Module::handleMessage(cMessage *msg)
+{
+    EV << msg->getName() << " at " << simTime() << "s" << endl;
+    delete msg;
+}
+
+void Module::finish()
+{
+   EV << "finish at " << simTime() << "s" << endl;
+   EV << "-" << endl;
+}
+
+
+
+}; //namespace
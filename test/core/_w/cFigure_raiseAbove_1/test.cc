@@ -0,0 +1,90 @@
+
+#include <omnetpp.h>
+
+
+
+using namespace omnetpp;
+
+namespace cFigure_raiseAbove_1 {
+
+
+void printCanvas(cCanvas *canvas)
+{
+    for (int i=0; i<canvas->getNumFigures(); i++)
+        EV << " " << canvas->getFigure(i)->getName();
+    EV << endl;
+}
+
+
+
+class Test : public cSimpleModule
+{
+    public:
+        Test() : cSimpleModule(65536) {}
+        virtual void activity();
+};
+
+Define_Module(Test);
+
+void Test::activity()
+{
+
+#define M(name)       cFigure *name = new cGroupFigure(#name);
+#define P(statement)  try { EV << #statement << " ==> "; (void)statement; printCanvas(canvas); } catch (std::exception& e) { EV << e.what() << endl; }
+
+cCanvas *canvas = new cCanvas("canvas");
+M(a); M(b); M(c); M(d); M(e); M(f); M(x);
+
+EV << "add:\n";
+P(canvas->addFigure(c));
+P(canvas->addFigure(e));
+P(canvas->addFigure(d,1));
+P(canvas->addFigure(a,0));
+P(b->insertBefore(c));
+P(f->insertAfter(e));
+
+EV << "\nno-ops:\n";
+P("initial");
+P(b->raiseAbove(a)); // no-op
+P(d->raiseAbove(a)); // no-op
+P(c->raiseAbove(b)); // no-op
+P(d->raiseAbove(b)); // no-op
+P(a->raiseAbove(a)); // no-op
+
+P(a->lowerBelow(f)); // no-op
+P(e->lowerBelow(f)); // no-op
+P(c->lowerBelow(d)); // no-op
+P(a->lowerBelow(d)); // no-op
+P(d->lowerBelow(d)); // no-op
+
+P(a->lowerToBottom()); // no-op
+P(f->raiseToTop()); // no-op
+
+
+EV << "\npositive test cases:\n";
+P(a->raiseAbove(b));
+P(e->raiseAbove(f));
+P(c->lowerBelow(b));
+P(f->lowerBelow(d));
+
+P(f->lowerToBottom());
+P(a->raiseToTop());
+
+EV << "\nnegative test cases:\n";
+
+P(x->lowerToBottom());
+P(x->raiseToTop());
+
+P(a->raiseAbove(x));
+P(a->lowerBelow(x));
+
+P(x->raiseAbove(a));
+P(x->lowerBelow(a));
+
+delete canvas;
+delete x;
+
+
+}
+
+}; //namespace